@@ -14,19 +14,24 @@
  * limitations under the License.
  */
 
-#include "util/json/reader/IResettableReader.h"
 
-#include <gmock/gmock.h>
+#ifndef _OPENKIT_BEACONRECORDQUEUEFULLPOLICY_H
+#define _OPENKIT_BEACONRECORDQUEUEFULLPOLICY_H
 
-namespace test
-{
-	class MockResettableReader : public util::json::reader::IResettableReader
-	{
-	public:
-		MOCK_METHOD(int32_t, read, (), (override));
+#include "OpenKit/OpenKitExports.h"
 
-		MOCK_METHOD(void, mark, (int32_t), (override));
+#include <cstdint>
 
-		MOCK_METHOD(void, reset, (), (override));
+namespace openkit
+{
+	///
+	/// This enum declares how beacon data is handled, if the queue used for asynchronous submission is full
+	///
+	enum class OPENKIT_EXPORT BeaconRecordQueueFullPolicy : int32_t
+	{
+		BLOCK, // the reporting thread moves the queued data to the beacon cache itself
+		DROP // the reported data is discarded
 	};
-}
\ No newline at end of file
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _OPENKIT_COMPRESSIONSTRATEGY_H
+#define _OPENKIT_COMPRESSIONSTRATEGY_H
+
+#include "OpenKit/OpenKitExports.h"
+
+#include <cstdint>
+
+namespace openkit
+{
+	///
+	/// This enum declares the strategy used to compress beacon data
+	///
+	enum class OPENKIT_EXPORT CompressionStrategy : int32_t
+	{
+		DEFAULT, // general purpose strategy
+		FILTERED, // favors huffman coding over string matching
+		HUFFMAN_ONLY, // huffman coding only, no string matching at all
+		RLE, // limits string matching to run-length encoding
+		FIXED // prevents the use of dynamic huffman codes
+	};
+}
+
+#endif
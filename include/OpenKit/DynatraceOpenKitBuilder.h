@@ -24,6 +24,8 @@
 #include "ISSLTrustManager.h"
 #include "DataCollectionLevel.h"
 #include "CrashReportingLevel.h"
+#include "BeaconRecordQueueFullPolicy.h"
+#include "CompressionStrategy.h"
 #include "IHttpRequestInterceptor.h"
 #include "IHttpResponseInterceptor.h"
 
@@ -199,6 +201,118 @@ namespace openkit
 		///
 		DynatraceOpenKitBuilder& withHttpResponseInterceptor(std::shared_ptr<openkit::IHttpResponseInterceptor> httpResponseInterceptor);
 
+		///
+		/// Sets the maximum number of idle HTTP connections which are kept open for reuse.
+		///
+		/// Keeping connections alive avoids a TCP and TLS handshake for each request sent to the Dynatrace backend.
+		/// @param[in] maxIdleConnections maximum number of idle connections or @c 0 to close connections after each request.
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withHttpConnectionPoolMaxIdleConnections(int32_t maxIdleConnections);
+
+		///
+		/// Sets the time after which an idle HTTP connection is closed.
+		///
+		/// @param[in] idleTimeoutInMilliseconds idle timeout in milliseconds
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withHttpConnectionPoolIdleTimeout(int64_t idleTimeoutInMilliseconds);
+
+		///
+		/// Sets the maximum number of beacon requests which are sent concurrently.
+		///
+		/// When set to a value greater than one, beacons of different sessions are uploaded in parallel and
+		/// multiplexed over a single HTTP/2 connection, if the server supports it.
+		/// Once the server responds with "too many requests", no further requests are started.
+		/// @param[in] maxConcurrentRequests maximum number of concurrent requests
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withMaxConcurrentBeaconRequests(int32_t maxConcurrentRequests);
+
+		///
+		/// Sets the level used to compress beacon data.
+		///
+		/// Higher levels reduce the amount of data sent at the cost of CPU time.
+		/// Values outside of the range [-1, 9] are ignored, where @c -1 selects the default level
+		/// and @c 0 disables compression.
+		/// @param[in] compressionLevel compression level
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconCompressionLevel(int32_t compressionLevel);
+
+		///
+		/// Sets the strategy used to compress beacon data.
+		///
+		/// @param[in] compressionStrategy compression strategy
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconCompressionStrategy(openkit::CompressionStrategy compressionStrategy);
+
+		///
+		/// Sets the directory where beacon data exceeding the upper memory boundary of the beacon cache is stored.
+		///
+		/// Instead of discarding the oldest data, the memory based eviction strategy moves it to files in this
+		/// directory. The data is sent once the Dynatrace backend is reachable again, even after a restart.
+		/// The directory must exist and must not be shared with other OpenKit instances.
+		/// @param[in] directory the directory or @c nullptr/empty to discard the data (default)
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconCacheOverflowDirectory(const char* directory);
+
+		///
+		/// Sets the maximum size of the beacon data stored on disk.
+		///
+		/// Once exceeded, the oldest data stored on disk is discarded.
+		/// Values less than or equal to zero are ignored.
+		/// @param[in] maxSizeInBytes maximum size in bytes
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconCacheOverflowMaxSize(int64_t maxSizeInBytes);
+
+		///
+		/// Enables the asynchronous submission of beacon data, using a queue with the given capacity.
+		///
+		/// Reported data is put into a lock-free queue and moved to the beacon cache by a background thread,
+		/// so that reporting threads do not contend on the beacon cache.
+		/// The capacity is rounded up to the next power of two, @c 0 disables the queue (default).
+		/// Negative values are ignored.
+		/// @param[in] capacity maximum number of queued records
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconRecordQueueCapacity(int32_t capacity);
+
+		///
+		/// Sets the policy applied, if the queue used to submit beacon data asynchronously is full.
+		///
+		/// @param[in] policy policy applied if the queue is full
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withBeaconRecordQueueFullPolicy(openkit::BeaconRecordQueueFullPolicy policy);
+
+		///
+		/// Enables running background work on an executor shared by all OpenKit instances of the process.
+		///
+		/// The beacon cache eviction and the session watchdog are then run as tasks on a small, process-wide pool
+		/// of worker threads, instead of starting two dedicated threads per OpenKit instance.
+		/// Beacon data is still sent by a dedicated thread. Disabled by default.
+		/// @param[in] enabled @c true to use the shared executor
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withSharedExecutor(bool enabled);
+
+		///
+		/// Enables asynchronous writing of the default logger, using a queue with the given capacity.
+		///
+		/// Log records are put into a lock-free queue and written in batches by a background thread, so that
+		/// logging does not stall the calling threads. Records exceeding 1024 characters are truncated, records
+		/// are dropped if the queue is full. The capacity is rounded up to the next power of two, @c 0 writes
+		/// synchronously (default). Negative values are ignored.
+		/// This setting has no effect, if a custom logger is set via @ref withLogger.
+		/// @param[in] capacity maximum number of queued log records
+		/// @return @c this
+		///
+		DynatraceOpenKitBuilder& withLogRecordQueueCapacity(int32_t capacity);
+
 		///
 		/// Builds an @ref openkit::IOpenKit instance
 		/// @return an @ref openkit::IOpenKit instance
@@ -241,6 +355,28 @@ namespace openkit
 
 		std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const override;
 
+		int32_t getHttpConnectionPoolMaxIdleConnections() const override;
+
+		int64_t getHttpConnectionPoolIdleTimeout() const override;
+
+		int32_t getMaxConcurrentBeaconRequests() const override;
+
+		int32_t getBeaconCompressionLevel() const override;
+
+		CompressionStrategy getBeaconCompressionStrategy() const override;
+
+		const std::string& getBeaconCacheOverflowDirectory() const override;
+
+		int64_t getBeaconCacheOverflowMaxSize() const override;
+
+		int32_t getBeaconRecordQueueCapacity() const override;
+
+		BeaconRecordQueueFullPolicy getBeaconRecordQueueFullPolicy() const override;
+
+		bool isSharedExecutorEnabled() const override;
+
+		int32_t getLogRecordQueueCapacity() const override;
+
 		openkit::LogLevel getLogLevel() const override;
 
 		std::shared_ptr<openkit::ILogger> getLogger() const override;
@@ -311,6 +447,39 @@ namespace openkit
 
 		/// Used for intercepting HTTP responses from Dynatrace backend
 		std::shared_ptr<openkit::IHttpResponseInterceptor> mHttpResponseInterceptor;
+
+		/// maximum number of idle HTTP connections kept for reuse
+		int32_t mHttpConnectionPoolMaxIdleConnections;
+
+		/// idle timeout of HTTP connections in milliseconds
+		int64_t mHttpConnectionPoolIdleTimeout;
+
+		/// maximum number of concurrently sent beacon requests
+		int32_t mMaxConcurrentBeaconRequests;
+
+		/// level used to compress beacon data
+		int32_t mBeaconCompressionLevel;
+
+		/// strategy used to compress beacon data
+		openkit::CompressionStrategy mBeaconCompressionStrategy;
+
+		/// directory where beacon data exceeding the beacon cache's memory boundary is stored
+		std::string mBeaconCacheOverflowDirectory;
+
+		/// maximum size of beacon data stored on disk
+		int64_t mBeaconCacheOverflowMaxSize;
+
+		/// capacity of the queue used to submit beacon data asynchronously
+		int32_t mBeaconRecordQueueCapacity;
+
+		/// policy applied if the queue used to submit beacon data asynchronously is full
+		openkit::BeaconRecordQueueFullPolicy mBeaconRecordQueueFullPolicy;
+
+		/// flag indicating whether background work is run on the process-wide executor
+		bool mIsSharedExecutorEnabled;
+
+		/// capacity of the queue used by the default logger to write log records asynchronously
+		int32_t mLogRecordQueueCapacity;
 	};
 }
 
@@ -17,6 +17,8 @@
 #ifndef _OPENKIT_IOPENKITBUILDER_H
 #define _OPENKIT_IOPENKITBUILDER_H
 
+#include "BeaconRecordQueueFullPolicy.h"
+#include "CompressionStrategy.h"
 #include "CrashReportingLevel.h"
 #include "DataCollectionLevel.h"
 #include "ILogger.h"
@@ -202,6 +204,104 @@ namespace openkit
 		/// If no response interceptor was set, a default response interceptor is returned.
 		 ///
 		virtual std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const = 0;
+
+		///
+		/// Returns the maximum number of idle HTTP connections kept for reuse.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS
+		/// is returned.
+		///
+		virtual int32_t getHttpConnectionPoolMaxIdleConnections() const = 0;
+
+		///
+		/// Returns the time in milliseconds after which an idle HTTP connection is closed.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_HTTP_CONNECTION_POOL_IDLE_TIMEOUT_IN_MILLIS
+		/// is returned.
+		///
+		virtual int64_t getHttpConnectionPoolIdleTimeout() const = 0;
+
+		///
+		/// Returns the maximum number of beacon requests which are sent concurrently.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS
+		/// is returned.
+		///
+		virtual int32_t getMaxConcurrentBeaconRequests() const = 0;
+
+		///
+		/// Returns the level used to compress beacon data.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_BEACON_COMPRESSION_LEVEL
+		/// is returned.
+		///
+		virtual int32_t getBeaconCompressionLevel() const = 0;
+
+		///
+		/// Returns the strategy used to compress beacon data.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_BEACON_COMPRESSION_STRATEGY
+		/// is returned.
+		///
+		virtual CompressionStrategy getBeaconCompressionStrategy() const = 0;
+
+		///
+		/// Returns the directory where beacon data exceeding the beacon cache's memory boundary is stored.
+		///
+		/// @par
+		/// If no directory was set, an empty string is returned and no data is stored on disk.
+		///
+		virtual const std::string& getBeaconCacheOverflowDirectory() const = 0;
+
+		///
+		/// Returns the maximum size (in bytes) of beacon data stored on disk.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES
+		/// is returned.
+		///
+		virtual int64_t getBeaconCacheOverflowMaxSize() const = 0;
+
+		///
+		/// Returns the capacity of the queue used to submit beacon data asynchronously.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_BEACON_RECORD_QUEUE_CAPACITY
+		/// is returned, which means that beacon data is submitted synchronously.
+		///
+		virtual int32_t getBeaconRecordQueueCapacity() const = 0;
+
+		///
+		/// Returns the policy applied, if the queue used to submit beacon data asynchronously is full.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_BEACON_RECORD_QUEUE_FULL_POLICY
+		/// is returned.
+		///
+		virtual BeaconRecordQueueFullPolicy getBeaconRecordQueueFullPolicy() const = 0;
+
+		///
+		/// Returns whether the beacon cache eviction and the session watchdog run on the process-wide executor.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_SHARED_EXECUTOR_ENABLED
+		/// is returned.
+		///
+		virtual bool isSharedExecutorEnabled() const = 0;
+
+		///
+		/// Returns the capacity of the queue used by the default logger to write log records asynchronously.
+		///
+		/// @par
+		/// If no value was set, the @ref core::configuration::ConfigurationDefaults::DEFAULT_LOG_RECORD_QUEUE_CAPACITY
+		/// is returned, which means that log records are written synchronously.
+		///
+		virtual int32_t getLogRecordQueueCapacity() const = 0;
 	};
 }
 
@@ -19,6 +19,7 @@
 
 #include "OpenKit/OpenKitExports.h"
 #include <OpenKit/json/JsonObjectValue.h>
+#include <OpenKit/json/JsonDocument.h>
 #include <OpenKit/ConnectionType.h>
 
 #include <cstdint>
@@ -138,6 +139,17 @@ namespace openkit
 		///
 		virtual void sendBizEvent(const char* type, const json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) = 0;
 
+		///
+		/// Send a Business Event
+		///
+		/// Same as @ref sendBizEvent(const char*, const json::JsonObjectValue::JsonObjectMapPtr), but taking the
+		/// attributes from a @ref json::JsonDocument, which avoids allocating a separate object per attribute.
+		///
+		/// @param type Mandatory event type
+		/// @param attributes Attributes the resulting event is populated with
+		///
+		virtual void sendBizEvent(const char* type, const json::JsonDocument& attributes) = 0;
+
 		///
 		/// Reports a biz event with a mandatory type and additional attributes
 		/// @param name name of the event which is mandatory
@@ -145,6 +157,17 @@ namespace openkit
 		///
 		virtual void sendEvent(const char* name, const json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) = 0;
 
+		///
+		/// Reports an event with a mandatory name and additional attributes
+		///
+		/// Same as @ref sendEvent(const char*, const json::JsonObjectValue::JsonObjectMapPtr), but taking the
+		/// attributes from a @ref json::JsonDocument, which avoids allocating a separate object per attribute.
+		///
+		/// @param name name of the event which is mandatory
+		/// @param attributes additional attributes which are passed along side our internal attributes
+		///
+		virtual void sendEvent(const char* name, const json::JsonDocument& attributes) = 0;
+
 	};
 }
 #endif
\ No newline at end of file
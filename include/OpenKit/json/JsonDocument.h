@@ -0,0 +1,396 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _OPENKIT_JSON_JSONDOCUMENT_H
+#define _OPENKIT_JSON_JSONDOCUMENT_H
+
+#include "OpenKit/OpenKitExports.h"
+
+#include "JsonValue.h"
+#include "JsonObjectValue.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace openkit
+{
+	namespace json
+	{
+		///
+		/// JSON object, storing all of its values in a single flat list and all long strings in a single buffer.
+		///
+		/// @par
+		/// In contrast to @ref JsonObjectValue, adding a value does not create a separate object. Strings of up to
+		/// @ref MAX_INLINE_STRING_LENGTH bytes are stored within the value itself, longer ones are appended to a buffer
+		/// shared by all values. Both only grow, until the document is cleared. A document is intended to hold the
+		/// attributes of a single event and might be reused for the next one, after calling @ref clear.
+		///
+		/// @par
+		/// Nested objects and arrays are started with @ref beginObject and @ref beginArray and finished with
+		/// @ref endObject and @ref endArray. Values added to an object require a key, the key of values added to an
+		/// array is ignored. If a key is added more than once to the same object, only the first value is kept.
+		/// Objects and arrays which are not finished are implicitly finished at the end of the document.
+		///
+		/// @par
+		/// A document is not thread safe.
+		///
+		class OPENKIT_EXPORT JsonDocument
+		{
+		public:
+
+			///
+			/// Maximum number of bytes of a key or string value, which is stored within the value itself.
+			///
+			static constexpr size_t MAX_INLINE_STRING_LENGTH = 12;
+
+			///
+			/// Constructor creating an empty document
+			///
+			JsonDocument();
+
+			///
+			/// Adds a string value
+			/// @param key the key of the value
+			/// @param value the string value or @c nullptr to add a JSON null value
+			/// @return the document itself
+			///
+			JsonDocument& addString(const char* key, const char* value);
+
+			///
+			/// Adds a string value
+			/// @param key the key of the value
+			/// @param value the string value
+			/// @return the document itself
+			///
+			JsonDocument& addString(const char* key, const std::string& value);
+
+			///
+			/// Adds an integer value
+			/// @param key the key of the value
+			/// @param value the integer value
+			/// @return the document itself
+			///
+			JsonDocument& addLong(const char* key, int64_t value);
+
+			///
+			/// Adds a floating point value
+			///
+			/// @par
+			/// Non-finite values (NaN or infinity) are written as JSON null.
+			///
+			/// @param key the key of the value
+			/// @param value the floating point value
+			/// @return the document itself
+			///
+			JsonDocument& addDouble(const char* key, double value);
+
+			///
+			/// Adds a boolean value
+			/// @param key the key of the value
+			/// @param value the boolean value
+			/// @return the document itself
+			///
+			JsonDocument& addBoolean(const char* key, bool value);
+
+			///
+			/// Adds a JSON null value
+			/// @param key the key of the value
+			/// @return the document itself
+			///
+			JsonDocument& addNull(const char* key);
+
+			///
+			/// Adds a value of the shared pointer based JSON model, including all of its nested values
+			/// @param key the key of the value
+			/// @param value the value to add
+			/// @return the document itself
+			///
+			JsonDocument& addValue(const char* key, const JsonValue& value);
+
+			///
+			/// Adds all entries of the given map, using the map's keys
+			/// @param members the entries to add
+			/// @return the document itself
+			///
+			JsonDocument& addMembers(const JsonObjectValue::JsonObjectMap& members);
+
+			///
+			/// Starts a nested object, to which all subsequently added values belong until @ref endObject is called
+			/// @param key the key of the object
+			/// @return the document itself
+			///
+			JsonDocument& beginObject(const char* key);
+
+			///
+			/// Finishes the most recently started object
+			/// @return the document itself
+			///
+			JsonDocument& endObject();
+
+			///
+			/// Starts a nested array, to which all subsequently added values belong until @ref endArray is called
+			/// @param key the key of the array
+			/// @return the document itself
+			///
+			JsonDocument& beginArray(const char* key);
+
+			///
+			/// Finishes the most recently started array
+			/// @return the document itself
+			///
+			JsonDocument& endArray();
+
+			///
+			/// Appends a string value to the current array
+			/// @param value the string value or @c nullptr to append a JSON null value
+			/// @return the document itself
+			///
+			JsonDocument& appendString(const char* value);
+
+			///
+			/// Appends a string value to the current array
+			/// @param value the string value
+			/// @return the document itself
+			///
+			JsonDocument& appendString(const std::string& value);
+
+			///
+			/// Appends an integer value to the current array
+			/// @param value the integer value
+			/// @return the document itself
+			///
+			JsonDocument& appendLong(int64_t value);
+
+			///
+			/// Appends a floating point value to the current array
+			/// @param value the floating point value
+			/// @return the document itself
+			///
+			JsonDocument& appendDouble(double value);
+
+			///
+			/// Appends a boolean value to the current array
+			/// @param value the boolean value
+			/// @return the document itself
+			///
+			JsonDocument& appendBoolean(bool value);
+
+			///
+			/// Appends a JSON null value to the current array
+			/// @return the document itself
+			///
+			JsonDocument& appendNull();
+
+			///
+			/// Starts a nested object in the current array
+			/// @return the document itself
+			///
+			JsonDocument& appendObject();
+
+			///
+			/// Starts a nested array in the current array
+			/// @return the document itself
+			///
+			JsonDocument& appendArray();
+
+			///
+			/// Removes all values, but keeps the memory allocated so far for reuse
+			///
+			void clear();
+
+			///
+			/// Returns the number of values of the top level object
+			///
+			size_t size() const;
+
+			///
+			/// Returns @c true if the top level object does not contain any values
+			///
+			bool empty() const;
+
+			///
+			/// Returns @c true if and only if the given key is present in the top level object.
+			/// @param key the key to test whether it is present or not
+			///
+			bool containsKey(const std::string& key) const;
+
+			///
+			/// Returns the JSON string representation of this document
+			///
+			std::string toString() const;
+
+			///
+			/// Internal only - Writes the JSON string representation of the document
+			/// @param jsonWriter Writer which is able to write the json string
+			///
+			void writeJsonString(JsonWriter& jsonWriter) const;
+
+			///
+			/// Internal only - Returns the position of the first value of the top level object
+			///
+			size_t firstMember() const;
+
+			///
+			/// Internal only - Returns the position of the value following the given top level value
+			///
+			size_t nextMember(size_t position) const;
+
+			///
+			/// Internal only - Returns the position after the last value of the top level object
+			///
+			size_t endMember() const;
+
+			///
+			/// Internal only - Returns the key of the top level value at the given position
+			/// @param position the position of the value
+			/// @param[out] keyLength the number of bytes of the key
+			/// @return the key, which is not null terminated
+			///
+			const char* getMemberKey(size_t position, size_t& keyLength) const;
+
+			///
+			/// Internal only - Writes the JSON string representation of the top level value at the given position
+			/// @param jsonWriter Writer which is able to write the json string
+			/// @param position the position of the value
+			///
+			void writeMemberValue(JsonWriter& jsonWriter, size_t position) const;
+
+		private: // types
+
+			///
+			/// Type of a single node of the document
+			///
+			enum class NodeType : uint8_t
+			{
+				NULL_VALUE,
+				BOOLEAN_VALUE,
+				LONG_VALUE,
+				DOUBLE_VALUE,
+				STRING_VALUE,
+				OBJECT_BEGIN,
+				ARRAY_BEGIN,
+				CONTAINER_END
+			};
+
+			///
+			/// String stored either within the node or in the document's string buffer
+			///
+			struct StringRef
+			{
+				/// Number of bytes of the string
+				uint32_t length;
+
+				union
+				{
+					/// Characters of a string of up to MAX_INLINE_STRING_LENGTH bytes
+					char inlineData[MAX_INLINE_STRING_LENGTH];
+
+					/// Offset of a longer string in the document's string buffer
+					uint32_t offset;
+				};
+			};
+
+			///
+			/// Single value, or the beginning or end of an object or array
+			///
+			struct Node
+			{
+				/// Type of the node
+				NodeType type;
+
+				/// Flag indicating that the node, including all nested nodes, is ignored due to a duplicate key
+				bool isIgnored;
+
+				/// Position of the matching CONTAINER_END node for OBJECT_BEGIN and ARRAY_BEGIN nodes, 0 if not yet finished
+				uint32_t end;
+
+				/// Key of the value, empty within arrays
+				StringRef key;
+
+				union
+				{
+					bool booleanValue;
+					int64_t longValue;
+					double doubleValue;
+					StringRef stringValue;
+				};
+			};
+
+		private: // functions
+
+			///
+			/// Appends a node for the given key to the current container
+			///
+			/// @return the added node or @c nullptr if a value is not added, because its key is missing or a duplicate
+			///
+			Node* addNode(NodeType type, const char* key);
+
+			///
+			/// Returns @c true if the current container is an array
+			///
+			bool isInArray() const;
+
+			///
+			/// Returns @c true if a value with the given key is found, starting at the given position up to the end
+			/// of the surrounding container
+			///
+			bool containsKey(size_t position, const char* key, size_t keyLength) const;
+
+			///
+			/// Stores the given string within the node or in the string buffer
+			///
+			StringRef storeString(const char* data, size_t length);
+
+			///
+			/// Returns the characters of the given string
+			///
+			const char* getData(const StringRef& string) const;
+
+			///
+			/// Finishes the most recently started container of the given type
+			///
+			void endContainer(NodeType type);
+
+			///
+			/// Returns the position of the node following the given node, including all nested nodes
+			///
+			size_t skipNode(size_t position) const;
+
+			///
+			/// Writes the node at the given position and returns the position of the next node
+			///
+			size_t writeNode(JsonWriter& jsonWriter, size_t position) const;
+
+		private: // members
+
+			/// Nodes in document order
+			std::vector<Node> mNodes;
+
+			/// Positions of the OBJECT_BEGIN or ARRAY_BEGIN nodes of all containers which are not finished
+			std::vector<uint32_t> mOpenContainers;
+
+			/// Buffer holding all strings which are not stored within a node
+			std::string mStrings;
+
+			/// Number of values of the top level object
+			size_t mSize;
+		};
+	}
+}
+
+#endif //_OPENKIT_JSON_JSONDOCUMENT_H
@@ -62,6 +62,14 @@ namespace openkit
 			///
 			static std::shared_ptr<JsonNumberValue> fromNumberLiteral(const std::string& literalValue);
 
+			///
+			/// Factory method for constructing a @ref JsonNumberValue from a number literal
+			/// @param literalValue the characters of the number literal, which do not need to be null terminated
+			/// @param literalLength the number of characters in @c literalValue
+			/// @return @c null if @c literalValue does not represent a number or a newly created @ref JsonNumberValue
+			///
+			static std::shared_ptr<JsonNumberValue> fromNumberLiteral(const char* literalValue, size_t literalLength);
+
 			///
 			/// Indicates that this value is of type number
 			///
@@ -165,15 +173,17 @@ namespace openkit
 
 			///
 			/// Parses a long value from the given string literal value and returns the corresponding @ref JsonNumberValue
-			/// @param literalValue the long value as string to be parsed
-			/// @return a @ref JsonNumberValue representing a 64-bit integer number
-			static std::shared_ptr<JsonNumberValue> parseLongValue(const std::string& literalValue);
+			/// @param literalValue the characters of the long value to be parsed
+			/// @param literalLength the number of characters in @c literalValue
+			/// @return a @ref JsonNumberValue representing a 64-bit integer number or @c null if the value overflows
+			static std::shared_ptr<JsonNumberValue> parseLongValue(const char* literalValue, size_t literalLength);
 
 			///
 			/// Parses a double value from the given string literal and returns the corresponding @ref JsonNumberValue
-			/// @param literalValue the double value as string to be parsed.
-			/// @return a @ref JsonNumberValue representing a 64-bit floating point number
-			static std::shared_ptr<JsonNumberValue> parseDoubleValue(const std::string& literalValue);
+			/// @param literalValue the characters of the double value to be parsed.
+			/// @param literalLength the number of characters in @c literalValue
+			/// @return a @ref JsonNumberValue representing a 64-bit floating point number or @c null if the value overflows
+			static std::shared_ptr<JsonNumberValue> parseDoubleValue(const char* literalValue, size_t literalLength);
 		};
 	}
 }
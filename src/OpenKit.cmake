@@ -13,6 +13,8 @@
 # limitations under the License.
 
 set(OPENKIT_PUBLIC_HEADERS_CXX_API
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/BeaconRecordQueueFullPolicy.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/CompressionStrategy.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/ConnectionType.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/CrashReportingLevel.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/DataCollectionLevel.h
@@ -34,6 +36,7 @@ set(OPENKIT_PUBLIC_HEADERS_CXX_API
     ${CMAKE_SOURCE_DIR}/include/OpenKit/OpenKit.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonArrayValue.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonBooleanValue.h
+    ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonDocument.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonNullValue.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonNumberValue.h
     ${CMAKE_SOURCE_DIR}/include/OpenKit/json/JsonObjectValue.h
@@ -65,18 +68,28 @@ set(OPENKIT_SOURCES_C_API
 )
 
 set(OPENKIT_SOURCES_CORE_CACHING
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AsyncBeaconCache.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AsyncBeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCache.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEntry.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEntry.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEvictor.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEvictor.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheOverflowStore.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheOverflowStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecord.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecord.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecordArena.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecordArena.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconHeader.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconKey.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconKey.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconRecordQueue.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconRecordQueue.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IBeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IBeaconCacheEvictor.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/IBeaconCacheOverflowStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/IObserver.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/SpaceEvictionStrategy.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/SpaceEvictionStrategy.h
@@ -105,6 +118,8 @@ set(OPENKIT_SOURCES_CORE_COMMUNICATION
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/BeaconSendingTerminalState.h
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/IBeaconSendingContext.h
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/IBeaconSendingState.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/communication/SessionRegistry.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/communication/SessionRegistry.h
 )
 
 set(OPENKIT_SOURCES_CORE_CONFIGURATION
@@ -127,13 +142,17 @@ set(OPENKIT_SOURCES_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/PrivacyConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfiguration.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfiguration.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfigurationSnapshot.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfigurationSnapshot.h
 )
 
 set(OPENKIT_SOURCES_CORE_UTIL
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/BoundedQueue.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/Compressor.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/Compressor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CountDownLatch.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CountDownLatch.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/DeadlineQueue.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ConnectionTypeUtil.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ConnectionTypeUtil.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CyclicBarrier.cxx
@@ -141,16 +160,24 @@ set(OPENKIT_SOURCES_CORE_UTIL
     ${CMAKE_CURRENT_LIST_DIR}/core/util/DefaultLogger.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/DefaultLogger.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/EnumClassHash.h
-    ${CMAKE_CURRENT_LIST_DIR}/core/util/EventPayloadBuilderUtil.cxx
-    ${CMAKE_CURRENT_LIST_DIR}/core/util/EventPayloadBuilderUtil.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ExecutorTask.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ExecutorTask.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/IInterruptibleThreadSuspender.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidator.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidator.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InterruptibleThreadSuspender.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InterruptibleThreadSuspender.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/LogRecordQueue.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/LogRecordQueue.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ReadWriteLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedReadLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedWriteLock.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/SharedExecutor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/SharedExecutor.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressor.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressorPool.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressorPool.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/StringUtil.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/StringUtil.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueue.h
@@ -181,6 +208,8 @@ set(OPENKIT_SOURCES_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadAttributes.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadBuilder.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadBuilder.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadTemplate.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadTemplate.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/IActionCommon.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/ICancelableOpenKitObject.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/IOpenKitComposite.h
@@ -219,6 +248,8 @@ set(OPENKIT_SOURCES_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/SupplementaryBasicData.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestTracer.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestTracer.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestURL.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestURL.h
 )
 
 set(OPENKIT_SOURCES_PROTOCOL_HTTP
@@ -247,9 +278,16 @@ set(OPENKIT_SOURCES_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Beacon.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Beacon.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconProtocolConstants.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconRecordKey.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconRecordWriter.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconRecordWriter.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/EventType.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPConnectionPool.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPConnectionPool.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPRequestMultiplexer.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPRequestMultiplexer.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/IAdditionalQueryParameters.h
@@ -262,6 +300,8 @@ set(OPENKIT_SOURCES_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParser.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParser.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/RecoveredBeaconSender.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/RecoveredBeaconSender.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttribute.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributes.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributes.cxx
@@ -312,15 +352,10 @@ set(OPENKIT_SOURCES_UTIL_JSON_LEXER
     ${CMAKE_CURRENT_LIST_DIR}/util/json/lexer/JsonTokenType.h
 )
 
-set(OPENKIT_SOURCES_UTIL_JSON_READER
-    ${CMAKE_CURRENT_LIST_DIR}/util/json/reader/IResettableReader.h
-    ${CMAKE_CURRENT_LIST_DIR}/util/json/reader/DefaultResettableReader.h
-    ${CMAKE_CURRENT_LIST_DIR}/util/json/reader/DefaultResettableReader.cxx
-)
-
 set(OPENKIT_SOURCES_UTIL_JSON_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonArrayValue.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonBooleanValue.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonDocument.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonNullValue.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonNumberValue.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonObjectValue.cxx
@@ -359,7 +394,6 @@ set(OPENKIT_SOURCES
     ${OPENKIT_SOURCES_PROVIDERS}
     ${OPENKIT_SOURCES_UTIL_JSON_CONSTANTS}
     ${OPENKIT_SOURCES_UTIL_JSON_LEXER}
-    ${OPENKIT_SOURCES_UTIL_JSON_READER}
     ${OPENKIT_SOURCES_UTIL_JSON_OBJECTS}
     ${OPENKIT_SOURCES_UTIL_JSON_PARSER}
     ${OPENKIT_SOURCES_UTIL_JSON}
@@ -617,7 +651,6 @@ function(build_open_kit)
     source_group("Source Files\\Json\\Lexer" FILES ${OPENKIT_SOURCES_UTIL_JSON_LEXER})
     source_group("Source Files\\Json\\Objects" FILES ${OPENKIT_SOURCES_UTIL_JSON_OBJECTS})
     source_group("Source Files\\Json\\Parser" FILES ${OPENKIT_SOURCES_UTIL_JSON_PARSER})
-    source_group("Source Files\\Json\\Reader" FILES ${OPENKIT_SOURCES_UTIL_JSON_READER})
 
     if (BUILD_SHARED_LIBS AND MSVC)
         # add generated version.rc to Resource Files source group
@@ -50,6 +50,17 @@ DynatraceOpenKitBuilder::DynatraceOpenKitBuilder(const char* endpointURL, const
 	, mCrashReportingLevel(core::configuration::DEFAULT_CRASH_REPORTING_LEVEL)
 	, mHttpRequestInterceptor(protocol::NullHttpRequestInterceptor::instance())
 	, mHttpResponseInterceptor(protocol::NullHttpResponseInterceptor::instance())
+	, mHttpConnectionPoolMaxIdleConnections(core::configuration::DEFAULT_HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS)
+	, mHttpConnectionPoolIdleTimeout(core::configuration::DEFAULT_HTTP_CONNECTION_POOL_IDLE_TIMEOUT_IN_MILLIS)
+	, mMaxConcurrentBeaconRequests(core::configuration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS)
+	, mBeaconCompressionLevel(core::configuration::DEFAULT_BEACON_COMPRESSION_LEVEL)
+	, mBeaconCompressionStrategy(core::configuration::DEFAULT_BEACON_COMPRESSION_STRATEGY)
+	, mBeaconCacheOverflowDirectory()
+	, mBeaconCacheOverflowMaxSize(core::configuration::DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES)
+	, mBeaconRecordQueueCapacity(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_CAPACITY)
+	, mBeaconRecordQueueFullPolicy(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_FULL_POLICY)
+	, mIsSharedExecutorEnabled(core::configuration::DEFAULT_SHARED_EXECUTOR_ENABLED)
+	, mLogRecordQueueCapacity(core::configuration::DEFAULT_LOG_RECORD_QUEUE_CAPACITY)
 {
 }
 
@@ -158,6 +169,87 @@ DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withHttpResponseInterceptor(st
 	return *this;
 }
 
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withHttpConnectionPoolMaxIdleConnections(int32_t maxIdleConnections)
+{
+	mHttpConnectionPoolMaxIdleConnections = maxIdleConnections;
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withHttpConnectionPoolIdleTimeout(int64_t idleTimeoutInMilliseconds)
+{
+	mHttpConnectionPoolIdleTimeout = idleTimeoutInMilliseconds;
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withMaxConcurrentBeaconRequests(int32_t maxConcurrentRequests)
+{
+	if (maxConcurrentRequests > 0)
+	{
+		mMaxConcurrentBeaconRequests = maxConcurrentRequests;
+	}
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconCompressionLevel(int32_t compressionLevel)
+{
+	if (compressionLevel >= -1 && compressionLevel <= 9)
+	{
+		mBeaconCompressionLevel = compressionLevel;
+	}
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconCompressionStrategy(openkit::CompressionStrategy compressionStrategy)
+{
+	mBeaconCompressionStrategy = compressionStrategy;
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconCacheOverflowDirectory(const char* directory)
+{
+	mBeaconCacheOverflowDirectory = directory != nullptr ? directory : "";
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconCacheOverflowMaxSize(int64_t maxSizeInBytes)
+{
+	if (maxSizeInBytes > 0)
+	{
+		mBeaconCacheOverflowMaxSize = maxSizeInBytes;
+	}
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconRecordQueueCapacity(int32_t capacity)
+{
+	if (capacity >= 0)
+	{
+		mBeaconRecordQueueCapacity = capacity;
+	}
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withBeaconRecordQueueFullPolicy(openkit::BeaconRecordQueueFullPolicy policy)
+{
+	mBeaconRecordQueueFullPolicy = policy;
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withSharedExecutor(bool enabled)
+{
+	mIsSharedExecutorEnabled = enabled;
+	return *this;
+}
+
+DynatraceOpenKitBuilder& DynatraceOpenKitBuilder::withLogRecordQueueCapacity(int32_t capacity)
+{
+	if (capacity >= 0)
+	{
+		mLogRecordQueueCapacity = capacity;
+	}
+	return *this;
+}
+
 std::shared_ptr<openkit::IOpenKit> DynatraceOpenKitBuilder::build()
 {
 	core::objects::OpenKitInitializer initializer(*this);
@@ -242,6 +334,61 @@ std::shared_ptr<openkit::IHttpResponseInterceptor> DynatraceOpenKitBuilder::getH
 	return mHttpResponseInterceptor;
 }
 
+int32_t DynatraceOpenKitBuilder::getHttpConnectionPoolMaxIdleConnections() const
+{
+	return mHttpConnectionPoolMaxIdleConnections;
+}
+
+int64_t DynatraceOpenKitBuilder::getHttpConnectionPoolIdleTimeout() const
+{
+	return mHttpConnectionPoolIdleTimeout;
+}
+
+int32_t DynatraceOpenKitBuilder::getMaxConcurrentBeaconRequests() const
+{
+	return mMaxConcurrentBeaconRequests;
+}
+
+int32_t DynatraceOpenKitBuilder::getBeaconCompressionLevel() const
+{
+	return mBeaconCompressionLevel;
+}
+
+openkit::CompressionStrategy DynatraceOpenKitBuilder::getBeaconCompressionStrategy() const
+{
+	return mBeaconCompressionStrategy;
+}
+
+const std::string& DynatraceOpenKitBuilder::getBeaconCacheOverflowDirectory() const
+{
+	return mBeaconCacheOverflowDirectory;
+}
+
+int64_t DynatraceOpenKitBuilder::getBeaconCacheOverflowMaxSize() const
+{
+	return mBeaconCacheOverflowMaxSize;
+}
+
+int32_t DynatraceOpenKitBuilder::getBeaconRecordQueueCapacity() const
+{
+	return mBeaconRecordQueueCapacity;
+}
+
+openkit::BeaconRecordQueueFullPolicy DynatraceOpenKitBuilder::getBeaconRecordQueueFullPolicy() const
+{
+	return mBeaconRecordQueueFullPolicy;
+}
+
+bool DynatraceOpenKitBuilder::isSharedExecutorEnabled() const
+{
+	return mIsSharedExecutorEnabled;
+}
+
+int32_t DynatraceOpenKitBuilder::getLogRecordQueueCapacity() const
+{
+	return mLogRecordQueueCapacity;
+}
+
 openkit::LogLevel DynatraceOpenKitBuilder::getLogLevel() const
 {
 	return mLogLevel;
@@ -253,7 +400,7 @@ std::shared_ptr<openkit::ILogger> DynatraceOpenKitBuilder::getLogger() const
 	{
 		return mLogger;
 	}
-	return std::make_shared<core::util::DefaultLogger>(mLogLevel);
+	return std::make_shared<core::util::DefaultLogger>(mLogLevel, static_cast<size_t>(mLogRecordQueueCapacity));
 }
 
 
@@ -35,7 +35,8 @@ BeaconSender::BeaconSender
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider,
-	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache
 )
 	: mLogger(logger)
 	, mBeaconSendingContext(
@@ -44,7 +45,8 @@ BeaconSender::BeaconSender
 			httpClientConfiguration,
 			httpClientProvider,
 			timingProvider,
-			threadSuspender
+			threadSuspender,
+			beaconCache
 		)
 	)
 	, mSendingThread(new core::util::ThreadSurrogate())
@@ -129,3 +131,8 @@ void BeaconSender::addSession(std::shared_ptr<core::objects::SessionInternals> s
 	}
 	mBeaconSendingContext->addSession(session);
 }
+
+void BeaconSender::updateSessionState(std::shared_ptr<core::objects::SessionInternals> session)
+{
+	mBeaconSendingContext->updateSessionState(session);
+}
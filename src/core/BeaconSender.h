@@ -20,6 +20,7 @@
 #include "OpenKit/ILogger.h"
 #include "communication/IBeaconSendingContext.h"
 #include "core/IBeaconSender.h"
+#include "core/caching/IBeaconCache.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
 #include "core/objects/SessionInternals.h"
 #include "core/util/IInterruptibleThreadSuspender.h"
@@ -44,6 +45,8 @@ namespace core
 		/// @param[in] httpClientConfiguration initial HTTP client configuration.
 		/// @param[in] httpClientProvider the provider for HTTPClient instances
 		/// @param[in] timingProvider utility required for timing related stuff
+		/// @param[in] threadSuspender used for suspending the beacon sending thread
+		/// @param[in] beaconCache the cache providing beacons recovered from a previous process
 		///
 		BeaconSender
 		(
@@ -51,7 +54,8 @@ namespace core
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 			std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 			std::shared_ptr<providers::ITimingProvider> timingProvider,
-			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+			std::shared_ptr<core::caching::IBeaconCache> beaconCache
 		);
 
 		~BeaconSender() override = default;
@@ -72,6 +76,8 @@ namespace core
 
 		void addSession(std::shared_ptr<core::objects::SessionInternals> session) override;
 
+		void updateSessionState(std::shared_ptr<core::objects::SessionInternals> session) override;
+
 	private:
 		/// Logger to write traces to
 		std::shared_ptr<openkit::ILogger> mLogger;
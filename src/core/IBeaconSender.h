@@ -74,6 +74,11 @@ namespace core
 		/// Adds the given session to the known sessions of this beacon sender.
 		///
 		virtual void addSession(std::shared_ptr<core::objects::SessionInternals> session) = 0;
+
+		///
+		/// Updates the state of the given session, after it was finished.
+		///
+		virtual void updateSessionState(std::shared_ptr<core::objects::SessionInternals> session) = 0;
 	};
 }
 
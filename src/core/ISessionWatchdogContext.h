@@ -47,6 +47,14 @@ namespace core
 		///
 		virtual void execute() = 0;
 
+		///
+		/// Looks over the tracked sessions / session proxies like @ref execute, but returns instead of sleeping
+		/// until the next session is due.
+		///
+		/// @return the number of milliseconds to wait before executing again
+		///
+		virtual int64_t executeOnce() = 0;
+
 		///
 		/// Requests this context to finish up and shutdown.
 		///
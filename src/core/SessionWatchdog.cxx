@@ -21,10 +21,15 @@ using namespace core;
 static constexpr int64_t SHUTDOWN_TIMEOUT_MILLIS = 2 * 1000; // 2 seconds shutdown timeout
 
 SessionWatchdog::SessionWatchdog(std::shared_ptr<openkit::ILogger> logger,
-	std::shared_ptr<core::ISessionWatchdogContext> context)
+	std::shared_ptr<core::ISessionWatchdogContext> context,
+	std::shared_ptr<core::util::SharedExecutor> executor)
 	: mLogger(logger)
 	, mSessionWatchdogThread(new core::util::ThreadSurrogate())
 	, mContext(context)
+	, mExecutor(executor)
+	, mSessionWatchdogTask(executor == nullptr
+		? nullptr
+		: std::make_shared<core::util::ExecutorTask>(*executor, std::bind(&SessionWatchdog::watchdogTaskFunction, this)))
 {
 }
 
@@ -35,6 +40,12 @@ void SessionWatchdog::initialize()
 		mLogger->debug("SessionWatchdog initialize() - thread started");
 	}
 
+	if (mSessionWatchdogTask != nullptr)
+	{
+		mSessionWatchdogTask->start(0);
+		return;
+	}
+
 	mSessionWatchdogThread->start(std::bind(&SessionWatchdog::watchdogThreadFunction, this));
 }
 
@@ -46,6 +57,16 @@ void SessionWatchdog::watchdogThreadFunction()
 	}
 }
 
+int64_t SessionWatchdog::watchdogTaskFunction()
+{
+	if (mContext->isShutdownRequested())
+	{
+		return core::util::ExecutorTask::WAIT_FOR_WAKEUP;
+	}
+
+	return mContext->executeOnce();
+}
+
 void SessionWatchdog::shutdown()
 {
 	if (mLogger->isDebugEnabled())
@@ -54,7 +75,11 @@ void SessionWatchdog::shutdown()
 	}
 
 	mContext->requestShutdown();
-	if (mSessionWatchdogThread->isAlive())
+	if (mSessionWatchdogTask != nullptr)
+	{
+		mSessionWatchdogTask->stop(SHUTDOWN_TIMEOUT_MILLIS);
+	}
+	else if (mSessionWatchdogThread->isAlive())
 	{
 		mSessionWatchdogThread->join(SHUTDOWN_TIMEOUT_MILLIS);
 	}
@@ -22,6 +22,8 @@
 
 #include "ISessionWatchdog.h"
 #include "ISessionWatchdogContext.h"
+#include "core/util/ExecutorTask.h"
+#include "core/util/SharedExecutor.h"
 #include "core/util/ThreadSurrogate.h"
 
 #include <memory>
@@ -33,8 +35,16 @@ namespace core
 	{
 	public:
 
+		///
+		/// Constructor
+		///
+		/// @param[in] logger to write traces to
+		/// @param[in] context context holding the sessions to be closed or split
+		/// @param[in] executor executor running the watchdog or @c nullptr to use a dedicated thread
+		///
 		SessionWatchdog(std::shared_ptr<openkit::ILogger> logger,
-			std::shared_ptr<core::ISessionWatchdogContext> context);
+			std::shared_ptr<core::ISessionWatchdogContext> context,
+			std::shared_ptr<core::util::SharedExecutor> executor = nullptr);
 
 		~SessionWatchdog() override = default;
 
@@ -54,6 +64,8 @@ namespace core
 
 		void watchdogThreadFunction();
 
+		int64_t watchdogTaskFunction();
+
 		std::shared_ptr<openkit::ILogger> mLogger;
 
 		std::unique_ptr<core::util::ThreadSurrogate> mSessionWatchdogThread;
@@ -63,6 +75,16 @@ namespace core
 		///
 		std::shared_ptr<core::ISessionWatchdogContext> mContext;
 
+		///
+		/// executor running the watchdog task or @c nullptr if the watchdog thread is used
+		///
+		std::shared_ptr<core::util::SharedExecutor> mExecutor;
+
+		///
+		/// task executing the context, if an executor is used
+		///
+		std::shared_ptr<core::util::ExecutorTask> mSessionWatchdogTask;
+
 	};
 }
 
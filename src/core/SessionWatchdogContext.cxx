@@ -17,7 +17,7 @@
 #include "SessionWatchdogContext.h"
 
 #include <algorithm>
-#include <list>
+#include <limits>
 
 using namespace core;
 
@@ -40,10 +40,16 @@ const std::chrono::milliseconds& SessionWatchdogContext::getDefaultSleepTime()
 
 void SessionWatchdogContext::execute()
 {
-	auto durationToNextCloseInMillis = closeExpiredSessions();
-    auto durationToNextSplitInMillis = splitTimedOutSessions();
+	mThreadSuspender->sleep(executeOnce());
+}
+
+int64_t SessionWatchdogContext::executeOnce()
+{
+	auto nowInMillis = mTimingProvider->provideTimestampInMilliseconds();
+	auto durationToNextCloseInMillis = closeExpiredSessions(nowInMillis);
+    auto durationToNextSplitInMillis = splitTimedOutSessions(nowInMillis);
 
-	mThreadSuspender->sleep(std::min(durationToNextCloseInMillis, durationToNextSplitInMillis));
+	return std::min(durationToNextCloseInMillis, durationToNextSplitInMillis);
 }
 
 void SessionWatchdogContext::requestShutdown()
@@ -66,7 +72,7 @@ void SessionWatchdogContext::closeOrEnqueueForClosing(std::shared_ptr<core::obje
 
     auto closeTime = mTimingProvider->provideTimestampInMilliseconds() + closeGracePeriodInMillis;
     session->setSplitByEventsGracePeriodEndTimeInMillis(closeTime);
-    mSessionsToClose.put(session);
+    mSessionsToClose.put(session, closeTime);
 }
 
 void SessionWatchdogContext::dequeueFromClosing(std::shared_ptr<core::objects::SessionInternals> session)
@@ -81,7 +87,8 @@ void SessionWatchdogContext::addToSplitByTimeout(std::shared_ptr<core::objects::
         return;
     }
 
-    mSessionsToSplitByTimeout.put(sessionProxy);
+    // check the session proxy with the next execution
+    mSessionsToSplitByTimeout.put(sessionProxy, std::numeric_limits<int64_t>::min());
 }
 
 void SessionWatchdogContext::removeFromSplitByTimeout(std::shared_ptr<core::objects::ISessionProxy> sessionProxy)
@@ -99,69 +106,52 @@ std::vector<std::shared_ptr<core::objects::ISessionProxy>> SessionWatchdogContex
     return mSessionsToSplitByTimeout.toStdVector();
 }
 
-int64_t SessionWatchdogContext::closeExpiredSessions()
+int64_t SessionWatchdogContext::closeExpiredSessions(int64_t nowInMillis)
 {
-    auto sleepTimeInMillis = DEFAULT_SLEEP_TIME_MILLISECONDS.count();
-    auto allSessions = mSessionsToClose.toStdVector();
-    std::list<std::shared_ptr<core::objects::SessionInternals>> closableSessions;
-
-    // first iteration - get all closeable sessions
-    for (auto& session : allSessions)
+    // only sessions with an expired grace period are visited
+    for (auto& session : mSessionsToClose.takeDue(nowInMillis))
     {
-        auto nowInMillis = mTimingProvider->provideTimestampInMilliseconds();
-        auto gracePeriodEndTimeInMillis = session->getSplitByEventsGracePeriodEndTimeInMillis();
-        auto isGracePeriodExpired = gracePeriodEndTimeInMillis <= nowInMillis;
-        if (isGracePeriodExpired)
-        {
-            closableSessions.push_back(session);
-            continue;
-        }
-
-        auto sleepTimeToGracePeriodEndInMillis = gracePeriodEndTimeInMillis - nowInMillis;
-        sleepTimeInMillis = std::min(sleepTimeInMillis, sleepTimeToGracePeriodEndInMillis);
-    }
-
-    // remove the sessions
-    for (auto& session : closableSessions)
-    {
-        mSessionsToClose.remove(session);
         session->end(false);
     }
 
-    return sleepTimeInMillis;
+    return getSleepTimeUntil(mSessionsToClose.getNextDeadline(), nowInMillis);
 }
 
-int64_t SessionWatchdogContext::splitTimedOutSessions()
+int64_t SessionWatchdogContext::splitTimedOutSessions(int64_t nowInMillis)
 {
-    auto sleepTimeInMillis = DEFAULT_SLEEP_TIME_MILLISECONDS.count();
-    auto sessionProxiesToRemove = std::list<std::shared_ptr<core::objects::ISessionProxy>>();
-    auto allSessionProxies = mSessionsToSplitByTimeout.toStdVector();
-
-    // first iteration - get all session proxies that can be removed
-    for(auto& sessionProxy : allSessionProxies)
+    // only session proxies, whose split time might have been reached, are visited
+    // they stay queued while being split, so that concurrent adds and removes are not lost
+    for (auto& sessionProxy : mSessionsToSplitByTimeout.getDue(nowInMillis))
     {
         auto nextSessionSplitInMillis = sessionProxy->splitSessionByTime();
         if (nextSessionSplitInMillis < 0)
         {
-            sessionProxiesToRemove.push_back(sessionProxy);
+            // session proxy is finished or does not need to be split
+            mSessionsToSplitByTimeout.removeDue(sessionProxy);
             continue;
         }
 
-        auto nowInMillis = mTimingProvider->provideTimestampInMilliseconds();
-        auto durationToNextSplit = nextSessionSplitInMillis - nowInMillis;
-        if (durationToNextSplit < 0)
+        if (nextSessionSplitInMillis < nowInMillis)
         {
-            continue;
+            // check again after the default sleep time
+            nextSessionSplitInMillis = nowInMillis + DEFAULT_SLEEP_TIME_MILLISECONDS.count();
         }
 
-        sleepTimeInMillis = std::min(sleepTimeInMillis, durationToNextSplit);
+        // the split time only moves forward (e.g. due to user interactions), thus it is sufficient to
+        // check the session proxy again, once the currently known split time is reached
+        mSessionsToSplitByTimeout.reschedule(sessionProxy, nextSessionSplitInMillis);
     }
 
-    // remove previously identified session proxies
-    for(auto& sessionProxy : sessionProxiesToRemove)
+    return getSleepTimeUntil(mSessionsToSplitByTimeout.getNextDeadline(), nowInMillis);
+}
+
+int64_t SessionWatchdogContext::getSleepTimeUntil(int64_t deadlineInMillis, int64_t nowInMillis)
+{
+    auto sleepTimeInMillis = DEFAULT_SLEEP_TIME_MILLISECONDS.count();
+    if (deadlineInMillis < nowInMillis + sleepTimeInMillis)
     {
-        mSessionsToSplitByTimeout.remove(sessionProxy);
+        sleepTimeInMillis = std::max<int64_t>(deadlineInMillis - nowInMillis, 0);
     }
 
     return sleepTimeInMillis;
-}
\ No newline at end of file
+}
@@ -20,7 +20,7 @@
 
 #include "ISessionWatchdogContext.h"
 #include "core/util/IInterruptibleThreadSuspender.h"
-#include "core/util/SynchronizedQueue.h"
+#include "core/util/DeadlineQueue.h"
 #include "providers/ITimingProvider.h"
 
 #include <memory>
@@ -47,6 +47,8 @@ namespace core
 
 		void execute() override;
 
+		int64_t executeOnce() override;
+
 		void requestShutdown() override;
 
 		bool isShutdownRequested() override;
@@ -77,9 +79,14 @@ namespace core
 
 	private:
 
-		int64_t closeExpiredSessions();
+		int64_t closeExpiredSessions(int64_t nowInMillis);
+
+		int64_t splitTimedOutSessions(int64_t nowInMillis);
 
-		int64_t splitTimedOutSessions();
+		///
+		/// Returns the time to sleep until the given deadline, but at most the default sleep time.
+		///
+		static int64_t getSleepTimeUntil(int64_t deadlineInMillis, int64_t nowInMillis);
 
 		///
 		/// Indicator whether shutdown was requested or not.
@@ -97,14 +104,15 @@ namespace core
 		std::shared_ptr<core::util::IInterruptibleThreadSuspender> mThreadSuspender;
 
 		///
-		/// holds all sessions which are to be closed after a certain grace period.
+		/// holds all sessions which are to be closed after a certain grace period, ordered by the grace period's end.
 		///
-		core::util::SynchronizedQueue<std::shared_ptr<core::objects::SessionInternals>> mSessionsToClose;
+		core::util::DeadlineQueue<core::objects::SessionInternals> mSessionsToClose;
 
 		///
-		/// holds all session proxies which are to be split after expiration of either session duration or idle timeout.
+		/// holds all session proxies which are to be split after expiration of either session duration or idle timeout,
+		/// ordered by the time they need to be checked next.
 		///
-		core::util::SynchronizedQueue<std::shared_ptr<core::objects::ISessionProxy>> mSessionsToSplitByTimeout;
+		core::util::DeadlineQueue<core::objects::ISessionProxy> mSessionsToSplitByTimeout;
 	};
 }
 
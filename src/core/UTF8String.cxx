@@ -16,12 +16,68 @@
 
 #include "UTF8String.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <stdio.h>
 #include <sstream>
+#include <utility>
 
 using namespace core;
 
+///
+/// Returns @c true if the given character is a US-ASCII character other than the null character
+///
+static inline bool isAsciiCharacter(char character)
+{
+	return static_cast<unsigned char>(character) - 1u < 0x7Fu;
+}
+
+/// Mask selecting the highest bit of each byte in a word
+static constexpr uint64_t HIGH_BITS_MASK = 0x8080808080808080ULL;
+
+///
+/// Loads eight bytes from the given (possibly unaligned) address
+///
+static inline uint64_t loadWord(const char* data)
+{
+	uint64_t word;
+	std::memcpy(&word, data, sizeof(word));
+	return word;
+}
+
+///
+/// Counts the UTF8 continuation bytes (10xxxxxx) in the given word.
+///
+static inline size_t countContinuationBytes(uint64_t word)
+{
+	// the highest bit of each continuation byte is set, the second highest one is not
+	auto continuationBits = (word & ~(word << 1) & HIGH_BITS_MASK) >> 7;
+	// sum up the bytes, which are either 0 or 1, in the highest byte
+	return static_cast<size_t>((continuationBits * 0x0101010101010101ULL) >> 56);
+}
+
+///
+/// Counts the UTF8 continuation bytes (10xxxxxx) in the given data, a word at a time.
+///
+static size_t countContinuationBytes(const char* data, size_t numBytes)
+{
+	size_t count = 0;
+	size_t i = 0;
+	for (; i + sizeof(uint64_t) <= numBytes; i += sizeof(uint64_t))
+	{
+		count += countContinuationBytes(loadWord(data + i));
+	}
+	for (; i < numBytes; i++)
+	{
+		if ((static_cast<unsigned char>(data[i]) & 0xC0) == 0x80)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
 UTF8String::UTF8String()
 	: mData()
 	, mStringLength(0)
@@ -42,9 +98,50 @@ UTF8String::UTF8String(const std::string& stringData)
 {
 }
 
-UTF8String::~UTF8String()
+UTF8String::UTF8String(std::string&& stringData)
+	: UTF8String()
 {
-	mData.clear();
+	auto isPlainAscii = true;
+	for (auto character : stringData)
+	{
+		if (!isAsciiCharacter(character))
+		{
+			isPlainAscii = false;
+			break;
+		}
+	}
+
+	if (isPlainAscii)
+	{
+		mStringLength = stringData.size();
+		mData = std::move(stringData);
+	}
+	else
+	{
+		validateString(stringData.c_str());
+	}
+}
+
+UTF8String::UTF8String(UTF8String&& other) noexcept
+	: mData(std::move(other.mData))
+	, mStringLength(other.mStringLength)
+{
+	other.mData.clear();
+	other.mStringLength = 0;
+}
+
+UTF8String& UTF8String::operator=(UTF8String&& other) noexcept
+{
+	if (this != &other)
+	{
+		mData = std::move(other.mData);
+		mStringLength = other.mStringLength;
+
+		other.mData.clear();
+		other.mStringLength = 0;
+	}
+
+	return *this;
 }
 
 UTF8String::size_type UTF8String::getStringLength() const
@@ -147,32 +244,114 @@ size_t UTF8String::getByteWidthOfCharacter(const unsigned char character) const
 
 void UTF8String::validateString(const char* stringData)
 {
-	auto replacementCharacterASCII = "\xEF\xBF\xBD";
 	if (stringData == nullptr || stringData[0] == '\0')
 	{
 		mStringLength = 0;
 		return;
 	}
 
-	auto byteLength = 0;
+	mData.clear();
+	mStringLength = appendValidated(stringData);
+}
 
-	while (!isStringTerminationCharacter(stringData, byteLength))
+UTF8String::size_type UTF8String::appendValidated(const char* stringData)
+{
+	auto byteLength = getByteLengthOfString(stringData);
+	mData.reserve(mData.size() + byteLength);
+
+	size_type characterCount = 0; //number of characters, either UTF8 multibyte or ASCII single byte
+	size_t offset = 0;
+	while (offset < byteLength)
 	{
-		byteLength++;
+		// copy the run of well-formed characters at once
+		auto runStart = offset;
+		offset = getEndOfWellFormedRun(stringData, offset, byteLength);
+		if (offset > runStart)
+		{
+			auto runLength = offset - runStart;
+			mData.append(stringData + runStart, runLength);
+			characterCount += runLength - countContinuationBytes(stringData + runStart, runLength);
+		}
+
+		if (offset < byteLength)
+		{
+			offset = appendMalformed(stringData, offset, byteLength, characterCount);
+		}
 	}
 
-	if (byteLength <= 0)
+	return characterCount;
+}
+
+size_t UTF8String::getByteLengthOfString(const char* stringData)
+{
+	auto byteLength = std::strlen(stringData);
+
+	// search for a modified UTF-8 terminator (0xC0 0x80)
+	auto searchStart = stringData;
+	auto end = stringData + byteLength;
+	while (searchStart < end)
 	{
-		return;
+		auto found = static_cast<const char*>(std::memchr(searchStart, '\xC0', end - searchStart));
+		if (found == nullptr)
+		{
+			break;
+		}
+		if (found + 1 < end && found[1] == '\x80')
+		{
+			return found - stringData;
+		}
+		searchStart = found + 1;
 	}
 
-	mData.clear();
+	return byteLength;
+}
+
+size_t UTF8String::getEndOfWellFormedRun(const char* stringData, size_t offset, size_t byteLength) const
+{
+	while (offset < byteLength)
+	{
+		// skip US-ASCII characters a word at a time
+		while (offset + sizeof(uint64_t) <= byteLength && (loadWord(stringData + offset) & HIGH_BITS_MASK) == 0)
+		{
+			offset += sizeof(uint64_t);
+		}
+		if (offset >= byteLength)
+		{
+			break;
+		}
+
+		auto byteWidthOfCurrentCharacter = getByteWidthOfCharacter(static_cast<unsigned char>(stringData[offset]));
+		if (byteWidthOfCurrentCharacter == 1)
+		{
+			offset++;
+			continue;
+		}
+
+		if (byteWidthOfCurrentCharacter == 0 || offset + byteWidthOfCurrentCharacter > byteLength)
+		{
+			return offset;
+		}
+		for (size_t i = 1; i < byteWidthOfCurrentCharacter; i++)
+		{
+			if (!isPartOfPreviousUtf8Multibyte(static_cast<unsigned char>(stringData[offset + i])))
+			{
+				return offset;
+			}
+		}
+		offset += byteWidthOfCurrentCharacter;
+	}
+
+	return offset;
+}
+
+size_t UTF8String::appendMalformed(const char* stringData, size_t offset, size_t byteLength, size_type& characterCount)
+{
+	auto replacementCharacterASCII = "\xEF\xBF\xBD";
 
 	auto multibyteSeqenceLength = -1;
 	auto multibyteSequencePosition = -1;
 
-	auto characterCount = 0; //number of characters, either UTF8 multibyte or ASCII single byte
-	for (auto i = 0; i < byteLength; i++)//omit \0 at the end of the array
+	for (auto i = offset; i < byteLength; i++)
 	{
 		auto byteWidthOfCurrentCharacter = getByteWidthOfCharacter(static_cast<unsigned char>(stringData[i]));
 
@@ -189,11 +368,8 @@ void UTF8String::validateString(const char* stringData)
 			}
 			else if (multibyteSequencePosition == multibyteSeqenceLength - 1)
 			{
-				auto offset = i - multibyteSeqenceLength + 1;
-				for (auto j = 0; j < multibyteSeqenceLength; j++)
-				{
-					this->mData.push_back(stringData[offset + j]);
-				}
+				auto sequenceStart = i + 1 - multibyteSeqenceLength;
+				this->mData.append(stringData + sequenceStart, multibyteSeqenceLength);
 
 				multibyteSeqenceLength = -1;
 				multibyteSequencePosition = -1;
@@ -226,28 +402,19 @@ void UTF8String::validateString(const char* stringData)
 				multibyteSequencePosition = -1;
 			}
 
-			multibyteSeqenceLength = byteWidthOfCurrentCharacter;
+			multibyteSeqenceLength = static_cast<int32_t>(byteWidthOfCurrentCharacter);
 			multibyteSequencePosition = 0;
 		}
-	}
-
-	mStringLength = characterCount;
-}
 
-inline bool UTF8String::isStringTerminationCharacter(const char* stringData, size_t offset) const
-{
-	auto character = *(stringData + offset);
-	if (character == '\0') // standard null terminated string
-	{
-		return true;
-	}
-
-	if (character == '\xC0' && *(stringData + offset + 1) == '\x80') // modified UTF-8 terminated string
-	{
-		return true;
+		if (multibyteSeqenceLength == -1)
+		{
+			// back at a character boundary
+			return i + 1;
+		}
 	}
 
-	return false;
+	// an incomplete multi-byte character at the end is dropped
+	return byteLength;
 }
 
 bool UTF8String::equals(const UTF8String& other) const
@@ -276,92 +443,110 @@ void UTF8String::concatenate(const UTF8String& string)
 
 void UTF8String::concatenate(const char* string)
 {
-	UTF8String concatenateString(string);
-	concatenate(concatenateString);
+	if (string != nullptr)
+	{
+		mStringLength += appendValidated(string);
+	}
+}
+
+void UTF8String::concatenate(const char* data, size_type numBytes, size_type stringLength)
+{
+	if (numBytes > 0)
+	{
+		mData.append(data, numBytes);
+		mStringLength += stringLength;
+	}
 }
 
 //character can be multi-byte
 UTF8String::size_type UTF8String::getIndexOf(const char* comparisonCharacter, size_t offset) const
 {
-	if (offset == std::string::npos && offset >= mData.size())
+	if (offset >= mStringLength)
 	{
 		return std::string::npos;
 	}
 
 	size_t characterByteWidth = getByteWidthOfCharacter((unsigned char)(*comparisonCharacter));
-	if (characterByteWidth == std::string::npos)//error
+	if (characterByteWidth == 0)//error
 	{
 		return std::string::npos;
 	}
 
-	auto currentCharacter = &(mData[0]);
-
-	//this for loop takes multi byte characters into account correctly
-	for (size_t i = 0; i < mData.size(); i++)
+	// since the data is valid UTF8, a byte wise search can only match at the start of a character
+	auto byteOffset = getByteOffsetOfCharacter(0, offset);
+	auto found = mData.find(comparisonCharacter, byteOffset, characterByteWidth);
+	if (found == std::string::npos)
 	{
-		auto numberOfBytesCurrent = getByteWidthOfCharacter((unsigned char)(*currentCharacter));
-
-		if (i >= offset)
-		{
-			if (characterByteWidth == numberOfBytesCurrent)
-			{
-				if (numberOfBytesCurrent == 1 && (*currentCharacter) == (*comparisonCharacter))
-				{
-					return i;
-				}
-				if (numberOfBytesCurrent > 1 && memcmp(currentCharacter, comparisonCharacter, numberOfBytesCurrent) == 0)
-				{
-					return i;
-				}
-			}
-		}
-		currentCharacter += numberOfBytesCurrent;
+		return std::string::npos;
 	}
-	return std::string::npos;
+
+	auto numBytesSkipped = found - byteOffset;
+	return offset + numBytesSkipped - countContinuationBytes(mData.data() + byteOffset, numBytesSkipped);
 }
 
 UTF8String UTF8String::substring(size_t start, size_t length) const
 {
 	// Sanity
-	if (length == 0 || start > mData.size())
+	if (length == 0 || start >= mStringLength)
 	{
 		return UTF8String();
 	}
 
-	size_t byteIndex = 0;
-	size_t byteOffsetStart = 0;
-	size_t byteOffsetEnd = 0;
-	size_t characterIndex = 0;
-	size_t characterCounter = 0;
+	UTF8String substring;
 
-	//collect byte positions correctly counting multi byte characters
-	while (byteIndex < mData.size() && characterCounter < length)
+	auto byteOffsetStart = getByteOffsetOfCharacter(0, start);
+	auto byteOffsetEnd = mData.size();
+	if (length < mStringLength - start)
 	{
-		auto currentCharacter = mData[byteIndex];
-		auto numberOfBytes = getByteWidthOfCharacter(currentCharacter);
-		if (characterIndex == start)
-		{
-			byteOffsetStart = byteIndex;
-		}
-		if (characterIndex >= start)
+		byteOffsetEnd = getByteOffsetOfCharacter(byteOffsetStart, length);
+		substring.mStringLength = length;
+	}
+	else
+	{
+		substring.mStringLength = mStringLength - start;
+	}
+
+	//only copy the bytes of the substring
+	substring.mData.assign(mData, byteOffsetStart, byteOffsetEnd - byteOffsetStart);
+
+	return substring;
+}
+
+size_t UTF8String::getByteOffsetOfCharacter(size_t byteOffset, size_t numCharacters) const
+{
+	if (mStringLength == mData.size())
+	{
+		// plain US-ASCII string, every character is a single byte
+		return std::min(byteOffset + numCharacters, mData.size());
+	}
+
+	auto data = mData.data();
+
+	// skip whole words, as long as the searched character starts behind them
+	while (byteOffset + sizeof(uint64_t) <= mData.size())
+	{
+		auto numCharacterStarts = sizeof(uint64_t) - countContinuationBytes(loadWord(data + byteOffset));
+		if (numCharacterStarts >= numCharacters)
 		{
-			characterCounter++;
+			break;
 		}
-		byteOffsetEnd = byteIndex + numberOfBytes - 1;
-		byteIndex += numberOfBytes;
-		characterIndex++;
+		numCharacters -= numCharacterStarts;
+		byteOffset += sizeof(uint64_t);
 	}
 
-	//cut the new string using the indices
-	if (byteOffsetStart != std::string::npos && byteOffsetStart <= byteOffsetEnd && byteOffsetEnd < mData.size())
+	for (; byteOffset < mData.size(); byteOffset++)
 	{
-		UTF8String substring;
-		substring.mStringLength = characterCounter;
-		substring.mData.insert(substring.mData.begin(), mData.begin() + byteOffsetStart, mData.begin() + byteOffsetEnd + 1);
-
-		return substring;
+		if (!isPartOfPreviousUtf8Multibyte(static_cast<unsigned char>(data[byteOffset])))
+		{
+			if (numCharacters == 0)
+			{
+				return byteOffset;
+			}
+			numCharacters--;
+		}
 	}
-	return UTF8String();
+
+	return mData.size();
 }
 
 
@@ -383,7 +568,7 @@ std::vector<UTF8String> UTF8String::split(char delimiter) const
 	std::stringstream ss(mData);
 	while (std::getline(ss, item, delimiter))
 	{
-		parts.push_back(UTF8String(item));
+		parts.push_back(UTF8String(std::move(item)));
 	}
 	return parts;
 }
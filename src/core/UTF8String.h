@@ -45,6 +45,14 @@ namespace core
 		///
 		UTF8String(const std::string& string);
 
+		///
+		/// Initialize using a standard string, taking over its buffer if the string only consists of US-ASCII characters.
+		/// Otherwise the string is validated the same way as the other constructors do.
+		/// @param[in] string the string used to initialize this string
+		/// @return a new string initialized to the provided value
+		///
+		UTF8String(std::string&& string);
+
 		///
 		/// Using a user-provided char sequence initialize this string. Either UTF8 multibyte
 		/// data or plain US-ASCII can be used to initialize strings.
@@ -53,10 +61,30 @@ namespace core
 		///
 		UTF8String(const char* stringData);
 
+		///
+		/// Copy constructor
+		///
+		UTF8String(const UTF8String& other) = default;
+
+		///
+		/// Move constructor, leaving @c other as empty string
+		///
+		UTF8String(UTF8String&& other) noexcept;
+
+		///
+		/// Copy assignment operator
+		///
+		UTF8String& operator=(const UTF8String& other) = default;
+
+		///
+		/// Move assignment operator, leaving @c other as empty string
+		///
+		UTF8String& operator=(UTF8String&& other) noexcept;
+
 		///
 		/// Destructor
 		///
-		~UTF8String();
+		~UTF8String() = default;
 
 		///
 		/// Returns the string size. For UTF8 this is not necessarily the number of bytes
@@ -104,6 +132,15 @@ namespace core
 		///
 		void concatenate(const char* data);
 
+		///
+		/// Concatenate already validated UTF8 data, e.g. data previously taken from another string.
+		/// @remarks No validation is done, therefore the data must be valid UTF8.
+		/// @param[in] data pointer to the UTF8 data
+		/// @param[in] numBytes number of bytes to add
+		/// @param[in] stringLength number of characters encoded in @c data
+		///
+		void concatenate(const char* data, size_type numBytes, size_type stringLength);
+
 		///
 		/// Find first occurence of character. Indices do not refer to bytes, instead they refer to actual
 		/// characters. The reason is that UTF8 characters can span multiple bytes.
@@ -177,13 +214,52 @@ namespace core
 		size_t getByteWidthOfCharacter(const unsigned char character) const;
 
 		///
-		/// Checks if the character at the given offset in the given string corresponds to a string terminator.
+		/// Returns the number of bytes of the given string data, excluding the string terminator.
 		/// In addition to the standard string termination with \0 a termination according to modified UTF-8 (0xC0 0x80)
 		/// is also considered.
 		///
-		/// @return @c true if the character(s) at the given offset specify a string terminator, @c false otherwise.
+		/// @param[in] stringData the null or modified UTF-8 terminated string data
+		/// @returns the number of bytes before the first string terminator
+		///
+		static size_t getByteLengthOfString(const char* stringData);
+
+		///
+		/// Returns the end of the run of well-formed characters (US-ASCII characters and complete UTF8 multibyte characters)
+		/// starting at the given offset.
+		/// @param[in] stringData the string data to scan
+		/// @param[in] offset the byte offset to start at
+		/// @param[in] byteLength the number of bytes of @c stringData
+		/// @returns the byte offset of the first malformed byte or @c byteLength
+		///
+		size_t getEndOfWellFormedRun(const char* stringData, size_t offset, size_t byteLength) const;
+
+		///
+		/// Appends the malformed data starting at the given offset, replacing invalid UTF8 codepoints,
+		/// until the data is back at a character boundary.
+		/// @param[in] stringData the string data to validate
+		/// @param[in] offset the byte offset of the first malformed byte
+		/// @param[in] byteLength the number of bytes of @c stringData
+		/// @param[in,out] characterCount the number of characters, which is increased by the appended characters
+		/// @returns the byte offset at which the data is well-formed again or @c byteLength
+		///
+		size_t appendMalformed(const char* stringData, size_t offset, size_t byteLength, size_type& characterCount);
+
+		///
+		/// Returns the byte offset of the character following @c numCharacters characters starting at @c byteOffset.
+		/// For plain US-ASCII strings this is done in constant time, otherwise the continuation bytes are skipped
+		/// a word at a time.
+		/// @param[in] byteOffset the byte offset of the character to start at
+		/// @param[in] numCharacters the number of characters to skip
+		/// @returns the byte offset of the character or the number of bytes, if the string is too short
+		///
+		size_t getByteOffsetOfCharacter(size_t byteOffset, size_t numCharacters) const;
+
+		///
+		/// Validates the given string data and appends it to the internal storage, replacing invalid UTF8 codepoints.
+		/// @param[in] stringData the null or modified UTF-8 terminated string data to validate
+		/// @returns the number of characters appended
 		///
-		inline bool isStringTerminationCharacter(const char* stringData, size_t offset) const;
+		size_type appendValidated(const char* stringData);
 
 	private:
 
@@ -0,0 +1,250 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "AsyncBeaconCache.h"
+
+#include <chrono>
+#include <inttypes.h> // for PRIu64 macro
+
+using namespace core::caching;
+
+/// Interval in which the background thread moves queued records, unless the queue fills up before
+constexpr std::chrono::milliseconds DRAIN_INTERVAL = std::chrono::milliseconds(10);
+
+/// Timeout to wait for the background thread to finish
+constexpr std::chrono::milliseconds DRAIN_THREAD_JOIN_TIMEOUT = std::chrono::seconds(2);
+
+AsyncBeaconCache::AsyncBeaconCache(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<IBeaconCache> beaconCache,
+	size_t queueCapacity,
+	openkit::BeaconRecordQueueFullPolicy queueFullPolicy
+)
+	: mLogger(logger)
+	, mBeaconCache(beaconCache)
+	, mQueue(queueCapacity)
+	, mQueueFullPolicy(queueFullPolicy)
+	, mDrainThreshold(mQueue.getCapacity() / 2)
+	, mNumDroppedRecords(0)
+	, mDrainMutex()
+	, mDrainThread(new core::util::ThreadSurrogate())
+	, mDrainRequested(false)
+	, mStop(false)
+	, mMutex()
+	, mConditionVariable()
+{
+	mDrainThread->start(std::bind(&AsyncBeaconCache::drainQueueLoopFunc, this));
+}
+
+AsyncBeaconCache::~AsyncBeaconCache()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+		mConditionVariable.notify_all();
+	}
+
+	mDrainThread->join(DRAIN_THREAD_JOIN_TIMEOUT.count());
+}
+
+void AsyncBeaconCache::addObserver(IObserver* observer)
+{
+	mBeaconCache->addObserver(observer);
+}
+
+void AsyncBeaconCache::addEventData(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data)
+{
+	BeaconRecordQueue::Record record(beaconKey, timestamp, data, false);
+	submitRecord(record);
+}
+
+void AsyncBeaconCache::addActionData(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data)
+{
+	BeaconRecordQueue::Record record(beaconKey, timestamp, data, true);
+	submitRecord(record);
+}
+
+void AsyncBeaconCache::submitRecord(BeaconRecordQueue::Record& record)
+{
+	while (!mQueue.tryPush(record))
+	{
+		if (mQueueFullPolicy == openkit::BeaconRecordQueueFullPolicy::DROP)
+		{
+			mNumDroppedRecords++;
+			return;
+		}
+
+		// back pressure: the reporting thread moves the queued records itself
+		drainQueue();
+	}
+
+	if (mQueue.size() >= mDrainThreshold && !mDrainRequested.load(std::memory_order_relaxed)
+		&& !mDrainRequested.exchange(true))
+	{
+		// wake up the background thread before the queue is full
+		std::lock_guard<std::mutex> lock(mMutex);
+		mConditionVariable.notify_all();
+	}
+}
+
+size_t AsyncBeaconCache::drainQueue()
+{
+	// always lock, even if the queue is empty: records popped by another thread might not be in the cache yet
+	std::lock_guard<std::mutex> lock(mDrainMutex);
+
+	size_t numRecords = 0;
+	BeaconRecordQueue::Record record;
+	while (mQueue.tryPop(record))
+	{
+		if (record.isActionData)
+		{
+			mBeaconCache->addActionData(record.beaconKey, record.timestamp, record.data);
+		}
+		else
+		{
+			mBeaconCache->addEventData(record.beaconKey, record.timestamp, record.data);
+		}
+		numRecords++;
+	}
+
+	return numRecords;
+}
+
+uint64_t AsyncBeaconCache::getNumDroppedRecords() const
+{
+	return mNumDroppedRecords.load();
+}
+
+void AsyncBeaconCache::drainQueueLoopFunc()
+{
+	uint64_t numDroppedRecordsReported = 0;
+	while (true)
+	{
+		bool stop;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			if (!mStop && !mDrainRequested.load())
+			{
+				mConditionVariable.wait_for(lock, DRAIN_INTERVAL);
+			}
+			stop = mStop;
+		}
+		mDrainRequested = false;
+
+		drainQueue();
+
+		auto numDroppedRecords = mNumDroppedRecords.load();
+		if (numDroppedRecords != numDroppedRecordsReported && mLogger->isWarningEnabled())
+		{
+			mLogger->warning("AsyncBeaconCache - discarded %" PRIu64 " records, since the queue was full",
+				numDroppedRecords - numDroppedRecordsReported);
+		}
+		numDroppedRecordsReported = numDroppedRecords;
+
+		if (stop)
+		{
+			break;
+		}
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("AsyncBeaconCache drainQueueLoopFunc() - thread is stopped.");
+	}
+}
+
+void AsyncBeaconCache::deleteCacheEntry(const BeaconKey& beaconKey)
+{
+	drainQueue();
+	mBeaconCache->deleteCacheEntry(beaconKey);
+}
+
+void AsyncBeaconCache::prepareDataForSending(const BeaconKey& beaconKey)
+{
+	drainQueue();
+	mBeaconCache->prepareDataForSending(beaconKey);
+}
+
+bool AsyncBeaconCache::hasDataForSending(const BeaconKey& beaconKey)
+{
+	return mBeaconCache->hasDataForSending(beaconKey);
+}
+
+const core::UTF8String AsyncBeaconCache::getNextBeaconChunk(const BeaconKey& beaconKey, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter)
+{
+	return mBeaconCache->getNextBeaconChunk(beaconKey, chunkPrefix, maxSize, delimiter);
+}
+
+void AsyncBeaconCache::removeChunkedData(const BeaconKey& beaconKey)
+{
+	mBeaconCache->removeChunkedData(beaconKey);
+}
+
+void AsyncBeaconCache::resetChunkedData(const BeaconKey& beaconKey)
+{
+	mBeaconCache->resetChunkedData(beaconKey);
+}
+
+const std::unordered_set<BeaconKey, BeaconKey::Hash> AsyncBeaconCache::getBeaconKeys()
+{
+	drainQueue();
+	return mBeaconCache->getBeaconKeys();
+}
+
+uint32_t AsyncBeaconCache::evictRecordsByAge(const BeaconKey& beaconKey, int64_t minTimestamp)
+{
+	drainQueue();
+	return mBeaconCache->evictRecordsByAge(beaconKey, minTimestamp);
+}
+
+uint32_t AsyncBeaconCache::evictRecordsByNumber(const BeaconKey& beaconKey, uint32_t numRecords)
+{
+	drainQueue();
+	return mBeaconCache->evictRecordsByNumber(beaconKey, numRecords);
+}
+
+uint32_t AsyncBeaconCache::evictRecordsBySize(int64_t numBytes)
+{
+	drainQueue();
+	return mBeaconCache->evictRecordsBySize(numBytes);
+}
+
+int64_t AsyncBeaconCache::getNumBytesInCache() const
+{
+	return mBeaconCache->getNumBytesInCache();
+}
+
+bool AsyncBeaconCache::isEmpty(const BeaconKey& beaconKey)
+{
+	drainQueue();
+	return mBeaconCache->isEmpty(beaconKey);
+}
+
+void AsyncBeaconCache::setBeaconHeader(const BeaconKey& beaconKey, const BeaconHeader& header)
+{
+	mBeaconCache->setBeaconHeader(beaconKey, header);
+}
+
+bool AsyncBeaconCache::takeRecoveredBeacon(IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon, size_t maxNumBytes)
+{
+	return mBeaconCache->takeRecoveredBeacon(recoveredBeacon, maxNumBytes);
+}
+
+void AsyncBeaconCache::restoreRecoveredBeacon(const IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon)
+{
+	mBeaconCache->restoreRecoveredBeacon(recoveredBeacon);
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_ASYNCBEACONCACHE_H
+#define _CORE_CACHING_ASYNCBEACONCACHE_H
+
+#include "OpenKit/BeaconRecordQueueFullPolicy.h"
+#include "OpenKit/ILogger.h"
+#include "BeaconRecordQueue.h"
+#include "IBeaconCache.h"
+#include "core/util/ThreadSurrogate.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Beacon cache decorator, which decouples threads reporting data from the underlying beacon cache.
+		///
+		/// @par
+		/// Reported records are put into a lock-free @ref BeaconRecordQueue and moved to the underlying cache in
+		/// batches by a background thread. All operations reading the cache move the queued records first, so that
+		/// they observe the same data as with synchronous submission.
+		///
+		class AsyncBeaconCache : public IBeaconCache
+		{
+		public:
+			///
+			/// Constructor, starting the background thread moving queued records to the underlying cache.
+			///
+			/// @param[in] logger to write traces to
+			/// @param[in] beaconCache the underlying beacon cache
+			/// @param[in] queueCapacity the maximum number of queued records
+			/// @param[in] queueFullPolicy policy applied if the queue is full
+			///
+			AsyncBeaconCache(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<IBeaconCache> beaconCache,
+				size_t queueCapacity,
+				openkit::BeaconRecordQueueFullPolicy queueFullPolicy
+			);
+
+			///
+			/// Destructor, stopping the background thread after moving all queued records to the underlying cache.
+			///
+			~AsyncBeaconCache() override;
+
+			///
+			/// Delete the copy constructor
+			///
+			AsyncBeaconCache(const AsyncBeaconCache&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			AsyncBeaconCache& operator = (const AsyncBeaconCache &) = delete;
+
+			void addObserver(IObserver* observer) override;
+
+			void addEventData(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data) override;
+
+			void addActionData(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data) override;
+
+			void deleteCacheEntry(const BeaconKey& beaconKey) override;
+
+			void prepareDataForSending(const BeaconKey& beaconKey) override;
+
+			bool hasDataForSending(const BeaconKey& beaconKey) override;
+
+			const core::UTF8String getNextBeaconChunk(const BeaconKey& beaconKey, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) override;
+
+			void removeChunkedData(const BeaconKey& beaconKey) override;
+
+			void resetChunkedData(const BeaconKey& beaconKey) override;
+
+			const std::unordered_set<BeaconKey, BeaconKey::Hash> getBeaconKeys() override;
+
+			uint32_t evictRecordsByAge(const BeaconKey& beaconKey, int64_t minTimestamp) override;
+
+			uint32_t evictRecordsByNumber(const BeaconKey& beaconKey, uint32_t numRecords) override;
+
+			uint32_t evictRecordsBySize(int64_t numBytes) override;
+
+			int64_t getNumBytesInCache() const override;
+
+			bool isEmpty(const BeaconKey& beaconKey) override;
+
+			void setBeaconHeader(const BeaconKey& beaconKey, const BeaconHeader& header) override;
+
+			bool takeRecoveredBeacon(IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon, size_t maxNumBytes) override;
+
+			void restoreRecoveredBeacon(const IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon) override;
+
+			///
+			/// Moves all queued records to the underlying beacon cache.
+			///
+			/// @par
+			/// Also waits for records another thread is currently moving.
+			///
+			/// @return the number of records moved
+			///
+			size_t drainQueue();
+
+			///
+			/// Returns the number of records discarded, because the queue was full.
+			///
+			uint64_t getNumDroppedRecords() const;
+
+		private:
+			///
+			/// Queues the given record, applying the queue full policy if needed.
+			///
+			void submitRecord(BeaconRecordQueue::Record& record);
+
+			///
+			/// Moves queued records to the underlying cache until the queue is empty.
+			///
+			void drainQueueLoopFunc();
+
+		private:
+			/// Logger to write traces to
+			std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// The underlying beacon cache
+			std::shared_ptr<IBeaconCache> mBeaconCache;
+
+			/// Queue holding the records not yet moved to the underlying cache
+			BeaconRecordQueue mQueue;
+
+			/// Policy applied if the queue is full
+			const openkit::BeaconRecordQueueFullPolicy mQueueFullPolicy;
+
+			/// Number of queued records, at which the background thread is woken up before the interval elapsed
+			const size_t mDrainThreshold;
+
+			/// Number of records discarded, because the queue was full
+			std::atomic<uint64_t> mNumDroppedRecords;
+
+			/// Serializes moving records, so that the records of each beacon keep their order
+			std::mutex mDrainMutex;
+
+			/// Thread moving the queued records
+			std::unique_ptr<core::util::ThreadSurrogate> mDrainThread;
+
+			/// Flag set if the background thread should be woken up before the interval elapsed
+			std::atomic<bool> mDrainRequested;
+
+			/// Flag indicating that the background thread should stop
+			bool mStop;
+
+			/// Mutex guarding @c mStop
+			std::mutex mMutex;
+
+			/// Used to wake up the background thread
+			std::condition_variable mConditionVariable;
+		};
+	}
+}
+
+#endif
@@ -16,19 +16,19 @@
 
 #include "BeaconCache.h"
 
+#include <algorithm>
 #include <mutex>
 #include <inttypes.h> // for PRId64 macro
 
 using namespace core::caching;
 
-BeaconCache::BeaconCache(std::shared_ptr<openkit::ILogger> logger)
+BeaconCache::BeaconCache(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCacheOverflowStore> overflowStore)
 	: mLogger(logger)
 	, observers()
-	, mGlobalCacheLock()
-	, mBeacons()
-	, mCacheSizeInBytes(0)
+	, mOverflowStore(overflowStore)
+	, mShards()
+	, mNumEvictedRecords(0)
 {
-
 }
 
 void BeaconCache::addObserver(IObserver* observer)
@@ -54,10 +54,10 @@ void BeaconCache::addEventData(const BeaconKey& beaconKey, int64_t timestamp, co
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
 	entry->addEventData(record);
-	lock.unlock();
 
 	// update cache stats
-	mCacheSizeInBytes += record.getDataSizeInBytes();
+	updateCacheSize(beaconKey, *entry, record.getDataSizeInBytes());
+	lock.unlock();
 
 	// notify observers
 	onDataAdded();
@@ -77,10 +77,10 @@ void BeaconCache::addActionData(const BeaconKey& beaconKey, int64_t timestamp, c
 	BeaconCacheRecord record(timestamp, data);
 	std::unique_lock<std::mutex> lock(entry->getLock());
 	entry->addActionData(record);
-	lock.unlock();
 
 	// update cache stats
-	mCacheSizeInBytes += record.getDataSizeInBytes();
+	updateCacheSize(beaconKey, *entry, record.getDataSizeInBytes());
+	lock.unlock();
 
 	// notify observers
 	onDataAdded();
@@ -88,21 +88,33 @@ void BeaconCache::addActionData(const BeaconKey& beaconKey, int64_t timestamp, c
 
 void BeaconCache::deleteCacheEntry(const BeaconKey& beaconKey)
 {
-	core::util::ScopedWriteLock lock(mGlobalCacheLock);
+	auto& shard = getShard(beaconKey);
+	core::util::ScopedWriteLock lock(shard.lock);
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache deleteCacheEntry(sn=%d, seq=%d)",
 			beaconKey.getBeaconId(), beaconKey.getBeaconSequenceNumber());
 	}
 
-	auto it = mBeacons.find(beaconKey);
-	if (it != mBeacons.end())
+	auto it = shard.beacons.find(beaconKey);
+	if (it != shard.beacons.end())
 	{
-		mCacheSizeInBytes -= it->second->getTotalNumberOfBytes();
-		mBeacons.erase(it);
+		// the entry might still be referenced (e.g. by the evictor), so mark it as removed
+		std::unique_lock<std::mutex> entryLock(it->second->getLock());
+		shard.cacheSizeInBytes -= it->second->getTotalNumberOfBytes();
+		it->second->markRemovedFromCache();
+		entryLock.unlock();
+
+		shard.beacons.erase(it);
 	}
 
 	lock.unlock();
+
+	if (mOverflowStore != nullptr)
+	{
+		// records still being spilled by evictRecordsBySize are removed there, once it notices the removal
+		mOverflowStore->removeRecords(beaconKey);
+	}
 }
 
 void BeaconCache::prepareDataForSending(const BeaconKey& beaconKey)
@@ -122,10 +134,10 @@ void BeaconCache::prepareDataForSending(const BeaconKey& beaconKey)
 		std::unique_lock<std::mutex> lock(entry->getLock());
 		numBytes = entry->getTotalNumberOfBytes();
 		entry->copyDataForSending();
-		lock.unlock();
 
 		// assumption: sending will work fine, and everything we copied will be removed quite soon
-		mCacheSizeInBytes -= numBytes;
+		updateCacheSize(beaconKey, *entry, -numBytes);
+		lock.unlock();
 	}
 }
 
@@ -138,7 +150,8 @@ bool BeaconCache::hasDataForSending(const BeaconKey& beaconKey)
 		return false;
 	}
 
-	return entry->hasDataToSend();
+	// records in the overflow store are paged in by getNextBeaconChunk
+	return entry->hasDataToSend() || (mOverflowStore != nullptr && mOverflowStore->hasRecords(beaconKey));
 }
 
 const core::UTF8String BeaconCache::getNextBeaconChunk(const BeaconKey& beaconKey, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter)
@@ -150,6 +163,15 @@ const core::UTF8String BeaconCache::getNextBeaconChunk(const BeaconKey& beaconKe
 		return core::UTF8String();
 	}
 
+	if (mOverflowStore != nullptr && !entry->hasDataToSend())
+	{
+		// page in records moved to the overflow store, one chunk at a time
+		auto records = mOverflowStore->takeRecords(beaconKey, static_cast<size_t>(std::max(maxSize, 0)));
+
+		std::lock_guard<std::mutex> lock(entry->getLock());
+		entry->addRecordsForSending(records);
+	}
+
 	// data for chunking is available
 	return entry->getChunk(chunkPrefix, maxSize, delimiter);
 }
@@ -181,9 +203,9 @@ void BeaconCache::resetChunkedData(const BeaconKey& beaconKey)
 	entry->resetDataMarkedForSending();
 	int64_t newSize = entry->getTotalNumberOfBytes();
 	numBytes = newSize - oldSize;
-	lock.unlock();
 
-	mCacheSizeInBytes += numBytes;
+	updateCacheSize(beaconKey, *entry, numBytes);
+	lock.unlock();
 
 	// notify observers
 	onDataAdded();
@@ -195,14 +217,15 @@ std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntryOrInsert(const Beac
 	if (entry == nullptr)
 	{
 		// does not exist, and needs to be inserted
-		core::util::ScopedWriteLock lock(mGlobalCacheLock);
+		auto& shard = getShard(beaconKey);
+		core::util::ScopedWriteLock lock(shard.lock);
 
 		// double check since this could have been added in the mean time
-		auto it = mBeacons.find(beaconKey);
-		if (it == mBeacons.end())
+		auto it = shard.beacons.find(beaconKey);
+		if (it == shard.beacons.end())
 		{
 			entry = std::make_shared<BeaconCacheEntry>();
-			mBeacons.insert(std::make_pair(beaconKey, entry));
+			shard.beacons.insert(std::make_pair(beaconKey, entry));
 		}
 		else
 		{
@@ -281,14 +304,20 @@ std::vector<core::UTF8String> BeaconCache::extractData(const std::list<BeaconCac
 	return result;
 }
 
+BeaconCache::Shard& BeaconCache::getShard(const BeaconKey& beaconKey)
+{
+	return mShards[BeaconKey::Hash()(beaconKey) & (NUMBER_OF_SHARDS - 1)];
+}
+
 std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntry(const BeaconKey& beaconKey)
 {
 	std::shared_ptr<BeaconCacheEntry> entry = nullptr;
 
-	// acquire read lock and get the entry
-	core::util::ScopedReadLock lock(mGlobalCacheLock);
-	auto it = mBeacons.find(beaconKey);
-	if (it != mBeacons.end())
+	// acquire read lock of the responsible shard and get the entry
+	auto& shard = getShard(beaconKey);
+	core::util::ScopedReadLock lock(shard.lock);
+	auto it = shard.beacons.find(beaconKey);
+	if (it != shard.beacons.end())
 	{
 		entry = it->second;
 	}
@@ -301,12 +330,15 @@ const std::unordered_set<BeaconKey, BeaconKey::Hash> BeaconCache::getBeaconKeys(
 {
 	std::unordered_set<BeaconKey, BeaconKey::Hash> result;
 
-	core::util::ScopedReadLock lock(mGlobalCacheLock);
-	for (auto const& beacon : mBeacons)
+	for (auto& shard : mShards)
 	{
-		result.insert(beacon.first);
+		core::util::ScopedReadLock lock(shard.lock);
+		for (auto const& beacon : shard.beacons)
+		{
+			result.insert(beacon.first);
+		}
+		lock.unlock();
 	}
-	lock.unlock();
 
 	return result;
 }
@@ -321,8 +353,11 @@ uint32_t BeaconCache::evictRecordsByAge(const BeaconKey& beaconKey, int64_t minT
 	}
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
+	int64_t oldSize = entry->getTotalNumberOfBytes();
 	uint32_t numRecordsRemoved = entry->removeRecordsOlderThan(minTimestamp);
+	updateCacheSize(beaconKey, *entry, entry->getTotalNumberOfBytes() - oldSize);
 	lock.unlock();
+	mNumEvictedRecords.fetch_add(numRecordsRemoved, std::memory_order_relaxed);
 
 	if (mLogger->isDebugEnabled())
 	{
@@ -343,8 +378,11 @@ uint32_t BeaconCache::evictRecordsByNumber(const BeaconKey& beaconKey, uint32_t
 	}
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
+	int64_t oldSize = entry->getTotalNumberOfBytes();
 	uint32_t numRecordsRemoved = entry->removeOldestRecords(numRecords);
+	updateCacheSize(beaconKey, *entry, entry->getTotalNumberOfBytes() - oldSize);
 	lock.unlock();
+	mNumEvictedRecords.fetch_add(numRecordsRemoved, std::memory_order_relaxed);
 
 	if (mLogger->isDebugEnabled())
 	{
@@ -355,9 +393,131 @@ uint32_t BeaconCache::evictRecordsByNumber(const BeaconKey& beaconKey, uint32_t
 	return numRecordsRemoved;
 }
 
+uint32_t BeaconCache::evictRecordsBySize(int64_t numBytes)
+{
+	// build a heap of all beacons having records to evict, the one with the oldest record on top
+	std::vector<EvictionCandidate> candidates;
+	for (auto& shard : mShards)
+	{
+		core::util::ScopedReadLock lock(shard.lock);
+		for (auto const& beacon : shard.beacons)
+		{
+			std::lock_guard<std::mutex> entryLock(beacon.second->getLock());
+			if (beacon.second->hasRecordsToEvict())
+			{
+				candidates.push_back({ beacon.second->getOldestRecordTimestamp(), beacon.first, beacon.second });
+			}
+		}
+		lock.unlock();
+	}
+	std::make_heap(candidates.begin(), candidates.end());
+
+	int64_t numBytesEvicted = 0;
+	uint32_t numRecordsEvicted = 0;
+	while (numBytesEvicted < numBytes && !candidates.empty())
+	{
+		std::pop_heap(candidates.begin(), candidates.end());
+		auto candidate = candidates.back();
+		candidates.pop_back();
+
+		std::unique_lock<std::mutex> lock(candidate.entry->getLock());
+		if (candidate.entry->isRemovedFromCache())
+		{
+			continue;
+		}
+
+		// evict records of this beacon, as long as they are older than the oldest record of all other beacons
+		int64_t oldSize = candidate.entry->getTotalNumberOfBytes();
+		int64_t newSize = oldSize;
+		std::vector<IBeaconCacheOverflowStore::Record> evictedRecords;
+		while (numBytesEvicted + (oldSize - newSize) < numBytes
+			&& candidate.entry->hasRecordsToEvict()
+			&& (candidates.empty() || candidate.entry->getOldestRecordTimestamp() <= candidates.front().timestamp))
+		{
+			numRecordsEvicted += candidate.entry->removeOldestRecords(1, mOverflowStore != nullptr ? &evictedRecords : nullptr);
+			newSize = candidate.entry->getTotalNumberOfBytes();
+		}
+		updateCacheSize(candidate.beaconKey, *candidate.entry, newSize - oldSize);
+		numBytesEvicted += oldSize - newSize;
+
+		auto hasRecordsToEvict = candidate.entry->hasRecordsToEvict();
+		if (hasRecordsToEvict)
+		{
+			candidate.timestamp = candidate.entry->getOldestRecordTimestamp();
+		}
+		auto header = evictedRecords.empty() ? BeaconHeader() : candidate.entry->getHeader();
+		lock.unlock();
+
+		// writing to the overflow store must not block threads adding or sending data of this beacon
+		if (!evictedRecords.empty())
+		{
+			spillRecords(candidate, header, evictedRecords);
+		}
+
+		if (hasRecordsToEvict)
+		{
+			candidates.push_back(candidate);
+			std::push_heap(candidates.begin(), candidates.end());
+		}
+	}
+
+	mNumEvictedRecords.fetch_add(numRecordsEvicted, std::memory_order_relaxed);
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconCache evictRecordsBySize(numBytes=%" PRId64 ") has evicted %u records (%" PRId64 " bytes)",
+			numBytes, numRecordsEvicted, numBytesEvicted);
+	}
+
+	return numRecordsEvicted;
+}
+
+void BeaconCache::spillRecords(const EvictionCandidate& candidate, const BeaconHeader& header,
+	const std::vector<IBeaconCacheOverflowStore::Record>& records)
+{
+	if (!mOverflowStore->store(candidate.beaconKey, header, records))
+	{
+		if (mLogger->isWarningEnabled())
+		{
+			mLogger->warning("BeaconCache evictRecordsBySize() - discarded %zu records of beacon (sn=%d, seq=%d)",
+				records.size(), candidate.beaconKey.getBeaconId(), candidate.beaconKey.getBeaconSequenceNumber());
+		}
+		return;
+	}
+
+	// the beacon might have been deleted while the records were written, they must not outlive it
+	std::unique_lock<std::mutex> lock(candidate.entry->getLock());
+	auto isRemovedFromCache = candidate.entry->isRemovedFromCache();
+	lock.unlock();
+
+	if (isRemovedFromCache)
+	{
+		mOverflowStore->removeRecords(candidate.beaconKey);
+	}
+}
+
 int64_t BeaconCache::getNumBytesInCache() const
 {
-	return mCacheSizeInBytes;
+	int64_t numBytes = 0;
+	for (auto const& shard : mShards)
+	{
+		numBytes += shard.cacheSizeInBytes;
+	}
+
+	return numBytes;
+}
+
+uint64_t BeaconCache::getNumEvictedRecords() const
+{
+	return mNumEvictedRecords.load(std::memory_order_relaxed);
+}
+
+void BeaconCache::updateCacheSize(const BeaconKey& beaconKey, const BeaconCacheEntry& entry, int64_t numBytes)
+{
+	if (!entry.isRemovedFromCache())
+	{
+		getShard(beaconKey).cacheSizeInBytes += numBytes;
+	}
 }
 
 void BeaconCache::onDataAdded()
@@ -378,8 +538,36 @@ bool BeaconCache::isEmpty(const BeaconKey& beaconKey)
 	}
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
-	bool isEmpty = entry->getTotalNumberOfBytes() == 0;
+	bool isEmpty = entry->getTotalNumberOfBytes() == 0
+		&& (mOverflowStore == nullptr || !mOverflowStore->hasRecords(beaconKey));
 	lock.unlock();
 
 	return isEmpty;
+}
+
+void BeaconCache::setBeaconHeader(const BeaconKey& beaconKey, const BeaconHeader& header)
+{
+	if (mOverflowStore == nullptr)
+	{
+		// the header is only required for records in the overflow store
+		return;
+	}
+
+	auto entry = getCachedEntryOrInsert(beaconKey);
+
+	std::lock_guard<std::mutex> lock(entry->getLock());
+	entry->setHeader(header);
+}
+
+bool BeaconCache::takeRecoveredBeacon(IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon, size_t maxNumBytes)
+{
+	return mOverflowStore != nullptr && mOverflowStore->takeRecoveredBeacon(recoveredBeacon, maxNumBytes);
+}
+
+void BeaconCache::restoreRecoveredBeacon(const IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon)
+{
+	if (mOverflowStore != nullptr)
+	{
+		mOverflowStore->restoreRecoveredBeacon(recoveredBeacon);
+	}
 }
\ No newline at end of file
@@ -20,10 +20,12 @@
 #include "OpenKit/ILogger.h"
 #include "IBeaconCache.h"
 #include "BeaconCacheEntry.h"
+#include "IBeaconCacheOverflowStore.h"
 
 #include "core/util/ScopedReadLock.h"
 #include "core/util/ScopedWriteLock.h"
 
+#include <array>
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
@@ -40,13 +42,20 @@ namespace core
 		/// This cache needs to deal with high concurrency, since it's possible that a lot of threads insert new data concurrently.
 		/// Furthermore two OpenKit internal threads are also accessing the cache.
 		///
+		/// @par
+		/// To keep threads reporting data for different beacons from contending on a single lock, the beacons are
+		/// distributed over a fixed number of shards, each having its own lock and its own size counter.
+		///
 		class BeaconCache : public IBeaconCache
 		{
 		public:
 			///
 			/// Constructor
 			///
-			BeaconCache(std::shared_ptr<openkit::ILogger> logger);
+			/// @param[in] logger to write traces to
+			/// @param[in] overflowStore store for records evicted due to space constraints or @c nullptr
+			///
+			BeaconCache(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCacheOverflowStore> overflowStore = nullptr);
 
 			///
 			/// destructor
@@ -127,11 +136,68 @@ namespace core
 
 			uint32_t evictRecordsByNumber(const BeaconKey& beaconKey, uint32_t numRecords) override;
 
+			uint32_t evictRecordsBySize(int64_t numBytes) override;
+
 			int64_t getNumBytesInCache() const override;
 
 			bool isEmpty(const BeaconKey& beaconKey) override;
 
+			void setBeaconHeader(const BeaconKey& beaconKey, const BeaconHeader& header) override;
+
+			bool takeRecoveredBeacon(IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon, size_t maxNumBytes) override;
+
+			void restoreRecoveredBeacon(const IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon) override;
+
+			///
+			/// Returns the total number of records evicted from this cache so far.
+			///
+			uint64_t getNumEvictedRecords() const;
+
 		private:
+			///
+			/// Number of shards the beacons are distributed to (must be a power of two)
+			///
+			static constexpr size_t NUMBER_OF_SHARDS = 16;
+			static_assert((NUMBER_OF_SHARDS & (NUMBER_OF_SHARDS - 1)) == 0, "NUMBER_OF_SHARDS must be a power of two");
+
+			/// Size of a cache line, used to keep the shards from sharing one
+			static constexpr size_t CACHE_LINE_SIZE = 64;
+
+			///
+			/// Part of the cache holding a subset of all beacons
+			///
+			/// @par
+			/// Each shard is followed by a cache line of padding, so that threads working on different shards
+			/// do not invalidate each other's cache lines.
+			///
+			struct Shard
+			{
+				Shard()
+					: lock()
+					, beacons()
+					, cacheSizeInBytes(0)
+					, padding()
+				{
+				}
+
+				/// Locks the shard's beacons for read and write access
+				core::util::ReadWriteLock lock;
+
+				/// The beacons of this shard (key=beaconID, value=cache entry)
+				std::unordered_map<BeaconKey, std::shared_ptr<BeaconCacheEntry>, BeaconKey::Hash> beacons;
+
+				/// Sum of the data size estimation of the records in this shard
+				std::atomic<int64_t> cacheSizeInBytes;
+
+				/// Padding separating this shard from the next one
+				char padding[CACHE_LINE_SIZE];
+			};
+
+			///
+			/// Returns the shard responsible for the given BeaconKey.
+			///
+			Shard& getShard(const BeaconKey& beaconKey);
+
 			///
 			/// Get cached @ref BeaconCacheEntry or insert new one if nothing exists for given BeaconKey.
 			/// 
@@ -148,6 +214,37 @@ namespace core
 			///
 			std::shared_ptr<BeaconCacheEntry> getCachedEntry(const BeaconKey& beaconKey);
 
+			///
+			/// Beacon which might be evicted by @ref evictRecordsBySize
+			///
+			struct EvictionCandidate
+			{
+				/// Timestamp of the beacon's oldest record
+				int64_t timestamp;
+
+				/// The beacon's key
+				BeaconKey beaconKey;
+
+				/// The beacon's cache entry
+				std::shared_ptr<BeaconCacheEntry> entry;
+
+				///
+				/// Orders candidates, such that the one with the oldest record is on top of a heap.
+				///
+				bool operator<(const EvictionCandidate& other) const
+				{
+					return timestamp > other.timestamp;
+				}
+			};
+
+			///
+			/// Moves records evicted by @ref evictRecordsBySize to the overflow store.
+			///
+			/// Must be called without holding the entry's lock.
+			///
+			void spillRecords(const EvictionCandidate& candidate, const BeaconHeader& header,
+				const std::vector<IBeaconCacheOverflowStore::Record>& records);
+
 			///
 			/// Helper method to extract the data from the provided records.
 			/// 
@@ -156,6 +253,13 @@ namespace core
 			///
 			static std::vector<core::UTF8String> extractData(const std::list<BeaconCacheRecord>& eventData);
 
+			///
+			/// Adds @c numBytes to the cache size, unless the entry has already been removed from the cache.
+			///
+			/// Must only be called while holding the entry's lock.
+			///
+			void updateCacheSize(const BeaconKey& beaconKey, const BeaconCacheEntry& entry, int64_t numBytes);
+
 			///
 			/// Call this method when something was added (size of cache increased).
 			///
@@ -168,14 +272,14 @@ namespace core
 			/// Observers to be notified about data being added
 			std::vector<IObserver*> observers;
 
-			/// Locks the cache for read and write access
-			core::util::ReadWriteLock mGlobalCacheLock;
+			/// Store for records evicted due to space constraints (might be @c nullptr)
+			std::shared_ptr<IBeaconCacheOverflowStore> mOverflowStore;
 
-			/// The central part of the cache are the beacons (key=beaconID, value=
-			std::unordered_map<BeaconKey, std::shared_ptr<BeaconCacheEntry>, BeaconKey::Hash> mBeacons;
+			/// The central part of the cache are the beacons, distributed over the shards
+			std::array<Shard, NUMBER_OF_SHARDS> mShards;
 
-			/// Sum of all record's data size estimation.
-			std::atomic<int64_t> mCacheSizeInBytes;
+			/// Total number of records evicted by any eviction strategy
+			std::atomic<uint64_t> mNumEvictedRecords;
 		};
 	}
 }
@@ -16,6 +16,8 @@
 
 #include "BeaconCacheEntry.h"
 
+#include <algorithm>
+
 using namespace core::caching;
 
 BeaconCacheEntry::BeaconCacheEntry()
@@ -24,7 +26,8 @@ BeaconCacheEntry::BeaconCacheEntry()
 	, mMutex()
 	, mEventDataBeingSent()
 	, mActionDataBeingSent()
-	, mTotalNumBytes(0)
+	, mIsRemovedFromCache(false)
+	, mHeader()
 {
 
 }
@@ -36,14 +39,12 @@ std::mutex& BeaconCacheEntry::getLock()
 
 void BeaconCacheEntry::addEventData(const BeaconCacheRecord& record)
 {
-	mEventData.push_back(record);
-	mTotalNumBytes += record.getDataSizeInBytes();
+	mEventData.add(record.getTimestamp(), record.getData());
 }
 
 void BeaconCacheEntry::addActionData(const BeaconCacheRecord& record)
 {
-	mActionData.push_back(record);
-	mTotalNumBytes += record.getDataSizeInBytes();
+	mActionData.add(record.getTimestamp(), record.getData());
 }
 
 bool BeaconCacheEntry::needsDataCopyBeforeSending() const
@@ -54,10 +55,8 @@ bool BeaconCacheEntry::needsDataCopyBeforeSending() const
 
 void BeaconCacheEntry::copyDataForSending()
 {
-	mActionDataBeingSent.splice(mActionDataBeingSent.begin(), mActionData);
-	mEventDataBeingSent.splice(mEventDataBeingSent.begin(), mEventData);
-
-	mTotalNumBytes = 0;
+	mActionDataBeingSent.prepend(mActionData);
+	mEventDataBeingSent.prepend(mEventData);
 }
 
 bool BeaconCacheEntry::hasDataToSend() const
@@ -81,30 +80,14 @@ const core::UTF8String BeaconCacheEntry::getNextChunk(const core::UTF8String& ch
 	// append the chunk prefix
 	chunk.concatenate(chunkPrefix);
 
-	// append data from both lists
+	// append data from both arenas
 	// note the order is currently important -> event data goes first, then action data
-	chunkifyDataList(chunk, mEventDataBeingSent, maxSize, delimiter);
-	chunkifyDataList(chunk, mActionDataBeingSent, maxSize, delimiter);
+	mEventDataBeingSent.appendToChunk(chunk, maxSize, delimiter);
+	mActionDataBeingSent.appendToChunk(chunk, maxSize, delimiter);
 
 	return chunk;
 }
 
-void BeaconCacheEntry::chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter)
-{
-	auto it = dataBeingSent.begin();
-	while (it != dataBeingSent.end() && chunk.getStringLength() <= maxSize)
-	{
-		// mark the record for sending
-		it->markForSending();
-
-		// append delimiter & data
-		chunk.concatenate(delimiter);
-		chunk.concatenate(it->getData());
-
-		it++;
-	}
-}
-
 void BeaconCacheEntry::removeDataMarkedForSending()
 {
 	if (!hasDataToSend())
@@ -113,35 +96,8 @@ void BeaconCacheEntry::removeDataMarkedForSending()
 		return;
 	}
 
-	auto it = mEventDataBeingSent.begin();
-	while (it != mEventDataBeingSent.end())
-	{
-		if (it->isMarkedForSending())
-		{
-			it = mEventDataBeingSent.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
-
-	if (it == mEventDataBeingSent.end())
-	{
-		// only check action data, if all event data has been traversed, otherwise it's just waste of cpu time
-		it = mActionDataBeingSent.begin();
-		while (it != mActionDataBeingSent.end())
-		{
-			if (it->isMarkedForSending())
-			{
-				it = mActionDataBeingSent.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-	}
+	mEventDataBeingSent.removeMarkedForSending();
+	mActionDataBeingSent.removeMarkedForSending();
 }
 
 void BeaconCacheEntry::resetDataMarkedForSending()
@@ -152,119 +108,129 @@ void BeaconCacheEntry::resetDataMarkedForSending()
 		return;
 	}
 
-	// reset the "sending marks" and in the same traversal count the bytes which are added back
-	int64_t numBytes = 0;
-	for (auto it = mEventDataBeingSent.begin(); it != mEventDataBeingSent.end(); ++it)
-	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
-	}
-
-	for (auto it = mActionDataBeingSent.begin(); it != mActionDataBeingSent.end(); ++it)
-	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
-	}
+	// reset the "sending marks"
+	mEventDataBeingSent.unsetSending();
+	mActionDataBeingSent.unsetSending();
 
 	// merge data
-	mEventData.splice(mEventData.begin(), mEventDataBeingSent);
-	mActionData.splice(mActionData.begin(), mActionDataBeingSent);
-
-	mTotalNumBytes += numBytes;
+	mEventData.prepend(mEventDataBeingSent);
+	mActionData.prepend(mActionDataBeingSent);
 }
 
 int64_t BeaconCacheEntry::getTotalNumberOfBytes() const
 {
-	return mTotalNumBytes;
+	return mEventData.getDataSizeInBytes() + mActionData.getDataSizeInBytes();
 }
 
 int32_t BeaconCacheEntry::removeRecordsOlderThan(int64_t minTimestamp)
 {
-	int32_t numRecordsRemoved = removeRecordsOlderThan(mEventData, minTimestamp);
-	numRecordsRemoved += removeRecordsOlderThan(mActionData, minTimestamp);
-
-	return numRecordsRemoved;
-}
-
-int32_t BeaconCacheEntry::removeRecordsOlderThan(std::list<BeaconCacheRecord>& records, int64_t minTimestamp)
-{
-	int32_t numRecordsRemoved = 0;
-	auto it = records.begin();
-	while (it != records.end())
-	{
-		auto record = *it;
-		if (record.getTimestamp() < minTimestamp)
-		{
-			it = records.erase(it);
-			numRecordsRemoved++;
-		}
-		else
-		{
-			++it;
-		}
-	}
+	int32_t numRecordsRemoved = mEventData.removeRecordsOlderThan(minTimestamp);
+	numRecordsRemoved += mActionData.removeRecordsOlderThan(minTimestamp);
 
 	return numRecordsRemoved;
 }
 
-int32_t BeaconCacheEntry::removeOldestRecords(int32_t numRecords)
+int32_t BeaconCacheEntry::removeOldestRecords(int32_t numRecords, std::vector<IBeaconCacheOverflowStore::Record>* removedRecords)
 {
 	int32_t numRecordsRemoved = 0;
 
-	auto eventsIterator = mEventData.begin();
-	auto actionsIterator = mActionData.begin();
-
-	while (numRecordsRemoved < numRecords && (eventsIterator != mEventData.end() || actionsIterator != mActionData.end()))
+	while (numRecordsRemoved < numRecords && (!mEventData.empty() || !mActionData.empty()))
 	{
-		if (eventsIterator == mEventData.end())
+		bool isActionData;
+		if (mEventData.empty())
 		{
 			// actions is not empty -> remove action
-			actionsIterator = mActionData.erase(actionsIterator);
+			isActionData = true;
 		}
-		else if (actionsIterator == mActionData.end())
+		else if (mActionData.empty())
 		{
 			// events is not empty -> remove event
-			eventsIterator = mEventData.erase(eventsIterator);
+			isActionData = false;
 		}
 		else
 		{
 			// both are not empty -> compare by timestamp and take the older one
-			if ((*actionsIterator).getTimestamp() < (*eventsIterator).getTimestamp())
-			{
-				// first action is older than first event
-				actionsIterator = mActionData.erase(actionsIterator);
-			}
-			else
-			{
-				// first event is older than first action
-				eventsIterator = mEventData.erase(eventsIterator);
-			}
+			isActionData = mActionData.getFirstTimestamp() < mEventData.getFirstTimestamp();
 		}
 
+		auto& data = isActionData ? mActionData : mEventData;
+		if (removedRecords != nullptr)
+		{
+			removedRecords->emplace_back(isActionData, data.getFirstTimestamp(), data.getFirstData());
+		}
+		data.removeFirst();
+
 		numRecordsRemoved++;
 	}
 
 	return numRecordsRemoved;
 }
 
+void BeaconCacheEntry::addRecordsForSending(const std::vector<IBeaconCacheOverflowStore::Record>& records)
+{
+	for (const auto& record : records)
+	{
+		auto& data = record.isActionData ? mActionDataBeingSent : mEventDataBeingSent;
+		data.add(record.timestamp, record.data);
+	}
+}
+
+void BeaconCacheEntry::setHeader(const BeaconHeader& header)
+{
+	mHeader = header;
+}
+
+const BeaconHeader& BeaconCacheEntry::getHeader() const
+{
+	return mHeader;
+}
+
+bool BeaconCacheEntry::hasRecordsToEvict() const
+{
+	return !mEventData.empty() || !mActionData.empty();
+}
+
+int64_t BeaconCacheEntry::getOldestRecordTimestamp() const
+{
+	if (mEventData.empty())
+	{
+		return mActionData.getFirstTimestamp();
+	}
+	if (mActionData.empty())
+	{
+		return mEventData.getFirstTimestamp();
+	}
+
+	// same comparison as in removeOldestRecords
+	return std::min(mActionData.getFirstTimestamp(), mEventData.getFirstTimestamp());
+}
+
+void BeaconCacheEntry::markRemovedFromCache()
+{
+	mIsRemovedFromCache = true;
+}
+
+bool BeaconCacheEntry::isRemovedFromCache() const
+{
+	return mIsRemovedFromCache;
+}
+
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventData() const
 {
-	std::list<BeaconCacheRecord> result = mEventData;
-	return result;
+	return mEventData.getRecords();
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionData() const
 {
-	std::list<BeaconCacheRecord> result = mActionData;
-	return result;
+	return mActionData.getRecords();
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventDataBeingSent() const
 {
-	return mEventDataBeingSent;
+	return mEventDataBeingSent.getRecords();
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionDataBeingSent() const
 {
-	return mActionDataBeingSent;
+	return mActionDataBeingSent.getRecords();
 }
@@ -19,6 +19,9 @@
 
 #include "core/UTF8String.h"
 #include "BeaconCacheRecord.h"
+#include "BeaconCacheRecordArena.h"
+#include "BeaconHeader.h"
+#include "IBeaconCacheOverflowStore.h"
 
 #include <cstdint>
 #include <vector>
@@ -134,9 +137,67 @@ namespace core
 			/// first event's timestamp are equal, the first event is removed.
 			///
 			/// @param[in] numRecords The number of records.
+			/// @param[out] removedRecords If not @c nullptr, the removed records are appended.
 			/// @return Number of actually removed records.
 			///
-			int32_t removeOldestRecords(int32_t numRecords);
+			int32_t removeOldestRecords(int32_t numRecords, std::vector<IBeaconCacheOverflowStore::Record>* removedRecords = nullptr);
+
+			///
+			/// Add records to the event & action data being sent.
+			///
+			/// This is used to page in records which have been moved to the overflow store. Like the data copied by
+			/// @ref copyDataForSending, the records do not count towards @ref getTotalNumberOfBytes.
+			///
+			/// @param[in] records The records to add, oldest first.
+			///
+			void addRecordsForSending(const std::vector<IBeaconCacheOverflowStore::Record>& records);
+
+			///
+			/// Set the header of the beacon this entry belongs to.
+			///
+			/// @param[in] header The beacon's header.
+			///
+			void setHeader(const BeaconHeader& header);
+
+			///
+			/// Get the header of the beacon this entry belongs to.
+			///
+			/// @return The header previously set via @ref setHeader.
+			///
+			const BeaconHeader& getHeader() const;
+
+			///
+			/// Test if there are event or action records, which might be evicted.
+			///
+			/// Records which are currently being sent are not taken into account.
+			///
+			/// @return @c true if there is at least one record to evict, @c false otherwise.
+			///
+			bool hasRecordsToEvict() const;
+
+			///
+			/// Get the timestamp of the record, which is removed next by @ref removeOldestRecords.
+			///
+			/// Must only be called, if @ref hasRecordsToEvict returns @c true.
+			///
+			/// @return Timestamp of the oldest record.
+			///
+			int64_t getOldestRecordTimestamp() const;
+
+			///
+			/// Marks this entry as being removed from the @ref BeaconCache.
+			///
+			/// Since the entry might still be referenced by other threads, this allows them to detect that changes
+			/// to this entry must not be reflected in the cache's statistics anymore.
+			///
+			void markRemovedFromCache();
+
+			///
+			/// Test if this entry has been removed from the @ref BeaconCache.
+			///
+			/// @return @c true if @ref markRemovedFromCache was called, @c false otherwise.
+			///
+			bool isRemovedFromCache() const;
 
 			///
 			/// Get a deep copy of event data.
@@ -177,42 +238,28 @@ namespace core
 			///
 			const core::UTF8String getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
 
-			///
-			/// Iterates (up to the @c maxSize) the provided @c dataBeingSent list and appends the data together with the @c delimiter to the provided @c chunk.
-			/// param[in,out] chunk the chunk to which the data is appended
-			/// param[in] dataBeingSent the list of record containing the data to append
-			/// param[in] maxSize in characters for one chunk. Up to this size data (if available) is appended
-			/// param[in] delimiter the delimiter between data chunks
-			///
-			static void chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter);
-
-			///
-			/// Remove all @ref BeaconCacheRecord from @c records.
-			/// @param[in,out] records list of cache records
-			/// @param[in] minTimestamp The minimum timestamp allowed.
-			/// @return The number of records removed from @c records.
-			///
-			static int32_t removeRecordsOlderThan(std::list<BeaconCacheRecord>& records, int64_t minTimestamp);
-
 		private:
 
-			///	List storing all active event data.
-			std::list<BeaconCacheRecord> mEventData;
+			///	Arena storing all active event data.
+			BeaconCacheRecordArena mEventData;
 
-			///	List storing all active action data.
-			std::list<BeaconCacheRecord> mActionData;
+			///	Arena storing all active action data.
+			BeaconCacheRecordArena mActionData;
 
 			/// Lock object for locking access to session & event data.
 			std::mutex mMutex;
 
-			///	List storing all event data being sent.
-			std::list<BeaconCacheRecord> mEventDataBeingSent;
+			///	Arena storing all event data being sent.
+			BeaconCacheRecordArena mEventDataBeingSent;
+
+			///	Arena storing all action data being sent.
+			BeaconCacheRecordArena mActionDataBeingSent;
 
-			///	List storing all action data being sent.
-			std::list<BeaconCacheRecord> mActionDataBeingSent;
+			/// Flag indicating whether this entry has been removed from the cache.
+			bool mIsRemovedFromCache;
 
-			/// Sum of all record's data size estimation.
-			int64_t mTotalNumBytes;
+			/// Header of the beacon, required to send records stored in the overflow store.
+			BeaconHeader mHeader;
 		};
 	}
 }
@@ -29,7 +29,8 @@ BeaconCacheEvictor::BeaconCacheEvictor
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<IBeaconCache> beaconCache,
 	std::shared_ptr<core::configuration::IBeaconCacheConfiguration> configuration,
-	std::shared_ptr<providers::ITimingProvider> timingProvider
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::util::SharedExecutor> executor
 )
 : BeaconCacheEvictor
 (
@@ -51,7 +52,8 @@ BeaconCacheEvictor::BeaconCacheEvictor
 			configuration,
 			std::bind(&BeaconCacheEvictor::isStopRequested, this)
 		)
-	}
+	},
+	executor
 )
 {
 }
@@ -60,14 +62,21 @@ BeaconCacheEvictor::BeaconCacheEvictor
 (
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<IBeaconCache> beaconCache,
-	std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies
+	std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+	std::shared_ptr<core::util::SharedExecutor> executor
 )
 	: mLogger(logger)
 	, mBeaconCache(beaconCache)
 	, mStrategies(strategies)
 	, mEvictionThread(new core::util::ThreadSurrogate())
+	, mExecutor(executor)
+	, mEvictionTask(executor == nullptr
+		? nullptr
+		: std::make_shared<core::util::ExecutorTask>(*executor, std::bind(&BeaconCacheEvictor::cacheEvictionTaskFunc, this)))
 	, mStop(false)
 	, mRecordAdded(false)
+	, mNumUpdates(0)
+	, mNumWakeups(0)
 	, mMutex()
 	, mConditionVariable()
 {
@@ -75,6 +84,29 @@ BeaconCacheEvictor::BeaconCacheEvictor
 
 bool BeaconCacheEvictor::start()
 {
+	if (mEvictionTask != nullptr)
+	{
+		if (mEvictionTask->isStarted())
+		{
+			if (mLogger->isDebugEnabled())
+			{
+				mLogger->debug("BeaconCacheEvictor start() - Not starting BeaconCacheEviction task, since it's already started");
+			}
+
+			return false;
+		}
+
+		mBeaconCache->addObserver(this);
+		mEvictionTask->start(getMillisUntilNextExecution());
+
+		if (mLogger->isDebugEnabled())
+		{
+			mLogger->debug("BeaconCacheEvictor start() - BeaconCacheEviction task started.");
+		}
+
+		return true;
+	}
+
 	if (mEvictionThread->isStarted())
 	{
 		// eviction thread already started
@@ -126,6 +158,11 @@ bool BeaconCacheEvictor::stop(std::chrono::milliseconds timeout)
 		mConditionVariable.notify_all();
 	}
 
+	if (mEvictionTask != nullptr)
+	{
+		return mEvictionTask->stop(timeout.count());
+	}
+
 	return mEvictionThread->join(timeout.count());
 }
 
@@ -138,15 +175,74 @@ bool BeaconCacheEvictor::isStopRequested()
 
 bool BeaconCacheEvictor::isAlive()
 {
+	if (mEvictionTask != nullptr)
+	{
+		return mEvictionTask->isAlive();
+	}
+
 	return mEvictionThread->isAlive();
 }
 
 void BeaconCacheEvictor::update()
 {
-	std::unique_lock<std::mutex> lock(mMutex);
+	mNumUpdates.fetch_add(1, std::memory_order_relaxed);
+
+	if (mRecordAdded.load(std::memory_order_relaxed) || !isExecutionRequired())
+	{
+		// either a wakeup is already pending or there is nothing to evict
+		return;
+	}
+
+	if (!mRecordAdded.exchange(true))
+	{
+		if (mEvictionTask != nullptr)
+		{
+			mEvictionTask->wakeup();
+			return;
+		}
 
-	mRecordAdded = true;
-	mConditionVariable.notify_all();
+		// the mutex is required to not miss the eviction thread, which is about to wait
+		std::unique_lock<std::mutex> lock(mMutex);
+		mConditionVariable.notify_all();
+	}
+}
+
+uint64_t BeaconCacheEvictor::getNumUpdates() const
+{
+	return mNumUpdates.load(std::memory_order_relaxed);
+}
+
+uint64_t BeaconCacheEvictor::getNumWakeups() const
+{
+	return mNumWakeups.load(std::memory_order_relaxed);
+}
+
+bool BeaconCacheEvictor::isExecutionRequired()
+{
+	for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
+	{
+		if (it->get()->isExecutionRequired())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int64_t BeaconCacheEvictor::getMillisUntilNextExecution()
+{
+	int64_t millisUntilNextExecution = -1;
+	for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
+	{
+		int64_t millis = it->get()->getMillisUntilNextExecution();
+		if (millis >= 0 && (millisUntilNextExecution < 0 || millis < millisUntilNextExecution))
+		{
+			millisUntilNextExecution = millis;
+		}
+	}
+
+	return millisUntilNextExecution;
 }
 
 void BeaconCacheEvictor::cacheEvictionLoopFunc()
@@ -163,11 +259,18 @@ void BeaconCacheEvictor::cacheEvictionLoopFunc()
 
 	while (true)
 	{
+		int64_t millisUntilNextExecution = getMillisUntilNextExecution();
 		{
 			std::unique_lock<std::mutex> lock(mMutex);
-			while (!mRecordAdded && !mStop)
+			if (millisUntilNextExecution < 0)
+			{
+				mConditionVariable.wait(lock, [this]() { return mRecordAdded || mStop; });
+			}
+			else
 			{
-				mConditionVariable.wait(lock);
+				// time driven strategies are executed when the timeout elapsed
+				mConditionVariable.wait_for(lock, std::chrono::milliseconds(millisUntilNextExecution),
+					[this]() { return mRecordAdded || mStop; });
 			}
 
 			if (mStop)
@@ -180,16 +283,40 @@ void BeaconCacheEvictor::cacheEvictionLoopFunc()
 			mRecordAdded = false;
 		}
 
-		// a new record has been added to the cache
+		mNumWakeups.fetch_add(1, std::memory_order_relaxed);
+
+		// a new record has been added to the cache or a time driven strategy is due
 		// run all eviction strategies, to perform cache cleanup
-		for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
-		{
-			it->get()->execute();
-		}
+		executeStrategies();
 	}
 
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCacheEvictor cacheEvictionLoopFunc() - BeaconCacheEviction thread is stopped.");
 	}
-}
\ No newline at end of file
+}
+
+int64_t BeaconCacheEvictor::cacheEvictionTaskFunc()
+{
+	if (isStopRequested())
+	{
+		return core::util::ExecutorTask::WAIT_FOR_WAKEUP;
+	}
+
+	// reset the added flag before evicting, so that records added meanwhile trigger another run
+	mRecordAdded = false;
+	mNumWakeups.fetch_add(1, std::memory_order_relaxed);
+
+	executeStrategies();
+
+	auto millisUntilNextExecution = getMillisUntilNextExecution();
+	return millisUntilNextExecution < 0 ? core::util::ExecutorTask::WAIT_FOR_WAKEUP : millisUntilNextExecution;
+}
+
+void BeaconCacheEvictor::executeStrategies()
+{
+	for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
+	{
+		it->get()->execute();
+	}
+}
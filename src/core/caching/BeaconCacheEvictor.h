@@ -23,9 +23,12 @@
 #include "IBeaconCacheEvictor.h"
 #include "IBeaconCacheEvictionStrategy.h"
 #include "core/configuration/IBeaconCacheConfiguration.h"
+#include "core/util/ExecutorTask.h"
+#include "core/util/SharedExecutor.h"
 #include "core/util/ThreadSurrogate.h"
 #include "providers/ITimingProvider.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <mutex>
@@ -38,6 +41,15 @@ namespace core
 		///
 		/// Class responsible for handling an eviction thread, to ensure @ref BeaconCache stays in configured boundaries.
 		///
+		/// @par
+		/// The eviction thread is only woken up, if a strategy requires execution due to data being added to the cache
+		/// (e.g. the upper size bound is exceeded) or if a time driven strategy is due. Notifications received while a
+		/// wakeup is already pending are coalesced, without acquiring any lock.
+		///
+		/// @par
+		/// If a @ref core::util::SharedExecutor is given, the eviction strategies are run as a task on the
+		/// executor's worker threads, instead of on a dedicated eviction thread.
+		///
 		class BeaconCacheEvictor
 			: public IBeaconCacheEvictor
 			, IObserver
@@ -50,13 +62,15 @@ namespace core
 			/// @param[in] beaconCache    The Beacon cache to check if entries need to be evicted
 			/// @param[in] configuration  Beacon cache configuration
 			/// @param[in] timingProvider Timing provider required for time retrieval
+			/// @param[in] executor       Executor running the eviction or @c nullptr to use a dedicated thread
 			///
 			BeaconCacheEvictor
 			(
 				std::shared_ptr<openkit::ILogger> logger,
 				std::shared_ptr<IBeaconCache> beaconCache,
 				std::shared_ptr<configuration::IBeaconCacheConfiguration> configuration,
-				std::shared_ptr<providers::ITimingProvider> timingProvider
+				std::shared_ptr<providers::ITimingProvider> timingProvider,
+				std::shared_ptr<core::util::SharedExecutor> executor = nullptr
 			);
 
 			///
@@ -64,12 +78,14 @@ namespace core
 			/// @param[in] logger to write traces to
 			/// @param[in] beaconCache The Beacon cache to check if entries need to be evicted
 			/// @param[in] strategies  Strategies passed to the actual Runnable.
+			/// @param[in] executor    Executor running the eviction or @c nullptr to use a dedicated thread
 			///
 			BeaconCacheEvictor
 			(
 				std::shared_ptr<openkit::ILogger> logger,
 				std::shared_ptr<IBeaconCache> beaconCache,
-				std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies
+				std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+				std::shared_ptr<core::util::SharedExecutor> executor = nullptr
 			);
 
 			///
@@ -114,6 +130,41 @@ namespace core
 			////
 			void cacheEvictionLoopFunc();
 
+			///
+			/// Returns the number of notifications about records being added to the cache.
+			///
+			uint64_t getNumUpdates() const;
+
+			///
+			/// Returns the number of times the eviction thread woke up to execute the eviction strategies.
+			///
+			uint64_t getNumWakeups() const;
+
+		private:
+			///
+			/// Checks if any strategy needs to be executed due to data being added to the cache.
+			///
+			bool isExecutionRequired();
+
+			///
+			/// Returns the number of milliseconds until the next time driven strategy execution or a negative value
+			/// if no strategy is time driven.
+			///
+			int64_t getMillisUntilNextExecution();
+
+			///
+			/// Runs the eviction strategies once, when running on a @ref core::util::SharedExecutor.
+			///
+			/// @return the number of milliseconds until the next run is due or
+			///   @ref core::util::ExecutorTask::WAIT_FOR_WAKEUP
+			///
+			int64_t cacheEvictionTaskFunc();
+
+			///
+			/// Runs all eviction strategies.
+			///
+			void executeStrategies();
+
 		private:
 			/// Logger to write traces to
 			std::shared_ptr<openkit::ILogger> mLogger;
@@ -127,11 +178,23 @@ namespace core
 			/// Thread being responsible for evicting records from the cache, based on an eviction strategy
 			std::unique_ptr<core::util::ThreadSurrogate> mEvictionThread;
 
+			/// Executor running the eviction task or @c nullptr if the eviction thread is used
+			std::shared_ptr<core::util::SharedExecutor> mExecutor;
+
+			/// Task evicting records from the cache, if an executor is used
+			std::shared_ptr<core::util::ExecutorTask> mEvictionTask;
+
 			/// Flag to stop the eviction thread
 			bool mStop;
 
 			/// Flag, which indicates that a new record was added to the cache, thus we need to execute the eviction strategies
-			bool mRecordAdded;
+			std::atomic<bool> mRecordAdded;
+
+			/// Number of notifications about records being added
+			std::atomic<uint64_t> mNumUpdates;
+
+			/// Number of eviction thread wakeups
+			std::atomic<uint64_t> mNumWakeups;
 
 			/// Mutex for condition variable
 			std::mutex mMutex;
@@ -0,0 +1,750 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BeaconCacheOverflowStore.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <inttypes.h> // for PRIu64 macro
+#include <limits>
+
+#if defined(_WIN32) || defined(WIN32)
+#include <Windows.h>
+#endif
+
+using namespace core::caching;
+
+static constexpr char SEGMENT_FILE_PREFIX[] = "beacons-";
+static constexpr char SEGMENT_FILE_SUFFIX[] = ".seg";
+static constexpr char MANIFEST_FILE_NAME[] = "beacons.manifest";
+
+// each segment file starts with the magic bytes followed by the format version
+static constexpr char SEGMENT_MAGIC[] = { 'O', 'K', 'B', 'C' };
+static constexpr uint32_t SEGMENT_FORMAT_VERSION = 1;
+static constexpr size_t SEGMENT_HEADER_SIZE = sizeof(SEGMENT_MAGIC) + sizeof(uint32_t);
+
+// each frame starts with its size (excluding the size itself), the frame type and the store key
+static constexpr size_t FRAME_SIZE_FIELD_SIZE = sizeof(uint32_t);
+static constexpr size_t FRAME_COMMON_SIZE = sizeof(uint8_t) + sizeof(uint32_t) + 2 * sizeof(int32_t);
+
+static constexpr uint8_t FRAME_TYPE_HEADER = 1;
+static constexpr uint8_t FRAME_TYPE_EVENT_DATA = 2;
+static constexpr uint8_t FRAME_TYPE_ACTION_DATA = 3;
+static constexpr uint8_t FRAME_TYPE_REMOVED = 4;
+static constexpr uint8_t FRAME_TYPE_REMOVED_UNTIL = 5;
+
+static constexpr int64_t MIN_SEGMENT_SIZE_IN_BYTES = 4 * 1024;
+static constexpr int64_t MAX_SEGMENT_SIZE_IN_BYTES = 8 * 1024 * 1024;
+
+static void appendUInt(std::string& buffer, uint64_t value, size_t numBytes)
+{
+	// little endian, independent of the platform
+	for (size_t i = 0; i < numBytes; i++)
+	{
+		buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+	}
+}
+
+static uint64_t readUInt(const char* buffer, size_t numBytes)
+{
+	uint64_t value = 0;
+	for (size_t i = 0; i < numBytes; i++)
+	{
+		value |= static_cast<uint64_t>(static_cast<uint8_t>(buffer[i])) << (8 * i);
+	}
+	return value;
+}
+
+static void appendFrameStart(std::string& buffer, size_t frameSize, uint8_t type, uint32_t runID, int32_t beaconID, int32_t sequenceNumber)
+{
+	appendUInt(buffer, static_cast<uint32_t>(FRAME_COMMON_SIZE + frameSize), sizeof(uint32_t));
+	appendUInt(buffer, type, sizeof(uint8_t));
+	appendUInt(buffer, runID, sizeof(uint32_t));
+	appendUInt(buffer, static_cast<uint32_t>(beaconID), sizeof(int32_t));
+	appendUInt(buffer, static_cast<uint32_t>(sequenceNumber), sizeof(int32_t));
+}
+
+static bool readFrame(std::istream& input, std::string& frame)
+{
+	char sizeBuffer[FRAME_SIZE_FIELD_SIZE];
+	if (!input.read(sizeBuffer, FRAME_SIZE_FIELD_SIZE))
+	{
+		return false;
+	}
+
+	auto frameSize = static_cast<size_t>(readUInt(sizeBuffer, FRAME_SIZE_FIELD_SIZE));
+	if (frameSize < FRAME_COMMON_SIZE)
+	{
+		return false;
+	}
+
+	frame.resize(frameSize);
+	return static_cast<bool>(input.read(&frame[0], static_cast<std::streamsize>(frameSize)));
+}
+
+static IBeaconCacheOverflowStore::Record parseRecordFrame(const std::string& frame)
+{
+	const char* data = frame.data();
+	auto type = static_cast<uint8_t>(readUInt(data, sizeof(uint8_t)));
+	auto timestamp = static_cast<int64_t>(readUInt(data + FRAME_COMMON_SIZE, sizeof(int64_t)));
+	auto dataOffset = FRAME_COMMON_SIZE + sizeof(int64_t);
+
+	return IBeaconCacheOverflowStore::Record(
+		type == FRAME_TYPE_ACTION_DATA,
+		timestamp,
+		core::UTF8String(frame.substr(dataOffset))
+	);
+}
+
+static BeaconHeader parseHeaderFrame(const std::string& frame)
+{
+	const char* data = frame.data() + FRAME_COMMON_SIZE;
+
+	BeaconHeader header;
+	header.deviceID = static_cast<int64_t>(readUInt(data, sizeof(int64_t)));
+	data += sizeof(int64_t);
+	header.sessionNumber = static_cast<int32_t>(readUInt(data, sizeof(int32_t)));
+	data += sizeof(int32_t);
+	auto ipLength = static_cast<size_t>(readUInt(data, sizeof(uint32_t)));
+	data += sizeof(uint32_t);
+
+	auto ipOffset = static_cast<size_t>(data - frame.data());
+	header.clientIPAddress = core::UTF8String(frame.substr(ipOffset, ipLength));
+	header.beaconData = core::UTF8String(frame.substr(ipOffset + ipLength));
+
+	return header;
+}
+
+BeaconCacheOverflowStore::BeaconCacheOverflowStore(std::shared_ptr<openkit::ILogger> logger, const std::string& directory, int64_t maxSizeInBytes)
+	: mLogger(logger)
+	, mDirectory(directory)
+	, mMaxSizeInBytes(maxSizeInBytes)
+	, mMaxSegmentSizeInBytes(std::min(std::max(maxSizeInBytes / 8, MIN_SEGMENT_SIZE_IN_BYTES), MAX_SEGMENT_SIZE_IN_BYTES))
+	, mMutex()
+	, mIsOpen(false)
+	, mRunID(0)
+	, mSegments()
+	, mActiveSegment()
+	, mSizeInBytes(0)
+	, mBeacons()
+{
+}
+
+bool BeaconCacheOverflowStore::open()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// the manifest contains the ID of the oldest segment and the ID of the last process
+	uint64_t firstSegmentID = 0;
+	uint32_t lastRunID = 0;
+	std::ifstream manifest(getManifestFileName());
+	if (manifest)
+	{
+		manifest >> firstSegmentID >> lastRunID;
+	}
+	manifest.close();
+
+	recover(firstSegmentID);
+	for (auto& beacon : mBeacons)
+	{
+		lastRunID = std::max(lastRunID, std::get<0>(beacon.first));
+	}
+	mRunID = lastRunID + 1;
+
+	// never append to segments of previous processes, they might end with an incomplete frame
+	mIsOpen = rollOver() && writeManifest();
+	if (!mIsOpen)
+	{
+		if (mLogger->isWarningEnabled())
+		{
+			mLogger->warning("BeaconCacheOverflowStore open() - directory '%s' is not accessible", mDirectory.c_str());
+		}
+	}
+	else if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconCacheOverflowStore open() - recovered %zu beacons (%" PRId64 " bytes) from '%s'",
+			mBeacons.size(), mSizeInBytes, mDirectory.c_str());
+	}
+
+	return mIsOpen;
+}
+
+bool BeaconCacheOverflowStore::store(const BeaconKey& beaconKey, const BeaconHeader& header, const std::vector<Record>& records)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return storeInternal(toStoreKey(mRunID, beaconKey), header, records);
+}
+
+bool BeaconCacheOverflowStore::hasRecords(const BeaconKey& beaconKey)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mBeacons.find(toStoreKey(mRunID, beaconKey)) != mBeacons.end();
+}
+
+std::vector<IBeaconCacheOverflowStore::Record> BeaconCacheOverflowStore::takeRecords(const BeaconKey& beaconKey, size_t maxNumBytes)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return takeRecordsInternal(toStoreKey(mRunID, beaconKey), maxNumBytes);
+}
+
+void BeaconCacheOverflowStore::removeRecords(const BeaconKey& beaconKey)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	removeRecordsInternal(toStoreKey(mRunID, beaconKey));
+}
+
+bool BeaconCacheOverflowStore::takeRecoveredBeacon(RecoveredBeacon& recoveredBeacon, size_t maxNumBytes)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	for (auto it = mBeacons.begin(); it != mBeacons.end(); it = mBeacons.begin())
+	{
+		// beacons of the current process are sorted last
+		auto key = it->first;
+		if (std::get<0>(key) == mRunID)
+		{
+			return false;
+		}
+
+		if (!it->second.hasHeader || it->second.header.beaconData.empty())
+		{
+			// without header the records cannot be sent
+			removeRecordsInternal(key);
+			continue;
+		}
+
+		auto header = it->second.header;
+		auto records = takeRecordsInternal(key, maxNumBytes);
+		if (records.empty())
+		{
+			// none of the records could be read
+			continue;
+		}
+
+		recoveredBeacon.runID = std::get<0>(key);
+		recoveredBeacon.beaconKey = BeaconKey(std::get<1>(key), std::get<2>(key));
+		recoveredBeacon.header = header;
+		recoveredBeacon.records = std::move(records);
+		return true;
+	}
+
+	return false;
+}
+
+void BeaconCacheOverflowStore::restoreRecoveredBeacon(const RecoveredBeacon& recoveredBeacon)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	storeInternal(toStoreKey(recoveredBeacon.runID, recoveredBeacon.beaconKey), recoveredBeacon.header, recoveredBeacon.records);
+}
+
+int64_t BeaconCacheOverflowStore::getSizeInBytes()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mSizeInBytes;
+}
+
+BeaconCacheOverflowStore::StoreKey BeaconCacheOverflowStore::toStoreKey(uint32_t runID, const BeaconKey& beaconKey)
+{
+	return StoreKey(runID, beaconKey.getBeaconId(), beaconKey.getBeaconSequenceNumber());
+}
+
+bool BeaconCacheOverflowStore::storeInternal(const StoreKey& key, const BeaconHeader& header, const std::vector<Record>& records)
+{
+	if (!mIsOpen || records.empty())
+	{
+		return false;
+	}
+
+	// an empty header is not stored, it might still be set by subsequent calls
+	auto& beacon = mBeacons[key];
+	if (!beacon.hasHeader && !header.beaconData.empty())
+	{
+		beacon.header = header;
+		beacon.hasHeader = true;
+	}
+
+	// serialize all frames up front, so that they are written with a single call
+	std::string frames;
+	std::vector<size_t> recordFrameOffsets;
+	auto hasHeader = beacon.hasHeader;
+	auto beaconHeader = beacon.header;
+	auto isHeaderWritten = hasHeader
+		&& (beacon.headerSegmentID != mSegments.back().id || mSegments.back().sizeInBytes >= mMaxSegmentSizeInBytes);
+	if (isHeaderWritten)
+	{
+		// each segment containing records of a beacon also contains its header, in case older segments are deleted
+		const auto& ip = beaconHeader.clientIPAddress.getStringData();
+		const auto& data = beaconHeader.beaconData.getStringData();
+		appendFrameStart(frames, sizeof(int64_t) + sizeof(int32_t) + sizeof(uint32_t) + ip.size() + data.size(),
+			FRAME_TYPE_HEADER, std::get<0>(key), std::get<1>(key), std::get<2>(key));
+		appendUInt(frames, static_cast<uint64_t>(beaconHeader.deviceID), sizeof(int64_t));
+		appendUInt(frames, static_cast<uint32_t>(beaconHeader.sessionNumber), sizeof(int32_t));
+		appendUInt(frames, ip.size(), sizeof(uint32_t));
+		frames.append(ip);
+		frames.append(data);
+	}
+	for (const auto& record : records)
+	{
+		const auto& data = record.data.getStringData();
+		recordFrameOffsets.push_back(frames.size());
+		appendFrameStart(frames, sizeof(int64_t) + data.size(),
+			record.isActionData ? FRAME_TYPE_ACTION_DATA : FRAME_TYPE_EVENT_DATA, std::get<0>(key), std::get<1>(key), std::get<2>(key));
+		appendUInt(frames, static_cast<uint64_t>(record.timestamp), sizeof(int64_t));
+		frames.append(data);
+	}
+
+	std::vector<RecordLocation> locations;
+	if (!append(frames, recordFrameOffsets, locations))
+	{
+		// the beacon might have been removed from the index while making room
+		auto it = mBeacons.find(key);
+		if (it != mBeacons.end() && it->second.records.empty())
+		{
+			mBeacons.erase(it);
+		}
+		return false;
+	}
+
+	// look up the beacon again, since deleting old segments might have removed it
+	auto& storedBeacon = mBeacons[key];
+	if (!storedBeacon.hasHeader && hasHeader)
+	{
+		storedBeacon.header = beaconHeader;
+		storedBeacon.hasHeader = true;
+	}
+	if (isHeaderWritten)
+	{
+		storedBeacon.headerSegmentID = mSegments.back().id;
+	}
+	storedBeacon.records.insert(storedBeacon.records.end(), locations.begin(), locations.end());
+
+	return true;
+}
+
+std::vector<IBeaconCacheOverflowStore::Record> BeaconCacheOverflowStore::takeRecordsInternal(const StoreKey& key, size_t maxNumBytes)
+{
+	std::vector<Record> result;
+
+	auto it = mBeacons.find(key);
+	if (it == mBeacons.end())
+	{
+		return result;
+	}
+
+	// take the oldest records, as long as they fit into the given size (but at least one)
+	const auto& locations = it->second.records;
+	size_t numRecords = 0;
+	size_t numBytes = 0;
+	while (numRecords < locations.size() && (numRecords == 0 || numBytes + locations[numRecords].size <= maxNumBytes))
+	{
+		numBytes += locations[numRecords].size;
+		numRecords++;
+	}
+
+	std::ifstream segmentFile;
+	uint64_t openSegmentID = std::numeric_limits<uint64_t>::max();
+	std::string frame;
+	for (auto location = locations.begin(); location != locations.begin() + numRecords; ++location)
+	{
+		if (location->segmentID != openSegmentID)
+		{
+			if (location->segmentID == mSegments.back().id)
+			{
+				mActiveSegment.flush();
+			}
+			segmentFile.close();
+			segmentFile.clear();
+			segmentFile.open(getSegmentFileName(location->segmentID), std::ios::binary);
+			openSegmentID = location->segmentID;
+		}
+
+		segmentFile.seekg(static_cast<std::streamoff>(location->offset));
+		if (readFrame(segmentFile, frame) && frame.size() + FRAME_SIZE_FIELD_SIZE == location->size)
+		{
+			result.push_back(parseRecordFrame(frame));
+		}
+		else if (mLogger->isWarningEnabled())
+		{
+			mLogger->warning("BeaconCacheOverflowStore takeRecords() - failed to read record from segment %" PRIu64, location->segmentID);
+		}
+	}
+
+	removeFirstRecordsInternal(key, numRecords);
+
+	return result;
+}
+
+void BeaconCacheOverflowStore::removeRecordsInternal(const StoreKey& key)
+{
+	auto it = mBeacons.find(key);
+	if (it == mBeacons.end())
+	{
+		return;
+	}
+
+	for (const auto& location : it->second.records)
+	{
+		releaseRecord(location.segmentID);
+	}
+	mBeacons.erase(it);
+
+	// the marker ensures that the records are not recovered again
+	std::string frame;
+	appendFrameStart(frame, 0, FRAME_TYPE_REMOVED, std::get<0>(key), std::get<1>(key), std::get<2>(key));
+	std::vector<RecordLocation> locations;
+	append(frame, {}, locations);
+
+	deleteUnusedSegments();
+}
+
+void BeaconCacheOverflowStore::removeFirstRecordsInternal(const StoreKey& key, size_t numRecords)
+{
+	auto it = mBeacons.find(key);
+	if (it == mBeacons.end() || numRecords == 0)
+	{
+		return;
+	}
+
+	auto& records = it->second.records;
+	if (numRecords >= records.size())
+	{
+		removeRecordsInternal(key);
+		return;
+	}
+
+	auto lastRemoved = records[numRecords - 1];
+	for (size_t i = 0; i < numRecords; i++)
+	{
+		releaseRecord(records[i].segmentID);
+	}
+	records.erase(records.begin(), records.begin() + numRecords);
+
+	// the marker identifies the last removed record, since older segments might be deleted in the meantime
+	std::string frame;
+	appendFrameStart(frame, sizeof(uint64_t) + sizeof(uint64_t), FRAME_TYPE_REMOVED_UNTIL,
+		std::get<0>(key), std::get<1>(key), std::get<2>(key));
+	appendUInt(frame, lastRemoved.segmentID, sizeof(uint64_t));
+	appendUInt(frame, lastRemoved.offset, sizeof(uint64_t));
+	std::vector<RecordLocation> locations;
+	append(frame, {}, locations);
+
+	deleteUnusedSegments();
+}
+
+void BeaconCacheOverflowStore::recover(uint64_t firstSegmentID)
+{
+	uint32_t maxRunID = 0;
+	for (auto segmentID = firstSegmentID; recoverSegment(segmentID, maxRunID); segmentID++)
+	{
+		// segments are numbered consecutively, the first missing one ends the recovery
+	}
+
+	// beacons without records, e.g. having only a header, are irrelevant
+	for (auto it = mBeacons.begin(); it != mBeacons.end();)
+	{
+		if (it->second.records.empty())
+		{
+			it = mBeacons.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+}
+
+bool BeaconCacheOverflowStore::recoverSegment(uint64_t segmentID, uint32_t& maxRunID)
+{
+	std::ifstream segmentFile(getSegmentFileName(segmentID), std::ios::binary);
+	if (!segmentFile)
+	{
+		return false;
+	}
+
+	Segment segment = { segmentID, 0, 0 };
+
+	char header[SEGMENT_HEADER_SIZE];
+	if (segmentFile.read(header, SEGMENT_HEADER_SIZE)
+		&& std::equal(SEGMENT_MAGIC, SEGMENT_MAGIC + sizeof(SEGMENT_MAGIC), header)
+		&& readUInt(header + sizeof(SEGMENT_MAGIC), sizeof(uint32_t)) == SEGMENT_FORMAT_VERSION)
+	{
+		uint64_t offset = SEGMENT_HEADER_SIZE;
+		std::string frame;
+		while (readFrame(segmentFile, frame))
+		{
+			const char* data = frame.data();
+			auto type = static_cast<uint8_t>(readUInt(data, sizeof(uint8_t)));
+			auto runID = static_cast<uint32_t>(readUInt(data + 1, sizeof(uint32_t)));
+			auto beaconID = static_cast<int32_t>(readUInt(data + 5, sizeof(int32_t)));
+			auto sequenceNumber = static_cast<int32_t>(readUInt(data + 9, sizeof(int32_t)));
+			StoreKey key(runID, beaconID, sequenceNumber);
+			maxRunID = std::max(maxRunID, runID);
+
+			auto frameSize = static_cast<uint32_t>(frame.size() + FRAME_SIZE_FIELD_SIZE);
+			switch (type)
+			{
+			case FRAME_TYPE_HEADER:
+			{
+				auto& beacon = mBeacons[key];
+				beacon.header = parseHeaderFrame(frame);
+				beacon.hasHeader = true;
+				beacon.headerSegmentID = segmentID;
+				break;
+			}
+			case FRAME_TYPE_EVENT_DATA:
+			case FRAME_TYPE_ACTION_DATA:
+				mBeacons[key].records.push_back({ segmentID, offset, frameSize });
+				segment.numRecords++;
+				break;
+			case FRAME_TYPE_REMOVED:
+			{
+				auto it = mBeacons.find(key);
+				if (it != mBeacons.end())
+				{
+					for (const auto& location : it->second.records)
+					{
+						if (location.segmentID == segmentID)
+						{
+							segment.numRecords--;
+						}
+						else
+						{
+							releaseRecord(location.segmentID);
+						}
+					}
+					mBeacons.erase(it);
+				}
+				break;
+			}
+			case FRAME_TYPE_REMOVED_UNTIL:
+			{
+				auto it = mBeacons.find(key);
+				if (it != mBeacons.end() && frame.size() >= FRAME_COMMON_SIZE + 2 * sizeof(uint64_t))
+				{
+					// records are stored in the order of their location
+					auto lastSegmentID = readUInt(data + FRAME_COMMON_SIZE, sizeof(uint64_t));
+					auto lastOffset = readUInt(data + FRAME_COMMON_SIZE + sizeof(uint64_t), sizeof(uint64_t));
+					auto& records = it->second.records;
+					auto end = std::find_if(records.begin(), records.end(),
+						[lastSegmentID, lastOffset](const RecordLocation& location)
+						{
+							return location.segmentID > lastSegmentID
+								|| (location.segmentID == lastSegmentID && location.offset > lastOffset);
+						});
+					for (auto location = records.begin(); location != end; ++location)
+					{
+						if (location->segmentID == segmentID)
+						{
+							segment.numRecords--;
+						}
+						else
+						{
+							releaseRecord(location->segmentID);
+						}
+					}
+					records.erase(records.begin(), end);
+				}
+				break;
+			}
+			default:
+				// unknown frame type - skip it
+				break;
+			}
+
+			offset += frameSize;
+		}
+	}
+
+	segmentFile.clear();
+	segmentFile.seekg(0, std::ios::end);
+	segment.sizeInBytes = static_cast<int64_t>(segmentFile.tellg());
+	mSegments.push_back(segment);
+	mSizeInBytes += segment.sizeInBytes;
+
+	return true;
+}
+
+bool BeaconCacheOverflowStore::append(const std::string& frames, const std::vector<size_t>& recordFrameOffsets, std::vector<RecordLocation>& locations)
+{
+	auto numBytes = static_cast<int64_t>(frames.size());
+	if (numBytes + static_cast<int64_t>(SEGMENT_HEADER_SIZE) > mMaxSizeInBytes)
+	{
+		return false;
+	}
+
+	if (mSegments.back().sizeInBytes >= mMaxSegmentSizeInBytes && !rollOver())
+	{
+		return false;
+	}
+
+	// make room by deleting the oldest segments (but never the active one)
+	while (mSizeInBytes + numBytes > mMaxSizeInBytes && mSegments.size() > 1)
+	{
+		deleteOldestSegment();
+	}
+	if (mSizeInBytes + numBytes > mMaxSizeInBytes)
+	{
+		return false;
+	}
+
+	auto& segment = mSegments.back();
+	mActiveSegment.write(frames.data(), static_cast<std::streamsize>(frames.size()));
+	mActiveSegment.flush();
+	if (!mActiveSegment)
+	{
+		if (mLogger->isWarningEnabled())
+		{
+			mLogger->warning("BeaconCacheOverflowStore append() - failed to write segment %" PRIu64, segment.id);
+		}
+		// the segment's content is undefined from here on, so continue with a new one
+		mActiveSegment.clear();
+		rollOver();
+		return false;
+	}
+
+	for (auto offset : recordFrameOffsets)
+	{
+		auto frameSize = static_cast<uint32_t>(readUInt(frames.data() + offset, FRAME_SIZE_FIELD_SIZE) + FRAME_SIZE_FIELD_SIZE);
+		locations.push_back({ segment.id, static_cast<uint64_t>(segment.sizeInBytes) + offset, frameSize });
+	}
+	segment.sizeInBytes += numBytes;
+	segment.numRecords += recordFrameOffsets.size();
+	mSizeInBytes += numBytes;
+
+	return true;
+}
+
+bool BeaconCacheOverflowStore::rollOver()
+{
+	uint64_t segmentID = mSegments.empty() ? 0 : mSegments.back().id + 1;
+
+	mActiveSegment.close();
+	mActiveSegment.clear();
+	mActiveSegment.open(getSegmentFileName(segmentID), std::ios::binary | std::ios::trunc);
+
+	std::string header(SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+	appendUInt(header, SEGMENT_FORMAT_VERSION, sizeof(uint32_t));
+	mActiveSegment.write(header.data(), static_cast<std::streamsize>(header.size()));
+	mActiveSegment.flush();
+	if (!mActiveSegment)
+	{
+		mActiveSegment.close();
+		std::remove(getSegmentFileName(segmentID).c_str());
+		return false;
+	}
+
+	mSegments.push_back({ segmentID, static_cast<int64_t>(header.size()), 0 });
+	mSizeInBytes += static_cast<int64_t>(header.size());
+
+	deleteUnusedSegments();
+
+	return true;
+}
+
+void BeaconCacheOverflowStore::deleteOldestSegment()
+{
+	auto segment = mSegments.front();
+	mSegments.pop_front();
+	mSizeInBytes -= segment.sizeInBytes;
+	std::remove(getSegmentFileName(segment.id).c_str());
+	writeManifest();
+
+	if (segment.numRecords > 0 && mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconCacheOverflowStore deleteOldestSegment() - discarded %zu records of segment %" PRIu64,
+			segment.numRecords, segment.id);
+	}
+
+	// drop all records which were stored in the deleted segment
+	for (auto it = mBeacons.begin(); it != mBeacons.end();)
+	{
+		auto& records = it->second.records;
+		records.erase(std::remove_if(records.begin(), records.end(),
+			[&segment](const RecordLocation& location) { return location.segmentID == segment.id; }), records.end());
+		if (records.empty())
+		{
+			it = mBeacons.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void BeaconCacheOverflowStore::deleteUnusedSegments()
+{
+	// only delete from the beginning, since newer segments might contain removal markers for older ones
+	bool isDeleted = false;
+	while (mSegments.size() > 1 && mSegments.front().numRecords == 0)
+	{
+		auto segment = mSegments.front();
+		mSegments.pop_front();
+		mSizeInBytes -= segment.sizeInBytes;
+		std::remove(getSegmentFileName(segment.id).c_str());
+		isDeleted = true;
+	}
+
+	if (isDeleted)
+	{
+		writeManifest();
+	}
+}
+
+void BeaconCacheOverflowStore::releaseRecord(uint64_t segmentID)
+{
+	for (auto& segment : mSegments)
+	{
+		if (segment.id == segmentID)
+		{
+			segment.numRecords--;
+			return;
+		}
+	}
+}
+
+bool BeaconCacheOverflowStore::writeManifest()
+{
+	auto fileName = getManifestFileName();
+	auto tempFileName = fileName + ".tmp";
+
+	std::ofstream manifest(tempFileName, std::ios::trunc);
+	manifest << (mSegments.empty() ? 0 : mSegments.front().id) << " " << mRunID << "\n";
+	manifest.close();
+	if (!manifest)
+	{
+		return false;
+	}
+
+	// replace the previous manifest atomically, so that a crash never leaves the directory without one
+#if defined(_WIN32) || defined(WIN32)
+	return MoveFileExA(tempFileName.c_str(), fileName.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return std::rename(tempFileName.c_str(), fileName.c_str()) == 0;
+#endif
+}
+
+std::string BeaconCacheOverflowStore::getSegmentFileName(uint64_t segmentID) const
+{
+	return mDirectory + "/" + SEGMENT_FILE_PREFIX + std::to_string(segmentID) + SEGMENT_FILE_SUFFIX;
+}
+
+std::string BeaconCacheOverflowStore::getManifestFileName() const
+{
+	return mDirectory + "/" + MANIFEST_FILE_NAME;
+}
@@ -0,0 +1,261 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_BEACONCACHEOVERFLOWSTORE_H
+#define _CORE_CACHING_BEACONCACHEOVERFLOWSTORE_H
+
+#include "IBeaconCacheOverflowStore.h"
+#include "OpenKit/ILogger.h"
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Overflow store keeping the records in append-only segment files in a directory.
+		///
+		/// @par
+		/// Records are appended to the newest segment file, which is rolled over once it reaches a fixed size.
+		/// Taking records out of the store only appends a removal marker; segment files are deleted, once they are
+		/// the oldest one and do not contain any records anymore. If the size of all segment files exceeds the
+		/// configured maximum, the oldest segment files are deleted, regardless of their content.
+		///
+		/// @par
+		/// When opening the store, the records of previous processes are recovered from the existing segment files.
+		/// The directory must not be used by more than one store at a time.
+		///
+		class BeaconCacheOverflowStore : public IBeaconCacheOverflowStore
+		{
+		public:
+
+			///
+			/// Constructor
+			///
+			/// @param[in] logger logger to write traces to
+			/// @param[in] directory the directory where the segment files are stored
+			/// @param[in] maxSizeInBytes the maximum size of all segment files
+			///
+			BeaconCacheOverflowStore(std::shared_ptr<openkit::ILogger> logger, const std::string& directory, int64_t maxSizeInBytes);
+
+			///
+			/// Delete the copy constructor
+			///
+			BeaconCacheOverflowStore(const BeaconCacheOverflowStore&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			BeaconCacheOverflowStore& operator=(const BeaconCacheOverflowStore&) = delete;
+
+			~BeaconCacheOverflowStore() override = default;
+
+			///
+			/// Recovers the records stored by previous processes and prepares the store for new records.
+			///
+			/// @return @c true if the store can be used, @c false if the directory is not accessible
+			///
+			bool open();
+
+			bool store(const BeaconKey& beaconKey, const BeaconHeader& header, const std::vector<Record>& records) override;
+
+			bool hasRecords(const BeaconKey& beaconKey) override;
+
+			std::vector<Record> takeRecords(const BeaconKey& beaconKey, size_t maxNumBytes) override;
+
+			void removeRecords(const BeaconKey& beaconKey) override;
+
+			bool takeRecoveredBeacon(RecoveredBeacon& recoveredBeacon, size_t maxNumBytes) override;
+
+			void restoreRecoveredBeacon(const RecoveredBeacon& recoveredBeacon) override;
+
+			///
+			/// Returns the size of all segment files in bytes.
+			///
+			int64_t getSizeInBytes();
+
+		private:
+
+			///
+			/// Identifies a beacon across processes (run ID, beacon ID, beacon sequence number)
+			///
+			using StoreKey = std::tuple<uint32_t, int32_t, int32_t>;
+
+			///
+			/// Position of a record in the segment files
+			///
+			struct RecordLocation
+			{
+				/// the segment containing the record
+				uint64_t segmentID;
+
+				/// offset of the record's frame within the segment
+				uint64_t offset;
+
+				/// size of the record's frame
+				uint32_t size;
+			};
+
+			///
+			/// Index entry of a beacon
+			///
+			struct BeaconRecords
+			{
+				BeaconRecords()
+					: header()
+					, hasHeader(false)
+					, headerSegmentID(std::numeric_limits<uint64_t>::max())
+					, records()
+				{
+				}
+
+				/// the beacon's header
+				BeaconHeader header;
+
+				/// @c true if the header is known
+				bool hasHeader;
+
+				/// the newest segment the header has been written to (@c UINT64_MAX if none)
+				uint64_t headerSegmentID;
+
+				/// the locations of the beacon's records, oldest first
+				std::vector<RecordLocation> records;
+			};
+
+			///
+			/// A segment file
+			///
+			struct Segment
+			{
+				/// the segment's ID, also used for the file name
+				uint64_t id;
+
+				/// the file's size
+				int64_t sizeInBytes;
+
+				/// the number of records in this segment, which have not been removed
+				size_t numRecords;
+			};
+
+			static StoreKey toStoreKey(uint32_t runID, const BeaconKey& beaconKey);
+
+			bool storeInternal(const StoreKey& key, const BeaconHeader& header, const std::vector<Record>& records);
+
+			std::vector<Record> takeRecordsInternal(const StoreKey& key, size_t maxNumBytes);
+
+			void removeRecordsInternal(const StoreKey& key);
+
+			///
+			/// Removes the oldest @p numRecords records of the given beacon.
+			///
+			void removeFirstRecordsInternal(const StoreKey& key, size_t numRecords);
+
+			///
+			/// Reads all segment files and rebuilds the index.
+			///
+			void recover(uint64_t firstSegmentID);
+
+			///
+			/// Reads a single segment file and adds its content to the index.
+			///
+			/// @return @c false if the segment file does not exist
+			///
+			bool recoverSegment(uint64_t segmentID, uint32_t& maxRunID);
+
+			///
+			/// Appends the given frames to the active segment, rolling over and deleting old segments as needed.
+			///
+			bool append(const std::string& frames, const std::vector<size_t>& recordFrameOffsets, std::vector<RecordLocation>& locations);
+
+			///
+			/// Starts a new segment file.
+			///
+			bool rollOver();
+
+			///
+			/// Deletes the oldest segment file and removes all its records from the index.
+			///
+			void deleteOldestSegment();
+
+			///
+			/// Deletes segment files at the beginning, which do not contain records anymore.
+			///
+			void deleteUnusedSegments();
+
+			///
+			/// Decrements the record counter of the segment with the given ID.
+			///
+			void releaseRecord(uint64_t segmentID);
+
+			///
+			/// Writes the manifest to a temporary file and atomically replaces the previous manifest with it.
+			///
+			bool writeManifest();
+
+			std::string getSegmentFileName(uint64_t segmentID) const;
+
+			std::string getManifestFileName() const;
+
+		private:
+
+			/// logger to write traces to
+			std::shared_ptr<openkit::ILogger> mLogger;
+
+			/// the directory holding the segment files
+			const std::string mDirectory;
+
+			/// maximum size of all segment files
+			const int64_t mMaxSizeInBytes;
+
+			/// size at which a segment file is rolled over
+			const int64_t mMaxSegmentSizeInBytes;
+
+			/// protects all members below
+			std::mutex mMutex;
+
+			/// @c true if the store was opened successfully
+			bool mIsOpen;
+
+			/// ID of the current process' records
+			uint32_t mRunID;
+
+			/// the segments, oldest first; the last one is the active segment
+			std::deque<Segment> mSegments;
+
+			/// the active segment file
+			std::ofstream mActiveSegment;
+
+			/// sum of the sizes of all segments
+			int64_t mSizeInBytes;
+
+			/// index of all stored records
+			std::map<StoreKey, BeaconRecords> mBeacons;
+		};
+	}
+}
+
+#endif
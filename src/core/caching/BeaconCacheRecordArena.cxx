@@ -0,0 +1,321 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BeaconCacheRecordArena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+using namespace core::caching;
+
+// the first block of an arena is small, since most beacons only contain a few records
+constexpr size_t MIN_BLOCK_SIZE = 256;
+// subsequent blocks grow up to this size (records exceeding it get a block on their own)
+constexpr size_t MAX_BLOCK_SIZE = 16 * 1024;
+
+constexpr uint32_t RECORD_FLAG_MARKED_FOR_SENDING = 0x01;
+constexpr uint32_t RECORD_FLAG_REMOVED = 0x02;
+
+BeaconCacheRecordArena::BeaconCacheRecordArena()
+	: mBlocks()
+	, mNumRecords(0)
+	, mDataSizeInBytes(0)
+	, mMinTimestamp(std::numeric_limits<int64_t>::max())
+{
+}
+
+void BeaconCacheRecordArena::add(int64_t timestamp, const core::UTF8String& data)
+{
+	const auto& bytes = data.getStringData();
+	size_t recordSize = sizeof(RecordHeader) + bytes.size();
+
+	if (mBlocks.empty() || (mBlocks.back().capacity - mBlocks.back().end) < recordSize)
+	{
+		size_t blockSize = mBlocks.empty() ? MIN_BLOCK_SIZE : std::min(mBlocks.back().capacity * 2, MAX_BLOCK_SIZE);
+		blockSize = std::max(blockSize, recordSize);
+
+		Block block = { std::unique_ptr<char[]>(new char[blockSize]), blockSize, 0, 0, 0 };
+		mBlocks.push_back(std::move(block));
+	}
+
+	auto& block = mBlocks.back();
+	RecordHeader header = { timestamp, static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(data.getStringLength()), 0 };
+	writeHeader(block, block.end, header);
+	if (!bytes.empty())
+	{
+		std::memcpy(block.data.get() + block.end + sizeof(RecordHeader), bytes.data(), bytes.size());
+	}
+	block.end += recordSize;
+	block.numRecords++;
+
+	mNumRecords++;
+	mDataSizeInBytes += static_cast<int64_t>(bytes.size());
+	mMinTimestamp = std::min(mMinTimestamp, timestamp);
+}
+
+bool BeaconCacheRecordArena::empty() const
+{
+	return mNumRecords == 0;
+}
+
+size_t BeaconCacheRecordArena::size() const
+{
+	return mNumRecords;
+}
+
+int64_t BeaconCacheRecordArena::getDataSizeInBytes() const
+{
+	return mDataSizeInBytes;
+}
+
+int64_t BeaconCacheRecordArena::getMinTimestamp() const
+{
+	return mMinTimestamp;
+}
+
+void BeaconCacheRecordArena::prepend(BeaconCacheRecordArena& other)
+{
+	mBlocks.insert(mBlocks.begin(), std::make_move_iterator(other.mBlocks.begin()), std::make_move_iterator(other.mBlocks.end()));
+	mNumRecords += other.mNumRecords;
+	mDataSizeInBytes += other.mDataSizeInBytes;
+	mMinTimestamp = std::min(mMinTimestamp, other.mMinTimestamp);
+
+	other.mBlocks.clear();
+	other.mNumRecords = 0;
+	other.mDataSizeInBytes = 0;
+	other.mMinTimestamp = std::numeric_limits<int64_t>::max();
+
+	releaseEmptyBlocks();
+}
+
+void BeaconCacheRecordArena::appendToChunk(core::UTF8String& chunk, size_t maxSize, const core::UTF8String& delimiter)
+{
+	forEachRecord([&chunk, maxSize, &delimiter](Block& block, size_t offset, RecordHeader& header)
+	{
+		if (chunk.getStringLength() > maxSize)
+		{
+			return false;
+		}
+
+		// mark the record for sending
+		header.flags |= RECORD_FLAG_MARKED_FOR_SENDING;
+
+		// append delimiter & data
+		chunk.concatenate(delimiter);
+		chunk.concatenate(block.data.get() + offset + sizeof(RecordHeader), header.numBytes, header.stringLength);
+
+		return true;
+	});
+}
+
+void BeaconCacheRecordArena::removeMarkedForSending()
+{
+	forEachRecord([this](Block& block, size_t offset, RecordHeader& header)
+	{
+		if ((header.flags & RECORD_FLAG_MARKED_FOR_SENDING) != 0)
+		{
+			remove(block, offset, header);
+		}
+		return true;
+	});
+
+	releaseEmptyBlocks();
+}
+
+void BeaconCacheRecordArena::unsetSending()
+{
+	forEachRecord([](Block& /* block */, size_t /* offset */, RecordHeader& header)
+	{
+		header.flags &= ~RECORD_FLAG_MARKED_FOR_SENDING;
+		return true;
+	});
+}
+
+int32_t BeaconCacheRecordArena::removeRecordsOlderThan(int64_t minTimestamp)
+{
+	if (mMinTimestamp >= minTimestamp)
+	{
+		// no record is old enough
+		return 0;
+	}
+
+	int32_t numRecordsRemoved = 0;
+	int64_t newMinTimestamp = std::numeric_limits<int64_t>::max();
+	forEachRecord([this, minTimestamp, &numRecordsRemoved, &newMinTimestamp](Block& block, size_t offset, RecordHeader& header)
+	{
+		if (header.timestamp < minTimestamp)
+		{
+			remove(block, offset, header);
+			numRecordsRemoved++;
+		}
+		else
+		{
+			newMinTimestamp = std::min(newMinTimestamp, header.timestamp);
+		}
+		return true;
+	});
+
+	mMinTimestamp = newMinTimestamp;
+	releaseEmptyBlocks();
+
+	return numRecordsRemoved;
+}
+
+int64_t BeaconCacheRecordArena::getFirstTimestamp() const
+{
+	// leading removed records are always skipped by releaseEmptyBlocks
+	const auto& block = mBlocks.front();
+	return readHeader(block, block.begin).timestamp;
+}
+
+const core::UTF8String BeaconCacheRecordArena::getFirstData() const
+{
+	const auto& block = mBlocks.front();
+	auto header = readHeader(block, block.begin);
+
+	core::UTF8String data;
+	data.concatenate(block.data.get() + block.begin + sizeof(RecordHeader), header.numBytes, header.stringLength);
+	return data;
+}
+
+void BeaconCacheRecordArena::removeFirst()
+{
+	auto& block = mBlocks.front();
+	auto header = readHeader(block, block.begin);
+	remove(block, block.begin, header);
+	writeHeader(block, block.begin, header);
+
+	releaseEmptyBlocks();
+}
+
+const std::list<BeaconCacheRecord> BeaconCacheRecordArena::getRecords() const
+{
+	std::list<BeaconCacheRecord> result;
+	for (const auto& block : mBlocks)
+	{
+		size_t offset = block.begin;
+		while (offset < block.end)
+		{
+			auto header = readHeader(block, offset);
+			if ((header.flags & RECORD_FLAG_REMOVED) == 0)
+			{
+				BeaconCacheRecord record(header.timestamp,
+					core::UTF8String(std::string(block.data.get() + offset + sizeof(RecordHeader), header.numBytes)));
+				if ((header.flags & RECORD_FLAG_MARKED_FOR_SENDING) != 0)
+				{
+					record.markForSending();
+				}
+				result.push_back(record);
+			}
+			offset += sizeof(RecordHeader) + header.numBytes;
+		}
+	}
+
+	return result;
+}
+
+size_t BeaconCacheRecordArena::getNumberOfBlocks() const
+{
+	return mBlocks.size();
+}
+
+template <typename Function>
+void BeaconCacheRecordArena::forEachRecord(Function function)
+{
+	for (auto& block : mBlocks)
+	{
+		size_t offset = block.begin;
+		while (offset < block.end)
+		{
+			auto header = readHeader(block, offset);
+			auto recordSize = sizeof(RecordHeader) + header.numBytes;
+			if ((header.flags & RECORD_FLAG_REMOVED) == 0)
+			{
+				auto oldFlags = header.flags;
+				auto proceed = function(block, offset, header);
+				if (header.flags != oldFlags)
+				{
+					writeHeader(block, offset, header);
+				}
+				if (!proceed)
+				{
+					return;
+				}
+			}
+			offset += recordSize;
+		}
+	}
+}
+
+void BeaconCacheRecordArena::remove(Block& block, size_t /* offset */, RecordHeader& header)
+{
+	header.flags |= RECORD_FLAG_REMOVED;
+	block.numRecords--;
+
+	mNumRecords--;
+	mDataSizeInBytes -= static_cast<int64_t>(header.numBytes);
+}
+
+void BeaconCacheRecordArena::releaseEmptyBlocks()
+{
+	if (mBlocks.empty())
+	{
+		return;
+	}
+
+	// records might have been removed from any block, not only from the first one
+	auto lastBlock = std::prev(mBlocks.end());
+	mBlocks.erase(std::remove_if(mBlocks.begin(), lastBlock, [](const Block& block) { return block.numRecords == 0; }), lastBlock);
+
+	auto& last = mBlocks.back();
+	if (last.numRecords == 0)
+	{
+		// keep the last block for subsequent records
+		last.begin = 0;
+		last.end = 0;
+	}
+	if (mNumRecords == 0)
+	{
+		mMinTimestamp = std::numeric_limits<int64_t>::max();
+	}
+
+	// skip removed records, so that the first record is always accessible directly
+	auto& first = mBlocks.front();
+	while (first.begin < first.end)
+	{
+		auto header = readHeader(first, first.begin);
+		if ((header.flags & RECORD_FLAG_REMOVED) == 0)
+		{
+			break;
+		}
+		first.begin += sizeof(RecordHeader) + header.numBytes;
+	}
+}
+
+BeaconCacheRecordArena::RecordHeader BeaconCacheRecordArena::readHeader(const Block& block, size_t offset)
+{
+	// headers are not necessarily aligned within the block
+	RecordHeader header;
+	std::memcpy(&header, block.data.get() + offset, sizeof(RecordHeader));
+	return header;
+}
+
+void BeaconCacheRecordArena::writeHeader(Block& block, size_t offset, const RecordHeader& header)
+{
+	std::memcpy(block.data.get() + offset, &header, sizeof(RecordHeader));
+}
@@ -0,0 +1,242 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_CACHING_BEACONCACHERECORDARENA_H
+#define _CORE_CACHING_BEACONCACHERECORDARENA_H
+
+#include "core/UTF8String.h"
+#include "BeaconCacheRecord.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Ordered sequence of beacon cache records, stored contiguously in a queue of memory blocks.
+		///
+		/// @par
+		/// Each record is stored as a fixed size header (timestamp, size, flags) followed by its data, so adding a record
+		/// does not allocate, unless the last block is full. Records are only ever appended at the end; removed records
+		/// are flagged and the memory of a block is released as soon as the block does not contain any record anymore.
+		///
+		/// @par
+		/// This class is not thread safe, the owning @ref BeaconCacheEntry takes care of locking.
+		///
+		class BeaconCacheRecordArena
+		{
+		public:
+
+			///
+			/// Default constructor
+			///
+			BeaconCacheRecordArena();
+
+			///
+			/// Appends a new record.
+			///
+			/// @param[in] timestamp the record's timestamp
+			/// @param[in] data the record's data
+			///
+			void add(int64_t timestamp, const core::UTF8String& data);
+
+			///
+			/// Returns @c true if the arena does not contain any record.
+			///
+			bool empty() const;
+
+			///
+			/// Returns the number of records.
+			///
+			size_t size() const;
+
+			///
+			/// Returns the sum of all record's data size.
+			///
+			int64_t getDataSizeInBytes() const;
+
+			///
+			/// Returns a lower bound of all record's timestamps.
+			///
+			/// @par
+			/// The value is exact after @ref removeRecordsOlderThan, removing records in any other way might leave it
+			/// smaller than the actual minimum. If the arena is empty @c INT64_MAX is returned.
+			///
+			int64_t getMinTimestamp() const;
+
+			///
+			/// Moves all records of @c other in front of the records of this arena.
+			///
+			/// @par
+			/// Only whole blocks are moved, the record data itself is not copied.
+			///
+			/// @param[in,out] other arena whose records are moved; it is empty afterwards
+			///
+			void prepend(BeaconCacheRecordArena& other);
+
+			///
+			/// Appends records, starting with the first one, to the given chunk as long as the chunk does not exceed
+			/// @c maxSize and marks them for sending.
+			///
+			/// @param[in,out] chunk the chunk to which the data is appended
+			/// @param[in] maxSize in characters for one chunk
+			/// @param[in] delimiter the delimiter prepended to each record's data
+			///
+			void appendToChunk(core::UTF8String& chunk, size_t maxSize, const core::UTF8String& delimiter);
+
+			///
+			/// Removes all records which are marked for sending.
+			///
+			void removeMarkedForSending();
+
+			///
+			/// Removes the sending mark from all records.
+			///
+			void unsetSending();
+
+			///
+			/// Removes all records with a timestamp smaller than @c minTimestamp.
+			///
+			/// @par
+			/// The records are only traversed if @ref getMinTimestamp indicates that there is something to remove.
+			///
+			/// @param[in] minTimestamp the minimum timestamp allowed
+			/// @return the number of removed records
+			///
+			int32_t removeRecordsOlderThan(int64_t minTimestamp);
+
+			///
+			/// Returns the timestamp of the first record.
+			///
+			/// @remarks Must not be called, if the arena is empty.
+			///
+			int64_t getFirstTimestamp() const;
+
+			///
+			/// Returns the data of the first record.
+			///
+			/// @remarks Must not be called, if the arena is empty.
+			///
+			const core::UTF8String getFirstData() const;
+
+			///
+			/// Removes the first record.
+			///
+			/// @remarks Must not be called, if the arena is empty.
+			///
+			void removeFirst();
+
+			///
+			/// Get a deep copy of all records.
+			///
+			/// This method shall only be used for testing purposes.
+			///
+			const std::list<BeaconCacheRecord> getRecords() const;
+
+			///
+			/// Returns the number of memory blocks currently held.
+			///
+			/// This method shall only be used for testing purposes.
+			///
+			size_t getNumberOfBlocks() const;
+
+		private:
+
+			///
+			/// Header stored in front of each record's data
+			///
+			struct RecordHeader
+			{
+				/// the record's timestamp
+				int64_t timestamp;
+
+				/// number of bytes of the record's data
+				uint32_t numBytes;
+
+				/// number of characters of the record's data
+				uint32_t stringLength;
+
+				/// combination of the RECORD_FLAG_* values
+				uint32_t flags;
+			};
+
+			///
+			/// Memory block holding a sequence of records
+			///
+			struct Block
+			{
+				/// the memory
+				std::unique_ptr<char[]> data;
+
+				/// size of the memory
+				size_t capacity;
+
+				/// offset of the first record, which is not removed
+				size_t begin;
+
+				/// offset behind the last record
+				size_t end;
+
+				/// number of records in this block, which are not removed
+				size_t numRecords;
+			};
+
+			///
+			/// Calls the given function for each record, which is not removed.
+			///
+			/// @par
+			/// The function is invoked with the block, the offset of the record's header and the header itself.
+			/// Changes to the header are written back. Iteration stops, if the function returns @c false.
+			///
+			template <typename Function>
+			void forEachRecord(Function function);
+
+			///
+			/// Marks the record at the given offset as removed.
+			///
+			void remove(Block& block, size_t offset, RecordHeader& header);
+
+			///
+			/// Releases all blocks which do not contain records anymore, except the last one, which is kept
+			/// for subsequent records. Removed records at the beginning of the first block are skipped.
+			///
+			void releaseEmptyBlocks();
+
+			static RecordHeader readHeader(const Block& block, size_t offset);
+
+			static void writeHeader(Block& block, size_t offset, const RecordHeader& header);
+
+			/// the blocks, the oldest one at the front
+			std::deque<Block> mBlocks;
+
+			/// number of records, which are not removed
+			size_t mNumRecords;
+
+			/// sum of the data size of all records, which are not removed
+			int64_t mDataSizeInBytes;
+
+			/// lower bound of the timestamps of all records, which are not removed
+			int64_t mMinTimestamp;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_BEACONHEADER_H
+#define _CORE_CACHING_BEACONHEADER_H
+
+#include "core/UTF8String.h"
+
+#include <cstdint>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Beacon specific data, which is required to send cached records without the beacon they belong to.
+		///
+		struct BeaconHeader
+		{
+			BeaconHeader()
+				: deviceID(0)
+				, sessionNumber(0)
+				, clientIPAddress()
+				, beaconData()
+			{
+			}
+
+			/// the device ID sent along with the beacon
+			int64_t deviceID;
+
+			/// the session number sent along with the beacon
+			int32_t sessionNumber;
+
+			/// the client IP address sent along with the beacon
+			core::UTF8String clientIPAddress;
+
+			/// serialized beacon data, which does not depend on the time of sending
+			core::UTF8String beaconData;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BeaconRecordQueue.h"
+
+#include <utility>
+
+using namespace core::caching;
+
+BeaconRecordQueue::Record::Record()
+	: beaconKey(0, 0)
+	, timestamp(0)
+	, data()
+	, isActionData(false)
+{
+}
+
+BeaconRecordQueue::Record::Record(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data, bool isActionData)
+	: beaconKey(beaconKey)
+	, timestamp(timestamp)
+	, data(data)
+	, isActionData(isActionData)
+{
+}
+
+BeaconRecordQueue::BeaconRecordQueue(size_t capacity)
+	: mQueue(capacity)
+{
+}
+
+bool BeaconRecordQueue::tryPush(Record& record)
+{
+	return mQueue.tryPush([&record](Record& slotRecord)
+	{
+		slotRecord = std::move(record);
+	});
+}
+
+bool BeaconRecordQueue::tryPop(Record& record)
+{
+	return mQueue.tryPop([&record](Record& slotRecord)
+	{
+		record = std::move(slotRecord);
+	});
+}
+
+size_t BeaconRecordQueue::size() const
+{
+	return mQueue.size();
+}
+
+size_t BeaconRecordQueue::getCapacity() const
+{
+	return mQueue.getCapacity();
+}
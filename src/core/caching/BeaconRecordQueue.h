@@ -0,0 +1,126 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_BEACONRECORDQUEUE_H
+#define _CORE_CACHING_BEACONRECORDQUEUE_H
+
+#include "BeaconKey.h"
+#include "core/UTF8String.h"
+#include "core/util/BoundedQueue.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Bounded lock-free queue, used to hand over beacon records from reporting threads to the beacon cache.
+		///
+		/// @par
+		/// Records are moved into and out of the slots of a @ref core::util::BoundedQueue.
+		///
+		class BeaconRecordQueue
+		{
+		public:
+
+			///
+			/// A queued record
+			///
+			struct Record
+			{
+				///
+				/// Default constructor
+				///
+				Record();
+
+				///
+				/// Constructor
+				///
+				/// @param[in] beaconKey the key of the beacon the record belongs to
+				/// @param[in] timestamp the timestamp of the record
+				/// @param[in] data the serialized record
+				/// @param[in] isActionData @c true if this is action data, @c false for event data
+				///
+				Record(const BeaconKey& beaconKey, int64_t timestamp, const core::UTF8String& data, bool isActionData);
+
+				/// The key of the beacon the record belongs to
+				BeaconKey beaconKey;
+
+				/// The timestamp of the record
+				int64_t timestamp;
+
+				/// The serialized record
+				core::UTF8String data;
+
+				/// @c true if this is action data, @c false for event data
+				bool isActionData;
+			};
+
+			///
+			/// Constructor
+			///
+			/// @param[in] capacity the maximum number of queued records, which is rounded up to the next power of two
+			///
+			BeaconRecordQueue(size_t capacity);
+
+			///
+			/// Delete the copy constructor
+			///
+			BeaconRecordQueue(const BeaconRecordQueue&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			BeaconRecordQueue& operator=(const BeaconRecordQueue&) = delete;
+
+			///
+			/// Adds the given record to the queue, unless the queue is full.
+			///
+			/// @param[in,out] record the record to add, which is moved from if it was added
+			/// @return @c true if the record was added, @c false if the queue is full
+			///
+			bool tryPush(Record& record);
+
+			///
+			/// Removes the oldest record from the queue.
+			///
+			/// @param[out] record receives the removed record
+			/// @return @c true if a record was removed, @c false if the queue is empty
+			///
+			bool tryPop(Record& record);
+
+			///
+			/// Returns the approximate number of queued records.
+			///
+			size_t size() const;
+
+			///
+			/// Returns the maximum number of queued records.
+			///
+			size_t getCapacity() const;
+
+		private:
+
+			/// The ring buffer holding the records
+			core::util::BoundedQueue<Record> mQueue;
+		};
+	}
+}
+
+#endif
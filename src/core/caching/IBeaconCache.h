@@ -17,7 +17,9 @@
 #ifndef _CORE_CACHING_IBEACONCACHE_H
 #define _CORE_CACHING_IBEACONCACHE_H
 
+#include "BeaconHeader.h"
 #include "BeaconKey.h"
+#include "IBeaconCacheOverflowStore.h"
 #include "IObserver.h"
 #include "core/UTF8String.h"
 
@@ -86,6 +88,8 @@ namespace core
 			///
 			/// Test if there is more data to send.
 			///
+			/// Data moved to the overflow store counts as data for sending, it is paged in by @ref getNextBeaconChunk.
+			///
 			/// @param beaconKey[in] key The beaconkey for which to check if there is more data for sending.
 			/// @retval true if there is data for sending
 			/// @retval if BeaconKey does not exist or there is no data for sending.
@@ -154,6 +158,17 @@ namespace core
 			///
 			virtual uint32_t evictRecordsByNumber(const BeaconKey & beaconKey, uint32_t numRecords) = 0;
 
+			///
+			/// Evict the oldest @ref BeaconCacheRecord of all beacons, until at least @c numBytes have been evicted.
+			///
+			/// Records are evicted in the order of their age across all beacons, regardless to which beacon they belong.
+			/// Records which are currently being sent are not evicted.
+			///
+			/// @param[in] numBytes The number of bytes to evict.
+			/// @return Returns the number of evicted cache records.
+			///
+			virtual uint32_t evictRecordsBySize(int64_t numBytes) = 0;
+
 			///
 			/// Get number of bytes currently stored in cache.
 			///
@@ -168,6 +183,31 @@ namespace core
 			/// @return @c true if the cached entry is empty, @c false otherwise.
 			///
 			virtual bool isEmpty(const BeaconKey& beaconKey) = 0;
+
+			///
+			/// Set the header of a beacon, which is required to send its records after they have been moved to the
+			/// overflow store.
+			///
+			/// @param[in] beaconKey The beacon's key.
+			/// @param[in] header The beacon's header.
+			///
+			virtual void setBeaconHeader(const BeaconKey& beaconKey, const BeaconHeader& header) = 0;
+
+			///
+			/// Take the oldest records of a beacon, which were moved to the overflow store by a previous process.
+			///
+			/// @param[out] recoveredBeacon The beacon and its records.
+			/// @param[in] maxNumBytes The maximum size of the records to take at once.
+			/// @return @c true if a beacon was returned, @c false if there are no (more) recovered beacons.
+			///
+			virtual bool takeRecoveredBeacon(IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon, size_t maxNumBytes) = 0;
+
+			///
+			/// Put back a beacon previously returned by @ref takeRecoveredBeacon, e.g. because it could not be sent.
+			///
+			/// @param[in] recoveredBeacon The beacon and its records.
+			///
+			virtual void restoreRecoveredBeacon(const IBeaconCacheOverflowStore::RecoveredBeacon& recoveredBeacon) = 0;
 		};
 	}
 }
@@ -17,6 +17,8 @@
 #ifndef _CORE_CACHING_IBEACONCACHEEVICTIONSTRATEGY_H
 #define _CORE_CACHING_IBEACONCACHEEVICTIONSTRATEGY_H
 
+#include <cstdint>
+
 namespace core
 {
 	namespace caching
@@ -36,6 +38,24 @@ namespace core
 			/// Called when this strategy is executed.
 			///
 			virtual void execute() = 0;
+
+			///
+			/// Checks if data added to the cache requires this strategy to be executed.
+			///
+			/// This method is called by the threads adding data to the cache, therefore it must be cheap.
+			///
+			/// @return @c true if the strategy needs to be executed, @c false otherwise.
+			///
+			virtual bool isExecutionRequired() = 0;
+
+			///
+			/// Returns the number of milliseconds until this strategy needs to be executed, regardless of data being added.
+			///
+			/// This method is only called by the eviction thread.
+			///
+			/// @return the number of milliseconds until the next execution, or a negative value if the strategy is not time driven.
+			///
+			virtual int64_t getMillisUntilNextExecution() = 0;
 		};
 
 	}
@@ -0,0 +1,167 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CACHING_IBEACONCACHEOVERFLOWSTORE_H
+#define _CORE_CACHING_IBEACONCACHEOVERFLOWSTORE_H
+
+#include "BeaconHeader.h"
+#include "BeaconKey.h"
+#include "core/UTF8String.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core
+{
+	namespace caching
+	{
+		///
+		/// Persistent storage for beacon cache records, which do not fit into memory anymore.
+		///
+		/// @par
+		/// Records stored by the current process are identified by their @ref BeaconKey. Records stored by a previous
+		/// process are "recovered beacons", since the beacon they belong to does not exist anymore.
+		///
+		/// Implementations must be thread safe.
+		///
+		class IBeaconCacheOverflowStore
+		{
+		public:
+
+			///
+			/// A single record stored in the overflow store
+			///
+			struct Record
+			{
+				Record()
+					: isActionData(false)
+					, timestamp(0)
+					, data()
+				{
+				}
+
+				Record(bool isActionData, int64_t timestamp, const core::UTF8String& data)
+					: isActionData(isActionData)
+					, timestamp(timestamp)
+					, data(data)
+				{
+				}
+
+				/// @c true for action data, @c false for event data
+				bool isActionData;
+
+				/// the record's timestamp
+				int64_t timestamp;
+
+				/// the record's serialized data
+				core::UTF8String data;
+			};
+
+			///
+			/// The records of a beacon stored by a previous process
+			///
+			struct RecoveredBeacon
+			{
+				RecoveredBeacon()
+					: runID(0)
+					, beaconKey(0, 0)
+					, header()
+					, records()
+				{
+				}
+
+				/// identifies the process which stored the records
+				uint32_t runID;
+
+				/// the key of the beacon in the previous process
+				BeaconKey beaconKey;
+
+				/// the beacon's header
+				BeaconHeader header;
+
+				/// the beacon's records
+				std::vector<Record> records;
+			};
+
+			///
+			/// Destructor
+			///
+			virtual ~IBeaconCacheOverflowStore() = default;
+
+			///
+			/// Append records of a beacon.
+			///
+			/// @param[in] beaconKey the key of the beacon the records belong to
+			/// @param[in] header the beacon's header
+			/// @param[in] records the records to store
+			/// @return @c true if the records were stored, @c false otherwise
+			///
+			virtual bool store(const BeaconKey& beaconKey, const BeaconHeader& header, const std::vector<Record>& records) = 0;
+
+			///
+			/// Test if records of the given beacon are stored.
+			///
+			/// @param[in] beaconKey the beacon's key
+			/// @return @c true if there are records, @c false otherwise
+			///
+			virtual bool hasRecords(const BeaconKey& beaconKey) = 0;
+
+			///
+			/// Remove the oldest records of the given beacon and return them, oldest first.
+			///
+			/// @par
+			/// Records are taken as long as their size does not exceed @p maxNumBytes, but at least one record is
+			/// returned. The remaining records stay in the store.
+			///
+			/// @param[in] beaconKey the beacon's key
+			/// @param[in] maxNumBytes the maximum size of the records to take
+			/// @return the records taken from the store
+			///
+			virtual std::vector<Record> takeRecords(const BeaconKey& beaconKey, size_t maxNumBytes) = 0;
+
+			///
+			/// Discard all records of the given beacon.
+			///
+			/// @param[in] beaconKey the beacon's key
+			///
+			virtual void removeRecords(const BeaconKey& beaconKey) = 0;
+
+			///
+			/// Remove the oldest records of one beacon stored by a previous process and return them.
+			///
+			/// @par
+			/// Like @ref takeRecords, at most @p maxNumBytes are taken at once (but at least one record). The remaining
+			/// records of the beacon are returned by subsequent calls.
+			///
+			/// @param[out] recoveredBeacon the beacon and its records
+			/// @param[in] maxNumBytes the maximum size of the records to take
+			/// @return @c true if a beacon was returned, @c false if there are no more recovered beacons
+			///
+			virtual bool takeRecoveredBeacon(RecoveredBeacon& recoveredBeacon, size_t maxNumBytes) = 0;
+
+			///
+			/// Store a beacon previously returned by @ref takeRecoveredBeacon again (e.g. because sending failed).
+			///
+			/// @param[in] recoveredBeacon the beacon and its records
+			///
+			virtual void restoreRecoveredBeacon(const RecoveredBeacon& recoveredBeacon) = 0;
+		};
+	}
+}
+
+#endif
@@ -16,8 +16,6 @@
 
 #include "SpaceEvictionStrategy.h"
 
-#include <unordered_map>
-
 using namespace core::caching;
 
 SpaceEvictionStrategy::SpaceEvictionStrategy
@@ -56,6 +54,16 @@ void SpaceEvictionStrategy::execute()
 	}
 }
 
+bool SpaceEvictionStrategy::isExecutionRequired()
+{
+	return !isStrategyDisabled() && shouldRun();
+}
+
+int64_t SpaceEvictionStrategy::getMillisUntilNextExecution()
+{
+	return -1;
+}
+
 bool SpaceEvictionStrategy::isStrategyDisabled() const
 {
 	return mConfiguration->getCacheSizeLowerBound() <= 0
@@ -70,40 +78,25 @@ bool SpaceEvictionStrategy::shouldRun() const
 
 void SpaceEvictionStrategy::doExecute()
 {
-	std::unordered_map<BeaconKey, uint32_t, BeaconKey::Hash> removedRecordsPerBeacon;
-	while (!mIsStopRequested() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
+	uint32_t numRecordsRemoved = 0;
+	int64_t numBytesInCache = mBeaconCache->getNumBytesInCache();
+	while (!mIsStopRequested() && numBytesInCache > mConfiguration->getCacheSizeLowerBound())
 	{
-		auto beaconKeys = mBeaconCache->getBeaconKeys();
-		auto it = beaconKeys.begin();
-		while (!mIsStopRequested() && it != beaconKeys.end() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
+		// remove the oldest records of all beacons, until the lower bound is reached
+		// more data might have been added concurrently, therefore check again afterwards
+		uint32_t numRecordsRemovedInPass = mBeaconCache->evictRecordsBySize(numBytesInCache - mConfiguration->getCacheSizeLowerBound());
+		if (numRecordsRemovedInPass == 0)
 		{
-			// remove 1 record from Beacon cache for given beaconID
-			// the result is the number of records removed, which might be in range [0, numRecords=1]
-			uint32_t numRecordsRemoved = mBeaconCache->evictRecordsByNumber(*it, 1);
-
-			if (mLogger->isDebugEnabled())
-			{
-				auto itr = removedRecordsPerBeacon.find(*it);
-				if (itr == removedRecordsPerBeacon.end())
-				{
-					removedRecordsPerBeacon.insert(std::make_pair(*it, numRecordsRemoved));
-				}
-				else
-				{
-					itr->second += numRecordsRemoved;
-				}
-			}
-
-			it++;
+			// nothing left to evict (e.g. all data is currently being sent)
+			break;
 		}
+
+		numRecordsRemoved += numRecordsRemovedInPass;
+		numBytesInCache = mBeaconCache->getNumBytesInCache();
 	}
 
 	if (mLogger->isDebugEnabled())
 	{
-		for (auto itr = removedRecordsPerBeacon.begin(); itr != removedRecordsPerBeacon.end(); itr++)
-		{
-			mLogger->debug("SpaceEvictionStrategy doExecute() - Removed %u records from Beacon with key [sn=%d, seq=%d]",
-				itr->second, itr->first.getBeaconId(), itr->first.getBeaconSequenceNumber());
-		}
+		mLogger->debug("SpaceEvictionStrategy doExecute() - Removed %u records", numRecordsRemoved);
 	}
-}
\ No newline at end of file
+}
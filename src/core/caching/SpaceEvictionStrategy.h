@@ -72,6 +72,20 @@ namespace core
 			///
 			void execute() override;
 
+			///
+			/// Checks if the number of bytes in the Beacon cache exceeds the configured upper limit.
+			///
+			/// @return @c true if the strategy is enabled and should run, @c false otherwise.
+			///
+			bool isExecutionRequired() override;
+
+			///
+			/// This strategy is only executed when data is added to the cache.
+			///
+			/// @return always @c -1
+			///
+			int64_t getMillisUntilNextExecution() override;
+
 			///
 			/// Checks if the strategy is disabled.
 			///
@@ -16,6 +16,7 @@
 
 #include "TimeEvictionStrategy.h"
 
+#include <algorithm>
 #include <map>
 
 using namespace core::caching;
@@ -64,6 +65,28 @@ void TimeEvictionStrategy::execute()
 	}
 }
 
+bool TimeEvictionStrategy::isExecutionRequired()
+{
+	return false;
+}
+
+int64_t TimeEvictionStrategy::getMillisUntilNextExecution()
+{
+	if (isStrategyDisabled())
+	{
+		return -1;
+	}
+
+	if (mLastRunTimestamp < 0)
+	{
+		// not executed yet
+		return 0;
+	}
+
+	int64_t elapsed = mTimingProvider->provideTimestampInMilliseconds() - mLastRunTimestamp;
+	return std::max<int64_t>(mConfiguration->getMaxRecordAge() - elapsed, 0);
+}
+
 bool TimeEvictionStrategy::isStrategyDisabled() const
 {
 	return mConfiguration->getMaxRecordAge() <= 0;
@@ -75,6 +75,20 @@ namespace core
 			///
 			void execute() override;
 
+			///
+			/// Data added to the cache never requires this strategy to be executed, since it is time driven.
+			///
+			/// @return always @c false
+			///
+			bool isExecutionRequired() override;
+
+			///
+			/// Returns the number of milliseconds until the maximum record age has elapsed since the last run.
+			///
+			/// @return the number of milliseconds until the next execution, or @c -1 if the strategy is disabled.
+			///
+			int64_t getMillisUntilNextExecution() override;
+
 			///
 			/// Checks if the strategy is disabled.
 			///
@@ -105,32 +105,127 @@ const char* BeaconSendingCaptureOnState::getStateName() const
 	return "CaptureOn";
 }
 
+std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendSessions(
+	IBeaconSendingContext& context,
+	const std::vector<std::shared_ptr<core::objects::SessionInternals>>& sessions,
+	const SessionFilter& sessionFilter,
+	const SessionResponseHandler& responseHandler
+)
+{
+	auto maxConcurrentRequests = static_cast<size_t>(std::max(context.getMaxConcurrentBeaconRequests(), 1));
+	if (maxConcurrentRequests <= 1 || sessions.size() <= 1)
+	{
+		std::shared_ptr<protocol::IStatusResponse> statusResponse = nullptr;
+		for (auto session : sessions)
+		{
+			if (!sessionFilter(session))
+			{
+				continue;
+			}
+
+			statusResponse = session->sendBeacon(context.getHTTPClientProvider(), context);
+			if (responseHandler(session, statusResponse))
+			{
+				break;
+			}
+		}
+
+		return statusResponse;
+	}
+
+	// shared with the response handlers, which are invoked while the client provider drives the requests
+	struct SendState
+	{
+		std::shared_ptr<protocol::IStatusResponse> statusResponse;
+		size_t numRunningRequests;
+		bool isAborted;
+		bool isThrottled;
+	};
+	auto state = std::make_shared<SendState>(SendState{ nullptr, 0, false, false });
+
+	auto clientProvider = context.getHTTPClientProvider();
+	size_t nextSessionIndex = 0;
+	while (true)
+	{
+		while (!state->isAborted && state->numRunningRequests < maxConcurrentRequests && nextSessionIndex < sessions.size())
+		{
+			auto session = sessions[nextSessionIndex++];
+			if (!sessionFilter(session))
+			{
+				continue;
+			}
+
+			state->numRunningRequests++;
+			session->sendBeaconAsync(clientProvider, context,
+				[state, session, &responseHandler](std::shared_ptr<protocol::IStatusResponse> response)
+				{
+					state->numRunningRequests--;
+					if (!state->isThrottled)
+					{
+						// a "too many requests" response must not be hidden by responses completing afterwards
+						state->statusResponse = response;
+						state->isThrottled = BeaconSendingResponseUtil::isTooManyRequestsResponse(response);
+					}
+					if (responseHandler(session, response))
+					{
+						state->isAborted = true;
+					}
+				}
+			);
+		}
+
+		if (state->numRunningRequests == 0)
+		{
+			break;
+		}
+
+		if (clientProvider->processPendingRequests() == 0 && state->numRunningRequests > 0)
+		{
+			// no request is pending anymore, but not all responses arrived - must not wait forever
+			break;
+		}
+	}
+
+	return state->statusResponse;
+}
+
 std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendFinishedSessions(
 	IBeaconSendingContext& context
 )
 {
-	std::shared_ptr<protocol::IStatusResponse> statusResponse = nullptr;
 	// check if there's finished Sessions to be sent -> immediately send beacon(s) of finished Sessions
-	for (auto session : context.getAllFinishedAndConfiguredSessions())
-	{
-		if (session->isDataSendingAllowed()) {
-			statusResponse = session->sendBeacon(context.getHTTPClientProvider(), context);
+	return sendSessions(context, context.getAllFinishedAndConfiguredSessions(),
+		[&context](std::shared_ptr<core::objects::SessionInternals> session)
+		{
+			if (session->isDataSendingAllowed())
+			{
+				return true;
+			}
+
+			// session is not allowed to be sent - so remove it from beacon cache
+			context.removeSession(session);
+			session->clearCapturedData();
+
+			return false;
+		},
+		[&context](std::shared_ptr<core::objects::SessionInternals> session, std::shared_ptr<protocol::IStatusResponse> statusResponse)
+		{
 			if (!BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
 			{
 				// something went wrong,
 				if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse) || !session->isEmpty())
 				{
-					break; //  sending did not work, break out for now and retry it later
+					return true; //  sending did not work, break out for now and retry it later
 				}
 			}
-		}
 
-		// session was sent/is not allowed to be sent - so remove it from beacon cache
-		context.removeSession(session);
-		session->clearCapturedData();
-	}
+			// session was sent - so remove it from beacon cache
+			context.removeSession(session);
+			session->clearCapturedData();
 
-	return statusResponse;
+			return false;
+		}
+	);
 }
 
 std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendOpenSessions(IBeaconSendingContext& context)
@@ -142,22 +237,24 @@ std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendOpen
 		return nullptr; // send interval to send open sessions has not expired yet
 	}
 
-	for (auto session : context.getAllOpenAndConfiguredSessions())
-	{
-		if (session->isDataSendingAllowed())
+	statusResponse = sendSessions(context, context.getAllOpenAndConfiguredSessions(),
+		[](std::shared_ptr<core::objects::SessionInternals> session)
 		{
-			statusResponse = session->sendBeacon(context.getHTTPClientProvider(), context);
-			if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
+			if (session->isDataSendingAllowed())
 			{
-				// server is currently overloaded, return immediately
-				break;
+				return true;
 			}
-		}
-		else
-		{
+
 			session->clearCapturedData();
+
+			return false;
+		},
+		[](std::shared_ptr<core::objects::SessionInternals>, std::shared_ptr<protocol::IStatusResponse> statusResponse)
+		{
+			// server is currently overloaded, return immediately
+			return BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse);
 		}
-	}
+	);
 
 	context.setLastOpenSessionBeaconSendTime(currentTimestamp);
 
@@ -193,6 +290,7 @@ std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendNewS
 		{
 			// already exceeded the maximum number of session requests, disable any further data collecting
 			session->disableCapture();
+			context.updateSessionState(session);
 			continue;
 		}
 
@@ -202,6 +300,7 @@ std::shared_ptr<protocol::IStatusResponse> BeaconSendingCaptureOnState::sendNewS
 			auto updatedAttributes = context.updateFrom(statusResponse);
 			auto newServerConfig = configuration::ServerConfiguration::from(updatedAttributes);
 			session->updateServerConfiguration(newServerConfig);
+			context.updateSessionState(session);
 		}
 		else if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
 		{
@@ -19,8 +19,10 @@
 
 #include "AbstractBeaconSendingState.h"
 #include "IBeaconSendingContext.h"
+#include "core/objects/SessionInternals.h"
 #include "protocol/IStatusResponse.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include <chrono>
@@ -57,6 +59,46 @@ namespace core
 			const char* getStateName() const override;
 
 		private:
+
+			///
+			/// Function deciding if the beacon of a session is sent.
+			///
+			/// @par
+			/// If the beacon shall not be sent, the function is responsible to handle the session accordingly.
+			///
+			using SessionFilter = std::function<bool(std::shared_ptr<core::objects::SessionInternals>)>;
+
+			///
+			/// Function handling the response received for the beacon of a session.
+			///
+			/// @return @c true if no further sessions shall be sent in this cycle, @c false otherwise.
+			///
+			using SessionResponseHandler = std::function<bool(
+				std::shared_ptr<core::objects::SessionInternals>,
+				std::shared_ptr<protocol::IStatusResponse>
+			)>;
+
+			///
+			/// Sends the beacons of all given sessions, which pass the given filter.
+			///
+			/// @par
+			/// If the context allows more than one concurrent beacon request, up to that many beacons are sent
+			/// asynchronously, while this thread drives all requests via the HTTP client provider. As soon as one session
+			/// requests to abort, no further sessions are started, whereas requests already in flight are completed.
+			///
+			/// @param[in] context the state context
+			/// @param[in] sessions the sessions to send
+			/// @param[in] sessionFilter function deciding whether a session is sent
+			/// @param[in] responseHandler function handling the response of a sent session
+			/// @return the last response received, or the "too many requests" response if one was received.
+			///
+			static std::shared_ptr<protocol::IStatusResponse> sendSessions(
+				IBeaconSendingContext& context,
+				const std::vector<std::shared_ptr<core::objects::SessionInternals>>& sessions,
+				const SessionFilter& sessionFilter,
+				const SessionResponseHandler& responseHandler
+			);
+
 			///
 			/// Send all sessions which have been finished previously.
 			/// @param[in] context the state context
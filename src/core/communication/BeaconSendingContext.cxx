@@ -20,6 +20,7 @@
 #include "BeaconSendingResponseUtil.h"
 #include "IBeaconSendingState.h"
 #include "protocol/HTTPClient.h"
+#include "protocol/RecoveredBeaconSender.h"
 #include "protocol/ResponseAttributes.h"
 #include "core/configuration/ServerConfiguration.h"
 #include "core/configuration/HTTPClientConfiguration.h"
@@ -34,6 +35,7 @@ BeaconSendingContext::BeaconSendingContext(
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider,
 	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache,
 	std::unique_ptr<IBeaconSendingState> initialState
 )
 	: mLockObject()
@@ -52,6 +54,7 @@ BeaconSendingContext::BeaconSendingContext(
 	, mInitCountdownLatch(1)
 	, mThreadSuspender(threadSuspender)
 	, mSessions()
+	, mBeaconCache(beaconCache)
 {
 }
 
@@ -61,7 +64,8 @@ BeaconSendingContext::BeaconSendingContext
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfig,
 	std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 	std::shared_ptr<providers::ITimingProvider> timingProvider,
-	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+	std::shared_ptr<core::caching::IBeaconCache> beaconCache
 )
 : BeaconSendingContext(
 	logger,
@@ -69,6 +73,7 @@ BeaconSendingContext::BeaconSendingContext
 	httpClientProvider,
 	timingProvider,
 	threadSuspender,
+	beaconCache,
 	std::unique_ptr<IBeaconSendingState>(new BeaconSendingInitialState())
 )
 {
@@ -165,6 +170,11 @@ std::shared_ptr<protocol::IHTTPClient> BeaconSendingContext::getHTTPClient()
 	return mHTTPClientProvider->createClient(mHTTPClientConfiguration);
 }
 
+int32_t BeaconSendingContext::getMaxConcurrentBeaconRequests() const
+{
+	return mHTTPClientConfiguration->getMaxConcurrentRequests();
+}
+
 int64_t BeaconSendingContext::getCurrentTimestamp() const
 {
 	return mTimingProvider->provideTimestampInMilliseconds();
@@ -295,10 +305,21 @@ std::shared_ptr<core::configuration::IServerConfiguration> BeaconSendingContext:
 	return mServerConfiguration;
 }
 
+std::shared_ptr<protocol::IStatusResponse> BeaconSendingContext::sendRecoveredBeacons()
+{
+	if (mBeaconCache == nullptr)
+	{
+		return nullptr;
+	}
+
+	protocol::RecoveredBeaconSender recoveredBeaconSender(mBeaconCache, mTimingProvider);
+	return recoveredBeaconSender.send(getHTTPClient(), *this, *getLastServerConfiguration());
+}
+
 void BeaconSendingContext::clearAllSessionData()
 {
 	// clear captured data from finished sessions
-	for (auto session : mSessions.toStdVector())
+	for (auto session : mSessions.getAllSessions())
 	{
 		session->clearCapturedData();
 		if (session->isFinished())
@@ -310,46 +331,17 @@ void BeaconSendingContext::clearAllSessionData()
 
 std::vector<std::shared_ptr<core::objects::SessionInternals>> BeaconSendingContext::getAllNotConfiguredSessions()
 {
-	std::vector<std::shared_ptr<core::objects::SessionInternals>> notConfiguredSessions;
-
-	for (auto session : mSessions.toStdVector())
-	{
-		if (!session->isConfigured())
-		{
-			notConfiguredSessions.push_back(session);
-		}
-	}
-
-	return notConfiguredSessions;
+	return mSessions.getNotConfiguredSessions();
 }
 
 std::vector<std::shared_ptr<core::objects::SessionInternals>> BeaconSendingContext::getAllOpenAndConfiguredSessions()
 {
-	std::vector<std::shared_ptr<core::objects::SessionInternals>> openSessions;
-
-	for (auto session : mSessions.toStdVector())
-	{
-		if (session->isConfiguredAndOpen())
-		{
-			openSessions.push_back(session);
-		}
-	}
-
-	return openSessions;
+	return mSessions.getOpenAndConfiguredSessions();
 }
 
 std::vector<std::shared_ptr<core::objects::SessionInternals>> BeaconSendingContext::getAllFinishedAndConfiguredSessions()
 {
-	std::vector<std::shared_ptr<core::objects::SessionInternals>> finishedSessions;
-	for (auto session : mSessions.toStdVector())
-	{
-		if (session->isConfiguredAndFinished())
-		{
-			finishedSessions.push_back(session);
-		}
-	}
-
-	return finishedSessions;
+	return mSessions.getFinishedAndConfiguredSessions();
 }
 
 size_t BeaconSendingContext::getSessionCount()
@@ -364,7 +356,7 @@ int32_t BeaconSendingContext::getCurrentServerID() const
 
 void BeaconSendingContext::addSession(std::shared_ptr<core::objects::SessionInternals> session)
 {
-	mSessions.put(session);
+	mSessions.add(session);
 }
 
 bool BeaconSendingContext::removeSession(std::shared_ptr<core::objects::SessionInternals> sessionWrapper)
@@ -372,6 +364,11 @@ bool BeaconSendingContext::removeSession(std::shared_ptr<core::objects::SessionI
 	return mSessions.remove(sessionWrapper);
 }
 
+void BeaconSendingContext::updateSessionState(std::shared_ptr<core::objects::SessionInternals> session)
+{
+	mSessions.updateState(session);
+}
+
 IBeaconSendingState::StateType BeaconSendingContext::getCurrentStateType() const
 {
 	return mCurrentState->getStateType();
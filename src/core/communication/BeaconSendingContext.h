@@ -20,11 +20,12 @@
 #include "OpenKit/ILogger.h"
 #include "IBeaconSendingContext.h"
 #include "IBeaconSendingState.h"
+#include "SessionRegistry.h"
+#include "core/caching/IBeaconCache.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
 #include "core/objects/SessionInternals.h"
 #include "core/util/CountDownLatch.h"
 #include "core/util/IInterruptibleThreadSuspender.h"
-#include "core/util/SynchronizedQueue.h"
 #include "protocol/IStatusResponse.h"
 #include "providers/IHTTPClientProvider.h"
 #include "providers/ITimingProvider.h"
@@ -51,13 +52,16 @@ namespace core
 			/// @param[in] httpClientConfiguration HTTP related configuration details
 			/// @param[in] httpClientProvider provider for HTTPClient objects
 			/// @param[in] timingProvider utility class for timing related stuff
+			/// @param[in] threadSuspender used for suspending the beacon sending thread
+			/// @param[in] beaconCache the cache providing beacons recovered from a previous process
 			///
 			BeaconSendingContext(
 				std::shared_ptr<openkit::ILogger> logger,
 				std::shared_ptr<core::configuration::IHTTPClientConfiguration> httpClientConfiguration,
 				std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 				std::shared_ptr<providers::ITimingProvider> timingProvider,
-				std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+				std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+				std::shared_ptr<core::caching::IBeaconCache> beaconCache
 			);
 
 			///
@@ -66,6 +70,8 @@ namespace core
 			/// @param[in] httpClientConfiguration HTTP related configuration details
 			/// @param[in] httpClientProvider provider for HTTPClient objects
 			/// @param[in] timingProvider utility class for timing related stuff
+			/// @param[in] threadSuspender used for suspending the beacon sending thread
+			/// @param[in] beaconCache the cache providing beacons recovered from a previous process
 			/// @param[in] initialState the initial state
 			///
 			BeaconSendingContext(
@@ -74,6 +80,7 @@ namespace core
 				std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider,
 				std::shared_ptr<providers::ITimingProvider> timingProvider,
 				std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+				std::shared_ptr<core::caching::IBeaconCache> beaconCache,
 				std::unique_ptr<IBeaconSendingState> initialState
 			);
 
@@ -112,6 +119,8 @@ namespace core
 
 			std::shared_ptr<protocol::IHTTPClient> getHTTPClient() override;
 
+			int32_t getMaxConcurrentBeaconRequests() const override;
+
 			int64_t getCurrentTimestamp() const override;
 
 			void sleep() override;
@@ -138,6 +147,8 @@ namespace core
 
 			std::shared_ptr<core::configuration::IServerConfiguration> getLastServerConfiguration() const override;
 
+			std::shared_ptr<protocol::IStatusResponse> sendRecoveredBeacons() override;
+
 			std::vector<std::shared_ptr<core::objects::SessionInternals>> getAllNotConfiguredSessions() override;
 
 			std::vector<std::shared_ptr<core::objects::SessionInternals>> getAllOpenAndConfiguredSessions() override;
@@ -152,6 +163,8 @@ namespace core
 
 			bool removeSession(std::shared_ptr<core::objects::SessionInternals> session) override;
 
+			void updateSessionState(std::shared_ptr<core::objects::SessionInternals> session) override;
+
 			IBeaconSendingState::StateType getCurrentStateType() const override;
 
 			int64_t getConfigurationTimestamp() const override;
@@ -245,8 +258,11 @@ namespace core
 			///
 			std::shared_ptr<core::util::IInterruptibleThreadSuspender> mThreadSuspender;
 
-			/// container storing all session wrappers
-			core::util::SynchronizedQueue<std::shared_ptr<core::objects::SessionInternals>> mSessions;
+			/// registry storing all sessions, bucketed by their state
+			SessionRegistry mSessions;
+
+			/// cache providing beacons recovered from a previous process
+			std::shared_ptr<core::caching::IBeaconCache> mBeaconCache;
 		};
 	}
 }
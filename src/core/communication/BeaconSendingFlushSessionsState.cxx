@@ -38,12 +38,14 @@ void BeaconSendingFlushSessionsState::doExecute(IBeaconSendingContext& context)
 	for (auto newSession : context.getAllNotConfiguredSessions())
 	{
 		newSession->enableCapture();
+		context.updateSessionState(newSession);
 	}
 
 	// end open sessions -> will be flushed afterwards
 	for (auto openSession : context.getAllOpenAndConfiguredSessions())
 	{
 		openSession->end(false);
+		context.updateSessionState(openSession);
 	}
 
 	// flush already finished (and previously ended) sessions
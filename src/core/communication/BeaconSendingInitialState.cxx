@@ -73,6 +73,19 @@ void BeaconSendingInitialState::doExecute(IBeaconSendingContext& context)
 			context.setNextState(std::make_shared<BeaconSendingCaptureOffState>());
 		}
 		context.setInitCompleted(true);
+
+		if (context.isCaptureOn())
+		{
+			// records left over by a previous process are sent once, failed ones are retried by the next process
+			auto recoveredBeaconsResponse = context.sendRecoveredBeacons();
+			if (BeaconSendingResponseUtil::isTooManyRequestsResponse(recoveredBeaconsResponse))
+			{
+				// server is currently overloaded, temporarily switch to capture off
+				context.setNextState(std::make_shared<BeaconSendingCaptureOffState>(
+					recoveredBeaconsResponse->getRetryAfterInMilliseconds()
+				));
+			}
+		}
 	}
 }
 
@@ -126,6 +126,11 @@ namespace core
 			///
 			virtual std::shared_ptr<protocol::IHTTPClient> getHTTPClient() = 0;
 
+			///
+			/// Returns the maximum number of beacon requests which might be sent concurrently.
+			///
+			virtual int32_t getMaxConcurrentBeaconRequests() const = 0;
+
 			///
 			/// Get current timestamp
 			/// @returns current timestamp
@@ -205,6 +210,13 @@ namespace core
 			///
 			virtual std::shared_ptr<core::configuration::IServerConfiguration> getLastServerConfiguration() const = 0;
 
+			///
+			/// Sends the records of beacons, which were moved to the beacon cache's overflow store by a previous process.
+			///
+			/// @return the last response received or @c nullptr if there were no recovered beacons
+			///
+			virtual std::shared_ptr<protocol::IStatusResponse> sendRecoveredBeacons() = 0;
+
 			///
 			/// Get all sessions that were not yet configured.
 			///
@@ -257,6 +269,16 @@ namespace core
 			///
 			virtual bool removeSession(std::shared_ptr<core::objects::SessionInternals> session) = 0;
 
+			///
+			/// Updates the state of the given session in the sessions known by this context.
+			///
+			/// @par
+			/// Must be called after a session was configured or finished.
+			///
+			/// @param[in] session the session which changed its state.
+			///
+			virtual void updateSessionState(std::shared_ptr<core::objects::SessionInternals> session) = 0;
+
 			///
 			/// Returns the type of state
 			/// @returns type of state as defined in IBeaconSendingState
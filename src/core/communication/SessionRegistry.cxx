@@ -0,0 +1,162 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SessionRegistry.h"
+
+using namespace core::communication;
+
+SessionRegistry::SessionRegistry()
+	: mBuckets()
+	, mIndex()
+	, mMutex()
+{
+}
+
+void SessionRegistry::add(std::shared_ptr<core::objects::SessionInternals> session)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if (mIndex.find(session.get()) != mIndex.end())
+	{
+		return;
+	}
+
+	// determined under the lock, a concurrent updateState would otherwise ignore the session not added yet
+	auto state = getState(*session);
+	auto& bucket = getBucket(state);
+	auto position = bucket.insert(bucket.end(), session);
+	mIndex.emplace(session.get(), Location(state, position));
+}
+
+bool SessionRegistry::remove(const std::shared_ptr<core::objects::SessionInternals>& session)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto it = mIndex.find(session.get());
+	if (it == mIndex.end())
+	{
+		return false;
+	}
+
+	getBucket(it->second.state).erase(it->second.position);
+	mIndex.erase(it);
+
+	return true;
+}
+
+void SessionRegistry::updateState(const std::shared_ptr<core::objects::SessionInternals>& session)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto it = mIndex.find(session.get());
+	if (it == mIndex.end())
+	{
+		return;
+	}
+
+	auto newState = getState(*session);
+	if (newState <= it->second.state)
+	{
+		// no state transition, states are never moved backwards
+		return;
+	}
+
+	// splicing keeps the iterator stored in the index valid
+	auto& newBucket = getBucket(newState);
+	newBucket.splice(newBucket.end(), getBucket(it->second.state), it->second.position);
+	it->second.state = newState;
+}
+
+std::vector<std::shared_ptr<core::objects::SessionInternals>> SessionRegistry::getNotConfiguredSessions()
+{
+	std::vector<std::shared_ptr<core::objects::SessionInternals>> newSessions;
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto& bucket = getBucket(State::NEW);
+		newSessions.assign(bucket.begin(), bucket.end());
+	}
+
+	// the sessions are queried outside the lock to keep it short
+	std::vector<std::shared_ptr<core::objects::SessionInternals>> sessions;
+	for (auto& session : newSessions)
+	{
+		if (!session->isConfigured())
+		{
+			sessions.push_back(session);
+		}
+	}
+
+	return sessions;
+}
+
+std::vector<std::shared_ptr<core::objects::SessionInternals>> SessionRegistry::getOpenAndConfiguredSessions()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto& bucket = getBucket(State::CONFIGURED_AND_OPEN);
+	return std::vector<std::shared_ptr<core::objects::SessionInternals>>(bucket.begin(), bucket.end());
+}
+
+std::vector<std::shared_ptr<core::objects::SessionInternals>> SessionRegistry::getFinishedAndConfiguredSessions()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto& bucket = getBucket(State::CONFIGURED_AND_FINISHED);
+	return std::vector<std::shared_ptr<core::objects::SessionInternals>>(bucket.begin(), bucket.end());
+}
+
+std::vector<std::shared_ptr<core::objects::SessionInternals>> SessionRegistry::getAllSessions()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	std::vector<std::shared_ptr<core::objects::SessionInternals>> sessions;
+	sessions.reserve(mIndex.size());
+	for (auto& bucket : mBuckets)
+	{
+		sessions.insert(sessions.end(), bucket.begin(), bucket.end());
+	}
+
+	return sessions;
+}
+
+size_t SessionRegistry::size()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	return mIndex.size();
+}
+
+SessionRegistry::SessionList& SessionRegistry::getBucket(State state)
+{
+	return mBuckets[static_cast<size_t>(state)];
+}
+
+SessionRegistry::State SessionRegistry::getState(core::objects::SessionInternals& session)
+{
+	if (session.isConfiguredAndFinished())
+	{
+		return State::CONFIGURED_AND_FINISHED;
+	}
+
+	if (session.isConfiguredAndOpen())
+	{
+		return State::CONFIGURED_AND_OPEN;
+	}
+
+	return State::NEW;
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_COMMUNICATION_SESSIONREGISTRY_H
+#define _CORE_COMMUNICATION_SESSIONREGISTRY_H
+
+#include "core/objects/SessionInternals.h"
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace core
+{
+	namespace communication
+	{
+		///
+		/// Registry of the sessions, which have not been sent completely yet.
+		///
+		/// @par
+		/// The sessions are kept in buckets by their lifecycle state (new, configured and open, configured and finished),
+		/// so that retrieving the sessions of one state only needs to visit the sessions, which might be in this state.
+		/// Sessions are indexed by their address, which allows removing a session in constant time.
+		///
+		/// @par
+		/// A session is put into the bucket of its state when it is added. Whenever a session is configured or finished
+		/// afterwards, @ref updateState has to be called to move it to the bucket of its new state. States are only
+		/// moved forward, thus the getters never need to check the state of configured sessions.
+		///
+		class SessionRegistry
+		{
+		public:
+			///
+			/// Constructor
+			///
+			SessionRegistry();
+
+			///
+			/// Delete the copy constructor
+			///
+			SessionRegistry(const SessionRegistry&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			SessionRegistry& operator = (const SessionRegistry&) = delete;
+
+			///
+			/// Adds the given session, unless it was already added.
+			///
+			/// @param[in] session the session to add
+			///
+			void add(std::shared_ptr<core::objects::SessionInternals> session);
+
+			///
+			/// Removes the given session.
+			///
+			/// @param[in] session the session to remove
+			/// @return @c true if the session was removed, @c false if it was not registered.
+			///
+			bool remove(const std::shared_ptr<core::objects::SessionInternals>& session);
+
+			///
+			/// Moves the given session to the bucket of its current state.
+			///
+			/// @par
+			/// Must be called after the session was configured or finished. Unknown sessions are ignored.
+			///
+			/// @param[in] session the session which changed its state
+			///
+			void updateState(const std::shared_ptr<core::objects::SessionInternals>& session);
+
+			///
+			/// Returns all sessions, which are not yet configured.
+			///
+			std::vector<std::shared_ptr<core::objects::SessionInternals>> getNotConfiguredSessions();
+
+			///
+			/// Returns all sessions, which are configured and still open.
+			///
+			std::vector<std::shared_ptr<core::objects::SessionInternals>> getOpenAndConfiguredSessions();
+
+			///
+			/// Returns all sessions, which are configured and finished.
+			///
+			std::vector<std::shared_ptr<core::objects::SessionInternals>> getFinishedAndConfiguredSessions();
+
+			///
+			/// Returns all sessions, regardless of their state.
+			///
+			std::vector<std::shared_ptr<core::objects::SessionInternals>> getAllSessions();
+
+			///
+			/// Returns the number of registered sessions.
+			///
+			size_t size();
+
+		private:
+			///
+			/// The lifecycle states, in the order they are passed
+			///
+			enum class State : int32_t
+			{
+				NEW = 0,
+				CONFIGURED_AND_OPEN = 1,
+				CONFIGURED_AND_FINISHED = 2
+			};
+
+			using SessionList = std::list<std::shared_ptr<core::objects::SessionInternals>>;
+
+			///
+			/// Location of a session in the buckets
+			///
+			struct Location
+			{
+				///
+				/// Constructor
+				///
+				/// @param[in] state the state of the session
+				/// @param[in] position the position of the session in the bucket of @c state
+				///
+				Location(State state, SessionList::iterator position)
+					: state(state)
+					, position(position)
+				{
+				}
+
+				/// the state and thereby the bucket the session is kept in
+				State state;
+
+				/// the position of the session in its bucket
+				SessionList::iterator position;
+			};
+
+			///
+			/// Returns the bucket of the given state.
+			///
+			SessionList& getBucket(State state);
+
+			///
+			/// Determines the current state of the given session.
+			///
+			/// @par
+			/// Called while holding @ref mMutex, so that a state transition cannot get lost between determining the
+			/// state and updating the index. Sessions never call into the registry while holding their own lock.
+			///
+			static State getState(core::objects::SessionInternals& session);
+
+			/// buckets of sessions, one per state
+			std::array<SessionList, 3> mBuckets;
+
+			/// index of all sessions
+			std::unordered_map<const core::objects::SessionInternals*, Location> mIndex;
+
+			/// synchronization
+			std::mutex mMutex;
+		};
+	}
+}
+
+#endif
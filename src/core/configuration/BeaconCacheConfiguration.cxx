@@ -22,6 +22,10 @@ BeaconCacheConfiguration::BeaconCacheConfiguration(const openkit::IOpenKitBuilde
 	: mMaxRecordAge(builder.getBeaconCacheMaxRecordAge())
 	, mCacheSizeLowerBound(builder.getBeaconCacheLowerMemoryBoundary())
 	, mCacheSizeUpperBound(builder.getBeaconCacheUpperMemoryBoundary())
+	, mOverflowDirectory(builder.getBeaconCacheOverflowDirectory())
+	, mOverflowMaxSize(builder.getBeaconCacheOverflowMaxSize())
+	, mRecordQueueCapacity(builder.getBeaconRecordQueueCapacity())
+	, mRecordQueueFullPolicy(builder.getBeaconRecordQueueFullPolicy())
 {
 }
 
@@ -44,4 +48,24 @@ int64_t BeaconCacheConfiguration::getCacheSizeLowerBound() const
 int64_t BeaconCacheConfiguration::getCacheSizeUpperBound() const
 {
 	return mCacheSizeUpperBound;
+}
+
+const std::string& BeaconCacheConfiguration::getOverflowDirectory() const
+{
+	return mOverflowDirectory;
+}
+
+int64_t BeaconCacheConfiguration::getOverflowMaxSize() const
+{
+	return mOverflowMaxSize;
+}
+
+int32_t BeaconCacheConfiguration::getRecordQueueCapacity() const
+{
+	return mRecordQueueCapacity;
+}
+
+openkit::BeaconRecordQueueFullPolicy BeaconCacheConfiguration::getRecordQueueFullPolicy() const
+{
+	return mRecordQueueFullPolicy;
 }
\ No newline at end of file
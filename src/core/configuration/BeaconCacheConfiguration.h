@@ -21,6 +21,7 @@
 #include "OpenKit/IOpenKitBuilder.h"
 
 #include <cstdint>
+#include <string>
 
 namespace core
 {
@@ -64,6 +65,26 @@ namespace core
 			///
 			int64_t getCacheSizeUpperBound() const override;
 
+			///
+			/// Get the directory for records exceeding the cache size.
+			///
+			const std::string& getOverflowDirectory() const override;
+
+			///
+			/// Get the maximum size of the records stored on disk.
+			///
+			int64_t getOverflowMaxSize() const override;
+
+			///
+			/// Get the capacity of the queue used to submit records asynchronously.
+			///
+			int32_t getRecordQueueCapacity() const override;
+
+			///
+			/// Get the policy applied, if the queue used to submit records asynchronously is full.
+			///
+			openkit::BeaconRecordQueueFullPolicy getRecordQueueFullPolicy() const override;
+
 		private:
 			/// maximum record age
 			int64_t mMaxRecordAge;
@@ -73,6 +94,18 @@ namespace core
 
 			/// upper memory limit for the cache
 			int64_t mCacheSizeUpperBound;
+
+			/// directory for records exceeding the cache size
+			std::string mOverflowDirectory;
+
+			/// maximum size of the records stored on disk
+			int64_t mOverflowMaxSize;
+
+			/// capacity of the queue used to submit records asynchronously
+			int32_t mRecordQueueCapacity;
+
+			/// policy applied if the queue used to submit records asynchronously is full
+			openkit::BeaconRecordQueueFullPolicy mRecordQueueFullPolicy;
 		};
 	}
 }
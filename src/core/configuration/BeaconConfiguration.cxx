@@ -33,6 +33,7 @@ BeaconConfiguration::BeaconConfiguration(
 			.build()
 	)
 	, mServerConfiguration(nullptr)
+	, mServerConfigurationSnapshot(ServerConfigurationSnapshot::from(ServerConfiguration::defaultInstance()).getPackedValue())
 	, mIsServerConfigurationSet(false)
 	, mServerConfigurationUpdateCallback(nullptr)
 	, mMutex()
@@ -73,6 +74,20 @@ std::shared_ptr<IServerConfiguration> BeaconConfiguration::getServerConfiguratio
 	return getServerConfigurationOrDefault();
 }
 
+ServerConfigurationSnapshot BeaconConfiguration::getServerConfigurationSnapshot() const
+{
+	return ServerConfigurationSnapshot(mServerConfigurationSnapshot.load(std::memory_order_acquire));
+}
+
+void BeaconConfiguration::setServerConfiguration(std::shared_ptr<IServerConfiguration> serverConfiguration)
+{
+	mServerConfiguration = serverConfiguration;
+	mServerConfigurationSnapshot.store(
+		ServerConfigurationSnapshot::from(getServerConfigurationOrDefault()).getPackedValue(),
+		std::memory_order_release
+	);
+}
+
 void BeaconConfiguration::initializeServerConfiguration(std::shared_ptr<IServerConfiguration> initialServerConfiguration)
 {
 	if ((initialServerConfiguration == nullptr)
@@ -92,7 +107,7 @@ void BeaconConfiguration::initializeServerConfiguration(std::shared_ptr<IServerC
 			return;
 		}
 
-		mServerConfiguration = initialServerConfiguration;
+		setServerConfiguration(initialServerConfiguration);
 
 		callback = mServerConfigurationUpdateCallback;
 	}
@@ -126,7 +141,7 @@ void BeaconConfiguration::updateServerConfiguration(
 			newServerConfiguration = mServerConfiguration->merge(newServerConfiguration);
 		}
 
-		mServerConfiguration = newServerConfiguration;
+		setServerConfiguration(newServerConfiguration);
 		mIsServerConfigurationSet = true;
 
 		callback = mServerConfigurationUpdateCallback;
@@ -154,9 +169,9 @@ void BeaconConfiguration::updateCaptureWith(bool captureState)
 	std::lock_guard<std::recursive_mutex> lock(mMutex);
 
 	auto currentServerConfig = getServerConfigurationOrDefault();
-	mServerConfiguration = ServerConfiguration::Builder(currentServerConfig)
+	setServerConfiguration(ServerConfiguration::Builder(currentServerConfig)
 		.withCapture(captureState)
-		.build();
+		.build());
 
 	mIsServerConfigurationSet = true;
 }
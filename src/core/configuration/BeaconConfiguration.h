@@ -23,6 +23,7 @@
 #include "IPrivacyConfiguration.h"
 #include "IServerConfiguration.h"
 
+#include <atomic>
 #include <mutex>
 
 namespace core
@@ -66,6 +67,8 @@ namespace core
 
 			std::shared_ptr<IServerConfiguration> getServerConfiguration() override;
 
+			ServerConfigurationSnapshot getServerConfigurationSnapshot() const override;
+
 			void initializeServerConfiguration(std::shared_ptr<IServerConfiguration> initialServerConfiguration) override;
 
 			void enableCapture() override;
@@ -89,6 +92,15 @@ namespace core
 
 			std::shared_ptr<IServerConfiguration> getServerConfigurationOrDefault();
 
+			///
+			/// Sets the server configuration and publishes its snapshot.
+			///
+			/// Must only be called while holding @ref mMutex.
+			///
+			/// @param serverConfiguration the new server configuration
+			///
+			void setServerConfiguration(std::shared_ptr<IServerConfiguration> serverConfiguration);
+
 			/// application related configuration
 			const std::shared_ptr<IOpenKitConfiguration> mOpenKitConfiguration;
 
@@ -101,6 +113,9 @@ namespace core
 			/// server related configuration
 			std::shared_ptr<IServerConfiguration> mServerConfiguration;
 
+			/// packed snapshot of the server configuration or its default, read without locking
+			std::atomic<uint64_t> mServerConfigurationSnapshot;
+
 			/// indicator if server configuration was set or not
 			bool mIsServerConfigurationSet;
 
@@ -17,6 +17,8 @@
 #ifndef _CORE_CONFIGURATION_CONFIGURATIONDEFAULTS_H
 #define _CORE_CONFIGURATION_CONFIGURATIONDEFAULTS_H
 
+#include "OpenKit/BeaconRecordQueueFullPolicy.h"
+#include "OpenKit/CompressionStrategy.h"
 #include "OpenKit/CrashReportingLevel.h"
 #include "OpenKit/DataCollectionLevel.h"
 
@@ -63,6 +65,72 @@ namespace core
 		/// Specifies the default multiplicity.
 		///
 		static constexpr int32_t DEFAULT_MULTIPLICITY = 1;
+
+		///
+		/// Default maximum number of idle HTTP connections kept by the HTTP connection pool.
+		///
+		static constexpr int32_t DEFAULT_HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS = 4;
+
+		///
+		/// Default time after which an idle HTTP connection is closed.
+		///
+		static constexpr int64_t DEFAULT_HTTP_CONNECTION_POOL_IDLE_TIMEOUT_IN_MILLIS = 60 * 1000;			// 1 minute
+
+		///
+		/// Default maximum number of beacon requests sent concurrently.
+		///
+		/// @par
+		/// By default sessions are sent one after another.
+		///
+		static constexpr int32_t DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS = 1;
+
+		///
+		/// Default level used to compress beacon data (zlib's default level).
+		///
+		static constexpr int32_t DEFAULT_BEACON_COMPRESSION_LEVEL = -1;
+
+		///
+		/// Default strategy used to compress beacon data.
+		///
+		static constexpr openkit::CompressionStrategy DEFAULT_BEACON_COMPRESSION_STRATEGY = openkit::CompressionStrategy::DEFAULT;
+
+		///
+		/// Defines the default maximum size of the beacon cache's overflow files
+		///
+		/// @par
+		/// The overflow is only used if a directory was configured.
+		/// The default maximum size is 256 MB
+		///
+		static constexpr int64_t DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES = 256 * 1024 * 1024;	// 256MiB
+
+		///
+		/// Defines the default capacity of the queue used to submit beacon data asynchronously
+		///
+		/// @par
+		/// By default beacon data is added to the beacon cache synchronously.
+		///
+		static constexpr int32_t DEFAULT_BEACON_RECORD_QUEUE_CAPACITY = 0;
+
+		///
+		/// Default policy applied, if the queue used to submit beacon data asynchronously is full.
+		///
+		static constexpr openkit::BeaconRecordQueueFullPolicy DEFAULT_BEACON_RECORD_QUEUE_FULL_POLICY = openkit::BeaconRecordQueueFullPolicy::BLOCK;
+
+		///
+		/// Defines whether background work is run on the process-wide executor by default
+		///
+		/// @par
+		/// By default each OpenKit instance uses dedicated background threads.
+		///
+		static constexpr bool DEFAULT_SHARED_EXECUTOR_ENABLED = false;
+
+		///
+		/// Defines the default capacity of the queue used by the default logger to write log records asynchronously
+		///
+		/// @par
+		/// By default log records are written synchronously.
+		///
+		static constexpr int32_t DEFAULT_LOG_RECORD_QUEUE_CAPACITY = 0;
 	}
 }
 
@@ -15,6 +15,7 @@
  */
 
 #include "HTTPClientConfiguration.h"
+#include "ConfigurationDefaults.h"
 
 using namespace core::configuration;
 
@@ -27,6 +28,7 @@ HTTPClientConfiguration::HTTPClientConfiguration(
 	, mSSLTrustManager(builder.getTrustManager())
 	, mHttpRequestInterceptor(builder.getHttpRequestInterceptor())
 	, mHttpResponseInterceptor(builder.getHttpResponseInterceptor())
+	, mMaxConcurrentRequests(builder.getMaxConcurrentRequests())
 {
 }
 
@@ -72,6 +74,11 @@ std::shared_ptr<openkit::IHttpResponseInterceptor> HTTPClientConfiguration::getH
 	return mHttpResponseInterceptor;
 }
 
+int32_t HTTPClientConfiguration::getMaxConcurrentRequests() const
+{
+	return mMaxConcurrentRequests;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Builder implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +90,7 @@ HTTPClientConfiguration::Builder::Builder()
  , mTrustManager(nullptr)
  , mHttpRequestInterceptor(nullptr)
  , mHttpResponseInterceptor(nullptr)
+ , mMaxConcurrentRequests(DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS)
 {
 }
 
@@ -93,6 +101,7 @@ HTTPClientConfiguration::Builder::Builder(std::shared_ptr<IOpenKitConfiguration>
 	, mTrustManager(openKitConfig->getTrustManager())
 	, mHttpRequestInterceptor(openKitConfig->getHttpRequestInterceptor())
 	, mHttpResponseInterceptor(openKitConfig->getHttpResponseInterceptor())
+	, mMaxConcurrentRequests(openKitConfig->getMaxConcurrentBeaconRequests())
 {
 }
 
@@ -103,6 +112,7 @@ HTTPClientConfiguration::Builder::Builder(std::shared_ptr<IHTTPClientConfigurati
 	, mTrustManager(httpClientConfig->getSSLTrustManager())
 	, mHttpRequestInterceptor(httpClientConfig->getHttpRequestInterceptor())
 	, mHttpResponseInterceptor(httpClientConfig->getHttpResponseInterceptor())
+	, mMaxConcurrentRequests(httpClientConfig->getMaxConcurrentRequests())
 {
 }
 
@@ -182,6 +192,17 @@ std::shared_ptr<openkit::IHttpResponseInterceptor>HTTPClientConfiguration::Build
 	return mHttpResponseInterceptor;
 }
 
+HTTPClientConfiguration::Builder& HTTPClientConfiguration::Builder::withMaxConcurrentRequests(int32_t maxConcurrentRequests)
+{
+	mMaxConcurrentRequests = maxConcurrentRequests;
+	return *this;
+}
+
+int32_t HTTPClientConfiguration::Builder::getMaxConcurrentRequests() const
+{
+	return mMaxConcurrentRequests;
+}
+
 std::shared_ptr<IHTTPClientConfiguration> HTTPClientConfiguration::Builder::build()
 {
 	return std::make_shared<HTTPClientConfiguration>(*this);
@@ -84,6 +84,10 @@ namespace core
 
 				Builder& withHttpResponseInterceptor(std::shared_ptr<openkit::IHttpResponseInterceptor> httpResponseInterceptor);
 
+				int32_t getMaxConcurrentRequests() const;
+
+				Builder& withMaxConcurrentRequests(int32_t maxConcurrentRequests);
+
 				std::shared_ptr<core::configuration::IHTTPClientConfiguration> build();
 
 			private:
@@ -99,6 +103,8 @@ namespace core
 				std::shared_ptr<openkit::IHttpRequestInterceptor> mHttpRequestInterceptor;
 
 				std::shared_ptr<openkit::IHttpResponseInterceptor> mHttpResponseInterceptor;
+
+				int32_t mMaxConcurrentRequests;
 			};
 
 			///
@@ -158,6 +164,11 @@ namespace core
 			///
 			std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const override;
 
+			///
+			/// Returns the maximum number of beacon requests sent concurrently.
+			///
+			int32_t getMaxConcurrentRequests() const override;
+
 		private:
 			/// the beacon URL
 			const core::UTF8String mBaseURL;
@@ -176,6 +187,9 @@ namespace core
 
 			/// used for intercepting HTTP responses from the backend
 			const std::shared_ptr<openkit::IHttpResponseInterceptor> mHttpResponseInterceptor;
+
+			/// maximum number of concurrently sent beacon requests
+			const int32_t mMaxConcurrentRequests;
 		};
 	}
 }
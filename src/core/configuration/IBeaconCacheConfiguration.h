@@ -17,7 +17,10 @@
 #ifndef _CORE_CONFIGURATION_IBEACONCACHECONFIGURATION_H
 #define _CORE_CONFIGURATION_IBEACONCACHECONFIGURATION_H
 
+#include "OpenKit/BeaconRecordQueueFullPolicy.h"
+
 #include <cstdint>
+#include <string>
 
 namespace core
 {
@@ -50,6 +53,28 @@ namespace core
 			/// Returns the upper cache size which, upon exceeding, will start the space eviction strategy.
 			///
 			virtual int64_t getCacheSizeUpperBound() const = 0;
+
+			///
+			/// Returns the directory where records exceeding the cache size are stored or an empty string, if such
+			/// records are discarded.
+			///
+			virtual const std::string& getOverflowDirectory() const = 0;
+
+			///
+			/// Returns the maximum size (in bytes) of the records stored in the @ref getOverflowDirectory().
+			///
+			virtual int64_t getOverflowMaxSize() const = 0;
+
+			///
+			/// Returns the capacity of the queue used to submit records asynchronously or @c 0, if records are
+			/// added to the beacon cache synchronously.
+			///
+			virtual int32_t getRecordQueueCapacity() const = 0;
+
+			///
+			/// Returns the policy applied, if the queue used to submit records asynchronously is full.
+			///
+			virtual openkit::BeaconRecordQueueFullPolicy getRecordQueueFullPolicy() const = 0;
 		};
 	}
 }
@@ -23,6 +23,7 @@
 #include "core/configuration/IOpenKitConfiguration.h"
 #include "core/configuration/IPrivacyConfiguration.h"
 #include "core/configuration/IServerConfiguration.h"
+#include "core/configuration/ServerConfigurationSnapshot.h"
 
 #include <cstdint>
 #include <functional>
@@ -65,6 +66,14 @@ namespace core
 			///
 			virtual std::shared_ptr<IServerConfiguration> getServerConfiguration() = 0;
 
+			///
+			/// Returns a snapshot of the server configuration attributes required for capturing data.
+			///
+			/// @par
+			/// In contrast to @ref getServerConfiguration() the snapshot is read without any locking.
+			///
+			virtual ServerConfigurationSnapshot getServerConfigurationSnapshot() const = 0;
+
 			///
 			/// Initializes this beacon configuration with the given server configuration. This will not set
 			/// IBeaconConfiguration::isServerConfigurationSet to @c true so that new session requests to the server will
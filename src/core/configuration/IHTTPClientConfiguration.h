@@ -66,6 +66,11 @@ namespace core
 			/// from Dynatrace backend.
 			///
 			virtual std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const = 0;
+
+			///
+			/// Returns the maximum number of beacon requests sent concurrently.
+			///
+			virtual int32_t getMaxConcurrentRequests() const = 0;
 		};
 	}
 }
@@ -17,6 +17,7 @@
 #ifndef _CORE_CONFIGURATION_IOPENKITCONFIGURATION_H
 #define _CORE_CONFIGURATION_IOPENKITCONFIGURATION_H
 
+#include "OpenKit/CompressionStrategy.h"
 #include "OpenKit/ISSLTrustManager.h"
 #include "OpenKit/IHttpRequestInterceptor.h"
 #include "OpenKit/IHttpResponseInterceptor.h"
@@ -103,6 +104,36 @@ namespace core
 			/// Returns the openkit::IHttpResponseInterceptor
 			///
 			virtual std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const = 0;
+
+			///
+			/// Returns the maximum number of idle connections kept by the HTTP connection pool.
+			///
+			virtual int32_t getHttpConnectionPoolMaxIdleConnections() const = 0;
+
+			///
+			/// Returns the time in milliseconds after which an idle HTTP connection is closed.
+			///
+			virtual int64_t getHttpConnectionPoolIdleTimeout() const = 0;
+
+			///
+			/// Returns the maximum number of beacon requests sent concurrently.
+			///
+			virtual int32_t getMaxConcurrentBeaconRequests() const = 0;
+
+			///
+			/// Returns the level used to compress beacon data.
+			///
+			virtual int32_t getBeaconCompressionLevel() const = 0;
+
+			///
+			/// Returns the strategy used to compress beacon data.
+			///
+			virtual openkit::CompressionStrategy getBeaconCompressionStrategy() const = 0;
+
+			///
+			/// Returns whether background work is run on the process-wide executor.
+			///
+			virtual bool isSharedExecutorEnabled() const = 0;
 		};
 	}
 }
@@ -34,6 +34,12 @@ OpenKitConfiguration::OpenKitConfiguration(const openkit::IOpenKitBuilder& build
 	, mTrustManager(builder.getTrustManager())
 	, mHttpRequestInterceptor(builder.getHttpRequestInterceptor())
 	, mHttpResponseInterceptor(builder.getHttpResponseInterceptor())
+	, mHttpConnectionPoolMaxIdleConnections(builder.getHttpConnectionPoolMaxIdleConnections())
+	, mHttpConnectionPoolIdleTimeout(builder.getHttpConnectionPoolIdleTimeout())
+	, mMaxConcurrentBeaconRequests(builder.getMaxConcurrentBeaconRequests())
+	, mBeaconCompressionLevel(builder.getBeaconCompressionLevel())
+	, mBeaconCompressionStrategy(builder.getBeaconCompressionStrategy())
+	, mIsSharedExecutorEnabled(builder.isSharedExecutorEnabled())
 {
 }
 
@@ -114,3 +120,33 @@ std::shared_ptr<openkit::IHttpResponseInterceptor> OpenKitConfiguration::getHttp
 {
 	return mHttpResponseInterceptor;
 }
+
+int32_t OpenKitConfiguration::getHttpConnectionPoolMaxIdleConnections() const
+{
+	return mHttpConnectionPoolMaxIdleConnections;
+}
+
+int64_t OpenKitConfiguration::getHttpConnectionPoolIdleTimeout() const
+{
+	return mHttpConnectionPoolIdleTimeout;
+}
+
+int32_t OpenKitConfiguration::getMaxConcurrentBeaconRequests() const
+{
+	return mMaxConcurrentBeaconRequests;
+}
+
+int32_t OpenKitConfiguration::getBeaconCompressionLevel() const
+{
+	return mBeaconCompressionLevel;
+}
+
+openkit::CompressionStrategy OpenKitConfiguration::getBeaconCompressionStrategy() const
+{
+	return mBeaconCompressionStrategy;
+}
+
+bool OpenKitConfiguration::isSharedExecutorEnabled() const
+{
+	return mIsSharedExecutorEnabled;
+}
@@ -81,6 +81,18 @@ namespace core
 
 			std::shared_ptr<openkit::IHttpResponseInterceptor> getHttpResponseInterceptor() const override;
 
+			int32_t getHttpConnectionPoolMaxIdleConnections() const override;
+
+			int64_t getHttpConnectionPoolIdleTimeout() const override;
+
+			int32_t getMaxConcurrentBeaconRequests() const override;
+
+			int32_t getBeaconCompressionLevel() const override;
+
+			openkit::CompressionStrategy getBeaconCompressionStrategy() const override;
+
+			bool isSharedExecutorEnabled() const override;
+
 		private:
 
 			/// endpoint URL to send data to
@@ -124,6 +136,24 @@ namespace core
 
 			/// configured HTTP response interceptor
 			const std::shared_ptr<openkit::IHttpResponseInterceptor> mHttpResponseInterceptor;
+
+			/// maximum number of idle connections kept by the HTTP connection pool
+			const int32_t mHttpConnectionPoolMaxIdleConnections;
+
+			/// idle timeout of pooled HTTP connections in milliseconds
+			const int64_t mHttpConnectionPoolIdleTimeout;
+
+			/// maximum number of concurrently sent beacon requests
+			const int32_t mMaxConcurrentBeaconRequests;
+
+			/// level used to compress beacon data
+			const int32_t mBeaconCompressionLevel;
+
+			/// strategy used to compress beacon data
+			const openkit::CompressionStrategy mBeaconCompressionStrategy;
+
+			/// flag indicating whether background work is run on the process-wide executor
+			const bool mIsSharedExecutorEnabled;
 		};
 	}
 }
@@ -0,0 +1,97 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ServerConfigurationSnapshot.h"
+
+#include <algorithm>
+
+using namespace core::configuration;
+
+/// bit indicating that sending data is allowed
+constexpr uint64_t SENDING_DATA_ALLOWED_BIT = 0x01;
+/// bit indicating that sending errors is allowed
+constexpr uint64_t SENDING_ERRORS_ALLOWED_BIT = 0x02;
+/// bit indicating that sending crashes is allowed
+constexpr uint64_t SENDING_CRASHES_ALLOWED_BIT = 0x04;
+/// position of the traffic control percentage (8 bits)
+constexpr uint32_t TRAFFIC_CONTROL_PERCENTAGE_SHIFT = 8;
+/// position of the multiplicity (32 bits)
+constexpr uint32_t MULTIPLICITY_SHIFT = 32;
+
+ServerConfigurationSnapshot::ServerConfigurationSnapshot(uint64_t packedValue)
+	: mPackedValue(packedValue)
+{
+}
+
+ServerConfigurationSnapshot ServerConfigurationSnapshot::from(const std::shared_ptr<IServerConfiguration>& serverConfiguration)
+{
+	if (serverConfiguration == nullptr)
+	{
+		return ServerConfigurationSnapshot(0);
+	}
+
+	uint64_t packedValue = 0;
+	if (serverConfiguration->isSendingDataAllowed())
+	{
+		packedValue |= SENDING_DATA_ALLOWED_BIT;
+	}
+	if (serverConfiguration->isSendingErrorsAllowed())
+	{
+		packedValue |= SENDING_ERRORS_ALLOWED_BIT;
+	}
+	if (serverConfiguration->isSendingCrashesAllowed())
+	{
+		packedValue |= SENDING_CRASHES_ALLOWED_BIT;
+	}
+
+	// traffic control values are in the range [0, 99], therefore limiting the percentage does not change any decision
+	auto trafficControlPercentage = std::min(std::max(serverConfiguration->getTrafficControlPercentage(), 0), 100);
+	packedValue |= static_cast<uint64_t>(trafficControlPercentage) << TRAFFIC_CONTROL_PERCENTAGE_SHIFT;
+	packedValue |= static_cast<uint64_t>(static_cast<uint32_t>(serverConfiguration->getMultiplicity())) << MULTIPLICITY_SHIFT;
+
+	return ServerConfigurationSnapshot(packedValue);
+}
+
+bool ServerConfigurationSnapshot::isSendingDataAllowed() const
+{
+	return (mPackedValue & SENDING_DATA_ALLOWED_BIT) != 0;
+}
+
+bool ServerConfigurationSnapshot::isSendingErrorsAllowed() const
+{
+	return (mPackedValue & SENDING_ERRORS_ALLOWED_BIT) != 0;
+}
+
+bool ServerConfigurationSnapshot::isSendingCrashesAllowed() const
+{
+	return (mPackedValue & SENDING_CRASHES_ALLOWED_BIT) != 0;
+}
+
+int32_t ServerConfigurationSnapshot::getTrafficControlPercentage() const
+{
+	return static_cast<int32_t>((mPackedValue >> TRAFFIC_CONTROL_PERCENTAGE_SHIFT) & 0xFF);
+}
+
+int32_t ServerConfigurationSnapshot::getMultiplicity() const
+{
+	return static_cast<int32_t>(static_cast<uint32_t>(mPackedValue >> MULTIPLICITY_SHIFT));
+}
+
+uint64_t ServerConfigurationSnapshot::getPackedValue() const
+{
+	return mPackedValue;
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_CONFIGURATION_SERVERCONFIGURATIONSNAPSHOT_H
+#define _CORE_CONFIGURATION_SERVERCONFIGURATIONSNAPSHOT_H
+
+#include "IServerConfiguration.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace core
+{
+	namespace configuration
+	{
+		///
+		/// Immutable snapshot of the server configuration attributes, which are evaluated whenever data is captured.
+		///
+		/// @par
+		/// The attributes are packed into a single 64-bit word, which allows publishing and reading the snapshot
+		/// through a single atomic, without any locking.
+		///
+		class ServerConfigurationSnapshot
+		{
+		public:
+			///
+			/// Constructor taking the packed value of a snapshot.
+			///
+			/// @param[in] packedValue the value as returned by @ref getPackedValue()
+			///
+			explicit ServerConfigurationSnapshot(uint64_t packedValue);
+
+			///
+			/// Creates a snapshot of the given server configuration.
+			///
+			/// @param[in] serverConfiguration the server configuration to take the snapshot from
+			/// @return the snapshot, which does not allow capturing anything, if @c serverConfiguration is @c nullptr
+			///
+			static ServerConfigurationSnapshot from(const std::shared_ptr<IServerConfiguration>& serverConfiguration);
+
+			///
+			/// Returns a boolean indicating whether sending arbitrary data to the server is allowed or not.
+			///
+			bool isSendingDataAllowed() const;
+
+			///
+			/// Returns a boolean indicating whether sending errors to the server is allowed or not.
+			///
+			bool isSendingErrorsAllowed() const;
+
+			///
+			/// Returns a boolean indicating whether sending crashes to the server is allowed or not.
+			///
+			bool isSendingCrashesAllowed() const;
+
+			///
+			/// Returns the traffic control percentage, limited to the range [0, 100].
+			///
+			int32_t getTrafficControlPercentage() const;
+
+			///
+			/// Returns the multiplicity value.
+			///
+			int32_t getMultiplicity() const;
+
+			///
+			/// Returns the packed value of this snapshot.
+			///
+			uint64_t getPackedValue() const;
+
+		private:
+			/// all attributes packed into a single word
+			uint64_t mPackedValue;
+		};
+	}
+}
+
+#endif
@@ -295,23 +295,23 @@ void ActionCommonImpl::reportError(
 
 std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequest(const char* url)
 {
-	core::UTF8String urlString(url);
-	if (urlString.empty())
+	WebRequestURL webRequestURL(url);
+	if (webRequestURL.isEmpty())
 	{
 		mLogger->warning("%s traceWebRequest (string): url must not be null or empty", toString().c_str());
 		return NullWebRequestTracer::instance();
 	}
-	if (!WebRequestTracer::isValidURLScheme(urlString))
+	if (!webRequestURL.hasValidScheme())
 	{
 		mLogger->warning("%s traceWebRequest (string): url \"%s\" does not have a valid scheme",
 			toString().c_str(),
-			urlString.getStringData().c_str()
+			webRequestURL.getURL().getStringData().c_str()
 		);
 		return NullWebRequestTracer::instance();
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), urlString.getStringData().c_str());
+		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), webRequestURL.getURL().getStringData().c_str());
 	}
 
 	// synchronized scope
@@ -320,7 +320,7 @@ std::shared_ptr<openkit::IWebRequestTracer> ActionCommonImpl::traceWebRequest(co
 
 		if (!isActionLeft())
 		{
-			auto tracer = std::make_shared<core::objects::WebRequestTracer>(mLogger, shared_from_this(), mBeacon, urlString);
+			auto tracer = std::make_shared<core::objects::WebRequestTracer>(mLogger, shared_from_this(), mBeacon, webRequestURL);
 			storeChildInList(tracer);
 
 			return tracer;
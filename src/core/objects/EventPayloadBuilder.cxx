@@ -16,34 +16,103 @@
 
 #include "EventPayloadBuilder.h"
 #include "EventPayloadAttributes.h"
+#include "core/UTF8String.h"
+#include "util/json/JsonWriter.h"
 #include <OpenKit/json/JsonObjectValue.h>
 #include <OpenKit/ILogger.h>
 #include <OpenKit/json/JsonStringValue.h>
 #include <OpenKit/json/JsonArrayValue.h>
 
+#include <cstring>
+
 using namespace core::objects;
 
+constexpr uint32_t EventPayloadBuilder::NOT_REMOVED;
+
+/// Payloads exceeding this number of bytes do not keep the per-thread buffer allocated
+static constexpr size_t MAX_RETAINED_BUFFER_SIZE = 64 * 1024;
+
+static bool startsWith(const char* key, size_t keyLength, const char* prefix, size_t prefixLength)
+{
+	return keyLength >= prefixLength && memcmp(key, prefix, prefixLength) == 0;
+}
+
+static bool isReservedKey(const char* key, size_t keyLength)
+{
+	return (keyLength == 2 && memcmp(key, "dt", 2) == 0)
+		|| (startsWith(key, keyLength, "dt.", 3) && !startsWith(key, keyLength, "dt.agent.", 9));
+}
+
+static bool isReservedKey(const std::string& key)
+{
+	return isReservedKey(key.data(), key.size());
+}
+
+///
+/// Returns the number of characters of the given UTF-8 encoded data, in the same way
+/// as @ref core::UTF8String::getStringLength would.
+///
+static size_t getNumberOfCharacters(const char* data, size_t length)
+{
+	for (auto i = size_t(0); i < length; i++)
+	{
+		if (static_cast<unsigned char>(data[i]) >= 0x80)
+		{
+			return core::UTF8String(std::string(data, length)).getStringLength();
+		}
+	}
+
+	return length;
+}
+
 EventPayloadBuilder::EventPayloadBuilder
 (
 	openkit::json::JsonObjectValue::JsonObjectMapPtr attributes,
 	std::shared_ptr<openkit::ILogger> logger
 )
 	: mLogger(logger)
-	, mAttributes(std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>())
+	, mAdaptedAttributes()
+	, mCustomAttributes(&mAdaptedAttributes)
+	, mRemovedCustomAttributes()
+	, mAttributes()
+	, mNumOperations(0)
+	, mCleanedAt(0)
+	, mCustomAttributesSizeKey()
+	, mCustomAttributesSizeMeasuredAt(0)
+	, mNonFiniteNumericValuesIndicatorKey()
 {
 	if (attributes != nullptr)
 	{
-		mAttributes->insert(attributes->begin(), attributes->end());
+		mAdaptedAttributes.addMembers(*attributes);
 	}
 }
 
+EventPayloadBuilder::EventPayloadBuilder
+(
+	const openkit::json::JsonDocument& attributes,
+	std::shared_ptr<openkit::ILogger> logger
+)
+	: mLogger(logger)
+	, mAdaptedAttributes()
+	, mCustomAttributes(&attributes)
+	, mRemovedCustomAttributes()
+	, mAttributes()
+	, mNumOperations(0)
+	, mCleanedAt(0)
+	, mCustomAttributesSizeKey()
+	, mCustomAttributesSizeMeasuredAt(0)
+	, mNonFiniteNumericValuesIndicatorKey()
+{
+}
+
 EventPayloadBuilder& EventPayloadBuilder::addOverridableAttribute(const char* key, std::shared_ptr<openkit::json::JsonValue> value)
 {
 	if (value != nullptr)
 	{
-		if (mAttributes->find(key) == mAttributes->end())
+		std::string attributeKey(key);
+		if (!containsAttribute(attributeKey))
 		{
-			mAttributes->insert(std::make_pair(key, value));
+			mAttributes.push_back({ std::move(attributeKey), value, nullptr, ++mNumOperations, NOT_REMOVED });
 		}
 	}
 
@@ -54,12 +123,44 @@ EventPayloadBuilder& EventPayloadBuilder::addNonOverridableAttribute(const char*
 {
 	if (value != nullptr)
 	{
-		if (mAttributes->find(key) != mAttributes->end())
+		std::string attributeKey(key);
+		auto operation = ++mNumOperations;
+
+		if (containsAttribute(attributeKey))
 		{
 			mLogger->warning("EventPayloadBuilder addNonOverrideableAttribute: %s is reserved for internal values!", key);
+			removeAttribute(attributeKey, operation);
+		}
+
+		mAttributes.push_back({ std::move(attributeKey), value, nullptr, operation, NOT_REMOVED });
+	}
+
+	return *this;
+}
+
+EventPayloadBuilder& EventPayloadBuilder::addTemplateAttributes(const EventPayloadTemplate& eventTemplate)
+{
+	for (const auto& templateAttribute : eventTemplate.getAttributes())
+	{
+		if (templateAttribute.isOverridable)
+		{
+			if (!containsAttribute(templateAttribute.key))
+			{
+				mAttributes.push_back({ std::string(), nullptr, &templateAttribute, ++mNumOperations, NOT_REMOVED });
+			}
+
+			continue;
+		}
+
+		auto operation = ++mNumOperations;
+
+		if (containsAttribute(templateAttribute.key))
+		{
+			mLogger->warning("EventPayloadBuilder addNonOverrideableAttribute: %s is reserved for internal values!", templateAttribute.key.c_str());
+			removeAttribute(templateAttribute.key, operation);
 		}
 
-		(* mAttributes)[key] = value;
+		mAttributes.push_back({ std::string(), nullptr, &templateAttribute, operation, NOT_REMOVED });
 	}
 
 	return *this;
@@ -67,28 +168,282 @@ EventPayloadBuilder& EventPayloadBuilder::addNonOverridableAttribute(const char*
 
 EventPayloadBuilder& EventPayloadBuilder::cleanReservedInternalAttributes()
 {
-	for (auto it = (* mAttributes).begin(); it != (*mAttributes).end();) {
-		if ((*it).first.compare("dt") == 0 || ((*it).first.rfind("dt.", 0) == 0
-			&& (*it).first.rfind("dt.agent.", 0) == std::string::npos))
+	auto operation = ++mNumOperations;
+	if (mCleanedAt == 0)
+	{
+		mCleanedAt = operation;
+	}
+
+	for (auto position = mCustomAttributes->firstMember(); position != mCustomAttributes->endMember(); position = mCustomAttributes->nextMember(position))
+	{
+		size_t keyLength = 0;
+		auto keyData = mCustomAttributes->getMemberKey(position, keyLength);
+		if (!isReservedKey(keyData, keyLength))
 		{
-			mLogger->warning("EventPayloadBuilder cleanReservedInternalAttributes: %s is reserved for internal values!", (*it).first.c_str());
-			it = (*mAttributes).erase(it);
+			continue;
 		}
-		else 
+
+		std::string key(keyData, keyLength);
+		if (mRemovedCustomAttributes.find(key) == mRemovedCustomAttributes.end())
 		{
-			it++;
+			mLogger->warning("EventPayloadBuilder cleanReservedInternalAttributes: %s is reserved for internal values!", key.c_str());
+			mRemovedCustomAttributes.insert(std::make_pair(std::move(key), operation));
 		}
 	}
 
+	for (auto& attribute : mAttributes)
+	{
+		if (attribute.removedAt == NOT_REMOVED && isReservedKey(attribute.getKey()))
+		{
+			mLogger->warning("EventPayloadBuilder cleanReservedInternalAttributes: %s is reserved for internal values!", attribute.getKey().c_str());
+			attribute.removedAt = operation;
+		}
+	}
+
+	if (!mCustomAttributesSizeKey.empty() && isReservedKey(mCustomAttributesSizeKey))
+	{
+		mLogger->warning("EventPayloadBuilder cleanReservedInternalAttributes: %s is reserved for internal values!", mCustomAttributesSizeKey.c_str());
+		mCustomAttributesSizeKey.clear();
+	}
+
 	return *this;
 }
 
-openkit::json::JsonObjectValue::JsonObjectMapPtr EventPayloadBuilder::getAttributes() const
+EventPayloadBuilder& EventPayloadBuilder::addCustomAttributesSizeAttribute(const char* key)
 {
-	return mAttributes;
+	std::string attributeKey(key);
+	auto operation = ++mNumOperations;
+
+	if (containsAttribute(attributeKey))
+	{
+		mLogger->warning("EventPayloadBuilder addNonOverrideableAttribute: %s is reserved for internal values!", key);
+		removeAttribute(attributeKey, operation);
+	}
+
+	mCustomAttributesSizeKey = std::move(attributeKey);
+	mCustomAttributesSizeMeasuredAt = mCleanedAt != 0 ? mCleanedAt : operation;
+
+	return *this;
+}
+
+EventPayloadBuilder& EventPayloadBuilder::addNonFiniteNumericValuesIndicator(const char* key)
+{
+	mNonFiniteNumericValuesIndicatorKey = key;
+
+	return *this;
 }
 
 std::string EventPayloadBuilder::build()
 {
-	return openkit::json::JsonObjectValue::fromMap(mAttributes)->toString();
+	static thread_local openkit::json::JsonWriter writer;
+	writer.reset();
+
+	BuildState state = { 0, 0, 0, 0, false, nullptr, 0 };
+	auto isMeasuring = !mCustomAttributesSizeKey.empty();
+
+	writer.openObject();
+
+	for (auto position = mCustomAttributes->firstMember(); position != mCustomAttributes->endMember(); position = mCustomAttributes->nextMember(position))
+	{
+		size_t keyLength = 0;
+		auto key = mCustomAttributes->getMemberKey(position, keyLength);
+
+		auto removedAt = NOT_REMOVED;
+		if (!mRemovedCustomAttributes.empty())
+		{
+			auto it = mRemovedCustomAttributes.find(std::string(key, keyLength));
+			if (it != mRemovedCustomAttributes.end())
+			{
+				removedAt = it->second;
+			}
+		}
+
+		writeAttribute(writer, state, key, keyLength, nullptr, position,
+			removedAt == NOT_REMOVED,
+			isMeasuring && removedAt >= mCustomAttributesSizeMeasuredAt);
+	}
+
+	for (const auto& attribute : mAttributes)
+	{
+		const auto& key = attribute.getKey();
+		writeAttribute(writer, state, key.data(), key.size(), &attribute, 0,
+			attribute.removedAt == NOT_REMOVED,
+			isMeasuring && attribute.addedAt < mCustomAttributesSizeMeasuredAt && attribute.removedAt >= mCustomAttributesSizeMeasuredAt);
+	}
+
+	if (isMeasuring)
+	{
+		// the measured attributes are enclosed in braces and separated by commas
+		auto size = state.numMeasuredCharacters + 2 + (state.numMeasured > 1 ? state.numMeasured - 1 : 0);
+
+		writeKey(writer, state, mCustomAttributesSizeKey.data(), mCustomAttributesSizeKey.size());
+		writer.insertIntegerValue(static_cast<int64_t>(size));
+		state.numWritten++;
+	}
+
+	if (!mNonFiniteNumericValuesIndicatorKey.empty())
+	{
+		if (state.hasIndicatorValue)
+		{
+			// the indicator's own value is checked for non-finite values as well, before it is replaced
+			auto start = writer.getLength();
+			auto numNonFiniteValuesBefore = writer.getNumNonFiniteValues();
+
+			writeKey(writer, state, mNonFiniteNumericValuesIndicatorKey.data(), mNonFiniteNumericValuesIndicatorKey.size());
+			writeValue(writer, state.indicatorAttribute, state.indicatorPosition);
+			state.numNonFiniteValues += writer.getNumNonFiniteValues() - numNonFiniteValuesBefore;
+
+			if (state.numNonFiniteValues > 0)
+			{
+				mLogger->warning("EventPayloadBuilder addNonOverrideableAttribute: %s is reserved for internal values!", mNonFiniteNumericValuesIndicatorKey.c_str());
+				writer.truncate(start);
+			}
+			else
+			{
+				state.numWritten++;
+			}
+		}
+
+		if (state.numNonFiniteValues > 0)
+		{
+			writeKey(writer, state, mNonFiniteNumericValuesIndicatorKey.data(), mNonFiniteNumericValuesIndicatorKey.size());
+			writer.insertValue("true");
+			state.numWritten++;
+		}
+	}
+
+	writer.closeObject();
+
+	auto payload = writer.toString();
+	if (writer.getLength() > MAX_RETAINED_BUFFER_SIZE)
+	{
+		writer = openkit::json::JsonWriter();
+	}
+
+	return payload;
+}
+
+bool EventPayloadBuilder::containsAttribute(const std::string& key) const
+{
+	for (const auto& attribute : mAttributes)
+	{
+		if (attribute.removedAt == NOT_REMOVED && attribute.getKey() == key)
+		{
+			return true;
+		}
+	}
+
+	if (key == mCustomAttributesSizeKey)
+	{
+		return true;
+	}
+
+	return mCustomAttributes->containsKey(key)
+		&& mRemovedCustomAttributes.find(key) == mRemovedCustomAttributes.end();
+}
+
+void EventPayloadBuilder::removeAttribute(const std::string& key, uint32_t operation)
+{
+	for (auto& attribute : mAttributes)
+	{
+		if (attribute.removedAt == NOT_REMOVED && attribute.getKey() == key)
+		{
+			attribute.removedAt = operation;
+		}
+	}
+
+	if (key == mCustomAttributesSizeKey)
+	{
+		mCustomAttributesSizeKey.clear();
+	}
+
+	if (mCustomAttributes->containsKey(key))
+	{
+		mRemovedCustomAttributes.insert(std::make_pair(key, operation));
+	}
+}
+
+void EventPayloadBuilder::writeAttribute(openkit::json::JsonWriter& writer, BuildState& state, const char* key, size_t keyLength,
+	const Attribute* attribute, size_t position, bool isWritten, bool isMeasured) const
+{
+	if (isWritten && keyLength == mNonFiniteNumericValuesIndicatorKey.size() && keyLength > 0
+		&& memcmp(key, mNonFiniteNumericValuesIndicatorKey.data(), keyLength) == 0)
+	{
+		// written at the end, once it is known whether it is replaced by the indicator
+		state.hasIndicatorValue = true;
+		state.indicatorAttribute = attribute;
+		state.indicatorPosition = position;
+		isWritten = false;
+	}
+
+	if (!isWritten && !isMeasured)
+	{
+		return;
+	}
+
+	auto start = writer.getLength();
+	auto numNonFiniteValuesBefore = writer.getNumNonFiniteValues();
+
+	if (attribute != nullptr && attribute->templateAttribute != nullptr)
+	{
+		if (state.numWritten > 0)
+		{
+			writer.insertElementSeperator();
+		}
+
+		const auto& serializedMember = attribute->templateAttribute->serializedMember;
+		writer.insertSerialized(serializedMember.data(), serializedMember.size());
+	}
+	else
+	{
+		writeKey(writer, state, key, keyLength);
+		writeValue(writer, attribute, position);
+	}
+
+	if (isMeasured)
+	{
+		// separators are accounted for separately, since the measured attributes differ from the written ones
+		auto keyStart = start + (state.numWritten > 0 ? 1 : 0);
+		state.numMeasuredCharacters += getNumberOfCharacters(writer.getData() + keyStart, writer.getLength() - keyStart);
+		state.numMeasured++;
+	}
+
+	if (isWritten)
+	{
+		state.numNonFiniteValues += writer.getNumNonFiniteValues() - numNonFiniteValuesBefore;
+		state.numWritten++;
+	}
+	else
+	{
+		writer.truncate(start);
+	}
+}
+
+void EventPayloadBuilder::writeValue(openkit::json::JsonWriter& writer, const Attribute* attribute, size_t position) const
+{
+	if (attribute != nullptr && attribute->templateAttribute != nullptr)
+	{
+		const auto& serializedMember = attribute->templateAttribute->serializedMember;
+		auto valueOffset = attribute->templateAttribute->valueOffset;
+		writer.insertSerialized(serializedMember.data() + valueOffset, serializedMember.size() - valueOffset);
+	}
+	else if (attribute != nullptr)
+	{
+		attribute->value->writeJsonString(writer);
+	}
+	else
+	{
+		mCustomAttributes->writeMemberValue(writer, position);
+	}
+}
+
+void EventPayloadBuilder::writeKey(openkit::json::JsonWriter& writer, const BuildState& state, const char* key, size_t keyLength)
+{
+	if (state.numWritten > 0)
+	{
+		writer.insertElementSeperator();
+	}
+
+	writer.insertKey(key, keyLength);
+	writer.insertKeyValueSeperator();
 }
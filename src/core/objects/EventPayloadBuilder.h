@@ -21,11 +21,27 @@
 #include <OpenKit/json/JsonObjectValue.h>
 #include <OpenKit/ILogger.h>
 #include <OpenKit/json/JsonArrayValue.h>
+#include <OpenKit/json/JsonDocument.h>
+#include "EventPayloadTemplate.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace core
 {
 	namespace objects
 	{
+		/// <summary>
+		/// Builds the JSON payload of an event from the custom attributes and the attributes added internally.
+		/// </summary>
+		/// <remarks>
+		/// Custom attributes passed as a <see cref="openkit::json::JsonDocument"/> are neither copied nor modified,
+		/// custom attributes passed as map are adapted to a document first. Overridden and removed attributes are only
+		/// recorded and skipped when the payload is written in a single pass by <see cref="build"/>, which also
+		/// determines the values of the custom attributes size and the non-finite numeric values indicator.
+		/// </remarks>
 		class EventPayloadBuilder
 		{
 		public: 
@@ -37,6 +53,23 @@ namespace core
 			EventPayloadBuilder(openkit::json::JsonObjectValue::JsonObjectMapPtr attributes,
 				std::shared_ptr<openkit::ILogger> logger);
 
+			/// <summary>
+			/// Constructor
+			/// </summary>
+			/// <param name="attributes">Document containing attributes for sendEvent API, which must outlive the builder</param>
+			/// <param name="logger">Logger for tracing log messages</param>
+			EventPayloadBuilder(const openkit::json::JsonDocument& attributes, std::shared_ptr<openkit::ILogger> logger);
+
+			/// <summary>
+			/// Delete the copy constructor
+			/// </summary>
+			EventPayloadBuilder(const EventPayloadBuilder&) = delete;
+
+			/// <summary>
+			/// Delete the assignment operator
+			/// </summary>
+			EventPayloadBuilder& operator=(const EventPayloadBuilder&) = delete;
+
 			/// <summary>
 			/// Add an attribute which is overridable
 			/// </summary>
@@ -53,6 +86,13 @@ namespace core
 			/// <returns>Builder itself</returns>
 			EventPayloadBuilder& addNonOverridableAttribute(const char* key, std::shared_ptr<openkit::json::JsonValue> value);
 
+			/// <summary>
+			/// Add all attributes of the given template, in the same way as if they were added individually
+			/// </summary>
+			/// <param name="eventTemplate">Template holding the serialized attributes, which must outlive the builder</param>
+			/// <returns>Builder itself</returns>
+			EventPayloadBuilder& addTemplateAttributes(const EventPayloadTemplate& eventTemplate);
+
 			/// <summary>
 			/// Removes reservered internal attributes from the provided attributes
 			/// </summary>
@@ -60,10 +100,21 @@ namespace core
 			EventPayloadBuilder& cleanReservedInternalAttributes();
 
 			/// <summary>
-			/// Returns the currently used attributes
+			/// Add a non overridable attribute holding the number of characters of the payload, as it would have
+			/// been built before reserved internal attributes were cleaned for the first time, or as it would
+			/// be built now, if they were not cleaned yet.
 			/// </summary>
-			/// <returns>Attributes of the builder</returns>
-			openkit::json::JsonObjectValue::JsonObjectMapPtr getAttributes() const;
+			/// <param name="key">Key of the attribute</param>
+			/// <returns>Builder itself</returns>
+			EventPayloadBuilder& addCustomAttributesSizeAttribute(const char* key);
+
+			/// <summary>
+			/// Add a non overridable attribute with value <c>true</c>, if the built payload contains non-finite
+			/// numeric values. Otherwise an attribute with the same key is left as it is.
+			/// </summary>
+			/// <param name="key">Key of the attribute</param>
+			/// <returns>Builder itself</returns>
+			EventPayloadBuilder& addNonFiniteNumericValuesIndicator(const char* key);
 
 			/// <summary>
 			/// Building the whole payload string
@@ -72,13 +123,123 @@ namespace core
 			std::string build();
 
 		private:
+			/// <summary>
+			/// Attribute added by the builder itself
+			/// </summary>
+			struct Attribute
+			{
+				/// Key of the attribute, if it is not a template attribute
+				std::string key;
+
+				/// Value of the attribute, if it is not a template attribute
+				std::shared_ptr<openkit::json::JsonValue> value;
+
+				/// Serialized template attribute or nullptr
+				const EventPayloadTemplate::Attribute* templateAttribute;
+
+				/// Operation which added the attribute
+				uint32_t addedAt;
+
+				/// Operation which removed the attribute or NOT_REMOVED
+				uint32_t removedAt;
+
+				/// Returns the key of the attribute
+				const std::string& getKey() const
+				{
+					return templateAttribute != nullptr ? templateAttribute->key : key;
+				}
+			};
+
+			/// <summary>
+			/// Accumulated state while building the payload
+			/// </summary>
+			struct BuildState
+			{
+				/// Number of attributes written to the payload
+				size_t numWritten;
+
+				/// Number of non-finite numeric values written to the payload
+				size_t numNonFiniteValues;
+
+				/// Number of attributes accounted for the custom attributes size
+				size_t numMeasured;
+
+				/// Number of characters of the attributes accounted for the custom attributes size
+				size_t numMeasuredCharacters;
+
+				/// Flag indicating that a value is replaced by the non-finite numeric values indicator
+				bool hasIndicatorValue;
+
+				/// Internal attribute which is replaced by the non-finite numeric values indicator or nullptr
+				const Attribute* indicatorAttribute;
+
+				/// Position of the custom attribute which is replaced by the non-finite numeric values indicator
+				size_t indicatorPosition;
+			};
+
+			/// <summary>
+			/// Returns <c>true</c> if an attribute with the given key is currently part of the payload
+			/// </summary>
+			bool containsAttribute(const std::string& key) const;
+
+			/// <summary>
+			/// Removes the attribute with the given key from the payload
+			/// </summary>
+			/// <param name="key">Key of the attribute</param>
+			/// <param name="operation">Operation removing the attribute</param>
+			void removeAttribute(const std::string& key, uint32_t operation);
+
+			/// <summary>
+			/// Writes a single attribute, if it is part of the payload, and accounts it for the custom attributes
+			/// size, if it was part of the payload when the size was measured.
+			/// </summary>
+			/// <param name="attribute">Internal attribute or nullptr to write the custom attribute at <c>position</c></param>
+			void writeAttribute(openkit::json::JsonWriter& writer, BuildState& state, const char* key, size_t keyLength,
+				const Attribute* attribute, size_t position, bool isWritten, bool isMeasured) const;
+
+			/// <summary>
+			/// Writes the value of an internal attribute or the value of the custom attribute at the given position
+			/// </summary>
+			void writeValue(openkit::json::JsonWriter& writer, const Attribute* attribute, size_t position) const;
+
+			/// <summary>
+			/// Writes the key of an attribute, preceded by a separator if required
+			/// </summary>
+			static void writeKey(openkit::json::JsonWriter& writer, const BuildState& state, const char* key, size_t keyLength);
+
+			/// Marks attributes which were not removed
+			static constexpr uint32_t NOT_REMOVED = UINT32_MAX;
+
 			/// logger instance
 			std::shared_ptr<openkit::ILogger> mLogger;
 
+			/// Custom attributes passed as map, adapted to a document
+			openkit::json::JsonDocument mAdaptedAttributes;
+
+			/// Custom attributes, which are not modified by the builder
+			const openkit::json::JsonDocument* mCustomAttributes;
+
+			/// Custom attributes removed or overridden (key=attribute key, value=operation which removed it)
+			std::unordered_map<std::string, uint32_t> mRemovedCustomAttributes;
+
 			/// Internal attributes
-			openkit::json::JsonObjectValue::JsonObjectMapPtr mAttributes;
+			std::vector<Attribute> mAttributes;
+
+			/// Number of operations modifying the attributes
+			uint32_t mNumOperations;
+
+			/// Operation which cleaned reserved internal attributes the first time or 0
+			uint32_t mCleanedAt;
+
+			/// Key of the custom attributes size attribute or empty
+			std::string mCustomAttributesSizeKey;
+
+			/// Operation before which the custom attributes size is measured
+			uint32_t mCustomAttributesSizeMeasuredAt;
 
+			/// Key of the non-finite numeric values indicator or empty
+			std::string mNonFiniteNumericValuesIndicatorKey;
 		};
 	}
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EventPayloadTemplate.h"
+#include "util/json/JsonWriter.h"
+
+using namespace core::objects;
+
+EventPayloadTemplate::EventPayloadTemplate()
+	: mAttributes()
+{
+}
+
+EventPayloadTemplate& EventPayloadTemplate::addOverridableAttribute(const char* key, const openkit::json::JsonValue& value)
+{
+	return addAttribute(key, value, true);
+}
+
+EventPayloadTemplate& EventPayloadTemplate::addNonOverridableAttribute(const char* key, const openkit::json::JsonValue& value)
+{
+	return addAttribute(key, value, false);
+}
+
+const std::vector<EventPayloadTemplate::Attribute>& EventPayloadTemplate::getAttributes() const
+{
+	return mAttributes;
+}
+
+EventPayloadTemplate& EventPayloadTemplate::addAttribute(const char* key, const openkit::json::JsonValue& value, bool isOverridable)
+{
+	openkit::json::JsonWriter writer;
+	writer.insertKey(key);
+	writer.insertKeyValueSeperator();
+
+	auto valueOffset = writer.getLength();
+	value.writeJsonString(writer);
+
+	mAttributes.push_back({ key, writer.toString(), valueOffset, isOverridable });
+
+	return *this;
+}
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_OBJECTS_EVENTPAYLOADTEMPLATE_H
+#define _CORE_OBJECTS_EVENTPAYLOADTEMPLATE_H
+
+#include <OpenKit/json/JsonValue.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace core
+{
+	namespace objects
+	{
+		/// <summary>
+		/// Attributes which are added to every event payload of a session, serialized once up front.
+		/// </summary>
+		/// <remarks>
+		/// The serialized attributes are spliced into the payload by <see cref="EventPayloadBuilder"/>, which applies
+		/// the same rules for overridable and non-overridable attributes as for attributes added individually.
+		/// </remarks>
+		class EventPayloadTemplate
+		{
+		public:
+			/// <summary>
+			/// Serialized attribute of the template
+			/// </summary>
+			struct Attribute
+			{
+				/// Key of the attribute
+				std::string key;
+
+				/// Serialized key value pair of the attribute
+				std::string serializedMember;
+
+				/// Position of the serialized value within the serialized key value pair
+				size_t valueOffset;
+
+				/// Flag indicating whether a custom attribute with the same key takes precedence
+				bool isOverridable;
+			};
+
+			/// <summary>
+			/// Constructor
+			/// </summary>
+			EventPayloadTemplate();
+
+			/// <summary>
+			/// Add an attribute which is overridable
+			/// </summary>
+			/// <param name="key">Key of the attribute</param>
+			/// <param name="value">Value of the attribute</param>
+			/// <returns>Template itself</returns>
+			EventPayloadTemplate& addOverridableAttribute(const char* key, const openkit::json::JsonValue& value);
+
+			/// <summary>
+			/// Add an attribute which is not overridable
+			/// </summary>
+			/// <param name="key">Key of the attribute</param>
+			/// <param name="value">Value of the attribute</param>
+			/// <returns>Template itself</returns>
+			EventPayloadTemplate& addNonOverridableAttribute(const char* key, const openkit::json::JsonValue& value);
+
+			/// <summary>
+			/// Returns the attributes in the order they were added
+			/// </summary>
+			const std::vector<Attribute>& getAttributes() const;
+
+		private:
+			/// <summary>
+			/// Serializes and adds an attribute
+			/// </summary>
+			EventPayloadTemplate& addAttribute(const char* key, const openkit::json::JsonValue& value, bool isOverridable);
+
+			/// Serialized attributes
+			std::vector<Attribute> mAttributes;
+		};
+	}
+}
+#endif
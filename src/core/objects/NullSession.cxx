@@ -72,7 +72,17 @@ void NullSession::sendBizEvent(const char* /*type*/, const openkit::json::JsonOb
 	// intentionally left empty, due to NullObject pattern
 }
 
+void NullSession::sendBizEvent(const char* /*type*/, const openkit::json::JsonDocument& /*attributes*/)
+{
+	// intentionally left empty, due to NullObject pattern
+}
+
 void NullSession::sendEvent(const char* /*name*/, const openkit::json::JsonObjectValue::JsonObjectMapPtr /*attributes*/)
+{
+	// intentionally left empty, due to NullObject pattern
+}
+
+void NullSession::sendEvent(const char* /*name*/, const openkit::json::JsonDocument& /*attributes*/)
 {
 	// intentionally left empty, due to NullObject pattern
 }
\ No newline at end of file
@@ -58,7 +58,11 @@ namespace core
 
 			void sendBizEvent(const char* /*type*/, const openkit::json::JsonObjectValue::JsonObjectMapPtr /*attributes*/) override;
 
+			void sendBizEvent(const char* /*type*/, const openkit::json::JsonDocument& /*attributes*/) override;
+
 			void sendEvent(const char* /*name*/, const openkit::json::JsonObjectValue::JsonObjectMapPtr /*attributes*/) override;
+
+			void sendEvent(const char* /*name*/, const openkit::json::JsonDocument& /*attributes*/) override;
 		};
 	}
 }
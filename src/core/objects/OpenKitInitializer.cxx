@@ -19,13 +19,16 @@
 #include "core/BeaconSender.h"
 #include "core/SessionWatchdog.h"
 #include "core/SessionWatchdogContext.h"
+#include "core/caching/AsyncBeaconCache.h"
 #include "core/caching/BeaconCache.h"
 #include "core/caching/BeaconCacheEvictor.h"
+#include "core/caching/BeaconCacheOverflowStore.h"
 #include "core/configuration/BeaconCacheConfiguration.h"
 #include "core/configuration/HTTPClientConfiguration.h"
 #include "core/configuration/OpenKitConfiguration.h"
 #include "core/configuration/PrivacyConfiguration.h"
 #include "core/util/InterruptibleThreadSuspender.h"
+#include "core/util/SharedExecutor.h"
 #include "providers/DefaultHTTPClientProvider.h"
 #include "providers/DefaultSessionIDProvider.h"
 #include "providers/DefaultThreadIDProvider.h"
@@ -45,12 +48,46 @@ OpenKitInitializer::OpenKitInitializer(const openkit::IOpenKitBuilder& builder)
 	, mBeaconSender(nullptr)
 	, mSessionWatchdog(nullptr)
 {
-	mBeaconCache = std::make_shared<core::caching::BeaconCache>(mLogger);
+	auto beaconCacheConfig = core::configuration::BeaconCacheConfiguration::from(builder);
+	std::shared_ptr<core::caching::BeaconCacheOverflowStore> overflowStore = nullptr;
+	if (!beaconCacheConfig->getOverflowDirectory().empty())
+	{
+		overflowStore = std::make_shared<core::caching::BeaconCacheOverflowStore>(
+			mLogger,
+			beaconCacheConfig->getOverflowDirectory(),
+			beaconCacheConfig->getOverflowMaxSize()
+		);
+		if (!overflowStore->open())
+		{
+			// the cache works without overflow store, evicted records are discarded
+			overflowStore = nullptr;
+		}
+	}
+
+	mBeaconCache = std::make_shared<core::caching::BeaconCache>(mLogger, overflowStore);
+	if (beaconCacheConfig->getRecordQueueCapacity() > 0)
+	{
+		// decouple the threads reporting data from the beacon cache
+		mBeaconCache = std::make_shared<core::caching::AsyncBeaconCache>(
+			mLogger,
+			mBeaconCache,
+			static_cast<size_t>(beaconCacheConfig->getRecordQueueCapacity()),
+			beaconCacheConfig->getRecordQueueFullPolicy()
+		);
+	}
+	// background work shared by all OpenKit instances of the process, if enabled
+	std::shared_ptr<core::util::SharedExecutor> sharedExecutor = nullptr;
+	if (mOpenKitConfiguration->isSharedExecutorEnabled())
+	{
+		sharedExecutor = core::util::SharedExecutor::getInstance();
+	}
+
 	mBeaconCacheEvictor = std::make_shared<core::caching::BeaconCacheEvictor>(
 		mLogger,
 		mBeaconCache,
-		core::configuration::BeaconCacheConfiguration::from(builder),
-		mTimingProvider
+		beaconCacheConfig,
+		mTimingProvider,
+		sharedExecutor
 	);
 	auto httpClientConfig = core::configuration::HTTPClientConfiguration::from(mOpenKitConfiguration);
 	// shared thread suspender between BeaconSender and HttpClient. HttpClient will be woken up when
@@ -59,16 +96,23 @@ OpenKitInitializer::OpenKitInitializer(const openkit::IOpenKitBuilder& builder)
 	mBeaconSender = std::make_shared<core::BeaconSender>(
 		mLogger,
 		httpClientConfig,
-		std::make_shared<providers::DefaultHTTPClientProvider>(mLogger, beaconSenderThreadSuspender),
+		std::make_shared<providers::DefaultHTTPClientProvider>(
+			mLogger,
+			beaconSenderThreadSuspender,
+			mTimingProvider,
+			mOpenKitConfiguration
+		),
 		mTimingProvider,
-		beaconSenderThreadSuspender
+		beaconSenderThreadSuspender,
+		mBeaconCache
 	);
 	mSessionWatchdog = std::make_shared<core::SessionWatchdog>(
 		mLogger,
 		std::make_shared<core::SessionWatchdogContext>(
 			mTimingProvider,
 			std::make_shared<core::util::InterruptibleThreadSuspender>()
-		)
+		),
+		sharedExecutor
 	);
 }
 
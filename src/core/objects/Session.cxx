@@ -206,20 +206,24 @@ void Session::reportCarrier(const char* carrier)
 
 std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char* url)
 {
-	core::UTF8String urlString(url);
-	if (urlString.empty())
+	return traceWebRequest(WebRequestURL(url));
+}
+
+std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const WebRequestURL& url)
+{
+	if (url.isEmpty())
 	{
 		mLogger->warning("%s traceWebRequest: url must not be null or empty", toString().c_str());
 		return NullWebRequestTracer::instance();
 	}
-	if (!WebRequestTracer::isValidURLScheme(urlString))
+	if (!url.hasValidScheme())
 	{
-		mLogger->warning("%s traceWebRequest: url \"%s\" does not have a valid scheme", toString().c_str(), urlString.getStringData().c_str());
+		mLogger->warning("%s traceWebRequest: url \"%s\" does not have a valid scheme", toString().c_str(), url.getURL().getStringData().c_str());
 		return NullWebRequestTracer::instance();
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), urlString.getStringData().c_str());
+		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), url.getURL().getStringData().c_str());
 	}
 
 	{ // synchronized block
@@ -231,7 +235,7 @@ std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char*
 				mLogger,
 				shared_from_this(),
 				mBeacon,
-				urlString
+				url
 			);
 			storeChildInList(tracer);
 
@@ -279,6 +283,31 @@ void Session::sendBizEvent(const char* type, const openkit::json::JsonObjectValu
 	}
 }
 
+void Session::sendBizEvent(const char* type, const openkit::json::JsonDocument& attributes)
+{
+	UTF8String eventTypeString(type);
+
+	if (type == nullptr || eventTypeString.empty())
+	{
+		mLogger->warning("%s sendBizEvent: type must not be null or empty", toString().c_str());
+		return;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s sendBizEvent(%s, %s)", toString().c_str(), eventTypeString.getStringData().c_str(), attributes.toString().c_str());
+	}
+
+	{ // synchronized scope
+		std::lock_guard<std::recursive_mutex> lock(mMutex);
+
+		if (!isFinishingOrFinished())
+		{
+			mBeacon->sendBizEvent(eventTypeString, attributes);
+		}
+	}
+}
+
 void Session::sendEvent(const char* name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes)
 {
 	UTF8String eventNameString(name);
@@ -311,6 +340,31 @@ void Session::sendEvent(const char* name, const openkit::json::JsonObjectValue::
 	}
 }
 
+void Session::sendEvent(const char* name, const openkit::json::JsonDocument& attributes)
+{
+	UTF8String eventNameString(name);
+
+	if (name == nullptr || eventNameString.empty())
+	{
+		mLogger->warning("%s sendEvent: name must not be null or empty", toString().c_str());
+		return;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s sendEvent(%s, %s)", toString().c_str(), eventNameString.getStringData().c_str(), attributes.toString().c_str());
+	}
+
+	{ // synchronized scope
+		std::lock_guard<std::recursive_mutex> lock(mMutex);
+
+		if (!isFinishingOrFinished())
+		{
+			mBeacon->sendEvent(eventNameString, attributes);
+		}
+	}
+}
+
 void Session::close()
 {
 	end();
@@ -323,6 +377,14 @@ std::shared_ptr<protocol::IStatusResponse> Session::sendBeacon(
 	return mBeacon->send(clientProvider, additionalParameters);
 }
 
+void Session::sendBeaconAsync(
+	std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+	const protocol::IAdditionalQueryParameters& additionalParameters,
+	protocol::IHTTPClient::ResponseHandler responseHandler)
+{
+	mBeacon->sendAsync(clientProvider, additionalParameters, std::move(responseHandler));
+}
+
 bool Session::isEmpty() const
 {
 	return mBeacon->isEmpty();
@@ -103,12 +103,18 @@ namespace core
 
 			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+			std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const WebRequestURL& url) override;
+
 			void end() override;
 
 			void sendBizEvent(const char* type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) override;
 
+			void sendBizEvent(const char* type, const openkit::json::JsonDocument& attributes) override;
+
 			void sendEvent(const char* name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) override;
 
+			void sendEvent(const char* name, const openkit::json::JsonDocument& attributes) override;
+
 			void startSession() override;
 
 			std::shared_ptr<protocol::IStatusResponse> sendBeacon(
@@ -116,6 +122,12 @@ namespace core
 				const protocol::IAdditionalQueryParameters& additionalParameters
 			) override;
 
+			void sendBeaconAsync(
+				std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+				const protocol::IAdditionalQueryParameters& additionalParameters,
+				protocol::IHTTPClient::ResponseHandler responseHandler
+			) override;
+
 			bool isEmpty() const override;
 
 			void clearCapturedData() override;
@@ -24,6 +24,7 @@
 #include "core/configuration/IBeaconConfiguration.h"
 #include "core/objects/IOpenKitObject.h"
 #include "core/objects/OpenKitComposite.h"
+#include "core/objects/WebRequestURL.h"
 #include "protocol/IAdditionalQueryParameters.h"
 #include "protocol/IBeacon.h"
 #include "protocol/IStatusResponse.h"
@@ -62,8 +63,19 @@ namespace core
 
 			void sendEvent(const char* name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) override = 0;
 
+			void sendEvent(const char* name, const openkit::json::JsonDocument& attributes) override = 0;
+
 			void sendBizEvent(const char* type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) override = 0;
 
+			void sendBizEvent(const char* type, const openkit::json::JsonDocument& attributes) override = 0;
+
+			///
+			/// Traces a web request, whose URL was already validated where it was passed to the API.
+			/// @param[in] url the URL of the web request
+			/// @returns the tracer or a null object if the URL is invalid or the session is finished
+			///
+			virtual std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const WebRequestURL& url) = 0;
+
 			///
 			/// Start a session
 			///
@@ -80,6 +92,18 @@ namespace core
 				const protocol::IAdditionalQueryParameters& additionalParameters
 			) = 0;
 
+			///
+			/// Sends the current Beacon state without waiting for the response
+			/// @param[in] clientProvider the IHTTPClientProvider to use for sending
+			/// @param[in] additionalParameters additional parameters that will be appended to the beacon request
+			/// @param[in] responseHandler handler invoked with the status response returned for the Beacon data
+			///
+			virtual void sendBeaconAsync(
+				std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+				const protocol::IAdditionalQueryParameters& additionalParameters,
+				protocol::IHTTPClient::ResponseHandler responseHandler
+			) = 0;
+
 			///
 			/// Test if this session is empty or not
 			///
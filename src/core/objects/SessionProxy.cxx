@@ -227,20 +227,20 @@ void SessionProxy::reportCarrier(const char* carrier)
 
 std::shared_ptr<openkit::IWebRequestTracer> SessionProxy::traceWebRequest(const char* url)
 {
-	core::UTF8String urlString(url);
-	if (urlString.empty())
+	WebRequestURL webRequestURL(url);
+	if (webRequestURL.isEmpty())
 	{
 		mLogger->warning("%s traceWebRequest: url must not be null or empty", toString().c_str());
 		return NullWebRequestTracer::instance();
 	}
-	if (!WebRequestTracer::isValidURLScheme(urlString))
+	if (!webRequestURL.hasValidScheme())
 	{
-		mLogger->warning("%s traceWebRequest: url \"%s\" does not have a valid scheme", toString().c_str(), urlString.getStringData().c_str());
+		mLogger->warning("%s traceWebRequest: url \"%s\" does not have a valid scheme", toString().c_str(), webRequestURL.getURL().getStringData().c_str());
 		return NullWebRequestTracer::instance();
 	}
 	if (mLogger->isDebugEnabled())
 	{
-		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), urlString.getStringData().c_str());
+		mLogger->debug("%s traceWebRequest(%s)", toString().c_str(), webRequestURL.getURL().getStringData().c_str());
 	}
 
 	{ // synchronized scope
@@ -253,7 +253,7 @@ std::shared_ptr<openkit::IWebRequestTracer> SessionProxy::traceWebRequest(const
 
 		auto session = getOrSplitCurrentSessionByEvents();
 		recordTopLevelEventInteraction();
-		return session->traceWebRequest(url);
+		return session->traceWebRequest(webRequestURL);
 	}
 }
 
@@ -337,6 +337,35 @@ void SessionProxy::sendBizEvent(const char* type, const openkit::json::JsonObjec
 }
 
 
+void SessionProxy::sendBizEvent(const char* type, const openkit::json::JsonDocument& attributes)
+{
+	UTF8String eventTypeString(type);
+
+	if (type == nullptr || eventTypeString.empty())
+	{
+		mLogger->warning("%s sendBizEvent: type must not be null or empty", toString().c_str());
+		return;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s sendBizEvent(%s, %s)", toString().c_str(), eventTypeString.getStringData().c_str(), attributes.toString().c_str());
+	}
+
+	{ // synchronized scope
+		std::lock_guard<std::recursive_mutex> lock(mLockObject);
+
+		if (mIsFinished)
+		{
+			return;
+		}
+
+		auto session = getOrSplitCurrentSessionByEvents();
+		recordTopLevelEventInteraction();
+		session->sendBizEvent(type, attributes);
+	}
+}
+
 void SessionProxy::sendEvent(const char* name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes)
 {
 	UTF8String eventNameString(name);
@@ -373,6 +402,35 @@ void SessionProxy::sendEvent(const char* name, const openkit::json::JsonObjectVa
 	}
 }
 
+void SessionProxy::sendEvent(const char* name, const openkit::json::JsonDocument& attributes)
+{
+	UTF8String eventNameString(name);
+
+	if (name == nullptr || eventNameString.empty())
+	{
+		mLogger->warning("%s sendEvent: eventName must not be null or empty", toString().c_str());
+		return;
+	}
+
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s sendEvent(%s, %s)", toString().c_str(), eventNameString.getStringData().c_str(), attributes.toString().c_str());
+	}
+
+	{ // synchronized scope
+		std::lock_guard<std::recursive_mutex> lock(mLockObject);
+
+		if (mIsFinished)
+		{
+			return;
+		}
+
+		auto session = getOrSplitCurrentSessionByEvents();
+		recordTopLevelEventInteraction();
+		session->sendEvent(name, attributes);
+	}
+}
+
 bool SessionProxy::isFinished()
 {
 	std::lock_guard<std::recursive_mutex> lock(mLockObject);
@@ -396,6 +454,7 @@ void SessionProxy::onChildClosed(std::shared_ptr<IOpenKitObject> childObject)
 	if (childSession != nullptr)
 	{
 		mSessionWatchdog->dequeueFromClosing(childSession);
+		mBeaconSender->updateSessionState(childSession);
 	}
 }
 
@@ -89,8 +89,12 @@ namespace core
 
 			void sendBizEvent(const char* type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) override;
 
+			void sendBizEvent(const char* type, const openkit::json::JsonDocument& attributes) override;
+
 			void sendEvent(const char* name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes = nullptr) override;
 
+			void sendEvent(const char* name, const openkit::json::JsonDocument& attributes) override;
+
 			bool isFinished() override;
 
 			void close() override;
@@ -19,18 +19,26 @@
 #include "protocol/IBeacon.h"
 
 #include <sstream>
-#include <regex>
 
 using namespace core::objects;
 
-static const std::regex SCHEMA_VALIDATION_PATTERN("^[a-zA-Z][a-zA-Z0-9+\\-.]*://.+$", std::regex::optimize | std::regex::ECMAScript);
-
 WebRequestTracer::WebRequestTracer
 (
 	std::shared_ptr<openkit::ILogger> logger,
 	std::shared_ptr<IOpenKitComposite> parent,
 	std::shared_ptr<protocol::IBeacon> beacon,
 	const core::UTF8String& url
+)
+	: WebRequestTracer(logger, parent, beacon, WebRequestURL(url))
+{
+}
+
+WebRequestTracer::WebRequestTracer
+(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<IOpenKitComposite> parent,
+	std::shared_ptr<protocol::IBeacon> beacon,
+	const WebRequestURL& url
 )
 	: mLogger(logger)
 	, mParent(parent)
@@ -51,24 +59,22 @@ WebRequestTracer::WebRequestTracer
 
 bool WebRequestTracer::isValidURLScheme(const core::UTF8String& url)
 {
-	return std::regex_match(url.getStringData(), SCHEMA_VALIDATION_PATTERN);
+	return WebRequestURL::isValidScheme(url.getStringData());
 }
 
 core::UTF8String WebRequestTracer::calculateUrlFrom(const core::UTF8String& url)
 {
-	if (!isValidURLScheme(url))
-	{
-		return UNKNOWN_URL;
-	}
-
-	auto indexOfQuestionMark = url.getIndexOf("?");
+	return calculateUrlFrom(WebRequestURL(url));
+}
 
-	if (indexOfQuestionMark == std::string::npos)
+core::UTF8String WebRequestTracer::calculateUrlFrom(const WebRequestURL& url)
+{
+	if (!url.hasValidScheme())
 	{
-		return url;
+		return UNKNOWN_URL;
 	}
 
-	return url.substring(0, indexOfQuestionMark);
+	return url.getURLWithoutQuery();
 }
 
 const char* WebRequestTracer::getTag() const
@@ -25,6 +25,7 @@
 #include "OpenKit/IOpenKit.h"
 #include "core/objects/IWebRequestTracerInternals.h"
 #include "core/objects/OpenKitComposite.h"
+#include "core/objects/WebRequestURL.h"
 #include "core/UTF8String.h"
 
 #include <mutex>
@@ -64,6 +65,23 @@ namespace core
 				const core::UTF8String& url
 			);
 
+			///
+			/// Constructor which can be used for tracing and timing of a web request handled by any 3rd party HTTP Client.
+			/// Setting the Dynatrace tag to the @ref openkit::OpenKitConstants::WEBREQUEST_TAG_HEADER
+			/// HTTP header has to be done manually by the user.
+			///
+			/// @param[in] logger to write traces to
+			/// @param[in] parent the parent object, to which this web request belongs
+			/// @param[in] beacon @ref protocol::Beacon used to serialize the @ref WebRequestTracer
+			/// @param[in] url the URL of the web request, which was already validated
+			///
+			WebRequestTracer(
+				std::shared_ptr<openkit::ILogger> logger,
+				std::shared_ptr<IOpenKitComposite> parent,
+				std::shared_ptr<protocol::IBeacon> beacon,
+				const WebRequestURL& url
+			);
+
 			static constexpr const char* UNKNOWN_URL = "<unknown>";
 
 			///
@@ -79,6 +97,12 @@ namespace core
 			///
 			static core::UTF8String calculateUrlFrom(const core::UTF8String& url);
 
+			///
+			/// Returns the URL excluding possible parameters of the given validated @c url.
+			/// In case the url is invalid @ref UNKNOWN_URL is returned.
+			///
+			static core::UTF8String calculateUrlFrom(const WebRequestURL& url);
+
 			const char* getTag() const override;
 
 			std::shared_ptr<IWebRequestTracer> setBytesSent(int32_t bytesSent) override;
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WebRequestURL.h"
+
+using namespace core::objects;
+
+static bool isAsciiLetter(char character)
+{
+	return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+}
+
+static bool isSchemeCharacter(char character)
+{
+	return isAsciiLetter(character)
+		|| (character >= '0' && character <= '9')
+		|| character == '+'
+		|| character == '-'
+		|| character == '.';
+}
+
+WebRequestURL::WebRequestURL(const char* url)
+	: WebRequestURL(core::UTF8String(url))
+{
+}
+
+WebRequestURL::WebRequestURL(const core::UTF8String& url)
+	: mURL(url)
+	, mHasValidScheme(isValidScheme(url.getStringData()))
+	, mURLWithoutQuery()
+{
+	if (!mHasValidScheme)
+	{
+		return;
+	}
+
+	const auto& urlData = mURL.getStringData();
+	auto indexOfQuestionMark = urlData.find('?');
+
+	mURLWithoutQuery = indexOfQuestionMark == std::string::npos
+		? mURL
+		: core::UTF8String(urlData.substr(0, indexOfQuestionMark));
+}
+
+const core::UTF8String& WebRequestURL::getURL() const
+{
+	return mURL;
+}
+
+bool WebRequestURL::isEmpty() const
+{
+	return mURL.empty();
+}
+
+bool WebRequestURL::hasValidScheme() const
+{
+	return mHasValidScheme;
+}
+
+const core::UTF8String& WebRequestURL::getURLWithoutQuery() const
+{
+	return mURLWithoutQuery;
+}
+
+bool WebRequestURL::isValidScheme(const std::string& url)
+{
+	const auto length = url.size();
+	if (length == 0 || !isAsciiLetter(url[0]))
+	{
+		return false;
+	}
+
+	// the scheme ends at the first character not allowed in a scheme, which has to be the ':' of "://"
+	auto position = size_t(1);
+	while (position < length && isSchemeCharacter(url[position]))
+	{
+		position++;
+	}
+
+	if (length - position < 4 || url.compare(position, 3, "://") != 0)
+	{
+		return false;
+	}
+
+	// at least one character has to follow and, like '.' in ECMAScript, none of them may be a line terminator
+	for (position += 3; position < length; position++)
+	{
+		if (url[position] == '\n' || url[position] == '\r')
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
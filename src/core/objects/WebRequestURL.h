@@ -0,0 +1,95 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_OBJECTS_WEBREQUESTURL_H
+#define _CORE_OBJECTS_WEBREQUESTURL_H
+
+#include "core/UTF8String.h"
+
+#include <string>
+
+namespace core
+{
+	namespace objects
+	{
+		///
+		/// URL of a traced web request, which is validated once where it is passed to the API.
+		///
+		/// @par
+		/// The URL scheme is checked according to RFC3986 and, if it is valid, the URL without query is determined,
+		/// so that objects the URL is passed on to do not need to parse it again.
+		///
+		class WebRequestURL
+		{
+		public:
+			///
+			/// Constructor
+			/// @param[in] url the URL passed to the API, which might be @c nullptr
+			///
+			explicit WebRequestURL(const char* url);
+
+			///
+			/// Constructor
+			/// @param[in] url the URL passed to the API
+			///
+			explicit WebRequestURL(const core::UTF8String& url);
+
+			///
+			/// Returns the URL as it was passed to the API
+			///
+			const core::UTF8String& getURL() const;
+
+			///
+			/// Returns @c true if the URL is empty or @c nullptr was passed, @c false otherwise
+			///
+			bool isEmpty() const;
+
+			///
+			/// Returns @c true if the URL starts with a valid scheme, @c false otherwise
+			///
+			bool hasValidScheme() const;
+
+			///
+			/// Returns the URL excluding possible parameters or an empty string if the scheme is invalid
+			///
+			const core::UTF8String& getURLWithoutQuery() const;
+
+			///
+			/// Test if given @c url contains a valid URL scheme according to RFC3986.
+			///
+			/// @par
+			/// The check is equivalent to matching the regular expression <code>^[a-zA-Z][a-zA-Z0-9+\-.]*://.+$</code>,
+			/// but runs in a single pass over the URL.
+			///
+			/// @param[in] url The url to validate
+			/// @return @c true on success, @c false otherwise.
+			///
+			static bool isValidScheme(const std::string& url);
+
+		private:
+			/// the URL as it was passed to the API
+			core::UTF8String mURL;
+
+			/// flag indicating whether the scheme is valid
+			bool mHasValidScheme;
+
+			/// the URL excluding possible parameters
+			core::UTF8String mURLWithoutQuery;
+		};
+	}
+}
+
+#endif
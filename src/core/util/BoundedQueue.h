@@ -0,0 +1,236 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_BOUNDEDQUEUE_H
+#define _CORE_UTIL_BOUNDEDQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Bounded lock-free multi-producer/multi-consumer ring buffer, whose slots each hold one @c T.
+		///
+		/// @par
+		/// Each slot carries a sequence number telling producers and consumers whether the slot is free or filled
+		/// for the current lap, so that neither side has to take a lock. Producers claim a slot by advancing the
+		/// enqueue position with a compare-and-swap, consumers do the same with the dequeue position.
+		///
+		/// @par
+		/// All slots are allocated up front. Instead of copying values in and out, @ref tryPush and @ref tryPop hand
+		/// the payload of the claimed slot to a callback, which lets the queues built on top decide how data is
+		/// moved into and out of the slot.
+		///
+		template <class T> class BoundedQueue
+		{
+		public:
+
+			///
+			/// Constructor
+			///
+			/// @param[in] capacity the maximum number of queued elements, which is rounded up to the next power of two
+			///
+			BoundedQueue(size_t capacity)
+				: mMask(roundUpToPowerOfTwo(capacity) - 1)
+				, mSlots(new Slot[mMask + 1])
+				, mPadding0()
+				, mEnqueuePosition(0)
+				, mPadding1()
+				, mDequeuePosition(0)
+			{
+				for (size_t i = 0; i <= mMask; i++)
+				{
+					mSlots[i].sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			///
+			/// Delete the copy constructor
+			///
+			BoundedQueue(const BoundedQueue&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+			///
+			/// Claims a free slot, unless the queue is full, and lets @c write fill its payload.
+			///
+			/// @param[in] write callable taking a @c T&, which is invoked exactly once if a slot was claimed
+			/// @return @c true if an element was added, @c false if the queue is full
+			///
+			template <class Writer> bool tryPush(Writer&& write)
+			{
+				Slot* slot;
+				auto position = mEnqueuePosition.load(std::memory_order_relaxed);
+				while (true)
+				{
+					slot = &mSlots[position & mMask];
+					auto sequence = slot->sequence.load(std::memory_order_acquire);
+					auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+					if (difference == 0)
+					{
+						// the slot is free in this lap, try to claim it
+						if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (difference < 0)
+					{
+						// the slot still holds the element of the previous lap -> queue is full
+						return false;
+					}
+					else
+					{
+						// another producer claimed the slot
+						position = mEnqueuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				write(slot->payload);
+				slot->sequence.store(position + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			///
+			/// Claims the oldest filled slot, unless the queue is empty, and lets @c read consume its payload.
+			///
+			/// @param[in] read callable taking a @c T&, which is invoked exactly once if a slot was claimed
+			/// @return @c true if an element was removed, @c false if the queue is empty
+			///
+			template <class Reader> bool tryPop(Reader&& read)
+			{
+				Slot* slot;
+				auto position = mDequeuePosition.load(std::memory_order_relaxed);
+				while (true)
+				{
+					slot = &mSlots[position & mMask];
+					auto sequence = slot->sequence.load(std::memory_order_acquire);
+					auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+					if (difference == 0)
+					{
+						// the slot is filled in this lap, try to claim it
+						if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (difference < 0)
+					{
+						// the slot was not written yet -> queue is empty
+						return false;
+					}
+					else
+					{
+						// another consumer claimed the slot
+						position = mDequeuePosition.load(std::memory_order_relaxed);
+					}
+				}
+
+				read(slot->payload);
+				slot->sequence.store(position + mMask + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			///
+			/// Returns the approximate number of queued elements.
+			///
+			size_t size() const
+			{
+				auto dequeuePosition = mDequeuePosition.load(std::memory_order_relaxed);
+				auto enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+
+				return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+			}
+
+			///
+			/// Returns the maximum number of queued elements.
+			///
+			size_t getCapacity() const
+			{
+				return mMask + 1;
+			}
+
+		private:
+
+			///
+			/// Slot of the ring buffer
+			///
+			struct Slot
+			{
+				///
+				/// Default constructor
+				///
+				Slot()
+					: sequence(0)
+					, payload()
+				{
+				}
+
+				/// The lap and position of the slot, telling whether it can be written or read
+				std::atomic<size_t> sequence;
+
+				/// The element stored in the slot
+				T payload;
+			};
+
+			///
+			/// Returns the smallest power of two greater than or equal to @c value (at least 2).
+			///
+			static size_t roundUpToPowerOfTwo(size_t value)
+			{
+				size_t result = 2;
+				while (result < value)
+				{
+					result <<= 1;
+				}
+				return result;
+			}
+
+			/// Size of a cache line, used to keep the positions from sharing one
+			static constexpr size_t CACHE_LINE_SIZE = 64;
+
+			/// Mask to map positions to slots (capacity - 1)
+			const size_t mMask;
+
+			/// The slots of the ring buffer
+			std::unique_ptr<Slot[]> mSlots;
+
+			/// Padding between the read-only part and the enqueue position
+			char mPadding0[CACHE_LINE_SIZE];
+
+			/// Position of the next slot to write
+			std::atomic<size_t> mEnqueuePosition;
+
+			/// Padding between the enqueue and the dequeue position
+			char mPadding1[CACHE_LINE_SIZE];
+
+			/// Position of the next slot to read
+			std::atomic<size_t> mDequeuePosition;
+		};
+	}
+}
+
+#endif
@@ -17,65 +17,34 @@
 #include "Compressor.h"
 
 #include <cassert>
-#include <cstdint>
-#include <memory>
-
-#include <zlib.h>
 
 using namespace base::util;
 
-#define WINDOW_BITS   15
-#define GZIP_ENCODING 16
+// size by which the output buffer grows while compressing
+constexpr size_t OUTPUT_CHUNK_SIZE = 16 * 1024;
 
 void Compressor::compressMemory(const void* inData, size_t inDataSize, std::vector<unsigned char>& outData)
 {
-	std::vector<uint8_t> buffer;
-
-	const size_t BUFSIZE = 128 * 1024;
-	auto tmpBuffer = new uint8_t[BUFSIZE];
-
-	z_stream strm;
-	strm.zalloc = 0;
-	strm.zfree = 0;
-	strm.next_in = (Bytef*)inData;
-	strm.avail_in = inDataSize;
-	strm.next_out = tmpBuffer;
-	strm.avail_out = BUFSIZE;
+	StreamingCompressor compressor;
+	compressMemory(compressor, inData, inDataSize, outData);
+}
 
-	// Use GZIP with default compresssion
-	deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, WINDOW_BITS | GZIP_ENCODING, 8, Z_DEFAULT_STRATEGY);
+void Compressor::compressMemory(StreamingCompressor& compressor, const void* inData, size_t inDataSize, std::vector<unsigned char>& outData)
+{
+	outData.clear();
 
-	int32_t res = Z_OK;
-	while (strm.avail_in != 0 && res == Z_OK)
-	{
-		res = deflate(&strm, Z_NO_FLUSH);
-		assert(res == Z_OK);
-		if (strm.avail_out == 0)
-		{
-			buffer.insert(buffer.end(), tmpBuffer, tmpBuffer + BUFSIZE);
-			strm.next_out = tmpBuffer;
-			strm.avail_out = BUFSIZE;
-		}
-	}
+	auto initialized = compressor.reset(inData, inDataSize);
+	assert(initialized);
+	(void)initialized;
 
-	uint32_t deflateResult = Z_OK;
+	size_t written = 0;
 	do
 	{
-		if (strm.avail_out == 0)
-		{
-			buffer.insert(buffer.end(), tmpBuffer, tmpBuffer + BUFSIZE);
-			strm.next_out = tmpBuffer;
-			strm.avail_out = BUFSIZE;
-		}
-		deflateResult = deflate(&strm, Z_FINISH);
-	} while (deflateResult == Z_OK);
-
-	assert(deflateResult == Z_STREAM_END);
-	buffer.insert(buffer.end(), tmpBuffer, tmpBuffer + BUFSIZE - strm.avail_out);
-	deflateEnd(&strm);
-
-	outData.swap(buffer);
-
-	delete[] tmpBuffer;
+		auto offset = outData.size();
+		outData.resize(offset + OUTPUT_CHUNK_SIZE);
+		auto result = compressor.read(outData.data() + offset, OUTPUT_CHUNK_SIZE, written);
+		assert(result);
+		(void)result;
+		outData.resize(offset + written);
+	} while (written > 0);
 }
-
@@ -17,6 +17,8 @@
 #ifndef _CORE_UTIL_COMPRESSOR_H
 #define _CORE_UTIL_COMPRESSOR_H
 
+#include "StreamingCompressor.h"
+
 #include <vector>
 #include <cstddef>
 
@@ -38,6 +40,16 @@ namespace base
 			/// @param[out] out_data binary_data struct passed as reference that will contain the compressed data.
 			///
 			static void compressMemory(const void *inData, size_t inDataSize, std::vector<unsigned char>& out_data);
+
+			///
+			/// Compress block of memory at in_data with a length of @c inDataSize bytes, reusing the deflate state
+			/// of the given compressor.
+			/// @param[in] compressor the compressor to use
+			/// @param[in] inData pointer to the incoming data
+			/// @param[in] inDataSize size of data behind the pointer (measured in bytes)
+			/// @param[out] outData will contain the compressed data.
+			///
+			static void compressMemory(StreamingCompressor& compressor, const void* inData, size_t inDataSize, std::vector<unsigned char>& outData);
 		};
 	}
 	
@@ -0,0 +1,320 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_UTIL_DEADLINEQUEUE_H
+#define _CORE_UTIL_DEADLINEQUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Thread safe queue of entries, each one being due at a certain deadline.
+		///
+		/// @par
+		/// The deadlines are kept in a min-heap, so that only entries being due have to be visited. Removing an entry
+		/// only drops it from the index; its heap node is discarded lazily, once it reaches the top of the heap or when
+		/// the heap is compacted.
+		///
+		/// @par
+		/// Entries which need a new deadline after being processed can be fetched with @ref getDue. They stay in the
+		/// index without a deadline, until they are either rescheduled or removed. If the entry is put or removed
+		/// concurrently while being processed, the concurrent operation takes precedence.
+		///
+		template <class T> class DeadlineQueue
+		{
+		public:
+			///
+			/// Deadline returned by @ref getNextDeadline if the queue is empty.
+			///
+			static constexpr int64_t NO_DEADLINE = std::numeric_limits<int64_t>::max();
+
+			DeadlineQueue()
+				: mEntries()
+				, mHeap()
+				, mNextSequenceNumber(0)
+				, mMutex()
+			{
+			}
+
+			///
+			/// Adds the given entry with the given deadline. If the entry is already queued, its deadline is replaced.
+			///
+			void put(const std::shared_ptr<T>& entry, int64_t deadline)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				auto it = mEntries.find(entry.get());
+				if (it == mEntries.end())
+				{
+					it = mEntries.emplace(entry.get(), Entry(entry)).first;
+				}
+				schedule(it, deadline);
+			}
+
+			///
+			/// Removes the given entry.
+			///
+			/// @return @c true if the entry was queued, @c false otherwise
+			///
+			bool remove(const std::shared_ptr<T>& entry)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				return mEntries.erase(entry.get()) > 0;
+			}
+
+			///
+			/// Removes and returns all entries, whose deadline is less than or equal to @c now, ordered by their deadline.
+			///
+			std::vector<std::shared_ptr<T>> takeDue(int64_t now)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				std::vector<std::shared_ptr<T>> dueEntries;
+				while (!mHeap.empty() && mHeap.front().deadline <= now)
+				{
+					auto node = popHeap();
+					auto it = mEntries.find(node.key);
+					if (it != mEntries.end() && it->second.sequenceNumber == node.sequenceNumber)
+					{
+						dueEntries.push_back(std::move(it->second.value));
+						mEntries.erase(it);
+					}
+				}
+
+				return dueEntries;
+			}
+
+			///
+			/// Returns all entries, whose deadline is less than or equal to @c now, ordered by their deadline.
+			///
+			/// @par
+			/// Unlike @ref takeDue, the entries stay queued without a deadline. Each returned entry has to be passed to
+			/// either @ref reschedule or @ref removeDue once it was processed.
+			///
+			std::vector<std::shared_ptr<T>> getDue(int64_t now)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				std::vector<std::shared_ptr<T>> dueEntries;
+				while (!mHeap.empty() && mHeap.front().deadline <= now)
+				{
+					auto node = popHeap();
+					auto it = mEntries.find(node.key);
+					if (it != mEntries.end() && it->second.sequenceNumber == node.sequenceNumber)
+					{
+						dueEntries.push_back(it->second.value);
+						it->second.isDue = true;
+					}
+				}
+
+				return dueEntries;
+			}
+
+			///
+			/// Sets the new deadline of an entry returned by @ref getDue, unless it was put or removed in the meantime.
+			///
+			void reschedule(const std::shared_ptr<T>& entry, int64_t deadline)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				auto it = mEntries.find(entry.get());
+				if (it != mEntries.end() && it->second.isDue)
+				{
+					schedule(it, deadline);
+				}
+			}
+
+			///
+			/// Removes an entry returned by @ref getDue, unless it was put in the meantime.
+			///
+			void removeDue(const std::shared_ptr<T>& entry)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				auto it = mEntries.find(entry.get());
+				if (it != mEntries.end() && it->second.isDue)
+				{
+					mEntries.erase(it);
+				}
+			}
+
+			///
+			/// Returns the earliest deadline of all queued entries or @ref NO_DEADLINE if the queue is empty.
+			///
+			int64_t getNextDeadline()
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				while (!mHeap.empty() && isStale(mHeap.front()))
+				{
+					popHeap();
+				}
+
+				return mHeap.empty() ? NO_DEADLINE : mHeap.front().deadline;
+			}
+
+			///
+			/// Returns a shallow copy of all queued entries.
+			///
+			std::vector<std::shared_ptr<T>> toStdVector()
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				std::vector<std::shared_ptr<T>> entries;
+				entries.reserve(mEntries.size());
+				for (auto& entry : mEntries)
+				{
+					entries.push_back(entry.second.value);
+				}
+
+				return entries;
+			}
+
+			size_t size()
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				return mEntries.size();
+			}
+
+		private:
+			///
+			/// Number of heap nodes, below which stale nodes are not compacted
+			///
+			static constexpr size_t MIN_HEAP_SIZE_TO_COMPACT = 64;
+
+			struct Entry
+			{
+				///
+				/// Constructor, creating an entry without deadline
+				///
+				/// @param[in] value the queued entry
+				///
+				explicit Entry(const std::shared_ptr<T>& value)
+					: value(value)
+					, deadline(0)
+					, sequenceNumber(0)
+					, isDue(true)
+				{
+				}
+
+				/// the queued entry
+				std::shared_ptr<T> value;
+
+				/// the entry's deadline
+				int64_t deadline;
+
+				/// sequence number of the heap node being valid for this entry
+				uint64_t sequenceNumber;
+
+				/// @c true if the entry has no valid heap node, since it was returned by @ref getDue
+				bool isDue;
+			};
+
+			struct HeapNode
+			{
+				/// deadline of the entry
+				int64_t deadline;
+
+				/// sequence number, keeping entries with the same deadline in insertion order
+				uint64_t sequenceNumber;
+
+				/// key of the entry in the index
+				const T* key;
+
+				bool operator>(const HeapNode& other) const
+				{
+					return deadline != other.deadline ? deadline > other.deadline : sequenceNumber > other.sequenceNumber;
+				}
+			};
+
+			///
+			/// Sets the deadline of the given entry and pushes its heap node.
+			///
+			/// Must only be called while holding @ref mMutex.
+			///
+			void schedule(typename std::unordered_map<const T*, Entry>::iterator it, int64_t deadline)
+			{
+				auto sequenceNumber = mNextSequenceNumber++;
+				it->second.deadline = deadline;
+				it->second.sequenceNumber = sequenceNumber;
+				it->second.isDue = false;
+				mHeap.push_back(HeapNode{ deadline, sequenceNumber, it->first });
+				std::push_heap(mHeap.begin(), mHeap.end(), std::greater<HeapNode>());
+
+				if (mHeap.size() > 2 * mEntries.size() + MIN_HEAP_SIZE_TO_COMPACT)
+				{
+					compact();
+				}
+			}
+
+			HeapNode popHeap()
+			{
+				std::pop_heap(mHeap.begin(), mHeap.end(), std::greater<HeapNode>());
+				auto node = mHeap.back();
+				mHeap.pop_back();
+
+				return node;
+			}
+
+			bool isStale(const HeapNode& node) const
+			{
+				auto it = mEntries.find(node.key);
+				return it == mEntries.end() || it->second.sequenceNumber != node.sequenceNumber;
+			}
+
+			void compact()
+			{
+				mHeap.clear();
+				for (auto& entry : mEntries)
+				{
+					if (!entry.second.isDue)
+					{
+						mHeap.push_back(HeapNode{ entry.second.deadline, entry.second.sequenceNumber, entry.first });
+					}
+				}
+				std::make_heap(mHeap.begin(), mHeap.end(), std::greater<HeapNode>());
+			}
+
+			/// the queued entries, indexed by their address
+			std::unordered_map<const T*, Entry> mEntries;
+
+			/// min-heap of deadlines, which might contain nodes of removed or rescheduled entries
+			std::vector<HeapNode> mHeap;
+
+			/// sequence number of the next heap node
+			uint64_t mNextSequenceNumber;
+
+			mutable std::mutex mMutex;
+		};
+
+		template <class T> constexpr int64_t DeadlineQueue<T>::NO_DEADLINE;
+		template <class T> constexpr size_t DeadlineQueue<T>::MIN_HEAP_SIZE_TO_COMPACT;
+	}
+}
+#endif
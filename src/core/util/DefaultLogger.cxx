@@ -16,17 +16,75 @@
 
 #include "core/util/DefaultLogger.h"
 
-#include <thread>
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <ctime>
 #include <iostream>
 #include <sstream>
-#include <iomanip>
-#include <string>
-#include <cstdarg>
 
 using namespace core::util;
 
+/// Size of the per-thread buffer log records are formatted into (incl. terminating 0)
+constexpr size_t FORMAT_BUFFER_SIZE = LogRecordQueue::MAX_RECORD_LENGTH + 1;
+
+/// Interval in which the background thread writes the queued records
+constexpr std::chrono::milliseconds WRITE_INTERVAL = std::chrono::milliseconds(50);
+
+///
+/// Returns the ID of the calling thread, as written to the stream.
+///
+static std::string getCurrentThreadId()
+{
+	std::ostringstream threadId;
+	threadId << std::this_thread::get_id();
+	return threadId.str();
+}
+
+///
+/// Formats the date/time, the log level and the thread ID into the given buffer.
+///
+/// The date/time and the thread ID are only formatted once per second and once per thread respectively.
+///
+/// @return the number of characters written
+///
+static size_t formatPrefix(char* buffer, size_t bufferSize, const char* level)
+{
+	static thread_local const std::string threadId = getCurrentThreadId();
+	static thread_local std::time_t cachedTime = -1;
+	static thread_local char cachedTimestamp[32] = { 0 };
+
+	// add current date/time in format "YYYY-MM-DD HH:mm:ss"
+	auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	if (now != cachedTime)
+	{
+		struct tm tmNow;
+#if defined (_MSC_VER)
+		localtime_s(&tmNow, &now);
+#else
+		localtime_r(&now, &tmNow);
+#endif
+		std::strftime(cachedTimestamp, sizeof(cachedTimestamp), "%Y-%m-%d %X", &tmNow);
+		cachedTime = now;
+	}
+
+	auto length = std::snprintf(buffer, bufferSize, "%s %s [%s] ", cachedTimestamp, level, threadId.c_str());
+	return length < 0 ? 0 : std::min(static_cast<size_t>(length), bufferSize - 1);
+}
+
+///
+/// Formats a complete log record into the given buffer.
+///
+/// @return the length of the complete record, which might exceed the buffer
+///
+static size_t formatRecord(char* buffer, size_t bufferSize, const char* level, const char* format, va_list args)
+{
+	auto prefixLength = formatPrefix(buffer, bufferSize, level);
+	auto messageLength = vsnprintf(buffer + prefixLength, bufferSize - prefixLength, format, args);
+
+	return prefixLength + (messageLength < 0 ? 0 : static_cast<size_t>(messageLength));
+}
+
 DefaultLogger::DefaultLogger()
 	: DefaultLogger(openkit::LogLevel::LOG_LEVEL_WARN)
 {
@@ -38,9 +96,48 @@ DefaultLogger::DefaultLogger(openkit::LogLevel logLevel)
 }
 
 DefaultLogger::DefaultLogger(std::ostream &stream, openkit::LogLevel logLevel)
+	: DefaultLogger(stream, logLevel, 0)
+{
+}
+
+DefaultLogger::DefaultLogger(openkit::LogLevel logLevel, size_t queueCapacity)
+	: DefaultLogger(std::cout, logLevel, queueCapacity)
+{
+}
+
+DefaultLogger::DefaultLogger(std::ostream &stream, openkit::LogLevel logLevel, size_t queueCapacity)
 	: mStream(stream)
 	, mLogLevel(logLevel)
+	, mStreamMutex()
+	, mQueue(queueCapacity > 0 ? new LogRecordQueue(queueCapacity) : nullptr)
+	, mNumDroppedRecords(0)
+	, mNumReportedDroppedRecords(0)
+	, mMutex()
+	, mConditionVariable()
+	, mStop(false)
+	, mWriterThread()
+{
+	if (mQueue != nullptr)
+	{
+		mWriterThread = std::thread(&DefaultLogger::writerLoopFunc, this);
+	}
+}
+
+DefaultLogger::~DefaultLogger()
 {
+	if (!mWriterThread.joinable())
+	{
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		mStop = true;
+		mConditionVariable.notify_all();
+	}
+
+	// the background thread writes all remaining records before it exits
+	mWriterThread.join();
 }
 
 void DefaultLogger::log(openkit::LogLevel logLevel, const char* format, ...)
@@ -127,37 +224,109 @@ bool DefaultLogger::isDebugEnabled() const
 	return openkit::LogLevel::LOG_LEVEL_DEBUG >= mLogLevel;
 }
 
-void DefaultLogger::doLog(const char * level, const char* format, va_list args)
+uint64_t DefaultLogger::getNumDroppedRecords() const
 {
-	std::stringstream msg;
-
-	// add current date/time in format "YYYY-MM-DD HH:mm:ss"
-	auto now = std::chrono::system_clock::now();
-	auto in_time_t = std::chrono::system_clock::to_time_t(now);
-	struct tm tmNow;
-#if defined (_MSC_VER)
-	localtime_s(&tmNow, &in_time_t);
-#else
-	localtime_r(&in_time_t, &tmNow);
-#endif
-	msg << std::put_time(&tmNow, "%Y-%m-%d %X") << " " ;
-	
-	// add the log level
-	msg << level << " [";
+	return mNumDroppedRecords.load(std::memory_order_relaxed);
+}
 
-	// add thread id
-	msg << std::this_thread::get_id() << "] ";
+void DefaultLogger::doLog(const char * level, const char* format, va_list args)
+{
+	static thread_local char buffer[FORMAT_BUFFER_SIZE];
 
-	// add the trace statement
 	va_list argcopy;
 	va_copy(argcopy, args);
-	size_t length = vsnprintf(nullptr, 0, format, argcopy);	// excl. term. 0
+	auto length = formatRecord(buffer, FORMAT_BUFFER_SIZE, level, format, argcopy);
 	va_end(argcopy);
-	char *traceStatement = new char[length + 1]; // + 1 for term. 0
-	vsnprintf(traceStatement, length + 1, format, args);
-	msg << traceStatement;
-	delete[] traceStatement;
 
-	// finally print out the whole trace
-	mStream << msg.str() << std::endl;
+	if (mQueue != nullptr)
+	{
+		// longer records are truncated
+		if (!mQueue->tryPush(buffer, std::min(length, FORMAT_BUFFER_SIZE - 1)))
+		{
+			mNumDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+		}
+		else if (mQueue->size() >= mQueue->getCapacity() / 2)
+		{
+			// don't wait for the next interval, to keep the queue from running full
+			std::unique_lock<std::mutex> lock(mMutex);
+			mConditionVariable.notify_all();
+		}
+		return;
+	}
+
+	if (length < FORMAT_BUFFER_SIZE)
+	{
+		writeRecord(buffer, length);
+		return;
+	}
+
+	// the record does not fit into the per-thread buffer
+	std::string record(length + 1, '\0');
+	formatRecord(&record[0], record.size(), level, format, args);
+	writeRecord(record.data(), length);
+}
+
+void DefaultLogger::writeRecord(const char* record, size_t length)
+{
+	std::unique_lock<std::mutex> lock(mStreamMutex);
+
+	mStream.write(record, length);
+	mStream << std::endl;
+}
+
+void DefaultLogger::writerLoopFunc()
+{
+	std::string batch;
+	batch.reserve(mQueue->getCapacity() * 128);
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (true)
+	{
+		mConditionVariable.wait_for(lock, WRITE_INTERVAL,
+			[this]() { return mStop || mQueue->size() >= mQueue->getCapacity() / 2; });
+		auto stop = mStop;
+
+		lock.unlock();
+		writeQueuedRecords(batch);
+		lock.lock();
+
+		if (stop)
+		{
+			break;
+		}
+	}
+}
+
+void DefaultLogger::writeQueuedRecords(std::string& batch)
+{
+	batch.clear();
+	while (mQueue->tryPopInto(batch))
+	{
+		// collect all queued records
+	}
+
+	auto numDroppedRecords = mNumDroppedRecords.load(std::memory_order_relaxed);
+	if (numDroppedRecords != mNumReportedDroppedRecords && isWarningEnabled())
+	{
+		char buffer[FORMAT_BUFFER_SIZE];
+		auto length = formatPrefix(buffer, FORMAT_BUFFER_SIZE, openkit::getLogLevelName(openkit::LogLevel::LOG_LEVEL_WARN));
+		auto messageLength = std::snprintf(buffer + length, FORMAT_BUFFER_SIZE - length,
+			"DefaultLogger - %llu log records dropped, since the queue was full",
+			static_cast<unsigned long long>(numDroppedRecords - mNumReportedDroppedRecords));
+		length = std::min(length + (messageLength < 0 ? 0 : static_cast<size_t>(messageLength)), FORMAT_BUFFER_SIZE - 1);
+
+		batch.append(buffer, length);
+		batch.push_back('\n');
+	}
+	mNumReportedDroppedRecords = numDroppedRecords;
+
+	if (batch.empty())
+	{
+		return;
+	}
+
+	// a single write and flush per batch
+	std::unique_lock<std::mutex> lock(mStreamMutex);
+	mStream.write(batch.data(), batch.size());
+	mStream.flush();
 }
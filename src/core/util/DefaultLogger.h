@@ -19,8 +19,17 @@
 
 #include "OpenKit/ILogger.h"
 #include "OpenKit/LogLevel.h"
-
+#include "LogRecordQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <string>
+#include <thread>
 
 namespace core
 {
@@ -29,6 +38,12 @@ namespace core
 		///
 		/// Default implementation of @ref openkit::ILogger which write to std::cout
 		///
+		/// @par
+		/// Log records are formatted into a preallocated per-thread buffer. By default they are written to the stream
+		/// by the logging thread. If a queue capacity is given, the records are put into a lock-free
+		/// @ref LogRecordQueue instead and written in batches by a background thread. Records are dropped and counted,
+		/// if the queue is full.
+		///
 		class DefaultLogger : public openkit::ILogger
 		{
 		public:
@@ -51,9 +66,34 @@ namespace core
 			DefaultLogger(std::ostream &stream, openkit::LogLevel logLevel);
 
 			///
-			/// Destructor
+			/// Constructor for a logger writing asynchronously to std::cout
+			/// param[in] logLevel The log level of this logger
+			/// param[in] queueCapacity the maximum number of queued log records, @c 0 to write synchronously
+			///
+			DefaultLogger(openkit::LogLevel logLevel, size_t queueCapacity);
+
+			///
+			/// Constructor for a logger writing asynchronously to the provided stream
+			/// param[in] stream the stream where the default logger shall write to
+			/// param[in] logLevel The log level of this logger
+			/// param[in] queueCapacity the maximum number of queued log records, @c 0 to write synchronously
 			///
-			~DefaultLogger() override = default;
+			DefaultLogger(std::ostream &stream, openkit::LogLevel logLevel, size_t queueCapacity);
+
+			///
+			/// Destructor writing the queued log records
+			///
+			~DefaultLogger() override;
+
+			///
+			/// Delete the copy constructor
+			///
+			DefaultLogger(const DefaultLogger&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			DefaultLogger& operator=(const DefaultLogger&) = delete;
 
 			void log(openkit::LogLevel logLevel, const char* format, ...) override;
 
@@ -73,15 +113,36 @@ namespace core
 
 			bool isDebugEnabled() const override;
 
+			///
+			/// Returns the number of log records dropped, because the queue was full.
+			///
+			uint64_t getNumDroppedRecords() const;
+
 		private:
 			///
-			/// Does the actual logging to the @ref mStream.
+			/// Does the actual logging to the @ref mStream or the @ref mQueue.
 			/// param[in] level the log level is added to the trace
 			/// param[in] format the format string in a printf style
 			/// param[in] args the list of variable arguments to be passed to printf
 			///
 			void doLog(const char* level, const char* format, va_list args);
 
+			///
+			/// Writes a single record, followed by a line break, to the @ref mStream and flushes it.
+			///
+			void writeRecord(const char* record, size_t length);
+
+			///
+			/// The function of the background thread, writing the queued records.
+			///
+			void writerLoopFunc();
+
+			///
+			/// Writes all queued records to the @ref mStream at once.
+			/// param[in,out] batch buffer to collect the records in
+			///
+			void writeQueuedRecords(std::string& batch);
+
 			/// The stream to be logged to
 			std::ostream &mStream;
 
@@ -89,6 +150,30 @@ namespace core
 			/// @remarks Log messages with higher or same priority are logged,
 			/// all others are ignored.
 			openkit::LogLevel mLogLevel;
+
+			/// Serializes writing to the stream
+			std::mutex mStreamMutex;
+
+			/// Queue for asynchronous logging or @c nullptr if records are written synchronously
+			std::unique_ptr<LogRecordQueue> mQueue;
+
+			/// Number of records dropped, because the queue was full
+			std::atomic<uint64_t> mNumDroppedRecords;
+
+			/// Number of dropped records already reported (only accessed by the background thread)
+			uint64_t mNumReportedDroppedRecords;
+
+			/// Mutex for the condition variable
+			std::mutex mMutex;
+
+			/// To wake up the background thread
+			std::condition_variable mConditionVariable;
+
+			/// Flag to stop the background thread
+			bool mStop;
+
+			/// Background thread writing the queued records
+			std::thread mWriterThread;
 		};
 	}
 }
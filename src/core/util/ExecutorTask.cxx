@@ -0,0 +1,163 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ExecutorTask.h"
+
+#include <chrono>
+
+using namespace core::util;
+
+constexpr int64_t ExecutorTask::WAIT_FOR_WAKEUP;
+
+ExecutorTask::ExecutorTask(SharedExecutor& executor, const TaskFunction& taskFunction)
+	: mExecutorState(executor.mState)
+	, mTaskFunction(taskFunction)
+	, mMutex()
+	, mRunCompletedConditionVariable()
+	, mState(State::NOT_STARTED)
+	, mIsWakeupPending(false)
+	, mIsStopPending(false)
+	, mRunningThreadId()
+{
+}
+
+bool ExecutorTask::start(int64_t initialDelayInMillis)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	if (mState != State::NOT_STARTED)
+	{
+		// start was called before
+		return false;
+	}
+
+	scheduleOrWait(initialDelayInMillis);
+
+	return true;
+}
+
+void ExecutorTask::wakeup()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	switch (mState)
+	{
+	case State::WAITING:
+	case State::SCHEDULED:
+		scheduleOrWait(0);
+		break;
+	case State::RUNNING:
+		mIsWakeupPending = true;
+		break;
+	default:
+		// not started or already stopped
+		break;
+	}
+}
+
+bool ExecutorTask::stop(int64_t waitTimeInMillis)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	if (mState == State::RUNNING)
+	{
+		// the run in progress sets the state, once it completed
+		mIsStopPending = true;
+
+		if (mRunningThreadId == std::this_thread::get_id())
+		{
+			// called by the task function, which cannot complete while waiting for it
+			return true;
+		}
+
+		auto waitUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(waitTimeInMillis);
+		while (mState == State::RUNNING && std::chrono::steady_clock::now() < waitUntil)
+		{
+			mRunCompletedConditionVariable.wait_until(lock, waitUntil);
+		}
+
+		return mState != State::RUNNING;
+	}
+
+	if (mState == State::SCHEDULED)
+	{
+		SharedExecutor::cancel(*mExecutorState, shared_from_this());
+	}
+	if (mState != State::NOT_STARTED)
+	{
+		mState = State::STOPPED;
+	}
+
+	return true;
+}
+
+bool ExecutorTask::isStarted() const
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	return mState != State::NOT_STARTED;
+}
+
+bool ExecutorTask::isAlive() const
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	return mState != State::NOT_STARTED && mState != State::STOPPED;
+}
+
+void ExecutorTask::run()
+{
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		if (mState != State::SCHEDULED)
+		{
+			// the task got stopped, or is run already because of an earlier schedule
+			return;
+		}
+
+		mState = State::RUNNING;
+		mRunningThreadId = std::this_thread::get_id();
+	}
+
+	auto delayInMillis = mTaskFunction();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mRunningThreadId = std::thread::id();
+	if (mIsStopPending)
+	{
+		mState = State::STOPPED;
+	}
+	else
+	{
+		scheduleOrWait(mIsWakeupPending ? 0 : delayInMillis);
+	}
+
+	mIsWakeupPending = false;
+	mRunCompletedConditionVariable.notify_all();
+}
+
+void ExecutorTask::scheduleOrWait(int64_t delayInMillis)
+{
+	if (delayInMillis < 0)
+	{
+		mState = State::WAITING;
+		return;
+	}
+
+	mState = State::SCHEDULED;
+	SharedExecutor::schedule(*mExecutorState, shared_from_this(), delayInMillis);
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_UTIL_EXECUTORTASK_H
+#define _CORE_UTIL_EXECUTORTASK_H
+
+#include "SharedExecutor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Recurring piece of background work, which is run by a @ref SharedExecutor instead of a dedicated thread.
+		///
+		/// @par
+		/// The task function returns the number of milliseconds after which it wants to be run again, or
+		/// @ref WAIT_FOR_WAKEUP to be run only after @ref wakeup is called. The task is never run concurrently,
+		/// but it might be run earlier than requested.
+		///
+		class ExecutorTask
+			: public std::enable_shared_from_this<ExecutorTask>
+		{
+		public:
+
+			using TaskFunction = std::function<int64_t()>;
+
+			///
+			/// Delay returned by the task function, if it shall only be run again after @ref wakeup is called.
+			///
+			static constexpr int64_t WAIT_FOR_WAKEUP = -1;
+
+			///
+			/// Constructor
+			///
+			/// @param[in] executor the executor running this task. The task keeps the executor's shared state, therefore
+			///   the executor might be destroyed before the task; the task is not run anymore afterwards.
+			/// @param[in] taskFunction the function being invoked, each time the task is run
+			///
+			ExecutorTask(SharedExecutor& executor, const TaskFunction& taskFunction);
+
+			///
+			/// Schedules the task for the first time, if not called yet.
+			///
+			/// @param[in] initialDelayInMillis number of milliseconds after which the task is run the first time,
+			///   or @ref WAIT_FOR_WAKEUP
+			///
+			/// @return @c false if this method was already called before, @c true otherwise.
+			///
+			bool start(int64_t initialDelayInMillis);
+
+			///
+			/// Runs the task as soon as possible, unless it was stopped.
+			///
+			/// If the task is currently running, it is run once more right after.
+			///
+			void wakeup();
+
+			///
+			/// Stops the task and waits for a run in progress to complete.
+			///
+			/// If called by the task function itself, the task is stopped once the function returned, without waiting.
+			///
+			/// @param waitTimeInMillis number of milliseconds to wait for a run in progress to complete.
+			///
+			/// @return @c true if the task is not running anymore, @c false on timeout.
+			///
+			bool stop(int64_t waitTimeInMillis);
+
+			///
+			/// Gets @c true if ExecutorTask::start(int64_t) was called already, @c false otherwise.
+			///
+			bool isStarted() const;
+
+			///
+			/// Gets @c true if the task was started and did not stop yet, @c false otherwise.
+			///
+			bool isAlive() const;
+
+			///
+			/// Invokes the task function and schedules the next run. Called by the @ref SharedExecutor.
+			///
+			void run();
+
+			///
+			/// Copy constructor is not allowed
+			///
+			ExecutorTask(const ExecutorTask&) = delete;
+
+			///
+			/// Assignment operator is not allowed
+			///
+			ExecutorTask& operator = (const ExecutorTask&) = delete;
+
+		private:
+
+			enum class State
+			{
+				/// ExecutorTask::start(int64_t) was not called yet
+				NOT_STARTED,
+				/// the task is waiting for ExecutorTask::wakeup()
+				WAITING,
+				/// the task is scheduled in the executor
+				SCHEDULED,
+				/// the task function is being invoked
+				RUNNING,
+				/// the task was stopped
+				STOPPED
+			};
+
+			///
+			/// Schedules the task after the given delay or lets it wait for a wakeup.
+			///
+			/// Must only be called while holding the mutex.
+			///
+			void scheduleOrWait(int64_t delayInMillis);
+
+			/// The state of the executor running this task
+			const std::shared_ptr<SharedExecutor::State> mExecutorState;
+
+			/// The function being invoked, each time the task is run
+			const TaskFunction mTaskFunction;
+
+			/// Mutex guarding the state
+			mutable std::mutex mMutex;
+
+			/// Notified, when a run in progress completed
+			std::condition_variable mRunCompletedConditionVariable;
+
+			/// The task's state
+			State mState;
+
+			/// Flag indicating that the task was woken up while it was running
+			bool mIsWakeupPending;
+
+			/// Flag indicating that the task was stopped while it was running
+			bool mIsStopPending;
+
+			/// The thread invoking the task function, while the task is running
+			std::thread::id mRunningThreadId;
+		};
+	}
+}
+
+#endif
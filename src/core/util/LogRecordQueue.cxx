@@ -0,0 +1,58 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LogRecordQueue.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace core::util;
+
+constexpr size_t LogRecordQueue::MAX_RECORD_LENGTH;
+
+LogRecordQueue::LogRecordQueue(size_t capacity)
+	: mQueue(capacity)
+{
+}
+
+bool LogRecordQueue::tryPush(const char* record, size_t length)
+{
+	return mQueue.tryPush([record, length](Record& slotRecord)
+	{
+		slotRecord.length = std::min(length, MAX_RECORD_LENGTH);
+		std::memcpy(slotRecord.data, record, slotRecord.length);
+	});
+}
+
+bool LogRecordQueue::tryPopInto(std::string& output)
+{
+	return mQueue.tryPop([&output](Record& slotRecord)
+	{
+		output.append(slotRecord.data, slotRecord.length);
+		output.push_back('\n');
+	});
+}
+
+size_t LogRecordQueue::size() const
+{
+	return mQueue.size();
+}
+
+size_t LogRecordQueue::getCapacity() const
+{
+	return mQueue.getCapacity();
+}
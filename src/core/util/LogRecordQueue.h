@@ -0,0 +1,111 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_UTIL_LOGRECORDQUEUE_H
+#define _CORE_UTIL_LOGRECORDQUEUE_H
+
+#include "BoundedQueue.h"
+
+#include <cstddef>
+#include <string>
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Bounded lock-free queue, used to hand over formatted log records from logging threads to a writer thread.
+		///
+		/// @par
+		/// All slots are allocated up front and hold up to @ref MAX_RECORD_LENGTH characters, so that adding a record
+		/// does not allocate memory. The slots are managed by a @ref BoundedQueue, like the ones of
+		/// @ref core::caching::BeaconRecordQueue.
+		///
+		class LogRecordQueue
+		{
+		public:
+
+			///
+			/// Maximum number of characters of a record; longer records are truncated
+			///
+			static constexpr size_t MAX_RECORD_LENGTH = 1024;
+
+			///
+			/// Constructor
+			///
+			/// @param[in] capacity the maximum number of queued records, which is rounded up to the next power of two
+			///
+			LogRecordQueue(size_t capacity);
+
+			///
+			/// Delete the copy constructor
+			///
+			LogRecordQueue(const LogRecordQueue&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			LogRecordQueue& operator=(const LogRecordQueue&) = delete;
+
+			///
+			/// Adds the given record to the queue, unless the queue is full.
+			///
+			/// @param[in] record the characters of the record
+			/// @param[in] length the number of characters, which is truncated to @ref MAX_RECORD_LENGTH
+			/// @return @c true if the record was added, @c false if the queue is full
+			///
+			bool tryPush(const char* record, size_t length);
+
+			///
+			/// Removes the oldest record from the queue and appends it to the given string, followed by a line break.
+			///
+			/// @param[in,out] output the string the removed record is appended to
+			/// @return @c true if a record was removed, @c false if the queue is empty
+			///
+			bool tryPopInto(std::string& output);
+
+			///
+			/// Returns the approximate number of queued records.
+			///
+			size_t size() const;
+
+			///
+			/// Returns the maximum number of queued records.
+			///
+			size_t getCapacity() const;
+
+		private:
+
+			///
+			/// Record stored in a slot of the ring buffer
+			///
+			struct Record
+			{
+				/// Number of characters of the record
+				size_t length;
+
+				/// The characters of the record
+				char data[MAX_RECORD_LENGTH];
+			};
+
+			/// The ring buffer holding the records
+			BoundedQueue<Record> mQueue;
+		};
+	}
+}
+
+#endif
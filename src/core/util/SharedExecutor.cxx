@@ -0,0 +1,207 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "SharedExecutor.h"
+#include "DeadlineQueue.h"
+#include "ExecutorTask.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+using namespace core::util;
+
+constexpr size_t SharedExecutor::DEFAULT_NUMBER_OF_WORKERS;
+
+struct SharedExecutor::State
+{
+	State()
+		: mutex()
+		, conditionVariable()
+		, scheduledTasks()
+		, readyTasks()
+		, stop(false)
+	{
+	}
+
+	/// Mutex guarding the ready tasks and the stop flag
+	std::mutex mutex;
+
+	/// Worker threads wait on this condition variable for tasks becoming due
+	std::condition_variable conditionVariable;
+
+	/// Scheduled tasks ordered by the time they are due
+	DeadlineQueue<ExecutorTask> scheduledTasks;
+
+	/// Tasks which are due, but not yet taken by a worker thread
+	std::deque<std::shared_ptr<ExecutorTask>> readyTasks;
+
+	/// Flag to stop the worker threads
+	bool stop;
+};
+
+SharedExecutor::SharedExecutor(size_t numberOfWorkers)
+	: mState(std::make_shared<State>())
+	, mWorkers()
+{
+	numberOfWorkers = std::max(numberOfWorkers, size_t(1));
+	mWorkers.reserve(numberOfWorkers);
+	for (size_t i = 0; i < numberOfWorkers; i++)
+	{
+		mWorkers.emplace_back(&SharedExecutor::workerFunction, mState);
+	}
+}
+
+SharedExecutor::~SharedExecutor()
+{
+	std::vector<std::shared_ptr<ExecutorTask>> discardedTasks;
+	{
+		std::unique_lock<std::mutex> lock(mState->mutex);
+		mState->stop = true;
+		mState->conditionVariable.notify_all();
+
+		// tasks keep the state alive, therefore the state must not keep them
+		discardedTasks = mState->scheduledTasks.takeDue(DeadlineQueue<ExecutorTask>::NO_DEADLINE);
+		discardedTasks.insert(discardedTasks.end(), mState->readyTasks.begin(), mState->readyTasks.end());
+		mState->readyTasks.clear();
+	}
+	// the discarded tasks are released outside the lock
+	discardedTasks.clear();
+
+	for (auto& worker : mWorkers)
+	{
+		if (worker.get_id() == std::this_thread::get_id())
+		{
+			// the last reference was released by a task run on this worker, which holds its own reference to the
+			// shared state and stops once the task returned
+			worker.detach();
+		}
+		else
+		{
+			worker.join();
+		}
+	}
+}
+
+std::shared_ptr<SharedExecutor> SharedExecutor::getInstance()
+{
+	static std::mutex instanceMutex;
+	static std::weak_ptr<SharedExecutor> instance;
+
+	std::unique_lock<std::mutex> lock(instanceMutex);
+	auto executor = instance.lock();
+	if (executor == nullptr)
+	{
+		executor = std::make_shared<SharedExecutor>(DEFAULT_NUMBER_OF_WORKERS);
+		instance = executor;
+	}
+
+	return executor;
+}
+
+void SharedExecutor::schedule(const std::shared_ptr<ExecutorTask>& task, int64_t delayInMillis)
+{
+	schedule(*mState, task, delayInMillis);
+}
+
+void SharedExecutor::cancel(const std::shared_ptr<ExecutorTask>& task)
+{
+	cancel(*mState, task);
+}
+
+size_t SharedExecutor::getNumberOfWorkers() const
+{
+	return mWorkers.size();
+}
+
+void SharedExecutor::schedule(State& state, const std::shared_ptr<ExecutorTask>& task, int64_t delayInMillis)
+{
+	auto currentTime = now();
+	auto deadline = delayInMillis < DeadlineQueue<ExecutorTask>::NO_DEADLINE - currentTime
+		? currentTime + std::max(delayInMillis, int64_t(0))
+		: DeadlineQueue<ExecutorTask>::NO_DEADLINE - 1;
+
+	std::unique_lock<std::mutex> lock(state.mutex);
+	if (state.stop)
+	{
+		// the executor was destroyed, nobody would run the task
+		return;
+	}
+
+	state.scheduledTasks.put(task, deadline);
+
+	// waiting workers need to re-evaluate the time they are allowed to sleep
+	state.conditionVariable.notify_all();
+}
+
+void SharedExecutor::cancel(State& state, const std::shared_ptr<ExecutorTask>& task)
+{
+	std::unique_lock<std::mutex> lock(state.mutex);
+	state.scheduledTasks.remove(task);
+	state.readyTasks.erase(std::remove(state.readyTasks.begin(), state.readyTasks.end(), task), state.readyTasks.end());
+}
+
+void SharedExecutor::workerFunction(std::shared_ptr<State> state)
+{
+	std::unique_lock<std::mutex> lock(state->mutex);
+	while (!state->stop)
+	{
+		if (state->readyTasks.empty())
+		{
+			for (auto& task : state->scheduledTasks.takeDue(now()))
+			{
+				state->readyTasks.push_back(std::move(task));
+			}
+		}
+
+		if (state->readyTasks.empty())
+		{
+			auto nextDeadline = state->scheduledTasks.getNextDeadline();
+			if (nextDeadline == DeadlineQueue<ExecutorTask>::NO_DEADLINE)
+			{
+				state->conditionVariable.wait(lock);
+			}
+			else
+			{
+				state->conditionVariable.wait_for(lock,
+					std::chrono::milliseconds(std::max(nextDeadline - now(), int64_t(0))));
+			}
+			continue;
+		}
+
+		auto task = std::move(state->readyTasks.front());
+		state->readyTasks.pop_front();
+		if (!state->readyTasks.empty())
+		{
+			// let another worker take the remaining due tasks
+			state->conditionVariable.notify_one();
+		}
+
+		lock.unlock();
+		task->run();
+		task.reset();
+		lock.lock();
+	}
+}
+
+int64_t SharedExecutor::now()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
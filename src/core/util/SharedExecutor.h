@@ -0,0 +1,157 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _CORE_UTIL_SHAREDEXECUTOR_H
+#define _CORE_UTIL_SHAREDEXECUTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace core
+{
+	namespace util
+	{
+		class ExecutorTask;
+
+		///
+		/// Small fixed pool of worker threads running @ref ExecutorTask instances, once their delay elapsed.
+		///
+		/// @par
+		/// A process-wide instance can be shared by all OpenKit instances (see @ref getInstance), so that their
+		/// background work does not require dedicated threads per OpenKit instance.
+		///
+		class SharedExecutor
+		{
+		public:
+
+			///
+			/// Number of worker threads of the process-wide executor
+			///
+			static constexpr size_t DEFAULT_NUMBER_OF_WORKERS = 2;
+
+			///
+			/// Constructor starting the worker threads.
+			///
+			/// @param[in] numberOfWorkers number of worker threads (at least one worker is started)
+			///
+			explicit SharedExecutor(size_t numberOfWorkers);
+
+			///
+			/// Destructor stopping and joining the worker threads.
+			///
+			/// @remarks
+			/// Tasks which are still scheduled are discarded, without being run, and tasks scheduled afterwards are
+			/// ignored. If the last reference is released by a task, the worker running it is detached instead; it only
+			/// keeps the shared worker state alive.
+			///
+			~SharedExecutor();
+
+			///
+			/// Returns the process-wide executor.
+			///
+			/// @par
+			/// The executor is created on demand and destroyed, once the last user released it.
+			///
+			static std::shared_ptr<SharedExecutor> getInstance();
+
+			///
+			/// Schedules the given task to be run after the given delay.
+			///
+			/// If the task is already scheduled, it is rescheduled with the new delay.
+			///
+			/// @param[in] task the task to run
+			/// @param[in] delayInMillis number of milliseconds after which the task is run
+			///
+			void schedule(const std::shared_ptr<ExecutorTask>& task, int64_t delayInMillis);
+
+			///
+			/// Removes the given task from the scheduled tasks.
+			///
+			/// @param[in] task the task not to run
+			///
+			void cancel(const std::shared_ptr<ExecutorTask>& task);
+
+			///
+			/// Returns the number of worker threads.
+			///
+			size_t getNumberOfWorkers() const;
+
+			///
+			/// Copy constructor is not allowed
+			///
+			SharedExecutor(const SharedExecutor&) = delete;
+
+			///
+			/// Assignment operator is not allowed
+			///
+			SharedExecutor& operator = (const SharedExecutor&) = delete;
+
+		private:
+
+			/// Tasks schedule themselves through the shared state, which they keep alive
+			friend class ExecutorTask;
+
+			///
+			/// State shared between the executor, its worker threads and its tasks.
+			///
+			/// @par
+			/// The worker threads and tasks never access the executor itself, so that a worker running the task, which
+			/// releases the last reference to the executor, can safely outlive it.
+			///
+			struct State;
+
+			///
+			/// Schedules the given task in the given state, unless the executor owning the state was destroyed.
+			///
+			/// @param[in] state the state of the executor running the task
+			/// @param[in] task the task to run
+			/// @param[in] delayInMillis number of milliseconds after which the task is run
+			///
+			static void schedule(State& state, const std::shared_ptr<ExecutorTask>& task, int64_t delayInMillis);
+
+			///
+			/// Removes the given task from the scheduled tasks of the given state.
+			///
+			/// @param[in] state the state of the executor running the task
+			/// @param[in] task the task not to run
+			///
+			static void cancel(State& state, const std::shared_ptr<ExecutorTask>& task);
+
+			///
+			/// Function executed by each worker thread.
+			///
+			/// @param[in] state the state shared with the executor
+			///
+			static void workerFunction(std::shared_ptr<State> state);
+
+			///
+			/// Returns the current time of a monotonic clock in milliseconds.
+			///
+			static int64_t now();
+
+			/// The state shared with the worker threads and the tasks
+			const std::shared_ptr<State> mState;
+
+			/// The worker threads
+			std::vector<std::thread> mWorkers;
+		};
+	}
+}
+
+#endif
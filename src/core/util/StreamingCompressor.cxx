@@ -0,0 +1,141 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingCompressor.h"
+
+#include <zlib.h>
+
+using namespace base::util;
+
+#define WINDOW_BITS   15
+#define GZIP_ENCODING 16
+#define MEMORY_LEVEL  8
+
+///
+/// Maps the given compression strategy to the zlib strategy
+///
+static int toZlibStrategy(openkit::CompressionStrategy compressionStrategy)
+{
+	switch (compressionStrategy)
+	{
+	case openkit::CompressionStrategy::FILTERED:
+		return Z_FILTERED;
+	case openkit::CompressionStrategy::HUFFMAN_ONLY:
+		return Z_HUFFMAN_ONLY;
+	case openkit::CompressionStrategy::RLE:
+		return Z_RLE;
+	case openkit::CompressionStrategy::FIXED:
+		return Z_FIXED;
+	default:
+		return Z_DEFAULT_STRATEGY;
+	}
+}
+
+StreamingCompressor::StreamingCompressor(int32_t compressionLevel, openkit::CompressionStrategy compressionStrategy)
+	: mCompressionLevel(compressionLevel)
+	, mCompressionStrategy(compressionStrategy)
+	, mStream(nullptr)
+	, mIsInitialized(false)
+	, mIsFinished(true)
+{
+}
+
+StreamingCompressor::~StreamingCompressor()
+{
+	if (mIsInitialized)
+	{
+		deflateEnd(mStream.get());
+	}
+}
+
+bool StreamingCompressor::reset(const void* inData, size_t inDataSize)
+{
+	mIsFinished = true;
+
+	if (!mIsInitialized)
+	{
+		mStream.reset(new z_stream());
+		mStream->zalloc = Z_NULL;
+		mStream->zfree = Z_NULL;
+		mStream->opaque = Z_NULL;
+
+		// Use GZIP with the configured level and strategy
+		if (deflateInit2(mStream.get(), mCompressionLevel, Z_DEFLATED, WINDOW_BITS | GZIP_ENCODING, MEMORY_LEVEL,
+			toZlibStrategy(mCompressionStrategy)) != Z_OK)
+		{
+			mStream.reset();
+			return false;
+		}
+		mIsInitialized = true;
+	}
+	else if (deflateReset(mStream.get()) != Z_OK)
+	{
+		return false;
+	}
+
+	mStream->next_in = reinterpret_cast<Bytef*>(const_cast<void*>(inData));
+	mStream->avail_in = static_cast<uInt>(inDataSize);
+	mIsFinished = false;
+
+	return true;
+}
+
+bool StreamingCompressor::read(void* outData, size_t outDataSize, size_t& written)
+{
+	written = 0;
+	if (mIsFinished || outDataSize == 0)
+	{
+		return true;
+	}
+	if (!mIsInitialized)
+	{
+		return false;
+	}
+
+	mStream->next_out = reinterpret_cast<Bytef*>(outData);
+	mStream->avail_out = static_cast<uInt>(outDataSize);
+
+	// all input is available upfront, therefore the stream can be finished right away
+	auto result = deflate(mStream.get(), Z_FINISH);
+	written = outDataSize - mStream->avail_out;
+
+	if (result == Z_STREAM_END)
+	{
+		mIsFinished = true;
+	}
+	else if (result != Z_OK && result != Z_BUF_ERROR)
+	{
+		mIsFinished = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool StreamingCompressor::isFinished() const
+{
+	return mIsFinished;
+}
+
+int32_t StreamingCompressor::getCompressionLevel() const
+{
+	return mCompressionLevel;
+}
+
+openkit::CompressionStrategy StreamingCompressor::getCompressionStrategy() const
+{
+	return mCompressionStrategy;
+}
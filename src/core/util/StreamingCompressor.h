@@ -0,0 +1,127 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_STREAMINGCOMPRESSOR_H
+#define _CORE_UTIL_STREAMINGCOMPRESSOR_H
+
+#include "OpenKit/CompressionStrategy.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// forward declaration of zlib's stream state, which is not exposed to users of this class
+struct z_stream_s;
+
+namespace base
+{
+	namespace util
+	{
+		///
+		/// Utility class to gzip compress data incrementally into caller provided buffers.
+		///
+		/// @par
+		/// Unlike @ref Compressor no intermediate buffers are allocated for the compressed data. Instead the
+		/// compressed data is produced piecewise, whenever the consumer (e.g. curl's read callback) asks for more.
+		/// The underlying deflate state is allocated once and reused for all subsequent inputs.
+		///
+		class StreamingCompressor
+		{
+		public:
+
+			///
+			/// Constructor
+			/// @param[in] compressionLevel zlib compression level in the range [-1, 9], where @c -1 is the default level
+			/// @param[in] compressionStrategy strategy used for compressing the data
+			///
+			StreamingCompressor(
+				int32_t compressionLevel = -1,
+				openkit::CompressionStrategy compressionStrategy = openkit::CompressionStrategy::DEFAULT
+			);
+
+			///
+			/// Destructor
+			///
+			~StreamingCompressor();
+
+			///
+			/// Delete the copy constructor
+			///
+			StreamingCompressor(const StreamingCompressor&) = delete;
+
+			///
+			/// Delete the assignment operator
+			///
+			StreamingCompressor& operator = (const StreamingCompressor&) = delete;
+
+			///
+			/// Starts compressing the given data, discarding any state of a previous compression.
+			///
+			/// @par
+			/// The data is not copied and must stay valid until the compression finished or @ref reset is called again.
+			///
+			/// @param[in] inData pointer to the data to compress
+			/// @param[in] inDataSize size of data behind the pointer (measured in bytes)
+			/// @return @c true if the compressor is ready, @c false if the deflate state could not be initialized.
+			///
+			bool reset(const void* inData, size_t inDataSize);
+
+			///
+			/// Writes the next piece of compressed data to the given buffer.
+			///
+			/// @param[out] outData buffer where the compressed data is written to
+			/// @param[in] outDataSize size of the buffer (measured in bytes)
+			/// @param[out] written number of bytes written, @c 0 if the compression finished
+			/// @return @c true on success, @c false if compressing failed.
+			///
+			bool read(void* outData, size_t outDataSize, size_t& written);
+
+			///
+			/// Returns @c true if all compressed data has been read.
+			///
+			bool isFinished() const;
+
+			///
+			/// Returns the compression level used by this compressor.
+			///
+			int32_t getCompressionLevel() const;
+
+			///
+			/// Returns the compression strategy used by this compressor.
+			///
+			openkit::CompressionStrategy getCompressionStrategy() const;
+
+		private:
+
+			/// zlib compression level
+			const int32_t mCompressionLevel;
+
+			/// compression strategy
+			const openkit::CompressionStrategy mCompressionStrategy;
+
+			/// zlib stream state, allocated on the first call to @ref reset
+			std::unique_ptr<z_stream_s> mStream;
+
+			/// indicates that the deflate state has been initialized
+			bool mIsInitialized;
+
+			/// indicates that the end of the compressed stream was reached
+			bool mIsFinished;
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingCompressorPool.h"
+
+using namespace base::util;
+
+StreamingCompressorPool::StreamingCompressorPool(
+	int32_t compressionLevel,
+	openkit::CompressionStrategy compressionStrategy,
+	size_t maxIdleCompressors
+)
+	: mCompressionLevel(compressionLevel)
+	, mCompressionStrategy(compressionStrategy)
+	, mMaxIdleCompressors(maxIdleCompressors)
+	, mIdleCompressors()
+	, mMutex()
+{
+}
+
+std::unique_ptr<StreamingCompressor> StreamingCompressorPool::acquire()
+{
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (!mIdleCompressors.empty())
+		{
+			auto compressor = std::move(mIdleCompressors.back());
+			mIdleCompressors.pop_back();
+			return compressor;
+		}
+	}
+
+	return std::unique_ptr<StreamingCompressor>(new StreamingCompressor(mCompressionLevel, mCompressionStrategy));
+}
+
+void StreamingCompressorPool::release(std::unique_ptr<StreamingCompressor> compressor)
+{
+	if (compressor == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mIdleCompressors.size() < mMaxIdleCompressors)
+	{
+		mIdleCompressors.push_back(std::move(compressor));
+	}
+}
+
+size_t StreamingCompressorPool::getNumberOfIdleCompressors()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mIdleCompressors.size();
+}
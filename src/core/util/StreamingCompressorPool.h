@@ -0,0 +1,88 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CORE_UTIL_STREAMINGCOMPRESSORPOOL_H
+#define _CORE_UTIL_STREAMINGCOMPRESSORPOOL_H
+
+#include "StreamingCompressor.h"
+#include "OpenKit/CompressionStrategy.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace base
+{
+	namespace util
+	{
+		///
+		/// Pool of @ref StreamingCompressor instances, so that the deflate state survives the short lived HTTP clients.
+		///
+		class StreamingCompressorPool
+		{
+		public:
+
+			///
+			/// Constructor
+			/// @param[in] compressionLevel compression level of all compressors created by this pool
+			/// @param[in] compressionStrategy compression strategy of all compressors created by this pool
+			/// @param[in] maxIdleCompressors maximum number of compressors kept in the pool
+			///
+			StreamingCompressorPool(
+				int32_t compressionLevel,
+				openkit::CompressionStrategy compressionStrategy,
+				size_t maxIdleCompressors
+			);
+
+			///
+			/// Returns an idle compressor or a new one, if the pool is empty.
+			///
+			std::unique_ptr<StreamingCompressor> acquire();
+
+			///
+			/// Returns the given compressor to the pool. If the pool is full, the compressor is destroyed.
+			/// @param[in] compressor the compressor previously obtained via @ref acquire
+			///
+			void release(std::unique_ptr<StreamingCompressor> compressor);
+
+			///
+			/// Returns the number of compressors which are currently idle in the pool.
+			///
+			size_t getNumberOfIdleCompressors();
+
+		private:
+
+			/// compression level of the created compressors
+			const int32_t mCompressionLevel;
+
+			/// compression strategy of the created compressors
+			const openkit::CompressionStrategy mCompressionStrategy;
+
+			/// maximum number of idle compressors
+			const size_t mMaxIdleCompressors;
+
+			/// idle compressors
+			std::vector<std::unique_ptr<StreamingCompressor>> mIdleCompressors;
+
+			/// mutex guarding the idle compressors
+			std::mutex mMutex;
+		};
+	}
+}
+
+#endif
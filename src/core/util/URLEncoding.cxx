@@ -16,51 +16,107 @@
 
 #include "URLEncoding.h"
 
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstdint>
+#include <iterator>
+#include <utility>
 
 using namespace core::util;
 
-static const std::unordered_set<unsigned char> UNRESERVED_CHARACTERS_RFC3986 = { 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-																				 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
-																				 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1',
-																				 '2', '3', '4', '5', '6', '7', '8', '9', '-', '_', '.', '~' };
+///
+/// Lookup table containing @c true for all bytes which are unreserved characters according to RFC 3986
+///
+static const bool UNRESERVED_CHARACTERS_RFC3986[256] = {
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0x00 - 0x0F
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0x10 - 0x1F
+	false, false, false, false, false, false, false, false, false, false, false, false, false, true, true, false, // 0x20 - 0x2F
+	true, true, true, true, true, true, true, true, true, true, false, false, false, false, false, false, // 0x30 - 0x3F
+	false, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, // 0x40 - 0x4F
+	true, true, true, true, true, true, true, true, true, true, true, false, false, false, false, true, // 0x50 - 0x5F
+	false, true, true, true, true, true, true, true, true, true, true, true, true, true, true, true, // 0x60 - 0x6F
+	true, true, true, true, true, true, true, true, true, true, true, false, false, false, true, false, // 0x70 - 0x7F
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0x80 - 0x8F
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0x90 - 0x9F
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xA0 - 0xAF
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xB0 - 0xBF
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xC0 - 0xCF
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xD0 - 0xDF
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xE0 - 0xEF
+	false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, // 0xF0 - 0xFF
+};
 
-const char HEX_CHARACTERS[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+///
+/// Lookup table of the RFC 3986 unreserved characters, without any additional reserved characters
+///
+static const URLEncoding::UnreservedCharacters UNRESERVED_CHARACTERS({});
+
+static const char HEX_CHARACTERS[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+URLEncoding::UnreservedCharacters::UnreservedCharacters(const std::unordered_set<char>& additionalReservedCharacters)
+	: mIsUnreserved()
+{
+	std::copy(std::begin(UNRESERVED_CHARACTERS_RFC3986), std::end(UNRESERVED_CHARACTERS_RFC3986), mIsUnreserved.begin());
+	for (auto character : additionalReservedCharacters)
+	{
+		mIsUnreserved[static_cast<unsigned char>(character)] = false;
+	}
+}
 
 core::UTF8String URLEncoding::urlencode(const core::UTF8String& string)
 {
-	return urlencode(string, {});
+	return urlencode(string, UNRESERVED_CHARACTERS);
 }
 
 core::UTF8String URLEncoding::urlencode(const core::UTF8String& string, const std::unordered_set<char>& additionalReservedCharacters)
+{
+	return urlencode(string, UnreservedCharacters(additionalReservedCharacters));
+}
+
+core::UTF8String URLEncoding::urlencode(const core::UTF8String& string, const UnreservedCharacters& unreservedCharacters)
 {
 	std::string encoded;
 	encoded.reserve(string.getStringLength());
 
-	auto stringData = string.getStringData();
+	const auto& stringData = string.getStringData();
+	urlencode(stringData.data(), stringData.size(), unreservedCharacters, encoded);
 
-	for (auto it = stringData.begin(); it < stringData.end(); it++)
+	return core::UTF8String(std::move(encoded));
+}
+
+void URLEncoding::urlencode(const char* data, size_t numBytes, const std::unordered_set<char>& additionalReservedCharacters, std::string& encoded)
+{
+	urlencode(data, numBytes, UnreservedCharacters(additionalReservedCharacters), encoded);
+}
+
+void URLEncoding::urlencode(const char* data, size_t numBytes, const UnreservedCharacters& unreservedCharacters, std::string& encoded)
+{
+	const auto end = data + numBytes;
+	auto it = data;
+	while (it < end)
 	{
-		auto character = *it;
-		if (UNRESERVED_CHARACTERS_RFC3986.find(character) != UNRESERVED_CHARACTERS_RFC3986.end()     // character is in the list of unreserved characters -> copy
-			&& additionalReservedCharacters.find(character) == additionalReservedCharacters.end()) // character is not additionally marked as reserved
+		// copy the run of unreserved characters at once
+		auto runStart = it;
+		while (it < end && unreservedCharacters.contains(static_cast<unsigned char>(*it)))
 		{
-			encoded += character;
+			it++;
 		}
-		else // character must be escaped
+		if (it != runStart)
 		{
-			char hexString[4] = { '%', 0, 0, 0 };
-			hexString[1] = HEX_CHARACTERS[(character >> 4) & 0x0F];
-			hexString[2] = HEX_CHARACTERS[character & 0x0F];
-			encoded += hexString;
+			encoded.append(runStart, it - runStart);
 		}
-	}
 
-	return encoded;
- }
+		// escape the run of reserved characters
+		while (it < end && !unreservedCharacters.contains(static_cast<unsigned char>(*it)))
+		{
+			auto character = static_cast<unsigned char>(*it);
+			char hexString[3] = { '%', HEX_CHARACTERS[character >> 4], HEX_CHARACTERS[character & 0x0F] };
+			encoded.append(hexString, sizeof(hexString));
+			it++;
+		}
+	}
+}
 
 core::UTF8String URLEncoding::urldecode(const core::UTF8String& string)
 {
@@ -101,5 +157,5 @@ core::UTF8String URLEncoding::urldecode(const core::UTF8String& string)
 		}
 	}
 
-	return UTF8String(decoded);
+	return UTF8String(std::move(decoded));
 }
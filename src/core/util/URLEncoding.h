@@ -19,6 +19,9 @@
 
 #include "core/UTF8String.h"
 
+#include <array>
+#include <cstddef>
+#include <string>
 #include <unordered_set>
 
 namespace core
@@ -33,6 +36,38 @@ namespace core
 		{
 		public:
 
+			///
+			/// Lookup table of the bytes which are copied without encoding them.
+			///
+			/// @par
+			/// Contains the unreserved characters according to RFC 3986, except the additional reserved characters
+			/// given on construction. Callers encoding many strings with the same additional reserved characters
+			/// should build the table once and pass it to @ref urlencode.
+			///
+			class UnreservedCharacters
+			{
+			public:
+
+				///
+				/// Constructor
+				/// @param additionalReservedCharacters Additional characters to consider as reserved.
+				///
+				explicit UnreservedCharacters(const std::unordered_set<char>& additionalReservedCharacters);
+
+				///
+				/// Returns @c true if the given byte is copied without encoding it.
+				///
+				bool contains(unsigned char character) const
+				{
+					return mIsUnreserved[character];
+				}
+
+			private:
+
+				/// @c true for every byte which is not encoded
+				std::array<bool, 256> mIsUnreserved;
+			};
+
 			///
 			/// No default constructor, since it's a static utility class
 			///
@@ -58,6 +93,37 @@ namespace core
 			static core::UTF8String urlencode(const core::UTF8String& string,
 											  const std::unordered_set<char>& additionalReservedCharacters);
 
+			///
+			/// URL-Encode the given string, copying only the given unreserved characters without encoding them.
+			///
+			/// @param string The string to encode.
+			/// @param unreservedCharacters The characters which are not encoded.
+			/// @returns url-encoded version of the current string
+			///
+			static core::UTF8String urlencode(const core::UTF8String& string, const UnreservedCharacters& unreservedCharacters);
+
+			///
+			/// URL-Encode the given bytes and append the result to @c encoded.
+			///
+			/// @param data The bytes to encode.
+			/// @param numBytes The number of bytes to encode.
+			/// @param additionalReservedCharacters Additional characters to consider as reserved.
+			/// @param encoded The string the url-encoded bytes are appended to.
+			///
+			static void urlencode(const char* data, size_t numBytes,
+								  const std::unordered_set<char>& additionalReservedCharacters, std::string& encoded);
+
+			///
+			/// URL-Encode the given bytes and append the result to @c encoded.
+			///
+			/// @param data The bytes to encode.
+			/// @param numBytes The number of bytes to encode.
+			/// @param unreservedCharacters The characters which are not encoded.
+			/// @param encoded The string the url-encoded bytes are appended to.
+			///
+			static void urlencode(const char* data, size_t numBytes, const UnreservedCharacters& unreservedCharacters,
+								  std::string& encoded);
+
 			///
 			/// URL-Decode the given string
 			/// @returns url-decoded version of the current string
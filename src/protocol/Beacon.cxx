@@ -17,16 +17,14 @@
 #include "Beacon.h"
 #include "ProtocolConstants.h"
 #include "BeaconProtocolConstants.h"
-#include "core/util/URLEncoding.h"
+#include "BeaconRecordWriter.h"
 #include "core/util/InetAddressValidator.h"
 #include "core/util/StringUtil.h"
 #include "core/util/ConnectionTypeUtil.h"
-#include "core/util/EventPayloadBuilderUtil.h"
 #include "providers/DefaultPRNGenerator.h"
 #include "OpenKit/json/JsonObjectValue.h"
 #include "OpenKit/json/JsonStringValue.h"
 #include "OpenKit/json/JsonNumberValue.h"
-#include "OpenKit/json/JsonBooleanValue.h"
 #include "OpenKitVersion.h"
 #include <random>
 #include <core/objects/EventPayloadAttributes.h>
@@ -52,6 +50,9 @@ Beacon::Beacon(const protocol::IBeaconInitializer& initializer, const std::share
 	, mSessionSequenceNumber(initializer.getSessionSequenceNumber())
 	, mSessionStartTime(initializer.getTiminigProvider()->provideTimestampInMilliseconds())
 	, mImmutableBasicBeaconData()
+	, mEventPayloadTemplate()
+	, mBeaconHeader()
+	, mIsBeaconHeaderStored(true)
 	, mSupplementaryBasicData(initializer.getSupplementaryBasicData())
 
 {
@@ -75,123 +76,107 @@ Beacon::Beacon(const protocol::IBeaconInitializer& initializer, const std::share
 		: 1;
 
 	mImmutableBasicBeaconData = createImmutableBeaconData();
+	mEventPayloadTemplate = createEventPayloadTemplate();
+	mBeaconHeader = createBeaconHeader();
+	mBeaconCache->setBeaconHeader(mBeaconKey, mBeaconHeader);
 }
 
 core::UTF8String Beacon::createImmutableBeaconData()
 {
-	core::UTF8String basicBeaconData;
+	BeaconRecordWriter basicBeaconData;
 
 	auto openKitConfig = mBeaconConfiguration->getOpenKitConfiguration();
 
 	//version and application information
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_PROTOCOL_VERSION, protocol::PROTOCOL_VERSION);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_OPENKIT_VERSION, protocol::OPENKIT_VERSION);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_APPLICATION_ID, openKitConfig->getApplicationId());
-	addKeyValuePairIfNotEmpty(basicBeaconData, protocol::BEACON_KEY_APPLICATION_VERSION, openKitConfig->getApplicationVersion());
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_PROTOCOL_VERSION, protocol::PROTOCOL_VERSION);
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_OPENKIT_VERSION, protocol::OPENKIT_VERSION);
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_APPLICATION_ID, openKitConfig->getApplicationId());
+	basicBeaconData.addKeyValuePairIfNotEmpty(protocol::BEACON_KEY_APPLICATION_VERSION, openKitConfig->getApplicationVersion());
 
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_PLATFORM_TYPE, PLATFORM_TYPE_OPENKIT);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_AGENT_TECHNOLOGY_TYPE, AGENT_TECHNOLOGY_TYPE);
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_PLATFORM_TYPE, PLATFORM_TYPE_OPENKIT);
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_AGENT_TECHNOLOGY_TYPE, AGENT_TECHNOLOGY_TYPE);
 
 	// device/visitor ID, session number and IP address
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_VISITOR_ID, getDeviceID());
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_SESSION_NUMBER, getSessionNumber());
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_VISITOR_ID, getDeviceID());
+	basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_SESSION_NUMBER, getSessionNumber());
 	
 	if (mUseClientIpAddress)
 	{
-		addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_CLIENT_IP_ADDRESS, mClientIPAddress);
+		basicBeaconData.addKeyValuePair(protocol::BEACON_KEY_CLIENT_IP_ADDRESS, mClientIPAddress);
 	}
 
 	// platform information
-	addKeyValuePairIfNotEmpty(basicBeaconData, BEACON_KEY_DEVICE_OS, openKitConfig->getOperatingSystem());
-	addKeyValuePairIfNotEmpty(basicBeaconData, BEACON_KEY_DEVICE_MANUFACTURER, openKitConfig->getManufacturer());
-	addKeyValuePairIfNotEmpty(basicBeaconData, BEACON_KEY_DEVICE_MODEL, openKitConfig->getModelId());
+	basicBeaconData.addKeyValuePairIfNotEmpty(BEACON_KEY_DEVICE_OS, openKitConfig->getOperatingSystem());
+	basicBeaconData.addKeyValuePairIfNotEmpty(BEACON_KEY_DEVICE_MANUFACTURER, openKitConfig->getManufacturer());
+	basicBeaconData.addKeyValuePairIfNotEmpty(BEACON_KEY_DEVICE_MODEL, openKitConfig->getModelId());
 
 	auto privacyConfig = mBeaconConfiguration->getPrivacyConfiguration();
-	addKeyValuePair(basicBeaconData, BEACON_KEY_DATA_COLLECTION_LEVEL, (int32_t)privacyConfig->getDataCollectionLevel());
-	addKeyValuePair(basicBeaconData, BEACON_KEY_CRASH_REPORTING_LEVEL, (int32_t)privacyConfig->getCrashReportingLevel());
+	basicBeaconData.addKeyValuePair(BEACON_KEY_DATA_COLLECTION_LEVEL, (int32_t)privacyConfig->getDataCollectionLevel());
+	basicBeaconData.addKeyValuePair(BEACON_KEY_CRASH_REPORTING_LEVEL, (int32_t)privacyConfig->getCrashReportingLevel());
 
-	return basicBeaconData;
+	return basicBeaconData.toUTF8String();
 }
 
-core::UTF8String Beacon::createBasicEventData(protocol::EventType eventType, const core::UTF8String& eventName)
+core::caching::BeaconHeader Beacon::createBeaconHeader()
 {
-	core::UTF8String eventData = createBasicEventDataWithoutName(eventType);
-	if (!eventName.empty())
+	core::caching::BeaconHeader header;
+	header.deviceID = mDeviceID;
+	header.sessionNumber = mSessionNumber;
+	header.clientIPAddress = mClientIPAddress;
+
+	// only the data which does not change over time, transmission time & multiplicity are added when sending
+	BeaconRecordWriter beaconData;
+	const auto visitStoreVersion = getVisitStoreVersion();
+	beaconData.addKeyValuePair(BEACON_KEY_VISIT_STORE_VERSION, visitStoreVersion);
+	if (visitStoreVersion > 1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_NAME, truncate(eventName));
+		beaconData.addKeyValuePair(BEACON_KEY_SESSION_SEQUENCE, mSessionSequenceNumber);
 	}
-	
-	return eventData;
-}
+	beaconData.addKeyValuePair(BEACON_KEY_SESSION_START_TIME, mSessionStartTime);
 
-core::UTF8String Beacon::createBasicEventDataWithoutName(protocol::EventType eventType)
-{
-	core::UTF8String eventData;
-	addKeyValuePair(eventData, BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(eventType));
-	addKeyValuePair(eventData, BEACON_KEY_THREAD_ID, mThreadIDProvider->getThreadID());
+	header.beaconData = mImmutableBasicBeaconData;
+	header.beaconData.concatenate(BEACON_DATA_DELIMITER);
+	header.beaconData.concatenate(beaconData.toUTF8String());
 
-	return eventData;
+	return header;
 }
 
-core::UTF8String Beacon::createTimestampData()
+BeaconRecordWriter Beacon::createBasicEventData(protocol::EventType eventType, const core::UTF8String& eventName)
 {
-	core::UTF8String timestampData;
-	addKeyValuePair(timestampData, BEACON_KEY_TRANSMISSION_TIME, mTimingProvider->provideTimestampInMilliseconds());
-	addKeyValuePair(timestampData, BEACON_KEY_SESSION_START_TIME, mSessionStartTime);
-
-	return timestampData;
-}
-
-core::UTF8String Beacon::buildEvent(EventType eventType, const core::UTF8String& name, int32_t parentActionID, uint64_t& eventTimestamp)
-{
-	core::UTF8String eventData = createBasicEventData(eventType, name);
-
-	eventTimestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, parentActionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(eventTimestamp));
-
-	return eventData;
-}
-
-void Beacon::appendKey(core::UTF8String& s, const core::UTF8String& key)
-{
-	if (!s.empty())
+	BeaconRecordWriter eventData = createBasicEventDataWithoutName(eventType);
+	if (!eventName.empty())
 	{
-		s.concatenate(BEACON_DATA_DELIMITER);
+		eventData.addKeyValuePair(BEACON_KEY_NAME, truncate(eventName));
 	}
-
-	s.concatenate(key);
-	s.concatenate("=");
+	
+	return eventData;
 }
 
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String& value)
+BeaconRecordWriter Beacon::createBasicEventDataWithoutName(protocol::EventType eventType)
 {
-	appendKey(s, key);
-	s.concatenate(core::util::URLEncoding::urlencode(value, { '_' }));
-}
+	BeaconRecordWriter eventData;
+	eventData.addKeyValuePair(BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(eventType));
+	eventData.addKeyValuePair(BEACON_KEY_THREAD_ID, mThreadIDProvider->getThreadID());
 
-void Beacon::addKeyValuePairIfNotEmpty(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String& value)
-{
-	if(value.getStringLength() > 0)
-	{
-		addKeyValuePair(s, key, value);
-	}
+	return eventData;
 }
 
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int32_t value)
+void Beacon::addTimestampData(BeaconRecordWriter& writer)
 {
-	addKeyValuePair(s, key, core::util::StringUtil::toInvariantString(value));
+	writer.addKeyValuePair(BEACON_KEY_TRANSMISSION_TIME, mTimingProvider->provideTimestampInMilliseconds());
+	writer.addKeyValuePair(BEACON_KEY_SESSION_START_TIME, mSessionStartTime);
 }
 
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int64_t value)
+BeaconRecordWriter Beacon::buildEvent(EventType eventType, const core::UTF8String& name, int32_t parentActionID, uint64_t& eventTimestamp)
 {
-	addKeyValuePair(s, key, core::util::StringUtil::toInvariantString(value));
-}
+	BeaconRecordWriter eventData = createBasicEventData(eventType, name);
 
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, double value)
-{
-	addKeyValuePair(s, key, core::util::StringUtil::toInvariantString(value));
+	eventTimestamp = mTimingProvider->provideTimestampInMilliseconds();
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, parentActionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(eventTimestamp));
+
+	return eventData;
 }
 
 int32_t Beacon::createSequenceNumber()
@@ -267,22 +252,23 @@ void Beacon::addAction(std::shared_ptr<core::objects::IActionCommon> action)
 		return;
 	}
 
-	core::UTF8String actionData = createBasicEventData(EventType::ACTION, action->getName());
+	BeaconRecordWriter actionData = createBasicEventData(EventType::ACTION, action->getName());
 
-	addKeyValuePair(actionData, BEACON_KEY_ACTION_ID, action->getID());
-	addKeyValuePair(actionData, BEACON_KEY_PARENT_ACTION_ID, action->getParentID());
-	addKeyValuePair(actionData, BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNumber());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
-	addKeyValuePair(actionData, BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNumber());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
+	actionData.addKeyValuePair(BEACON_KEY_ACTION_ID, action->getID());
+	actionData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, action->getParentID());
+	actionData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNumber());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
+	actionData.addKeyValuePair(BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNumber());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
 
-	addActionData(action->getStartTime(), actionData);
+	addActionData(action->getStartTime(), actionData.toUTF8String());
 }
 
 void Beacon::addActionData(int64_t timestamp, const core::UTF8String& actionData)
 {
 	if (isDataCapturingEnabled())
 	{
+		storeBeaconHeader();
 		mBeaconCache->addActionData(mBeaconKey, timestamp, actionData);
 	}
 }
@@ -294,13 +280,13 @@ void Beacon::startSession()
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventDataWithoutName(EventType::SESSION_START);
+	BeaconRecordWriter eventData = createBasicEventDataWithoutName(EventType::SESSION_START);
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, int64_t(0));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, int64_t(0));
 
-	addEventData(mSessionStartTime, eventData);
+	addEventData(mSessionStartTime, eventData.toUTF8String());
 }
 
 void Beacon::endSession()
@@ -315,14 +301,14 @@ void Beacon::endSession()
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventDataWithoutName(EventType::SESSION_END);
+	BeaconRecordWriter eventData = createBasicEventDataWithoutName(EventType::SESSION_END);
 
 	auto endTime = getCurrentTimestamp();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(endTime));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(endTime));
 
-	addEventData(endTime, eventData);
+	addEventData(endTime, eventData.toUTF8String());
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, int32_t value)
@@ -348,10 +334,10 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, in
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_INT, valueName, actionID, eventTimestamp);
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	BeaconRecordWriter eventData = buildEvent(EventType::VALUE_INT, valueName, actionID, eventTimestamp);
+	eventData.addKeyValuePair(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, double value)
@@ -372,11 +358,11 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, do
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_DOUBLE, valueName, actionID, eventTimestamp);
+	BeaconRecordWriter eventData = buildEvent(EventType::VALUE_DOUBLE, valueName, actionID, eventTimestamp);
 
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	eventData.addKeyValuePair(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, const core::UTF8String& value)
@@ -397,11 +383,11 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, co
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_STRING, valueName, actionID, eventTimestamp);
+	BeaconRecordWriter eventData = buildEvent(EventType::VALUE_STRING, valueName, actionID, eventTimestamp);
 
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_VALUE, value);
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
@@ -422,9 +408,9 @@ void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::NAMED_EVENT, eventName, actionID, eventTimestamp);
+	BeaconRecordWriter eventData = buildEvent(EventType::NAMED_EVENT, eventName, actionID, eventTimestamp);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, int32_t errorCode)
@@ -444,15 +430,15 @@ void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, in
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_ERROR, errorName);
+	BeaconRecordWriter eventData = createBasicEventData(EventType::FAILURE_ERROR, errorName);
 	uint64_t timestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, actionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_VALUE, errorCode);
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, actionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_VALUE, errorCode);
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportError(
@@ -489,17 +475,17 @@ void Beacon::reportError(
 		}
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_EXCEPTION, errorName);
+	BeaconRecordWriter eventData = createBasicEventData(EventType::FAILURE_EXCEPTION, errorName);
 	uint64_t timestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, actionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_VALUE, causeName);
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_REASON, truncate(causeDescription, protocol::MAX_REASON_LEN));
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_STACKTRACE, truncate(causeStackTrace, maxStackTraceLength));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, actionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_ERROR_VALUE, causeName);
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_ERROR_REASON, truncate(causeDescription, protocol::MAX_REASON_LEN));
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_ERROR_STACKTRACE, truncate(causeStackTrace, maxStackTraceLength));
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.toUTF8String());
 }
 
 void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8String& reason, const core::UTF8String& stacktrace)
@@ -531,18 +517,18 @@ void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8Stri
 		}
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_CRASH, errorName);
+	BeaconRecordWriter eventData = createBasicEventData(EventType::FAILURE_CRASH, errorName);
 
 	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);                                  // no parent action
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_REASON, truncate(reason, protocol::MAX_REASON_LEN));
-	addKeyValuePairIfNotEmpty(eventData, BEACON_KEY_ERROR_STACKTRACE, truncate(stacktrace, maxStackTraceLength));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);                                  // no parent action
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_ERROR_REASON, truncate(reason, protocol::MAX_REASON_LEN));
+	eventData.addKeyValuePairIfNotEmpty(BEACON_KEY_ERROR_STACKTRACE, truncate(stacktrace, maxStackTraceLength));
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_TECHNOLOGY_TYPE, ERROR_TECHNOLOGY_TYPE);
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.toUTF8String());
 }
 
 void Beacon::addWebRequest(
@@ -565,33 +551,33 @@ void Beacon::addWebRequest(
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::WEBREQUEST, webRequestTracer->getURL());
+	BeaconRecordWriter eventData = createBasicEventData(EventType::WEBREQUEST, webRequestTracer->getURL());
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, parentActionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, webRequestTracer->getStartSequenceNo());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(webRequestTracer->getStartTime()));
-	addKeyValuePair(eventData, BEACON_KEY_END_SEQUENCE_NUMBER, webRequestTracer->getEndSequenceNo());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_1, webRequestTracer->getEndTime() - webRequestTracer->getStartTime());
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, parentActionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, webRequestTracer->getStartSequenceNo());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(webRequestTracer->getStartTime()));
+	eventData.addKeyValuePair(BEACON_KEY_END_SEQUENCE_NUMBER, webRequestTracer->getEndSequenceNo());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_1, webRequestTracer->getEndTime() - webRequestTracer->getStartTime());
 
 	int32_t bytesSent = webRequestTracer->getBytesSent();
 	if (bytesSent > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_BYTES_SENT, bytesSent);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_BYTES_SENT, bytesSent);
 	}
 
 	int32_t bytesReceived = webRequestTracer->getBytesReceived();
 	if (bytesReceived > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_BYTES_RECEIVED, bytesReceived);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_BYTES_RECEIVED, bytesReceived);
 	}
 
 	int32_t responseCode = webRequestTracer->getResponseCode();
 	if (responseCode > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_RESPONSE_CODE, responseCode);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_RESPONSE_CODE, responseCode);
 	}
 
-	addEventData(webRequestTracer->getStartTime(), eventData);
+	addEventData(webRequestTracer->getStartTime(), eventData.toUTF8String());
 }
 
 void Beacon::identifyUser(const core::UTF8String& userTag)
@@ -606,51 +592,66 @@ void Beacon::identifyUser(const core::UTF8String& userTag)
 		return;
 	}
 
-	core::UTF8String eventData = userTag.empty()
+	BeaconRecordWriter eventData = userTag.empty()
 		? createBasicEventDataWithoutName(EventType::IDENTIFY_USER)
 		: createBasicEventData(EventType::IDENTIFY_USER, userTag);
 
 	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.toUTF8String());
 }
 
 void Beacon::sendBizEvent(const core::UTF8String& type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes)
 {
-	if (type.empty())
+	if (isBizEventReported(type))
 	{
-		throw std::invalid_argument("type.empty() is true");
+		core::objects::EventPayloadBuilder builder(attributes, mLogger);
+		sendBizEventPayload(type, builder);
 	}
+}
 
-	if (!isDataCapturingEnabled())
+void Beacon::sendBizEvent(const core::UTF8String& type, const openkit::json::JsonDocument& attributes)
+{
+	if (isBizEventReported(type))
 	{
-		return;
+		core::objects::EventPayloadBuilder builder(attributes, mLogger);
+		sendBizEventPayload(type, builder);
 	}
+}
 
-	auto builder = std::make_shared<core::objects::EventPayloadBuilder>(attributes, mLogger);
-	builder->addNonOverridableAttribute("event.type", openkit::json::JsonStringValue::fromString(type.getStringData()));
-	
-	core::UTF8String inputPayload(builder->build());
-	
-	builder->cleanReservedInternalAttributes()
-		.addNonOverridableAttribute("dt.rum.custom_attributes_size", openkit::json::JsonNumberValue::fromLong(inputPayload.getStringLength()));
-	
-	generateEventPayload(builder);
-	builder->addNonOverridableAttribute(core::objects::EVENT_KIND, openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_BIZ));
+void Beacon::sendEvent(const core::UTF8String& name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes)
+{
+	if (isEventReported(name))
+	{
+		core::objects::EventPayloadBuilder builder(attributes, mLogger);
+		sendEventPayload(name, builder);
+	}
+}
+
+void Beacon::sendEvent(const core::UTF8String& name, const openkit::json::JsonDocument& attributes)
+{
+	if (isEventReported(name))
+	{
+		core::objects::EventPayloadBuilder builder(attributes, mLogger);
+		sendEventPayload(name, builder);
+	}
+}
 
-	if (core::util::EventPayloadBuilderUtil::isEventContainingNonFiniteNumericValues(builder))
+bool Beacon::isBizEventReported(const core::UTF8String& type)
+{
+	if (type.empty())
 	{
-		builder->addNonOverridableAttribute("dt.rum.has_nfn_values", openkit::json::JsonBooleanValue::trueValue());
+		throw std::invalid_argument("type.empty() is true");
 	}
 
-	sendEventPayload(*builder);
+	return isDataCapturingEnabled();
 }
 
-void Beacon::sendEvent(const core::UTF8String& name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes)
+bool Beacon::isEventReported(const core::UTF8String& name)
 {
 	if (name.empty())
 	{
@@ -659,25 +660,33 @@ void Beacon::sendEvent(const core::UTF8String& name, const openkit::json::JsonOb
 
 	if (!mBeaconConfiguration->getPrivacyConfiguration()->isEventReportingAllowed())
 	{
-		return;
+		return false;
 	}
 
-	if (!isDataCapturingEnabled())
-	{
-		return;
-	}
+	return isDataCapturingEnabled();
+}
+
+void Beacon::sendBizEventPayload(const core::UTF8String& type, core::objects::EventPayloadBuilder& builder)
+{
+	builder.addNonOverridableAttribute("event.type", openkit::json::JsonStringValue::fromString(type.getStringData()))
+		.cleanReservedInternalAttributes()
+		.addCustomAttributesSizeAttribute("dt.rum.custom_attributes_size");
 
-	auto builder = std::make_shared<core::objects::EventPayloadBuilder>(attributes, mLogger);
 	generateEventPayload(builder);
-	builder->addNonOverridableAttribute("event.name", openkit::json::JsonStringValue::fromString(name.getStringData()))
-		.addOverridableAttribute(core::objects::EVENT_KIND, openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_RUM));
+	builder.addNonOverridableAttribute(core::objects::EVENT_KIND, openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_BIZ))
+		.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
 
-	if (core::util::EventPayloadBuilderUtil::isEventContainingNonFiniteNumericValues(builder))
-	{
-		builder->addNonOverridableAttribute("dt.rum.has_nfn_values", openkit::json::JsonBooleanValue::trueValue());
-	}
+	sendEventPayload(builder);
+}
 
-	sendEventPayload(*builder);
+void Beacon::sendEventPayload(const core::UTF8String& name, core::objects::EventPayloadBuilder& builder)
+{
+	generateEventPayload(builder);
+	builder.addNonOverridableAttribute("event.name", openkit::json::JsonStringValue::fromString(name.getStringData()))
+		.addOverridableAttribute(core::objects::EVENT_KIND, openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_RUM))
+		.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	sendEventPayload(builder);
 }
 
 void Beacon::sendEventPayload(core::objects::EventPayloadBuilder& builder)
@@ -690,72 +699,74 @@ void Beacon::sendEventPayload(core::objects::EventPayloadBuilder& builder)
 
 	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
 
-	core::UTF8String eventData;
-	addKeyValuePair(eventData, BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(EventType::EVENT));
-	addKeyValuePair(eventData, BEACON_KEY_EVENT_PAYLOAD, jsonPayload);
+	BeaconRecordWriter eventData;
+	eventData.addKeyValuePair(BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(EventType::EVENT));
+	eventData.addKeyValuePair(BEACON_KEY_EVENT_PAYLOAD, jsonPayload);
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.toUTF8String());
 }
 
-void Beacon::generateEventPayload(std::shared_ptr<core::objects::EventPayloadBuilder> builder)
+void Beacon::generateEventPayload(core::objects::EventPayloadBuilder& builder)
+{
+	builder.addOverridableAttribute(core::objects::TIMESTAMP, openkit::json::JsonNumberValue::fromLong(mTimingProvider->provideTimestampInNanoseconds()));
+	builder.addTemplateAttributes(mEventPayloadTemplate);
+}
+
+core::objects::EventPayloadTemplate Beacon::createEventPayloadTemplate()
 {
 	auto openKitConfig = mBeaconConfiguration->getOpenKitConfiguration();
 
-	builder->addOverridableAttribute(core::objects::TIMESTAMP, openkit::json::JsonNumberValue::fromLong(mTimingProvider->provideTimestampInNanoseconds()));
-	builder->addNonOverridableAttribute(EVENT_PAYLOAD_APPLICATION_ID, openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationId().getStringData()));
-	builder->addNonOverridableAttribute(EVENT_PAYLOAD_INSTANCE_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(getDeviceID())));
-	builder->addNonOverridableAttribute(EVENT_PAYLOAD_SESSION_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(getDeviceID())
+	core::objects::EventPayloadTemplate eventPayloadTemplate;
+	eventPayloadTemplate.addNonOverridableAttribute(EVENT_PAYLOAD_APPLICATION_ID, *openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationId().getStringData()));
+	eventPayloadTemplate.addNonOverridableAttribute(EVENT_PAYLOAD_INSTANCE_ID, *openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(getDeviceID())));
+	eventPayloadTemplate.addNonOverridableAttribute(EVENT_PAYLOAD_SESSION_ID, *openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(getDeviceID())
 		+ "_" + core::util::StringUtil::toInvariantString(getSessionNumber())));
-	builder->addNonOverridableAttribute(EVENT_SCHEMA_VERSION, openkit::json::JsonStringValue::fromString("1.3"));
-	builder->addOverridableAttribute(core::objects::APP_VERSION, openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationVersion().getStringData()));
-	builder->addOverridableAttribute(core::objects::OS_NAME, openkit::json::JsonStringValue::fromString(openKitConfig->getOperatingSystem().getStringData()));
-	builder->addOverridableAttribute(core::objects::DEVICE_MANUFACTURER, openkit::json::JsonStringValue::fromString(openKitConfig->getManufacturer().getStringData()));
-	builder->addOverridableAttribute(core::objects::DEVICE_MODEL_IDENTIFIER, openkit::json::JsonStringValue::fromString(openKitConfig->getModelId().getStringData()));
-	builder->addOverridableAttribute(core::objects::EVENT_PROVIDER, openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationId().getStringData()));
+	eventPayloadTemplate.addNonOverridableAttribute(EVENT_SCHEMA_VERSION, *openkit::json::JsonStringValue::fromString("1.3"));
+	eventPayloadTemplate.addOverridableAttribute(core::objects::APP_VERSION, *openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationVersion().getStringData()));
+	eventPayloadTemplate.addOverridableAttribute(core::objects::OS_NAME, *openkit::json::JsonStringValue::fromString(openKitConfig->getOperatingSystem().getStringData()));
+	eventPayloadTemplate.addOverridableAttribute(core::objects::DEVICE_MANUFACTURER, *openkit::json::JsonStringValue::fromString(openKitConfig->getManufacturer().getStringData()));
+	eventPayloadTemplate.addOverridableAttribute(core::objects::DEVICE_MODEL_IDENTIFIER, *openkit::json::JsonStringValue::fromString(openKitConfig->getModelId().getStringData()));
+	eventPayloadTemplate.addOverridableAttribute(core::objects::EVENT_PROVIDER, *openkit::json::JsonStringValue::fromString(openKitConfig->getApplicationId().getStringData()));
+
+	return eventPayloadTemplate;
 }
 
-core::UTF8String Beacon::createMultiplicityData()
+void Beacon::addMultiplicityData(BeaconRecordWriter& writer)
 {
-	auto multiplicity = mBeaconConfiguration->getServerConfiguration()->getMultiplicity();
-	core::UTF8String multiplicityData;
-	addKeyValuePair(multiplicityData, BEACON_KEY_MULTIPLICITY, multiplicity);
-	return multiplicityData;
+	auto multiplicity = mBeaconConfiguration->getServerConfigurationSnapshot().getMultiplicity();
+	writer.addKeyValuePair(BEACON_KEY_MULTIPLICITY, multiplicity);
 }
 
 core::UTF8String Beacon::getMutableBeaconData()
 {
-	const auto delimiter = core::UTF8String(BEACON_DATA_DELIMITER);
-
-	core::UTF8String mutableBeaconData;
+	BeaconRecordWriter mutableBeaconData;
 
 	const auto visitStoreVersion = getVisitStoreVersion();
-	addKeyValuePair(mutableBeaconData, BEACON_KEY_VISIT_STORE_VERSION, visitStoreVersion);
+	mutableBeaconData.addKeyValuePair(BEACON_KEY_VISIT_STORE_VERSION, visitStoreVersion);
 
 	if(visitStoreVersion > 1) {
-		addKeyValuePair(mutableBeaconData, BEACON_KEY_SESSION_SEQUENCE, mSessionSequenceNumber);
+		mutableBeaconData.addKeyValuePair(BEACON_KEY_SESSION_SEQUENCE, mSessionSequenceNumber);
 	}
 
-	mutableBeaconData.concatenate(delimiter);
-	mutableBeaconData.concatenate(createTimestampData());
-	mutableBeaconData.concatenate(delimiter);
-	mutableBeaconData.concatenate(createMultiplicityData());
+	addTimestampData(mutableBeaconData);
+	addMultiplicityData(mutableBeaconData);
 
 	if (mSupplementaryBasicData->isNetworkTechnologyAvailable())
 	{
-		addKeyValuePair(mutableBeaconData, BEACON_KEY_NETWORK_TECHNOLOGY, mSupplementaryBasicData->getNetworkTechnology());
+		mutableBeaconData.addKeyValuePair(BEACON_KEY_NETWORK_TECHNOLOGY, mSupplementaryBasicData->getNetworkTechnology());
 	}
 
 	if (mSupplementaryBasicData->isCarrierAvailable())
 	{
-		addKeyValuePair(mutableBeaconData, BEACON_KEY_CARRIER, truncate(mSupplementaryBasicData->getCarrier()));
+		mutableBeaconData.addKeyValuePair(BEACON_KEY_CARRIER, truncate(mSupplementaryBasicData->getCarrier()));
 	}
 
 	if (mSupplementaryBasicData->isConnectionTypeAvailable() && mSupplementaryBasicData->getConnectionType() != openkit::ConnectionType::UNSET)
 	{
-		addKeyValuePair(mutableBeaconData, BEACON_KEY_CONNECTION_TYPE, core::util::ConnectionTypeToString(mSupplementaryBasicData->getConnectionType()));
+		mutableBeaconData.addKeyValuePair(BEACON_KEY_CONNECTION_TYPE, core::util::ConnectionTypeToString(mSupplementaryBasicData->getConnectionType()));
 	}
 
-	return mutableBeaconData;
+	return mutableBeaconData.toUTF8String();
 }
 
 std::shared_ptr<protocol::IStatusResponse> Beacon::send(std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
@@ -766,22 +777,12 @@ std::shared_ptr<protocol::IStatusResponse> Beacon::send(std::shared_ptr<provider
 	std::shared_ptr<protocol::IStatusResponse> response = nullptr;
 
 	mBeaconCache->prepareDataForSending(mBeaconKey);
-	while (mBeaconCache->hasDataForSending(mBeaconKey))
-	{
-		// prefix for this chunk - must be built up newly, due to changing timestamps
-		auto prefix = mImmutableBasicBeaconData;
-		prefix.concatenate( BEACON_DATA_DELIMITER );
-		prefix.concatenate( getMutableBeaconData());
-
-		auto chunk = mBeaconCache->getNextBeaconChunk(
-			mBeaconKey,
-			prefix,
-			mBeaconConfiguration->getServerConfiguration()->getBeaconSizeInBytes() - 1024,
-			BEACON_DATA_DELIMITER
-		);
-		if (chunk == nullptr || chunk.empty())
+	while (true)
+	{
+		auto chunk = getNextBeaconChunk();
+		if (chunk.empty())
 		{
-			return response;
+			break;
 		}
 
 		// send the request
@@ -791,7 +792,7 @@ std::shared_ptr<protocol::IStatusResponse> Beacon::send(std::shared_ptr<provider
 			// error happened - but don't know what exactly
 			// reset the previously retrieved chunk (restore it in internal cache) & retry another time
 			mBeaconCache->resetChunkedData(mBeaconKey);
-			break;
+			return response;
 		}
 		else
 		{
@@ -803,10 +804,76 @@ std::shared_ptr<protocol::IStatusResponse> Beacon::send(std::shared_ptr<provider
 	return response;
 }
 
+void Beacon::sendAsync(std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+	const protocol::IAdditionalQueryParameters& additionalParameters, protocol::IHTTPClient::ResponseHandler responseHandler)
+{
+	auto httpClient = clientProvider->createClient(mBeaconConfiguration->getHTTPClientConfiguration());
+
+	mBeaconCache->prepareDataForSending(mBeaconKey);
+	sendNextBeaconChunkAsync(httpClient, additionalParameters, nullptr, std::move(responseHandler));
+}
+
+core::UTF8String Beacon::getNextBeaconChunk()
+{
+	if (!mBeaconCache->hasDataForSending(mBeaconKey))
+	{
+		return core::UTF8String();
+	}
+
+	// prefix for this chunk - must be built up newly, due to changing timestamps
+	auto prefix = mImmutableBasicBeaconData;
+	prefix.concatenate( BEACON_DATA_DELIMITER );
+	prefix.concatenate( getMutableBeaconData());
+
+	auto chunk = mBeaconCache->getNextBeaconChunk(
+		mBeaconKey,
+		prefix,
+		mBeaconConfiguration->getServerConfiguration()->getBeaconSizeInBytes() - 1024,
+		BEACON_DATA_DELIMITER
+	);
+	if (chunk == nullptr)
+	{
+		return core::UTF8String();
+	}
+
+	return chunk;
+}
+
+void Beacon::sendNextBeaconChunkAsync(std::shared_ptr<protocol::IHTTPClient> httpClient,
+	const protocol::IAdditionalQueryParameters& additionalParameters, std::shared_ptr<protocol::IStatusResponse> previousResponse,
+	protocol::IHTTPClient::ResponseHandler responseHandler)
+{
+	auto chunk = getNextBeaconChunk();
+	if (chunk.empty())
+	{
+		responseHandler(previousResponse);
+		return;
+	}
+
+	httpClient->sendBeaconRequestAsync(mClientIPAddress, chunk, additionalParameters, mSessionNumber, mDeviceID,
+		[this, httpClient, &additionalParameters, responseHandler](std::shared_ptr<protocol::IStatusResponse> response)
+		{
+			if (response == nullptr || response->isErroneousResponse())
+			{
+				// error happened - but don't know what exactly
+				// reset the previously retrieved chunk (restore it in internal cache) & retry another time
+				mBeaconCache->resetChunkedData(mBeaconKey);
+				responseHandler(response);
+				return;
+			}
+
+			// worked -> remove previously retrieved chunk from cache & continue with the next one
+			mBeaconCache->removeChunkedData(mBeaconKey);
+			sendNextBeaconChunkAsync(httpClient, additionalParameters, response, responseHandler);
+		}
+	);
+}
+
 void Beacon::addEventData(int64_t timestamp, const core::UTF8String& eventData)
 {
 	if (isDataCapturingEnabled())
 	{
+		storeBeaconHeader();
 		mBeaconCache->addEventData(mBeaconKey, timestamp, eventData);
 	}
 }
@@ -839,6 +906,17 @@ void Beacon::clearData()
 {
 	// remove all cached data for this Beacon from the cache
 	mBeaconCache->deleteCacheEntry(mBeaconKey);
+
+	// the header was deleted along with the cache entry
+	mIsBeaconHeaderStored = false;
+}
+
+void Beacon::storeBeaconHeader()
+{
+	if (!mIsBeaconHeaderStored.load(std::memory_order_relaxed) && !mIsBeaconHeaderStored.exchange(true))
+	{
+		mBeaconCache->setBeaconHeader(mBeaconKey, mBeaconHeader);
+	}
 }
 
 int32_t Beacon::getSessionNumber() const
@@ -888,26 +966,26 @@ bool Beacon::isActionReportingAllowedByPrivacySettings()
 
 bool Beacon::isDataCapturingEnabled()
 {
-	auto serverConfiguration = mBeaconConfiguration->getServerConfiguration();
+	auto serverConfiguration = mBeaconConfiguration->getServerConfigurationSnapshot();
 
-	return serverConfiguration->isSendingDataAllowed()
-		&& mTrafficControlValue < serverConfiguration->getTrafficControlPercentage();
+	return serverConfiguration.isSendingDataAllowed()
+		&& mTrafficControlValue < serverConfiguration.getTrafficControlPercentage();
 }
 
 bool Beacon::isErrorCapturingEnabled()
 {
-	auto serverConfiguration = mBeaconConfiguration->getServerConfiguration();
+	auto serverConfiguration = mBeaconConfiguration->getServerConfigurationSnapshot();
 
-	return serverConfiguration->isSendingErrorsAllowed()
-		&& mTrafficControlValue < serverConfiguration->getTrafficControlPercentage();
+	return serverConfiguration.isSendingErrorsAllowed()
+		&& mTrafficControlValue < serverConfiguration.getTrafficControlPercentage();
 }
 
 bool Beacon::isCrashCapturingEnabled()
 {
-	auto serverConfiguration = mBeaconConfiguration->getServerConfiguration();
+	auto serverConfiguration = mBeaconConfiguration->getServerConfigurationSnapshot();
 
-	return serverConfiguration->isSendingCrashesAllowed()
-		&& mTrafficControlValue < serverConfiguration->getTrafficControlPercentage();
+	return serverConfiguration.isSendingCrashesAllowed()
+		&& mTrafficControlValue < serverConfiguration.getTrafficControlPercentage();
 }
 
 void Beacon::enableCapture()
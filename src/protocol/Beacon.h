@@ -18,6 +18,8 @@
 #define _PROTOCOL_BEACON_H
 
 #include "IBeacon.h"
+#include "BeaconRecordWriter.h"
+#include "core/caching/BeaconHeader.h"
 #include "core/caching/BeaconKey.h"
 #include "core/configuration/IBeaconConfiguration.h"
 #include "protocol/EventType.h"
@@ -28,6 +30,7 @@
 #include <atomic>
 #include <map>
 #include <core/objects/EventPayloadBuilder.h>
+#include <core/objects/EventPayloadTemplate.h>
 
 namespace protocol
 {
@@ -110,14 +113,25 @@ namespace protocol
 
 		void sendBizEvent(const core::UTF8String& type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) override;
 
+		void sendBizEvent(const core::UTF8String& type, const openkit::json::JsonDocument& attributes) override;
+
 		void sendEvent(const core::UTF8String& name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) override;
 
+		void sendEvent(const core::UTF8String& name, const openkit::json::JsonDocument& attributes) override;
+
 		std::shared_ptr<protocol::IStatusResponse> send
 		(
 			std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
 			const protocol::IAdditionalQueryParameters& additionalParameters
 		) override;
 
+		void sendAsync
+		(
+			std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+			const protocol::IAdditionalQueryParameters& additionalParameters,
+			protocol::IHTTPClient::ResponseHandler responseHandler
+		) override;
+
 		bool isEmpty() const override;
 
 		void clearData() override;
@@ -160,88 +174,71 @@ namespace protocol
 		core::UTF8String createImmutableBeaconData();
 
 		///
-		/// Serialization helper method for creating basic event data without name
-		/// @returns Serialized data
-		///
-		core::UTF8String createBasicEventDataWithoutName(EventType eventType);
-
-		///
-		/// Serialization helper method for creating basic event data
-		/// @returns Serialized data
+		/// Creates the header required to send this beacon's records, after they have been moved to the overflow store.
+		/// @returns the beacon header
 		///
-		core::UTF8String createBasicEventData(EventType eventType, const core::UTF8String& eventName);
+		core::caching::BeaconHeader createBeaconHeader();
 
 		///
-		/// Serialization helper method for creating basic timestamp data.
-		/// @returns Serialized data
+		/// Passes the beacon header to the beacon cache again, if the cache entry was deleted in the meantime.
 		///
-		core::UTF8String createTimestampData();
+		void storeBeaconHeader();
 
 		///
-		/// Serialization helper for event data.
-		/// @param[in] eventType The event's type.
-		/// @param[in] name Event name
-		/// @param[in] parentActionID The ID of the action on which this event was reported.
-		/// @param[inout] eventTimestamp uint64_t var that will be filled with the event timestamp
-		/// @returns The timestamp associated with the event(timestamp since session start time).
+		/// Creates the template holding the attributes, which are added to every event payload of this beacon.
+		/// @returns the event payload template
 		///
-		core::UTF8String buildEvent(
-			EventType eventType,
-			const core::UTF8String& name,
-			int32_t parentActionID,
-			uint64_t& eventTimestamp
-		);
+		core::objects::EventPayloadTemplate createEventPayloadTemplate();
 
 		///
-		/// Serialization helper method for appending a key.
-		/// @param[in] s reference to string containing serialized data
-		/// @param[in] key key to append to string
+		/// Takes the next chunk of this beacon's data from the beacon cache.
+		/// @returns the chunk or an empty string if there is no more data to send
 		///
-		void appendKey(core::UTF8String& s, const core::UTF8String& key);
+		core::UTF8String getNextBeaconChunk();
 
 		///
-		/// Serialization helper method for adding key/value pairs with string values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the string value to add
-		/// @returns the serialization data including the new key value pair
+		/// Sends the next chunk of this beacon's data and continues with the following chunk once the response arrived.
+		/// @param[in] httpClient the client used for sending
+		/// @param[in] additionalParameters additional parameters that will be sent with the beacon requests
+		/// @param[in] previousResponse the response of the previously sent chunk
+		/// @param[in] responseHandler handler invoked once all chunks were sent or sending failed
 		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String& value);
+		void sendNextBeaconChunkAsync(std::shared_ptr<protocol::IHTTPClient> httpClient,
+			const protocol::IAdditionalQueryParameters& additionalParameters, std::shared_ptr<protocol::IStatusResponse> previousResponse,
+			protocol::IHTTPClient::ResponseHandler responseHandler);
 
 		///
-		/// Serialization helper method for adding key/value pairs with string values in case the given value is not empty
-		/// @param s reference to string containing serialized data
-		/// @param key  key to append to string
-		/// @param value the string value to add
+		/// Serialization helper method for creating basic event data without name
+		/// @returns Serialized data
 		///
-		void addKeyValuePairIfNotEmpty(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String & value);
+		BeaconRecordWriter createBasicEventDataWithoutName(EventType eventType);
 
 		///
-		/// Serialization helper method for adding key/value pairs with int32 values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the integer value to add
-		/// @returns the serialization data including the new key value pair
+		/// Serialization helper method for creating basic event data
+		/// @returns Serialized data
 		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int32_t value);
+		BeaconRecordWriter createBasicEventData(EventType eventType, const core::UTF8String& eventName);
 
 		///
-		/// Serialization helper method for adding key/value pairs with int64 values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the long value to add
-		/// @returns the serialization data including the new key value pair
+		/// Serialization helper method for adding basic timestamp data.
+		/// @param[in,out] writer the writer the timestamp data is added to
 		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int64_t value);
+		void addTimestampData(BeaconRecordWriter& writer);
 
 		///
-		/// Serialization helper method for adding key/value pairs with double values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the double value to add
-		/// @returns the serialization data including the new key value pair
+		/// Serialization helper for event data.
+		/// @param[in] eventType The event's type.
+		/// @param[in] name Event name
+		/// @param[in] parentActionID The ID of the action on which this event was reported.
+		/// @param[inout] eventTimestamp uint64_t var that will be filled with the event timestamp
+		/// @returns The timestamp associated with the event(timestamp since session start time).
 		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, double value);
+		BeaconRecordWriter buildEvent(
+			EventType eventType,
+			const core::UTF8String& name,
+			int32_t parentActionID,
+			uint64_t& eventTimestamp
+		);
 
 		///
 		/// helper method for truncating name at max name size
@@ -289,10 +286,10 @@ namespace protocol
 		core::UTF8String getMutableBeaconData();
 
 		///
-		/// Generate multiplicity data
-		/// @returns the multiplicity data
+		/// Serialization helper method for adding multiplicity data
+		/// @param[in,out] writer the writer the multiplicity data is added to
 		///
-		core::UTF8String createMultiplicityData();
+		void addMultiplicityData(BeaconRecordWriter& writer);
 
 		///
 		/// Returns visit store version.
@@ -301,10 +298,39 @@ namespace protocol
 
 		///
 		/// Generating the EventPayloadBuilder which contains all auto enriched attributes and is taking over the
-		/// attributes which were provided by the customer without altering the original map
-		/// @param attributes Attributes provided by the customer
+		/// attributes which were provided by the customer without altering the original map.
+		/// Except for the timestamp, the auto enriched attributes are taken from the event payload template.
+		/// @param builder EventPayloadBuilder to add the auto enriched attributes to
 		///
-		void generateEventPayload(std::shared_ptr<core::objects::EventPayloadBuilder> builder);
+		void generateEventPayload(core::objects::EventPayloadBuilder& builder);
+
+		///
+		/// Checks whether a biz event with the given type is reported
+		/// @param type Type of the event
+		/// @throws std::invalid_argument if the type is empty
+		///
+		bool isBizEventReported(const core::UTF8String& type);
+
+		///
+		/// Checks whether an event with the given name is reported
+		/// @param name Name of the event
+		/// @throws std::invalid_argument if the name is empty
+		///
+		bool isEventReported(const core::UTF8String& name);
+
+		///
+		/// Adds all attributes of a biz event to the given builder and sends the event
+		/// @param type Type of the event
+		/// @param builder EventPayloadBuilder holding the attributes provided by the customer
+		///
+		void sendBizEventPayload(const core::UTF8String& type, core::objects::EventPayloadBuilder& builder);
+
+		///
+		/// Adds all attributes of an event to the given builder and sends the event
+		/// @param name Name of the event
+		/// @param builder EventPayloadBuilder holding the attributes provided by the customer
+		///
+		void sendEventPayload(const core::UTF8String& name, core::objects::EventPayloadBuilder& builder);
 
 		/// 
 		/// Helper function which is sending the event data including payload check
@@ -364,6 +390,15 @@ namespace protocol
 		/// basic beacon data
 		core::UTF8String mImmutableBasicBeaconData;
 
+		/// attributes added to every event payload, which do not change during the beacon's lifetime
+		core::objects::EventPayloadTemplate mEventPayloadTemplate;
+
+		/// header required to send this beacon's records after they have been moved to the overflow store
+		core::caching::BeaconHeader mBeaconHeader;
+
+		/// @c false if the header has to be passed to the beacon cache again, since the cache entry was deleted
+		std::atomic<bool> mIsBeaconHeaderStored;
+
 		/// mutable basic data
 		const std::shared_ptr<core::objects::ISupplementaryBasicData> mSupplementaryBasicData;
 	};
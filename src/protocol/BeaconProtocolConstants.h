@@ -17,6 +17,8 @@
 #ifndef _PROTOCOL_BEACONPROTOCOLCONSTANTS_H
 #define _PROTOCOL_BEACONPROTOCOLCONSTANTS_H
 
+#include "BeaconRecordKey.h"
+
 namespace protocol
 {
 	//delimiter
@@ -25,61 +27,63 @@ namespace protocol
 	//web request tag prefix constant
 	constexpr const char* TAG_PREFIX = "MT";
 
+	// keys of beacon records are serialized together with the delimiter and the equals sign
+
 	// basic data constants
-	constexpr const char* BEACON_KEY_PROTOCOL_VERSION = "vv";
-	constexpr const char* BEACON_KEY_OPENKIT_VERSION = "va";
-	constexpr const char* BEACON_KEY_APPLICATION_ID = "ap";
-	constexpr const char* BEACON_KEY_APPLICATION_VERSION = "vn";
-	constexpr const char* BEACON_KEY_PLATFORM_TYPE = "pt";
-	constexpr const char* BEACON_KEY_AGENT_TECHNOLOGY_TYPE = "tt";
-	constexpr const char* BEACON_KEY_VISITOR_ID = "vi";
-	constexpr const char* BEACON_KEY_SESSION_NUMBER = "sn";
-	constexpr const char* BEACON_KEY_SESSION_SEQUENCE = "ss";
-	constexpr const char* BEACON_KEY_CLIENT_IP_ADDRESS = "ip";
-	constexpr const char* BEACON_KEY_MULTIPLICITY = "mp";
-	constexpr const char* BEACON_KEY_DATA_COLLECTION_LEVEL = "dl";
-	constexpr const char* BEACON_KEY_CRASH_REPORTING_LEVEL = "cl";
-	constexpr const char* BEACON_KEY_VISIT_STORE_VERSION = "vs";
+	constexpr BeaconRecordKey BEACON_KEY_PROTOCOL_VERSION("&vv=");
+	constexpr BeaconRecordKey BEACON_KEY_OPENKIT_VERSION("&va=");
+	constexpr BeaconRecordKey BEACON_KEY_APPLICATION_ID("&ap=");
+	constexpr BeaconRecordKey BEACON_KEY_APPLICATION_VERSION("&vn=");
+	constexpr BeaconRecordKey BEACON_KEY_PLATFORM_TYPE("&pt=");
+	constexpr BeaconRecordKey BEACON_KEY_AGENT_TECHNOLOGY_TYPE("&tt=");
+	constexpr BeaconRecordKey BEACON_KEY_VISITOR_ID("&vi=");
+	constexpr BeaconRecordKey BEACON_KEY_SESSION_NUMBER("&sn=");
+	constexpr BeaconRecordKey BEACON_KEY_SESSION_SEQUENCE("&ss=");
+	constexpr BeaconRecordKey BEACON_KEY_CLIENT_IP_ADDRESS("&ip=");
+	constexpr BeaconRecordKey BEACON_KEY_MULTIPLICITY("&mp=");
+	constexpr BeaconRecordKey BEACON_KEY_DATA_COLLECTION_LEVEL("&dl=");
+	constexpr BeaconRecordKey BEACON_KEY_CRASH_REPORTING_LEVEL("&cl=");
+	constexpr BeaconRecordKey BEACON_KEY_VISIT_STORE_VERSION("&vs=");
 
 	//device data constants
-	constexpr const char BEACON_KEY_DEVICE_OS[] = "os";
-	constexpr const char BEACON_KEY_DEVICE_MANUFACTURER[] = "mf";
-	constexpr const char BEACON_KEY_DEVICE_MODEL[] = "md";
+	constexpr BeaconRecordKey BEACON_KEY_DEVICE_OS("&os=");
+	constexpr BeaconRecordKey BEACON_KEY_DEVICE_MANUFACTURER("&mf=");
+	constexpr BeaconRecordKey BEACON_KEY_DEVICE_MODEL("&md=");
 
 	// additional metadata
-	constexpr const char BEACON_KEY_CONNECTION_TYPE[] = "ct";
-	constexpr const char BEACON_KEY_NETWORK_TECHNOLOGY[] = "np";
-	constexpr const char BEACON_KEY_CARRIER[] = "cr";
+	constexpr BeaconRecordKey BEACON_KEY_CONNECTION_TYPE("&ct=");
+	constexpr BeaconRecordKey BEACON_KEY_NETWORK_TECHNOLOGY("&np=");
+	constexpr BeaconRecordKey BEACON_KEY_CARRIER("&cr=");
 
 	// timestamp constants
-	constexpr const char BEACON_KEY_SESSION_START_TIME[] = "tv";
-	constexpr const char BEACON_KEY_TRANSMISSION_TIME[] = "tx";
+	constexpr BeaconRecordKey BEACON_KEY_SESSION_START_TIME("&tv=");
+	constexpr BeaconRecordKey BEACON_KEY_TRANSMISSION_TIME("&tx=");
 
 	//action related constants
-	constexpr const char BEACON_KEY_EVENT_TYPE[] = "et";
-	constexpr const char BEACON_KEY_NAME[] = "na";
-	constexpr const char BEACON_KEY_THREAD_ID[] = "it";
-	constexpr const char BEACON_KEY_ACTION_ID[] = "ca";
-	constexpr const char BEACON_KEY_PARENT_ACTION_ID[] = "pa";
-	constexpr const char BEACON_KEY_START_SEQUENCE_NUMBER[] = "s0";
-	constexpr const char BEACON_KEY_TIME_0[] = "t0";
-	constexpr const char BEACON_KEY_END_SEQUENCE_NUMBER[] = "s1";
-	constexpr const char BEACON_KEY_TIME_1[] = "t1";
+	constexpr BeaconRecordKey BEACON_KEY_EVENT_TYPE("&et=");
+	constexpr BeaconRecordKey BEACON_KEY_NAME("&na=");
+	constexpr BeaconRecordKey BEACON_KEY_THREAD_ID("&it=");
+	constexpr BeaconRecordKey BEACON_KEY_ACTION_ID("&ca=");
+	constexpr BeaconRecordKey BEACON_KEY_PARENT_ACTION_ID("&pa=");
+	constexpr BeaconRecordKey BEACON_KEY_START_SEQUENCE_NUMBER("&s0=");
+	constexpr BeaconRecordKey BEACON_KEY_TIME_0("&t0=");
+	constexpr BeaconRecordKey BEACON_KEY_END_SEQUENCE_NUMBER("&s1=");
+	constexpr BeaconRecordKey BEACON_KEY_TIME_1("&t1=");
 
 	// data, error & crash capture constants
-	constexpr const char BEACON_KEY_VALUE[] = "vl";
-	constexpr const char BEACON_KEY_ERROR_VALUE[] = "ev";
-	constexpr const char BEACON_KEY_ERROR_REASON[] = "rs";
-	constexpr const char BEACON_KEY_ERROR_STACKTRACE[] = "st";
-	constexpr const char BEACON_KEY_ERROR_TECHNOLOGY_TYPE[] = "tt";
+	constexpr BeaconRecordKey BEACON_KEY_VALUE("&vl=");
+	constexpr BeaconRecordKey BEACON_KEY_ERROR_VALUE("&ev=");
+	constexpr BeaconRecordKey BEACON_KEY_ERROR_REASON("&rs=");
+	constexpr BeaconRecordKey BEACON_KEY_ERROR_STACKTRACE("&st=");
+	constexpr BeaconRecordKey BEACON_KEY_ERROR_TECHNOLOGY_TYPE("&tt=");
 
 	// web request constants
-	constexpr const char BEACON_KEY_WEBREQUEST_RESPONSE_CODE[] = "rc";
-	constexpr const char BEACON_KEY_WEBREQUEST_BYTES_SENT[] = "bs";
-	constexpr const char BEACON_KEY_WEBREQUEST_BYTES_RECEIVED[] = "br";
+	constexpr BeaconRecordKey BEACON_KEY_WEBREQUEST_RESPONSE_CODE("&rc=");
+	constexpr BeaconRecordKey BEACON_KEY_WEBREQUEST_BYTES_SENT("&bs=");
+	constexpr BeaconRecordKey BEACON_KEY_WEBREQUEST_BYTES_RECEIVED("&br=");
 
 	// events api
-	constexpr const char BEACON_KEY_EVENT_PAYLOAD[] = "pl";
+	constexpr BeaconRecordKey BEACON_KEY_EVENT_PAYLOAD("&pl=");
 	constexpr const int EVENT_PAYLOAD_BYTES_LENGTH = 16 * 1024;
 	constexpr const char* EVENT_PAYLOAD_APPLICATION_ID = "dt.rum.application.id";
 	constexpr const char* EVENT_PAYLOAD_INSTANCE_ID = "dt.rum.instance.id";
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _PROTOCOL_BEACONRECORDKEY_H
+#define _PROTOCOL_BEACONRECORDKEY_H
+
+#include <cstddef>
+
+namespace protocol
+{
+	///
+	/// Key of a beacon record's key/value pair, kept in its serialized form "&<key>=".
+	///
+	/// @par
+	/// Storing the delimiter and the equals sign together with the key allows the @ref BeaconRecordWriter to
+	/// append a key with a single copy of known length. The first pair of a record skips the delimiter.
+	///
+	class BeaconRecordKey
+	{
+	public:
+
+		///
+		/// Constructor
+		/// @param[in] serializedKey the key preceded by the delimiter and followed by the equals sign (e.g. "&na=")
+		///
+		template <size_t N>
+		constexpr explicit BeaconRecordKey(const char (&serializedKey)[N])
+			: mSerializedKey(serializedKey)
+			, mLength(N - 1)
+		{
+		}
+
+		///
+		/// Returns the key preceded by the delimiter and followed by the equals sign.
+		///
+		constexpr const char* getSerializedKey() const
+		{
+			return mSerializedKey;
+		}
+
+		///
+		/// Returns the number of bytes of the serialized key.
+		///
+		constexpr size_t getLength() const
+		{
+			return mLength;
+		}
+
+	private:
+
+		/// the key preceded by the delimiter and followed by the equals sign
+		const char* mSerializedKey;
+
+		/// number of bytes of the serialized key
+		size_t mLength;
+	};
+}
+
+#endif
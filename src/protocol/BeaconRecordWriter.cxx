@@ -0,0 +1,124 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BeaconRecordWriter.h"
+#include "core/util/StringUtil.h"
+#include "core/util/URLEncoding.h"
+
+#include <cstring>
+
+using namespace protocol;
+
+// most records fit into this size without reallocating
+static constexpr size_t INITIAL_CAPACITY = 256;
+
+// underscores are encoded additionally, since they are used as separator by the web request tag
+static const core::util::URLEncoding::UnreservedCharacters UNRESERVED_CHARACTERS({ '_' });
+
+BeaconRecordWriter::BeaconRecordWriter()
+	: mBuffer()
+{
+	mBuffer.reserve(INITIAL_CAPACITY);
+}
+
+void BeaconRecordWriter::addKeyValuePair(const BeaconRecordKey& key, const core::UTF8String& value)
+{
+	appendKey(key);
+	const auto& data = value.getStringData();
+	appendEncoded(data.data(), data.size());
+}
+
+void BeaconRecordWriter::addKeyValuePair(const BeaconRecordKey& key, const char* value)
+{
+	appendKey(key);
+	appendEncoded(value, std::strlen(value));
+}
+
+void BeaconRecordWriter::addKeyValuePair(const BeaconRecordKey& key, int32_t value)
+{
+	appendKey(key);
+	appendInteger(value);
+}
+
+void BeaconRecordWriter::addKeyValuePair(const BeaconRecordKey& key, int64_t value)
+{
+	appendKey(key);
+	appendInteger(value);
+}
+
+void BeaconRecordWriter::addKeyValuePair(const BeaconRecordKey& key, double value)
+{
+	appendKey(key);
+
+	// the exponent of large values might contain a '+', which must be encoded
+	auto formatted = core::util::StringUtil::toInvariantString(value);
+	appendEncoded(formatted.data(), formatted.size());
+}
+
+void BeaconRecordWriter::addKeyValuePairIfNotEmpty(const BeaconRecordKey& key, const core::UTF8String& value)
+{
+	if (!value.empty())
+	{
+		addKeyValuePair(key, value);
+	}
+}
+
+bool BeaconRecordWriter::empty() const
+{
+	return mBuffer.empty();
+}
+
+core::UTF8String BeaconRecordWriter::toUTF8String() const
+{
+	// the data is ASCII only, so the number of characters equals the number of bytes
+	core::UTF8String result;
+	result.concatenate(mBuffer.data(), mBuffer.size(), mBuffer.size());
+	return result;
+}
+
+void BeaconRecordWriter::appendKey(const BeaconRecordKey& key)
+{
+	// the serialized key starts with the delimiter, which is skipped for the first pair
+	auto skippedBytes = mBuffer.empty() ? size_t(1) : size_t(0);
+	mBuffer.append(key.getSerializedKey() + skippedBytes, key.getLength() - skippedBytes);
+}
+
+void BeaconRecordWriter::appendInteger(int64_t value)
+{
+	// format from the end of the buffer, using an unsigned value to handle INT64_MIN
+	char digits[20];
+	char* end = digits + sizeof(digits);
+	char* begin = end;
+
+	auto magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+	do
+	{
+		*--begin = static_cast<char>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+
+	if (value < 0)
+	{
+		mBuffer.push_back('-');
+	}
+	mBuffer.append(begin, end);
+}
+
+void BeaconRecordWriter::appendEncoded(const char* data, size_t numBytes)
+{
+	core::util::URLEncoding::urlencode(data, numBytes, UNRESERVED_CHARACTERS, mBuffer);
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _PROTOCOL_BEACONRECORDWRITER_H
+#define _PROTOCOL_BEACONRECORDWRITER_H
+
+#include "BeaconRecordKey.h"
+#include "core/UTF8String.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace protocol
+{
+	///
+	/// Serializes key/value pairs of a beacon record (e.g. "et=1&na=foo&it=2").
+	///
+	/// @par
+	/// All pairs are appended to a single buffer, without creating temporary strings. Since keys and
+	/// integers are plain ASCII and string values are url-encoded, the serialized data is always ASCII,
+	/// which allows converting it into a @ref core::UTF8String without validating it again.
+	///
+	class BeaconRecordWriter
+	{
+	public:
+
+		///
+		/// Constructor
+		///
+		BeaconRecordWriter();
+
+		///
+		/// Appends a key/value pair with a string value, which is url-encoded.
+		/// @param[in] key the key to append
+		/// @param[in] value the string value to append
+		///
+		void addKeyValuePair(const BeaconRecordKey& key, const core::UTF8String& value);
+
+		///
+		/// Appends a key/value pair with a string value, which is url-encoded.
+		/// @param[in] key the key to append
+		/// @param[in] value the string value to append
+		///
+		void addKeyValuePair(const BeaconRecordKey& key, const char* value);
+
+		///
+		/// Appends a key/value pair with an int32 value.
+		/// @param[in] key the key to append
+		/// @param[in] value the integer value to append
+		///
+		void addKeyValuePair(const BeaconRecordKey& key, int32_t value);
+
+		///
+		/// Appends a key/value pair with an int64 value.
+		/// @param[in] key the key to append
+		/// @param[in] value the integer value to append
+		///
+		void addKeyValuePair(const BeaconRecordKey& key, int64_t value);
+
+		///
+		/// Appends a key/value pair with a double value.
+		/// @param[in] key the key to append
+		/// @param[in] value the double value to append
+		///
+		void addKeyValuePair(const BeaconRecordKey& key, double value);
+
+		///
+		/// Appends a key/value pair with a string value, in case the given value is not empty.
+		/// @param[in] key the key to append
+		/// @param[in] value the string value to append
+		///
+		void addKeyValuePairIfNotEmpty(const BeaconRecordKey& key, const core::UTF8String& value);
+
+		///
+		/// Returns @c true if nothing has been written so far.
+		///
+		bool empty() const;
+
+		///
+		/// Returns the serialized data.
+		///
+		core::UTF8String toUTF8String() const;
+
+	private:
+
+		///
+		/// Appends the serialized key, skipping its delimiter if this is the first pair.
+		///
+		void appendKey(const BeaconRecordKey& key);
+
+		///
+		/// Appends the decimal representation of the given value.
+		///
+		void appendInteger(int64_t value);
+
+		///
+		/// Appends the url-encoded representation of the given bytes.
+		///
+		void appendEncoded(const char* data, size_t numBytes);
+
+		/// the serialized data
+		std::string mBuffer;
+	};
+}
+
+#endif
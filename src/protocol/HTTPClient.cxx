@@ -15,9 +15,10 @@
  */
 
 #include "HTTPClient.h"
+#include "HTTPConnectionPool.h"
+#include "HTTPRequestMultiplexer.h"
 #include "HTTPResponseParser.h"
 #include "ProtocolConstants.h"
-#include "core/util/Compressor.h"
 #include "core/util/URLEncoding.h"
 #include "core/util/StringUtil.h"
 #include "protocol/IStatusResponse.h"
@@ -43,24 +44,92 @@ constexpr uint32_t RETRY_SLEEP_TIME = 200; // retry sleep time in ms
 constexpr uint64_t CONNECT_TIMEOUT = 5; // Time-out connect operations after this amount of seconds
 constexpr uint64_t READ_TIMEOUT = 30; // Time-out the read operation after this amount of seconds
 
+static const core::util::URLEncoding::UnreservedCharacters UNRESERVED_CHARACTERS({ '_' });
+
 using namespace protocol;
 using namespace base::util;
 
+struct HTTPClient::AsyncRequest
+{
+	AsyncRequest(
+		RequestType requestType,
+		const core::UTF8String& url,
+		const core::UTF8String& clientIPAddress,
+		const core::UTF8String& beaconData,
+		ResponseHandler responseHandler,
+		std::unique_ptr<StreamingCompressor> compressor
+	)
+		: requestType(requestType)
+		, url(url)
+		, clientIPAddress(clientIPAddress)
+		, beaconData(beaconData)
+		, responseHandler(std::move(responseHandler))
+		, compressor(std::move(compressor))
+		, responseParser()
+		, upload()
+		, headers(nullptr)
+		, handle(nullptr)
+		, retryCount(0)
+	{
+	}
+
+	AsyncRequest(const AsyncRequest&) = delete;
+
+	AsyncRequest& operator = (const AsyncRequest&) = delete;
+
+	/// the type of request sent to the server
+	const RequestType requestType;
+
+	/// the url where to send the request to
+	const core::UTF8String url;
+
+	/// the IP address of the client
+	const core::UTF8String clientIPAddress;
+
+	/// the uncompressed data to send, referenced by @c upload while the transfer is running
+	const core::UTF8String beaconData;
+
+	/// handler invoked with the response
+	ResponseHandler responseHandler;
+
+	/// compressor exclusively used by this request
+	std::unique_ptr<StreamingCompressor> compressor;
+
+	/// receives the response of the running transfer
+	HTTPResponseParser responseParser;
+
+	/// data uploaded by the running transfer
+	Upload upload;
+
+	/// custom headers of the running transfer
+	struct curl_slist* headers;
+
+	/// handle of the running transfer
+	CURL* handle;
+
+	/// number of transfers which failed so far
+	uint32_t retryCount;
+};
+
 HTTPClient::HTTPClient
 (
 	std::shared_ptr<openkit::ILogger> logger,
 	const std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
-	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+	std::shared_ptr<HTTPConnectionPool> connectionPool,
+	std::shared_ptr<base::util::StreamingCompressorPool> compressorPool
 )
 	: mLogger(logger)
 	, mThreadSuspender(threadSuspender)
 	, mServerID(configuration->getServerID())
 	, mMonitorURL()
-	, mReadBuffer()
-	, mReadBufferPos(0)
+	, mCompressorPool(compressorPool)
+	, mCompressor(compressorPool != nullptr ? compressorPool->acquire() : nullptr)
 	, mSSLTrustManager(nullptr)
 	, mHttpClientConfiguration(configuration)
 	, mNewSessionURL()
+	, mUserAgentHeader()
+	, mConnectionPool(connectionPool)
 {
 	// build the beacon URLs
 	buildMonitorURL(mMonitorURL, configuration->getBaseURL(), configuration->getApplicationID(), mServerID);
@@ -79,6 +148,19 @@ HTTPClient::HTTPClient
 
 	mUserAgentHeader = std::string("OpenKit/");
 	mUserAgentHeader.append(OPENKIT_VERSION);
+
+	if (mCompressor == nullptr)
+	{
+		mCompressor.reset(new StreamingCompressor());
+	}
+}
+
+HTTPClient::~HTTPClient()
+{
+	if (mCompressorPool != nullptr)
+	{
+		mCompressorPool->release(std::move(mCompressor));
+	}
 }
 
 std::shared_ptr<IStatusResponse> HTTPClient::sendStatusRequest(const protocol::IAdditionalQueryParameters& additionalParameters)
@@ -111,6 +193,38 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendBeaconRequest(
 	return response;
 }
 
+void HTTPClient::sendBeaconRequestAsync(
+	const core::UTF8String& clientIPAddress,
+	const core::UTF8String& beaconData,
+	const protocol::IAdditionalQueryParameters& additionalParameters,
+	int32_t sessionNumber,
+	int64_t deviceID,
+	ResponseHandler responseHandler)
+{
+	auto multiplexer = mConnectionPool != nullptr ? mConnectionPool->getMultiplexer() : nullptr;
+	if (multiplexer == nullptr)
+	{
+		// concurrent requests are not enabled
+		responseHandler(sendBeaconRequest(clientIPAddress, beaconData, additionalParameters, sessionNumber, deviceID));
+		return;
+	}
+
+	auto url = appendAdditionalQueryParameters(mMonitorURL, additionalParameters);
+	url = appendSessionIdentifierParameter(url, sessionNumber, deviceID);
+	logRequest(RequestType::BEACON, url);
+
+	// each running request needs its own compressor
+	std::unique_ptr<StreamingCompressor> compressor(mCompressorPool != nullptr ? mCompressorPool->acquire() : nullptr);
+	if (compressor == nullptr)
+	{
+		compressor.reset(new StreamingCompressor());
+	}
+
+	auto request = std::make_shared<AsyncRequest>(RequestType::BEACON, url, clientIPAddress, beaconData,
+		std::move(responseHandler), std::move(compressor));
+	startAsyncRequest(multiplexer, request, 0);
+}
+
 std::shared_ptr<IStatusResponse> HTTPClient::sendNewSessionRequest(const protocol::IAdditionalQueryParameters& additionalParameters)
 {
 	auto url = appendAdditionalQueryParameters(mNewSessionURL, additionalParameters);
@@ -142,25 +256,46 @@ void HTTPClient::globalDestroy()
 /// @param[in] userPtr the user data to upload is read from there
 /// @return the size of the delievered data
 ///
+/// @remarks The data is compressed directly into curl's upload buffer, so no compressed copy is kept in memory.
+///
 size_t HTTPClient::readFunction(void *ptr, size_t elementSize, size_t numberOfElements, void* userPtr)
 {
 	if (userPtr)
 	{
-		auto _this = (HTTPClient*)userPtr;
-		size_t available = (_this->mReadBuffer.size() - _this->mReadBufferPos);
+		auto upload = (Upload*)userPtr;
 
-		if (available > 0)
+		size_t written = 0;
+		if (!upload->compressor->read(ptr, elementSize * numberOfElements, written))
 		{
-			size_t written = std::min(elementSize * numberOfElements, available);
-			memcpy(ptr, ((char*)(_this->mReadBuffer.data())) + _this->mReadBufferPos, written);
-			_this->mReadBufferPos += written;
-			return written;
+			upload->logger->error("HTTPClient readFunction() - compressing beacon data failed");
+			return CURL_READFUNC_ABORT;
 		}
+
+		return written;
 	}
 
 	return 0;
 }
 
+///
+/// Callback function invoked when curl needs to resend the upload data (e.g. if a reused connection was dead).
+/// @param[in] userPtr the user data to upload is read from there
+/// @param[in] offset the offset to seek to
+/// @param[in] origin the seek origin (@c SEEK_SET, @c SEEK_CUR or @c SEEK_END)
+/// @return @c CURL_SEEKFUNC_OK on success, @c CURL_SEEKFUNC_CANTSEEK otherwise
+///
+int HTTPClient::seekFunction(void* userPtr, int64_t offset, int origin)
+{
+	if (userPtr == nullptr || offset != 0 || origin != SEEK_SET)
+	{
+		// the compressed data is only available as stream, therefore only rewinding is supported
+		return CURL_SEEKFUNC_CANTSEEK;
+	}
+
+	auto upload = (Upload*)userPtr;
+	return upload->compressor->reset(upload->data, upload->size) ? CURL_SEEKFUNC_OK : CURL_SEEKFUNC_FAIL;
+}
+
 ///
 /// Local callback function for writing received data (=the response).
 /// @param[in] ptr to the delivered data
@@ -196,8 +331,7 @@ static size_t headerFunction(char *buffer, size_t elementSize, size_t numberOfEl
 	return elementSize * numberOfElements;
 }
 
-//TODO: stefan.eberl - use the request type or rethink design
-std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HTTPClient::HttpMethod method)
+void HTTPClient::logRequest(RequestType requestType, const core::UTF8String& url)
 {
 	if (mLogger->isDebugEnabled())
 	{
@@ -214,127 +348,48 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 			break;
 		}
 	}
+}
+
+//TODO: stefan.eberl - use the request type or rethink design
+std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HTTPClient::HttpMethod method)
+{
+	logRequest(requestType, url);
 
-	// init the curl session - get the curl handle
-	auto curl = curl_easy_init();
+	// init the curl session - get the curl handle (reused from the pool if possible)
+	auto curl = acquireCurlHandle();
 
 	if (!curl)
 	{
 		// Abort and cleanup if CURL cannot be initialized
-		mLogger->error("HTTPClient sendRequestInternal() - curl_easy_init() failed");
+		mLogger->error("HTTPClient sendRequestInternal() - acquiring curl handle failed");
 		return HTTPClient::unknownErrorResponse(requestType);
 	}
 
 	uint32_t retryCount = 0;
 	do
 	{
-		// make SSL/TSL certificate handling first thing
-		// just to ensure customers don't set something unintended
-		mSSLTrustManager->applyTrustManager(curl);
-
-		// build up HttpRequest object and let customer code set HTTP headers
-		// object is re-used for our own custom headers later on
-		std::string requestMethodAsString = getHttpMethodAsString(method);
-		HttpRequest httpRequest(url.getStringData(), requestMethodAsString);
-		mHttpClientConfiguration->getHttpRequestInterceptor()->intercept(httpRequest);
-
-		// Set the connection parameters (URL, timeouts, etc.)
-		curl_easy_setopt(curl, CURLOPT_URL, url.getStringData().c_str());
-		curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
-		curl_easy_setopt(curl, CURLOPT_TIMEOUT, READ_TIMEOUT);
-		// allow servers to send compressed data
-		curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
-
 		HTTPResponseParser responseParser;
-		// To retrieve the response headers
-		curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerFunction);
-		curl_easy_setopt(curl, CURLOPT_HEADERDATA, &responseParser);
-		// To retrieve the response
-		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFunction);
-		curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseParser);
-
-
-		if (!clientIPAddress.empty())
+		Upload upload = { mLogger.get(), mCompressor.get(), nullptr, 0 };
+		struct curl_slist* headers = nullptr;
+		if (!prepareRequest(curl, url, clientIPAddress, beaconData, method, responseParser, upload, headers))
 		{
-			httpRequest.setHeader("X-Client-IP", clientIPAddress.getStringData());
-		}
-
-		httpRequest.setHeader("User-Agent", mUserAgentHeader);
-
-		if (method == HttpMethod::POST)
-		{
-			// Do a regular HTTP post
-			curl_easy_setopt(curl, CURLOPT_POST, 1L);
-
-			if (!beaconData.empty())
-			{
-				if (mLogger->isDebugEnabled())
-				{
-					mLogger->debug("HTTPClient sendRequestInternal() - Beacon Payload: %s", beaconData.getStringData().c_str());
-				}
-
-				// Data to send is compressed => Compress the data
-				Compressor::compressMemory(beaconData.getStringData().c_str(), beaconData.getStringLength(), mReadBuffer);
-				mReadBufferPos = 0;
-				curl_easy_setopt(curl, CURLOPT_READFUNCTION, readFunction);
-				curl_easy_setopt(curl, CURLOPT_READDATA, this);
-				curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, mReadBuffer.size());
-				httpRequest.setHeader("Content-Encoding", "gzip");
-			}
-		}
-
-		// convert own request headers to format understood by CURL
-		struct curl_slist* list = nullptr;
-		for (const auto& headerEntry : httpRequest.getHttpHeaders())
-		{
-			std::ostringstream oss;
-			oss << headerEntry.first << ": " << headerEntry.second.front(); // only take first header value
-
-			struct curl_slist* tempList = curl_slist_append(list, oss.str().c_str());
-			if (tempList != nullptr)
-			{
-				list = tempList;
-			}
-			else
-			{
-				// failed to append new header (OOM?)
-				mLogger->warning("Failed to append \"%s\" to CURL header list", oss.str().c_str());
-				curl_slist_free_all(list);
-				list = nullptr;
-				break;
-			}
-		}
-
-		if (list != nullptr)
-		{
-			curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
+			releaseCurlHandle(curl);
+			return HTTPClient::unknownErrorResponse(requestType);
 		}
 
 		// Perform the request, res will get the return code
-		CURLcode response = curl_easy_perform(curl);
+		CURLcode response = mConnectionPool != nullptr ? mConnectionPool->perform(curl) : curl_easy_perform(curl);
 
 		// Cleanup custom headers
-		if (list != nullptr)
-		{
-			curl_slist_free_all(list);
-			list = nullptr;
-		}
+		curl_slist_free_all(headers);
 
 		if (response == CURLE_OK)
 		{
-			curl_easy_cleanup(curl);
+			releaseCurlHandle(curl);
 			curl = nullptr;
 
-			protocol::HttpResponse httpResponse(
-				url.getStringData(),
-				requestMethodAsString,
-				responseParser.getResponseStatus(),
-				responseParser.getReasonPhrase(),
-				responseParser.getResponseHeaders(),
-				responseParser.getResponseBody());
-
 			// handle the response
-			return handleResponse(requestType, httpResponse);
+			return createResponse(requestType, url, method, responseParser);
 		}
 		else
 		{
@@ -344,21 +399,213 @@ std::shared_ptr<IStatusResponse> HTTPClient::sendRequestInternal(HTTPClient::Req
 			// For CURL related errors, we retry. Note that HTTP status codes >= 400 are returned with CURLE_OK.
 			retryCount++;
 			mThreadSuspender->sleep(RETRY_SLEEP_TIME);
-			curl_easy_reset(curl);
+
+			// the failed connection is not reused by curl, but the handle still is
+			releaseCurlHandle(curl);
+			curl = acquireCurlHandle();
 		}
 
-	} while (retryCount < MAX_SEND_RETRIES);
+	} while (curl != nullptr && retryCount < MAX_SEND_RETRIES);
 
 	// Cleanup
 	if (curl != nullptr)
 	{
-		curl_easy_cleanup(curl);
+		releaseCurlHandle(curl);
 		curl = nullptr;
 	}
 
 	return HTTPClient::unknownErrorResponse(requestType);
 }
 
+bool HTTPClient::prepareRequest(void* curl, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData,
+	const HttpMethod method, HTTPResponseParser& responseParser, Upload& upload, struct curl_slist*& headers)
+{
+	// make SSL/TSL certificate handling first thing
+	// just to ensure customers don't set something unintended
+	mSSLTrustManager->applyTrustManager(curl);
+
+	// build up HttpRequest object and let customer code set HTTP headers
+	// object is re-used for our own custom headers later on
+	HttpRequest httpRequest(url.getStringData(), getHttpMethodAsString(method));
+	mHttpClientConfiguration->getHttpRequestInterceptor()->intercept(httpRequest);
+
+	// Set the connection parameters (URL, timeouts, etc.)
+	curl_easy_setopt(curl, CURLOPT_URL, url.getStringData().c_str());
+	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, READ_TIMEOUT);
+	// allow servers to send compressed data
+	curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+
+	// To retrieve the response headers
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerFunction);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &responseParser);
+	// To retrieve the response
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFunction);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseParser);
+
+
+	if (!clientIPAddress.empty())
+	{
+		httpRequest.setHeader("X-Client-IP", clientIPAddress.getStringData());
+	}
+
+	httpRequest.setHeader("User-Agent", mUserAgentHeader);
+
+	if (method == HttpMethod::POST)
+	{
+		// Do a regular HTTP post
+		curl_easy_setopt(curl, CURLOPT_POST, 1L);
+
+		if (!beaconData.empty())
+		{
+			if (mLogger->isDebugEnabled())
+			{
+				mLogger->debug("HTTPClient sendRequestInternal() - Beacon Payload: %s", beaconData.getStringData().c_str());
+			}
+
+			// Data to send is compressed => Compress the data while curl reads it
+			upload.data = beaconData.getStringData().c_str();
+			upload.size = beaconData.getStringData().size();
+			if (!upload.compressor->reset(upload.data, upload.size))
+			{
+				mLogger->error("HTTPClient sendRequestInternal() - initializing compression failed");
+				return false;
+			}
+			curl_easy_setopt(curl, CURLOPT_READFUNCTION, readFunction);
+			curl_easy_setopt(curl, CURLOPT_READDATA, &upload);
+			curl_easy_setopt(curl, CURLOPT_SEEKFUNCTION, seekFunction);
+			curl_easy_setopt(curl, CURLOPT_SEEKDATA, &upload);
+			// the compressed size is unknown upfront, therefore curl uses chunked transfer encoding
+			curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, -1L);
+			httpRequest.setHeader("Content-Encoding", "gzip");
+		}
+	}
+
+	// convert own request headers to format understood by CURL
+	struct curl_slist* list = nullptr;
+	for (const auto& headerEntry : httpRequest.getHttpHeaders())
+	{
+		std::ostringstream oss;
+		oss << headerEntry.first << ": " << headerEntry.second.front(); // only take first header value
+
+		struct curl_slist* tempList = curl_slist_append(list, oss.str().c_str());
+		if (tempList != nullptr)
+		{
+			list = tempList;
+		}
+		else
+		{
+			// failed to append new header (OOM?)
+			mLogger->warning("Failed to append \"%s\" to CURL header list", oss.str().c_str());
+			curl_slist_free_all(list);
+			list = nullptr;
+			break;
+		}
+	}
+
+	if (list != nullptr)
+	{
+		curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
+	}
+
+	headers = list;
+
+	return true;
+}
+
+std::shared_ptr<IStatusResponse> HTTPClient::createResponse(RequestType requestType, const core::UTF8String& url, const HttpMethod method,
+	const HTTPResponseParser& responseParser)
+{
+	protocol::HttpResponse httpResponse(
+		url.getStringData(),
+		getHttpMethodAsString(method),
+		responseParser.getResponseStatus(),
+		responseParser.getReasonPhrase(),
+		responseParser.getResponseHeaders(),
+		responseParser.getResponseBody());
+
+	return handleResponse(requestType, httpResponse);
+}
+
+void HTTPClient::startAsyncRequest(HTTPRequestMultiplexer* multiplexer, std::shared_ptr<AsyncRequest> request, int64_t delayInMillis)
+{
+	request->handle = static_cast<CURL*>(acquireCurlHandle());
+	if (request->handle == nullptr)
+	{
+		mLogger->error("HTTPClient startAsyncRequest() - acquiring curl handle failed");
+		completeAsyncRequest(request, unknownErrorResponse(request->requestType));
+		return;
+	}
+
+	request->responseParser = HTTPResponseParser();
+	request->upload = { mLogger.get(), request->compressor.get(), nullptr, 0 };
+	if (!prepareRequest(request->handle, request->url, request->clientIPAddress, request->beaconData, HttpMethod::POST,
+		request->responseParser, request->upload, request->headers))
+	{
+		completeAsyncRequest(request, unknownErrorResponse(request->requestType));
+		return;
+	}
+
+	auto self = shared_from_this();
+	auto completionHandler = [self, multiplexer, request](CURLcode result)
+	{
+		self->handleAsyncResult(multiplexer, request, result);
+	};
+	auto isAdded = delayInMillis > 0
+		? multiplexer->addDelayed(request->handle, completionHandler, delayInMillis)
+		: multiplexer->add(request->handle, completionHandler);
+	if (!isAdded)
+	{
+		completeAsyncRequest(request, unknownErrorResponse(request->requestType));
+	}
+}
+
+void HTTPClient::handleAsyncResult(HTTPRequestMultiplexer* multiplexer, std::shared_ptr<AsyncRequest> request, int result)
+{
+	auto curlResult = static_cast<CURLcode>(result);
+	if (curlResult == CURLE_OK)
+	{
+		completeAsyncRequest(request, createResponse(request->requestType, request->url, HttpMethod::POST, request->responseParser));
+		return;
+	}
+
+	// See https://curl.haxx.se/libcurl/c/libcurl-errors.html for a list of CURL error codes.
+	mLogger->error("HTTPClient handleAsyncResult() - transfer failed on '%s': ErrorCode '%u', [%s]", request->url.getStringData().c_str(), curlResult, curl_easy_strerror(curlResult));
+
+	// For CURL related errors, we retry. Like synchronous requests, the retry is delayed, while other transfers keep running.
+	request->retryCount++;
+	if (curlResult == CURLE_ABORTED_BY_CALLBACK || request->retryCount >= MAX_SEND_RETRIES)
+	{
+		completeAsyncRequest(request, unknownErrorResponse(request->requestType));
+		return;
+	}
+
+	// the failed connection is not reused by curl, but the handle still is
+	curl_slist_free_all(request->headers);
+	request->headers = nullptr;
+	releaseCurlHandle(request->handle);
+	request->handle = nullptr;
+
+	startAsyncRequest(multiplexer, request, RETRY_SLEEP_TIME);
+}
+
+void HTTPClient::completeAsyncRequest(std::shared_ptr<AsyncRequest> request, std::shared_ptr<IStatusResponse> response)
+{
+	curl_slist_free_all(request->headers);
+	request->headers = nullptr;
+	if (request->handle != nullptr)
+	{
+		releaseCurlHandle(request->handle);
+		request->handle = nullptr;
+	}
+	if (mCompressorPool != nullptr)
+	{
+		mCompressorPool->release(std::move(request->compressor));
+	}
+
+	request->responseHandler(response);
+}
+
 std::shared_ptr<IStatusResponse> HTTPClient::handleResponse(RequestType requestType, const HttpResponse& httpResponse)
 {
 	if (mLogger->isDebugEnabled())
@@ -439,9 +686,9 @@ void HTTPClient::appendQueryParam(core::UTF8String& url, const char* key, const
 {
 	// converts the given value string to a URL encoded string
 	url.concatenate("&");
-	url.concatenate(core::util::URLEncoding::urlencode(key, { '_' }));
+	url.concatenate(core::util::URLEncoding::urlencode(key, UNRESERVED_CHARACTERS));
 	url.concatenate("=");
-	url.concatenate(core::util::URLEncoding::urlencode(value, { '_' }));
+	url.concatenate(core::util::URLEncoding::urlencode(value, UNRESERVED_CHARACTERS));
 }
 
 std::shared_ptr<IStatusResponse> HTTPClient::unknownErrorResponse(RequestType requestType)
@@ -469,3 +716,25 @@ const char* HTTPClient::getHttpMethodAsString(HttpMethod method)
 		return "";
 	}
 }
+
+void* HTTPClient::acquireCurlHandle()
+{
+	if (mConnectionPool != nullptr)
+	{
+		return mConnectionPool->acquire();
+	}
+
+	return curl_easy_init();
+}
+
+void HTTPClient::releaseCurlHandle(void* curl)
+{
+	if (mConnectionPool != nullptr)
+	{
+		mConnectionPool->release(curl);
+	}
+	else
+	{
+		curl_easy_cleanup(curl);
+	}
+}
@@ -17,24 +17,43 @@
 #ifndef _PROTOCOL_HTTPCLIENT_H
 #define _PROTOCOL_HTTPCLIENT_H
 
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor" // enable_shared_from_this has a public non virtual destructor throwing a false positive in this code
+#endif
+
 #include "OpenKit/ILogger.h"
 #include "OpenKit/ISSLTrustManager.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
 #include "core/util/IInterruptibleThreadSuspender.h"
+#include "core/util/StreamingCompressor.h"
+#include "core/util/StreamingCompressorPool.h"
 #include "protocol/IHTTPClient.h"
 #include "protocol/http/HttpResponse.h"
 
 #include <vector>
 #include <memory>
 
+struct curl_slist;
+
 namespace protocol
 {
+	class HTTPConnectionPool;
+	class HTTPRequestMultiplexer;
+	class HTTPResponseParser;
+
 	///
 	/// HTTP client which abstracts the 2 basic request types:
 	/// - status checkd
 	/// - beacon send
 	///
-	class HTTPClient : public IHTTPClient
+	/// @par
+	/// Beacon requests sent asynchronously are driven by the connection pool's @ref HTTPRequestMultiplexer. Therefore
+	/// instances of this class must be owned by a @c std::shared_ptr.
+	///
+	class HTTPClient
+		: public IHTTPClient
+		, public std::enable_shared_from_this<HTTPClient>
 	{
 	public:
 
@@ -42,17 +61,27 @@ namespace protocol
 		/// Default constructor
 		/// @param[in] logger to write traces to
 		/// @param[in] configuration configuration parameters for the HTTPClient
+		/// @param[in] threadSuspender used for sleeping between retries
+		/// @param[in] connectionPool optional pool providing reusable curl handles. If @c nullptr every request
+		///            creates and cleans up its own curl handle.
+		/// @param[in] compressorPool optional pool providing reusable compressors. If @c nullptr a compressor
+		///            with default settings is created.
 		///
 		HTTPClient(
 			std::shared_ptr<openkit::ILogger> logger,
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration,
-			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+			std::shared_ptr<HTTPConnectionPool> connectionPool = nullptr,
+			std::shared_ptr<base::util::StreamingCompressorPool> compressorPool = nullptr
 		);
 
 		///
 		/// Destructor
 		///
-		~HTTPClient() override = default;
+		/// @par
+		/// Returns the compressor to the compressor pool.
+		///
+		~HTTPClient() override;
 
 		///
 		/// Delete the copy constructor
@@ -74,6 +103,15 @@ namespace protocol
 			int64_t deviceID
 		) override;
 
+		void sendBeaconRequestAsync(
+			const core::UTF8String& clientIPAddress,
+			const core::UTF8String& beaconData,
+			const protocol::IAdditionalQueryParameters& additionalParameters,
+			int32_t sessionNumber,
+			int64_t deviceID,
+			ResponseHandler responseHandler
+		) override;
+
 		std::shared_ptr<IStatusResponse> sendNewSessionRequest(const protocol::IAdditionalQueryParameters& additionalParameters) override;
 
 		///
@@ -109,6 +147,29 @@ namespace protocol
 			POST
 		};
 
+		///
+		/// Uncompressed data of an upload, which is compressed while curl reads it
+		///
+		struct Upload
+		{
+			/// logger to write traces to
+			openkit::ILogger* logger;
+
+			/// compresses the data on the fly while curl's read function asks for it
+			base::util::StreamingCompressor* compressor;
+
+			/// uncompressed data, owned by the caller of the request
+			const char* data;
+
+			/// size of the uncompressed data in bytes
+			size_t size;
+		};
+
+		///
+		/// State of a request sent asynchronously
+		///
+		struct AsyncRequest;
+
 		///
 		/// sends a status check request and returns a status response
 		/// @param[in] requestType the type of request sent to the server
@@ -120,6 +181,48 @@ namespace protocol
 		///
 		std::shared_ptr<IStatusResponse> sendRequestInternal(RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HttpMethod method);
 
+		///
+		/// Configures the given curl handle for sending a request
+		/// @param[in] curl the handle to configure
+		/// @param[in] url the url where to send the request to
+		/// @param[in] clientIPAddress optional the IP address of the client
+		/// @param[in] beaconData optional data to send in the HTTP POST
+		/// @param[in] method the HTTP method to use
+		/// @param[in] responseParser receives the response, must be kept alive until the transfer completed
+		/// @param[in,out] upload receives the data to upload, must be kept alive until the transfer completed
+		/// @param[out] headers the custom header list, which must be freed after the transfer completed
+		/// @returns @c true if the handle is ready to be performed, @c false otherwise
+		///
+		bool prepareRequest(void* curl, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData,
+			const HttpMethod method, HTTPResponseParser& responseParser, Upload& upload, struct curl_slist*& headers);
+
+		///
+		/// Creates the status response for a completed transfer
+		///
+		std::shared_ptr<IStatusResponse> createResponse(RequestType requestType, const core::UTF8String& url, const HttpMethod method,
+			const HTTPResponseParser& responseParser);
+
+		///
+		/// Adds the given request to the multiplexer, or completes it with an error response if this is not possible.
+		///
+		/// @param[in] multiplexer the multiplexer driving the transfer
+		/// @param[in] request the request to start
+		/// @param[in] delayInMillis the time in milliseconds the multiplexer waits before starting the transfer
+		///
+		void startAsyncRequest(HTTPRequestMultiplexer* multiplexer, std::shared_ptr<AsyncRequest> request, int64_t delayInMillis);
+
+		///
+		/// Handles the result of a transfer started by @ref startAsyncRequest, retrying failed transfers.
+		///
+		void handleAsyncResult(HTTPRequestMultiplexer* multiplexer, std::shared_ptr<AsyncRequest> request, int result);
+
+		///
+		/// Releases all resources of the given request and invokes its response handler.
+		///
+		void completeAsyncRequest(std::shared_ptr<AsyncRequest> request, std::shared_ptr<IStatusResponse> response);
+
+		void logRequest(RequestType requestType, const core::UTF8String& url);
+
 		///
 		/// Build URL used for status check and beacon send requests
 		/// @param[in,out] monitorURL the url to build
@@ -141,10 +244,22 @@ namespace protocol
 
 		static size_t readFunction(void *ptr, size_t elementSize, size_t numberOfElements, void* userPtr);
 
+		static int seekFunction(void* userPtr, int64_t offset, int origin);
+
 		std::shared_ptr<IStatusResponse> unknownErrorResponse(RequestType requestType);
 
 		static const char* getHttpMethodAsString(HttpMethod method);
 
+		///
+		/// Returns a curl easy handle, either from the connection pool or a newly created one.
+		///
+		void* acquireCurlHandle();
+
+		///
+		/// Returns the curl easy handle to the connection pool or cleans it up if no pool is used.
+		///
+		void releaseCurlHandle(void* curl);
+
 
 
 	private:
@@ -161,11 +276,11 @@ namespace protocol
 		/// URL used for status check and beacon send requests
 		core::UTF8String mMonitorURL;
 
-		/// buffer used for curl's read function
-		std::vector<unsigned char> mReadBuffer;
+		/// pool the compressor is obtained from and returned to (might be @c nullptr)
+		std::shared_ptr<base::util::StreamingCompressorPool> mCompressorPool;
 
-		/// read position in the read buffer
-		size_t mReadBufferPos;
+		/// compresses the beacon data of synchronously sent requests
+		std::unique_ptr<base::util::StreamingCompressor> mCompressor;
 
 		/// how the peer's TSL/SSL certificate and the hostname shall be trusted
 		std::shared_ptr<openkit::ISSLTrustManager> mSSLTrustManager;
@@ -178,8 +293,15 @@ namespace protocol
 
 		/// User agent header
 		std::string mUserAgentHeader;
+
+		/// pool of reusable curl handles (might be @c nullptr)
+		std::shared_ptr<HTTPConnectionPool> mConnectionPool;
 	};
 
 }
 
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
 #endif
\ No newline at end of file
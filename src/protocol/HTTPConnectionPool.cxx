@@ -0,0 +1,213 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HTTPConnectionPool.h"
+
+using namespace protocol;
+
+HTTPConnectionPool::HTTPConnectionPool(
+	std::shared_ptr<openkit::ILogger> logger,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	int32_t maxIdleConnections,
+	int64_t idleTimeoutInMillis,
+	int32_t maxConcurrentRequests
+)
+	: mLogger(logger)
+	, mTimingProvider(timingProvider)
+	, mMaxIdleConnections(maxIdleConnections)
+	, mIdleTimeoutInMillis(idleTimeoutInMillis)
+	, mMaxConcurrentRequests(maxConcurrentRequests)
+	, mIdleConnections()
+	, mMutex()
+	, mShareHandle(nullptr)
+	, mIsCurlInitialized(false)
+	, mMultiplexer(nullptr)
+	, mSharedDataLocks()
+{
+}
+
+HTTPConnectionPool::~HTTPConnectionPool()
+{
+	// aborts running transfers before any handle is cleaned up
+	mMultiplexer.reset();
+
+	for (auto& idleConnection : mIdleConnections)
+	{
+		curl_easy_cleanup(idleConnection.handle);
+	}
+	mIdleConnections.clear();
+
+	if (mShareHandle != nullptr)
+	{
+		curl_share_cleanup(mShareHandle);
+		mShareHandle = nullptr;
+	}
+
+	if (mIsCurlInitialized)
+	{
+		// libcurl reference counts global init/cleanup, therefore this does not interfere with OpenKit's own calls
+		curl_global_cleanup();
+	}
+}
+
+CURL* HTTPConnectionPool::acquire()
+{
+	CURL* handle = nullptr;
+
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		initialize();
+		evictExpiredConnections(mTimingProvider->provideTimestampInMilliseconds());
+
+		if (!mIdleConnections.empty())
+		{
+			handle = mIdleConnections.back().handle;
+			mIdleConnections.pop_back();
+		}
+	}
+
+	if (handle == nullptr)
+	{
+		handle = curl_easy_init();
+		if (handle == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	applyPoolOptions(handle);
+
+	return handle;
+}
+
+void HTTPConnectionPool::release(CURL* handle)
+{
+	if (handle == nullptr)
+	{
+		return;
+	}
+
+	// reset all options, but keep live connections and caches
+	curl_easy_reset(handle);
+
+	{ // synchronized scope
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if (mMaxIdleConnections > 0 && mIdleConnections.size() < static_cast<size_t>(mMaxIdleConnections))
+		{
+			mIdleConnections.push_back({ handle, mTimingProvider->provideTimestampInMilliseconds() });
+			return;
+		}
+	}
+
+	curl_easy_cleanup(handle);
+}
+
+CURLcode HTTPConnectionPool::perform(CURL* handle)
+{
+	return curl_easy_perform(handle);
+}
+
+HTTPRequestMultiplexer* HTTPConnectionPool::getMultiplexer()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	initialize();
+
+	return mMultiplexer.get();
+}
+
+size_t HTTPConnectionPool::getNumberOfIdleConnections()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mIdleConnections.size();
+}
+
+void HTTPConnectionPool::initialize()
+{
+	if (mIsCurlInitialized)
+	{
+		return;
+	}
+
+	// the pool might outlive OpenKit's global curl initialization, therefore hold an own reference
+	curl_global_init(CURL_GLOBAL_ALL);
+	mIsCurlInitialized = true;
+
+	if (mMaxConcurrentRequests > 1)
+	{
+		mMultiplexer.reset(new HTTPRequestMultiplexer(mLogger, mMaxConcurrentRequests));
+	}
+
+	mShareHandle = curl_share_init();
+	if (mShareHandle == nullptr)
+	{
+		mLogger->warning("HTTPConnectionPool - curl_share_init() failed, continuing without shared caches");
+		return;
+	}
+
+	curl_share_setopt(mShareHandle, CURLSHOPT_LOCKFUNC, lockSharedData);
+	curl_share_setopt(mShareHandle, CURLSHOPT_UNLOCKFUNC, unlockSharedData);
+	curl_share_setopt(mShareHandle, CURLSHOPT_USERDATA, this);
+	curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+}
+
+void HTTPConnectionPool::evictExpiredConnections(int64_t now)
+{
+	// oldest handles are at the front
+	while (!mIdleConnections.empty() && (now - mIdleConnections.front().releaseTimestamp) >= mIdleTimeoutInMillis)
+	{
+		curl_easy_cleanup(mIdleConnections.front().handle);
+		mIdleConnections.pop_front();
+	}
+}
+
+void HTTPConnectionPool::applyPoolOptions(CURL* handle) const
+{
+	if (mShareHandle != nullptr)
+	{
+		curl_easy_setopt(handle, CURLOPT_SHARE, mShareHandle);
+	}
+
+	if (mIdleTimeoutInMillis > 0)
+	{
+		// also let curl drop cached connections which were idle for too long
+		long maxAgeInSeconds = static_cast<long>((mIdleTimeoutInMillis + 999) / 1000);
+		curl_easy_setopt(handle, CURLOPT_MAXAGE_CONN, maxAgeInSeconds);
+	}
+
+	if (mMultiplexer != nullptr)
+	{
+		// prefer HTTP/2 and rather wait for a connection to multiplex on, than opening a new one
+		curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+	}
+}
+
+void HTTPConnectionPool::lockSharedData(CURL* /* handle */, curl_lock_data data, curl_lock_access /* access */, void* userPtr)
+{
+	auto pool = reinterpret_cast<HTTPConnectionPool*>(userPtr);
+	pool->mSharedDataLocks[data].lock();
+}
+
+void HTTPConnectionPool::unlockSharedData(CURL* /* handle */, curl_lock_data data, void* userPtr)
+{
+	auto pool = reinterpret_cast<HTTPConnectionPool*>(userPtr);
+	pool->mSharedDataLocks[data].unlock();
+}
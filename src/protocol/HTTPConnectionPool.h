@@ -0,0 +1,196 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _PROTOCOL_HTTPCONNECTIONPOOL_H
+#define _PROTOCOL_HTTPCONNECTIONPOOL_H
+
+#include "OpenKit/ILogger.h"
+#include "protocol/HTTPRequestMultiplexer.h"
+#include "providers/ITimingProvider.h"
+
+#include <curl/curl.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace protocol
+{
+	///
+	/// Pool of reusable curl easy handles shared by all @ref HTTPClient instances of one OpenKit.
+	///
+	/// @par
+	/// Handles returned to the pool keep their live connections, so consecutive requests to the same
+	/// endpoint skip the TCP and TLS handshake. Additionally all handles handed out by the pool are attached
+	/// to a common curl share handle, which shares the DNS cache, the TLS session cache and the connection cache.
+	///
+	/// @par
+	/// If more than one concurrent request is allowed, the pool additionally provides a @ref HTTPRequestMultiplexer
+	/// for sending requests asynchronously, which allows HTTP/2 multiplexing of concurrent requests.
+	///
+	class HTTPConnectionPool
+	{
+	public:
+
+		///
+		/// Constructor
+		/// @param[in] logger to write traces to
+		/// @param[in] timingProvider used to determine how long a handle has been idle
+		/// @param[in] maxIdleConnections maximum number of idle handles kept in the pool. If @c 0 or negative
+		///            handles are cleaned up after each request, but the share handle is still used.
+		/// @param[in] idleTimeoutInMillis time after which an idle handle and its connection is discarded.
+		/// @param[in] maxConcurrentRequests maximum number of requests performed concurrently. If greater than one
+		///            asynchronous transfers are driven by a common curl multi handle.
+		///
+		HTTPConnectionPool(
+			std::shared_ptr<openkit::ILogger> logger,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			int32_t maxIdleConnections,
+			int64_t idleTimeoutInMillis,
+			int32_t maxConcurrentRequests
+		);
+
+		///
+		/// Destructor
+		///
+		/// @par
+		/// Cleans up all pooled handles and the share handle.
+		///
+		~HTTPConnectionPool();
+
+		///
+		/// Delete the copy constructor
+		///
+		HTTPConnectionPool(const HTTPConnectionPool&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		HTTPConnectionPool& operator = (const HTTPConnectionPool&) = delete;
+
+		///
+		/// Returns an easy handle ready to be configured for the next request.
+		///
+		/// @par
+		/// The most recently released handle is preferred, since its connection is the most likely to still be alive.
+		/// A new handle is created, if the pool has no idle handle left.
+		///
+		/// @return an easy handle or @c nullptr if no handle could be created.
+		///
+		CURL* acquire();
+
+		///
+		/// Returns the given handle back to the pool.
+		///
+		/// @par
+		/// All options of the handle are reset, its connections, DNS and TLS session caches are retained.
+		/// If the pool is already full the handle is cleaned up instead.
+		///
+		/// @param[in] handle the handle previously obtained via @ref acquire
+		///
+		void release(CURL* handle);
+
+		///
+		/// Performs the transfer of a handle obtained via @ref acquire and blocks until it completed.
+		///
+		/// @param[in] handle the configured easy handle
+		/// @return the result of the transfer
+		///
+		CURLcode perform(CURL* handle);
+
+		///
+		/// Returns the multiplexer driving asynchronous transfers.
+		///
+		/// @remarks The multiplexer is not thread safe and must only be used by the thread sending the beacons.
+		///
+		/// @return the multiplexer or @c nullptr if requests are performed sequentially.
+		///
+		HTTPRequestMultiplexer* getMultiplexer();
+
+		///
+		/// Returns the number of handles which are currently idle in the pool.
+		///
+		size_t getNumberOfIdleConnections();
+
+	private:
+
+		///
+		/// Idle handle alongside the timestamp when it was released
+		///
+		struct IdleConnection
+		{
+			CURL* handle;
+			int64_t releaseTimestamp;
+		};
+
+		///
+		/// Lazily initializes libcurl, the share handle and the multiplexer.
+		/// @remarks Must be called with @c mMutex held.
+		///
+		void initialize();
+
+		///
+		/// Cleans up all idle handles which exceeded the idle timeout.
+		/// @remarks Must be called with @c mMutex held.
+		///
+		void evictExpiredConnections(int64_t now);
+
+		///
+		/// Attaches the share handle and the pool wide options to a fresh or reset easy handle.
+		///
+		void applyPoolOptions(CURL* handle) const;
+
+		static void lockSharedData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr);
+
+		static void unlockSharedData(CURL* handle, curl_lock_data data, void* userPtr);
+
+		/// Logger to write traces to
+		std::shared_ptr<openkit::ILogger> mLogger;
+
+		/// timing provider used to track idle times
+		std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+
+		/// maximum number of idle handles kept
+		const int32_t mMaxIdleConnections;
+
+		/// idle timeout in milliseconds
+		const int64_t mIdleTimeoutInMillis;
+
+		/// maximum number of concurrently performed requests
+		const int32_t mMaxConcurrentRequests;
+
+		/// idle handles, the most recently released one at the back
+		std::deque<IdleConnection> mIdleConnections;
+
+		/// mutex guarding the idle handles and the lazy initialization
+		std::mutex mMutex;
+
+		/// share handle for DNS, TLS session and connection cache
+		CURLSH* mShareHandle;
+
+		/// flag indicating if this pool holds a reference on the libcurl global state
+		bool mIsCurlInitialized;
+
+		/// multiplexer driving asynchronous transfers (@c nullptr if requests are performed sequentially)
+		std::unique_ptr<HTTPRequestMultiplexer> mMultiplexer;
+
+		/// one lock per shared data type, as requested by the share handle's lock callbacks
+		std::mutex mSharedDataLocks[CURL_LOCK_DATA_LAST];
+	};
+}
+
+#endif
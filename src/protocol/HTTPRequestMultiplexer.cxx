@@ -0,0 +1,202 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HTTPRequestMultiplexer.h"
+
+#include <algorithm>
+#include <chrono>
+
+// max time to wait for socket activity, before curl's timeouts are checked again
+constexpr int POLL_TIMEOUT_IN_MILLIS = 1000;
+
+using namespace protocol;
+
+static int64_t now()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+HTTPRequestMultiplexer::HTTPRequestMultiplexer(std::shared_ptr<openkit::ILogger> logger, int32_t maxConcurrentRequests)
+	: mLogger(logger)
+	, mMultiHandle(curl_multi_init())
+	, mRunningTransfers()
+	, mDelayedTransfers()
+	, mIsShutdown(false)
+{
+	if (mMultiHandle == nullptr)
+	{
+		mLogger->error("HTTPRequestMultiplexer - curl_multi_init() failed");
+		mIsShutdown = true;
+		return;
+	}
+
+	curl_multi_setopt(mMultiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+	curl_multi_setopt(mMultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(maxConcurrentRequests));
+}
+
+HTTPRequestMultiplexer::~HTTPRequestMultiplexer()
+{
+	mIsShutdown = true;
+
+	// abort everything which did not complete so far
+	std::unordered_map<CURL*, CompletionHandler> abortedTransfers;
+	abortedTransfers.swap(mRunningTransfers);
+	for (auto& entry : abortedTransfers)
+	{
+		curl_multi_remove_handle(mMultiHandle, entry.first);
+		entry.second(CURLE_ABORTED_BY_CALLBACK);
+	}
+
+	std::vector<DelayedTransfer> abortedDelayedTransfers;
+	abortedDelayedTransfers.swap(mDelayedTransfers);
+	for (auto& delayedTransfer : abortedDelayedTransfers)
+	{
+		delayedTransfer.completionHandler(CURLE_ABORTED_BY_CALLBACK);
+	}
+
+	if (mMultiHandle != nullptr)
+	{
+		curl_multi_cleanup(mMultiHandle);
+		mMultiHandle = nullptr;
+	}
+}
+
+bool HTTPRequestMultiplexer::add(CURL* handle, CompletionHandler completionHandler)
+{
+	if (mIsShutdown || handle == nullptr)
+	{
+		return false;
+	}
+
+	auto result = curl_multi_add_handle(mMultiHandle, handle);
+	if (result != CURLM_OK)
+	{
+		mLogger->error("HTTPRequestMultiplexer - curl_multi_add_handle() failed: %s", curl_multi_strerror(result));
+		return false;
+	}
+
+	mRunningTransfers[handle] = std::move(completionHandler);
+
+	return true;
+}
+
+bool HTTPRequestMultiplexer::addDelayed(CURL* handle, CompletionHandler completionHandler, int64_t delayInMillis)
+{
+	if (mIsShutdown || handle == nullptr)
+	{
+		return false;
+	}
+
+	DelayedTransfer delayedTransfer = { handle, std::move(completionHandler), now() + std::max(delayInMillis, int64_t(0)) };
+	mDelayedTransfers.push_back(std::move(delayedTransfer));
+
+	return true;
+}
+
+size_t HTTPRequestMultiplexer::perform()
+{
+	std::vector<std::pair<CompletionHandler, CURLcode>> completedTransfers;
+
+	while (!mRunningTransfers.empty() || !mDelayedTransfers.empty())
+	{
+		auto pollTimeout = startDueTransfers(completedTransfers);
+
+		if (!mRunningTransfers.empty())
+		{
+			int runningHandles = 0;
+			auto result = curl_multi_perform(mMultiHandle, &runningHandles);
+			if (result != CURLM_OK)
+			{
+				mLogger->error("HTTPRequestMultiplexer - curl_multi_perform() failed: %s", curl_multi_strerror(result));
+			}
+
+			takeCompletedTransfers(completedTransfers);
+		}
+
+		if (!completedTransfers.empty())
+		{
+			break;
+		}
+
+		// without any easy handle this just waits for the next delayed transfer
+		curl_multi_poll(mMultiHandle, nullptr, 0, pollTimeout, nullptr);
+	}
+
+	// handlers are invoked last, since they might add new transfers
+	for (auto& completedTransfer : completedTransfers)
+	{
+		completedTransfer.first(completedTransfer.second);
+	}
+
+	return getNumberOfRunningTransfers();
+}
+
+size_t HTTPRequestMultiplexer::getNumberOfRunningTransfers() const
+{
+	return mRunningTransfers.size() + mDelayedTransfers.size();
+}
+
+int HTTPRequestMultiplexer::startDueTransfers(std::vector<std::pair<CompletionHandler, CURLcode>>& completedTransfers)
+{
+	auto currentTime = now();
+	auto pollTimeout = int64_t(POLL_TIMEOUT_IN_MILLIS);
+
+	auto it = mDelayedTransfers.begin();
+	while (it != mDelayedTransfers.end())
+	{
+		if (it->deadline > currentTime)
+		{
+			pollTimeout = std::min(pollTimeout, it->deadline - currentTime);
+			++it;
+			continue;
+		}
+
+		if (!add(it->handle, it->completionHandler))
+		{
+			completedTransfers.emplace_back(std::move(it->completionHandler), CURLE_FAILED_INIT);
+		}
+		it = mDelayedTransfers.erase(it);
+	}
+
+	return static_cast<int>(pollTimeout);
+}
+
+void HTTPRequestMultiplexer::takeCompletedTransfers(std::vector<std::pair<CompletionHandler, CURLcode>>& completedTransfers)
+{
+	CURLMsg* message = nullptr;
+	int remainingMessages = 0;
+	while ((message = curl_multi_info_read(mMultiHandle, &remainingMessages)) != nullptr)
+	{
+		if (message->msg != CURLMSG_DONE)
+		{
+			continue;
+		}
+
+		// the message is invalidated when removing the handle
+		auto handle = message->easy_handle;
+		auto result = message->data.result;
+
+		curl_multi_remove_handle(mMultiHandle, handle);
+
+		auto it = mRunningTransfers.find(handle);
+		if (it != mRunningTransfers.end())
+		{
+			completedTransfers.emplace_back(std::move(it->second), result);
+			mRunningTransfers.erase(it);
+		}
+	}
+}
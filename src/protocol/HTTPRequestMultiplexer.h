@@ -0,0 +1,170 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _PROTOCOL_HTTPREQUESTMULTIPLEXER_H
+#define _PROTOCOL_HTTPREQUESTMULTIPLEXER_H
+
+#include "OpenKit/ILogger.h"
+
+#include <curl/curl.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace protocol
+{
+	///
+	/// Drives concurrent curl transfers through a single curl multi handle.
+	///
+	/// @par
+	/// Fully configured easy handles are added via @ref add and driven by the thread calling @ref perform, which
+	/// invokes the completion handler of each transfer as soon as it completed. Driving all transfers through one
+	/// multi handle allows curl to multiplex requests to the same host over a single HTTP/2 connection, or to use
+	/// up to @c maxConcurrentRequests parallel connections otherwise.
+	///
+	/// @remarks This class is not thread safe, all methods must be called from the same thread.
+	///
+	class HTTPRequestMultiplexer
+	{
+	public:
+
+		///
+		/// Handler invoked with the result of a transfer, as @c curl_easy_perform would have returned it.
+		///
+		using CompletionHandler = std::function<void(CURLcode)>;
+
+		///
+		/// Constructor
+		/// @param[in] logger to write traces to
+		/// @param[in] maxConcurrentRequests maximum number of connections opened to one host
+		///
+		HTTPRequestMultiplexer(std::shared_ptr<openkit::ILogger> logger, int32_t maxConcurrentRequests);
+
+		///
+		/// Destructor
+		///
+		/// @par
+		/// Aborts all running and delayed transfers and invokes their completion handlers with
+		/// @c CURLE_ABORTED_BY_CALLBACK.
+		///
+		~HTTPRequestMultiplexer();
+
+		///
+		/// Delete the copy constructor
+		///
+		HTTPRequestMultiplexer(const HTTPRequestMultiplexer&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		HTTPRequestMultiplexer& operator = (const HTTPRequestMultiplexer&) = delete;
+
+		///
+		/// Adds the transfer of the given easy handle, without performing it yet.
+		///
+		/// @param[in] handle the configured easy handle, which must not be used by the caller until the
+		///            completion handler was invoked.
+		/// @param[in] completionHandler handler invoked from @ref perform once the transfer completed.
+		/// @return @c true if the transfer was added, @c false otherwise. In the latter case the completion handler
+		///         is never invoked.
+		///
+		bool add(CURL* handle, CompletionHandler completionHandler);
+
+		///
+		/// Adds the transfer of the given easy handle, which is started by @ref perform once the given delay elapsed.
+		///
+		/// @par
+		/// Until then the handle is kept out of the multi handle, so that other transfers are driven meanwhile.
+		///
+		/// @param[in] handle the configured easy handle, which must not be used by the caller until the
+		///            completion handler was invoked.
+		/// @param[in] completionHandler handler invoked from @ref perform once the transfer completed.
+		/// @param[in] delayInMillis the time in milliseconds to wait before the transfer is started
+		/// @return @c true if the transfer was added, @c false otherwise. In the latter case the completion handler
+		///         is never invoked.
+		///
+		bool addDelayed(CURL* handle, CompletionHandler completionHandler, int64_t delayInMillis);
+
+		///
+		/// Drives all added transfers until at least one of them completed and invokes the completion handlers
+		/// of all completed transfers.
+		///
+		/// @par
+		/// Delayed transfers are started as soon as their delay elapsed. Completion handlers are allowed to add new
+		/// transfers.
+		///
+		/// @return the number of transfers which are still running.
+		///
+		size_t perform();
+
+		///
+		/// Returns the number of transfers added, but not completed so far, including delayed ones.
+		///
+		size_t getNumberOfRunningTransfers() const;
+
+	private:
+
+		///
+		/// A transfer which is not started before its deadline
+		///
+		struct DelayedTransfer
+		{
+			/// the configured easy handle
+			CURL* handle;
+
+			/// handler invoked once the transfer completed
+			CompletionHandler completionHandler;
+
+			/// the time in milliseconds of a monotonic clock when the transfer is started
+			int64_t deadline;
+		};
+
+		///
+		/// Adds all delayed transfers, whose deadline passed, to the multi handle.
+		///
+		/// @par
+		/// Transfers which cannot be added are moved to the given list with @c CURLE_FAILED_INIT as result.
+		///
+		/// @return the time in milliseconds until the next delayed transfer is due, but at most the poll timeout.
+		///
+		int startDueTransfers(std::vector<std::pair<CompletionHandler, CURLcode>>& completedTransfers);
+
+		///
+		/// Removes all completed transfers from the multi handle and moves their handlers and results to the given list.
+		///
+		void takeCompletedTransfers(std::vector<std::pair<CompletionHandler, CURLcode>>& completedTransfers);
+
+		/// Logger to write traces to
+		std::shared_ptr<openkit::ILogger> mLogger;
+
+		/// the multi handle
+		CURLM* mMultiHandle;
+
+		/// completion handlers of the transfers currently driven by the multi handle
+		std::unordered_map<CURL*, CompletionHandler> mRunningTransfers;
+
+		/// transfers which are not added to the multi handle before their deadline
+		std::vector<DelayedTransfer> mDelayedTransfers;
+
+		/// flag indicating that no further transfers are accepted
+		bool mIsShutdown;
+	};
+}
+
+#endif
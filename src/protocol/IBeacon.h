@@ -26,6 +26,7 @@
 #include "protocol/IStatusResponse.h"
 #include "providers/IHTTPClientProvider.h"
 #include "OpenKit/json/JsonObjectValue.h"
+#include "OpenKit/json/JsonDocument.h"
 
 #include <memory>
 #include <cstdint>
@@ -221,12 +222,24 @@ namespace protocol
 		/// @param attributes Additional attributes that will be sent with the event
 		virtual void sendBizEvent(const core::UTF8String& type, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) = 0;
 
+		/// 
+		/// Add event to the Beacon.
+		/// @param type Type of the event
+		/// @param attributes Additional attributes that will be sent with the event
+		virtual void sendBizEvent(const core::UTF8String& type, const openkit::json::JsonDocument& attributes) = 0;
+
 		/// 
 		/// Add event to the Beacon.
 		/// @param name Name of the event
 		/// @param attributes Additional attributes that will be sent with the event
 		virtual void sendEvent(const core::UTF8String& name, const openkit::json::JsonObjectValue::JsonObjectMapPtr attributes) = 0;
 
+		/// 
+		/// Add event to the Beacon.
+		/// @param name Name of the event
+		/// @param attributes Additional attributes that will be sent with the event
+		virtual void sendEvent(const core::UTF8String& name, const openkit::json::JsonDocument& attributes) = 0;
+
 		///
 		/// Sends the current Beacon state
 		/// @param[in] clientProvider the @ref providers::IHTTPClientProvider to use for sending
@@ -238,6 +251,23 @@ namespace protocol
 			const protocol::IAdditionalQueryParameters& additionalParameters
 		) = 0;
 
+		///
+		/// Sends the current Beacon state without waiting for the responses
+		///
+		/// @par
+		/// The chunks of this beacon are sent one after the other, each one once the response of the previous one
+		/// was received. The requests are driven by @ref providers::IHTTPClientProvider::processPendingRequests.
+		///
+		/// @param[in] clientProvider the @ref providers::IHTTPClientProvider to use for sending
+		/// @param[in] additionalParameters additional parameters, which must be kept alive until the response handler was invoked
+		/// @param[in] responseHandler handler invoked with the status response returned for the Beacon data
+		///
+		virtual void sendAsync(
+			std::shared_ptr<providers::IHTTPClientProvider> clientProvider,
+			const protocol::IAdditionalQueryParameters& additionalParameters,
+			protocol::IHTTPClient::ResponseHandler responseHandler
+		) = 0;
+
 		///
 		/// Checks if the Beacon is empty
 		///
@@ -21,6 +21,7 @@
 #include "protocol/IAdditionalQueryParameters.h"
 #include "protocol/IStatusResponse.h"
 
+#include <functional>
 #include <memory>
 
 namespace protocol
@@ -34,6 +35,11 @@ namespace protocol
 	{
 	public:
 
+		///
+		/// Handler invoked with the status response of an asynchronously sent request
+		///
+		using ResponseHandler = std::function<void(std::shared_ptr<IStatusResponse>)>;
+
 		///
 		/// Destructor
 		///
@@ -61,6 +67,28 @@ namespace protocol
 			int64_t deviceID
 		) = 0;
 
+		///
+		/// sends a beacon send request without waiting for its response
+		///
+		/// @par
+		/// The request is driven by @ref providers::IHTTPClientProvider::processPendingRequests and the response handler
+		/// is invoked from there. If the client does not support asynchronous requests, the request is sent immediately
+		/// and the response handler is invoked before this method returns.
+		///
+		/// @param[in] clientIPAddress the client IP address
+		/// @param[in] beaconData the beacon payload
+		/// @param[in] additional parameters that will be send with the beacon request
+		/// @param[in] responseHandler handler invoked with the status response of the request
+		///
+		virtual void sendBeaconRequestAsync(
+			const core::UTF8String& clientIPAddress,
+			const core::UTF8String& beaconData,
+			const protocol::IAdditionalQueryParameters& additionalParameters,
+			int32_t sessionNumber,
+			int64_t deviceID,
+			ResponseHandler responseHandler
+		) = 0;
+
 		///
 		/// sends a new session request and returns a status response
 		/// @param[in] additional parameters that will be send with the beacon request
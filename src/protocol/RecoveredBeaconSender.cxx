@@ -0,0 +1,77 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecoveredBeaconSender.h"
+#include "BeaconProtocolConstants.h"
+#include "BeaconRecordWriter.h"
+
+using namespace protocol;
+
+RecoveredBeaconSender::RecoveredBeaconSender(std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+	std::shared_ptr<providers::ITimingProvider> timingProvider)
+	: mBeaconCache(beaconCache)
+	, mTimingProvider(timingProvider)
+{
+}
+
+std::shared_ptr<IStatusResponse> RecoveredBeaconSender::send(std::shared_ptr<IHTTPClient> httpClient,
+	const IAdditionalQueryParameters& additionalParameters,
+	const core::configuration::IServerConfiguration& serverConfiguration)
+{
+	const auto delimiter = core::UTF8String(BEACON_DATA_DELIMITER);
+	const size_t maxSize = serverConfiguration.getBeaconSizeInBytes() - 1024;
+
+	std::shared_ptr<IStatusResponse> response = nullptr;
+	core::caching::IBeaconCacheOverflowStore::RecoveredBeacon recoveredBeacon;
+	while (mBeaconCache->takeRecoveredBeacon(recoveredBeacon, maxSize))
+	{
+		auto& records = recoveredBeacon.records;
+		auto it = records.begin();
+		while (it != records.end())
+		{
+			// prefix for this chunk - the beacon's original data with current transmission time & multiplicity
+			BeaconRecordWriter transmissionData;
+			transmissionData.addKeyValuePair(BEACON_KEY_TRANSMISSION_TIME, mTimingProvider->provideTimestampInMilliseconds());
+			transmissionData.addKeyValuePair(BEACON_KEY_MULTIPLICITY, serverConfiguration.getMultiplicity());
+
+			auto chunk = recoveredBeacon.header.beaconData;
+			chunk.concatenate(delimiter);
+			chunk.concatenate(transmissionData.toUTF8String());
+
+			auto chunkEnd = it;
+			while (chunkEnd != records.end() && (chunkEnd == it || chunk.getStringLength() <= maxSize))
+			{
+				chunk.concatenate(delimiter);
+				chunk.concatenate(chunkEnd->data);
+				++chunkEnd;
+			}
+
+			response = httpClient->sendBeaconRequest(recoveredBeacon.header.clientIPAddress, chunk, additionalParameters,
+				recoveredBeacon.header.sessionNumber, recoveredBeacon.header.deviceID);
+			if (response == nullptr || response->isErroneousResponse())
+			{
+				// put back the records not sent yet & retry with the next process
+				records.erase(records.begin(), it);
+				mBeaconCache->restoreRecoveredBeacon(recoveredBeacon);
+				return response;
+			}
+
+			it = chunkEnd;
+		}
+	}
+
+	return response;
+}
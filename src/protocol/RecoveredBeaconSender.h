@@ -0,0 +1,76 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _PROTOCOL_RECOVEREDBEACONSENDER_H
+#define _PROTOCOL_RECOVEREDBEACONSENDER_H
+
+#include "IAdditionalQueryParameters.h"
+#include "IHTTPClient.h"
+#include "IStatusResponse.h"
+#include "core/caching/IBeaconCache.h"
+#include "core/configuration/IServerConfiguration.h"
+#include "providers/ITimingProvider.h"
+
+#include <memory>
+
+namespace protocol
+{
+	///
+	/// Sends the records of beacons, which were moved to the overflow store by a previous process.
+	///
+	/// @par
+	/// Each recovered beacon is sent with the header it had in the previous process, only the transmission time and
+	/// the multiplicity are updated. Records are taken from the overflow store one chunk at a time.
+	///
+	class RecoveredBeaconSender
+	{
+	public:
+
+		///
+		/// Constructor
+		///
+		/// @param[in] beaconCache the cache providing the recovered beacons
+		/// @param[in] timingProvider provider for the transmission time
+		///
+		RecoveredBeaconSender(std::shared_ptr<core::caching::IBeaconCache> beaconCache,
+			std::shared_ptr<providers::ITimingProvider> timingProvider);
+
+		///
+		/// Sends all recovered beacons.
+		///
+		/// @par
+		/// If a request fails, the records not sent yet are put back to the overflow store and sending stops.
+		///
+		/// @param[in] httpClient the client used for sending
+		/// @param[in] additionalParameters additional parameters that will be sent with the beacon requests
+		/// @param[in] serverConfiguration provides the multiplicity and the maximum beacon size
+		/// @return the last response received or @c nullptr if there were no recovered beacons
+		///
+		std::shared_ptr<IStatusResponse> send(std::shared_ptr<IHTTPClient> httpClient,
+			const IAdditionalQueryParameters& additionalParameters,
+			const core::configuration::IServerConfiguration& serverConfiguration);
+
+	private:
+
+		/// the cache providing the recovered beacons
+		const std::shared_ptr<core::caching::IBeaconCache> mBeaconCache;
+
+		/// provider for the transmission time
+		const std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+	};
+}
+
+#endif
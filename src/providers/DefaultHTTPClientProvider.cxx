@@ -16,15 +16,35 @@
 
 #include "DefaultHTTPClientProvider.h"
 #include "protocol/HTTPClient.h"
+#include "core/util/StreamingCompressorPool.h"
+#include "protocol/HTTPConnectionPool.h"
+#include "protocol/HTTPRequestMultiplexer.h"
+
+#include <algorithm>
 
 using namespace providers;
 
 DefaultHTTPClientProvider::DefaultHTTPClientProvider(
 	std::shared_ptr<openkit::ILogger> logger,
-	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+	std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+	std::shared_ptr<providers::ITimingProvider> timingProvider,
+	std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration
 )
 	: mLogger(logger)
 	, mThreadSuspender(threadSuspender)
+	, mConnectionPool(std::make_shared<protocol::HTTPConnectionPool>(
+		logger,
+		timingProvider,
+		openKitConfiguration->getHttpConnectionPoolMaxIdleConnections(),
+		openKitConfiguration->getHttpConnectionPoolIdleTimeout(),
+		openKitConfiguration->getMaxConcurrentBeaconRequests()
+	))
+	, mCompressorPool(std::make_shared<base::util::StreamingCompressorPool>(
+		openKitConfiguration->getBeaconCompressionLevel(),
+		openKitConfiguration->getBeaconCompressionStrategy(),
+		// one compressor per concurrently sent request is sufficient
+		static_cast<size_t>(std::max(openKitConfiguration->getMaxConcurrentBeaconRequests(), 1))
+	))
 {
 }
 
@@ -32,5 +52,17 @@ std::shared_ptr<protocol::IHTTPClient> DefaultHTTPClientProvider::createClient(
 	std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 )
 {
-	return std::make_shared<protocol::HTTPClient>(mLogger, configuration, mThreadSuspender);
+	return std::make_shared<protocol::HTTPClient>(mLogger, configuration, mThreadSuspender, mConnectionPool, mCompressorPool);
+}
+
+size_t DefaultHTTPClientProvider::processPendingRequests()
+{
+	auto multiplexer = mConnectionPool->getMultiplexer();
+	if (multiplexer == nullptr)
+	{
+		// requests are sent synchronously, nothing can be pending
+		return 0;
+	}
+
+	return multiplexer->perform();
 }
\ No newline at end of file
@@ -17,20 +17,48 @@
 #ifndef _PROVIDERS_DEFAULTHTTPCLIENTPROVIDER_H
 #define _PROVIDERS_DEFAULTHTTPCLIENTPROVIDER_H
 
+#include "core/configuration/IOpenKitConfiguration.h"
 #include "providers/IHTTPClientProvider.h"
+#include "providers/ITimingProvider.h"
+
+namespace base
+{
+	namespace util
+	{
+		class StreamingCompressorPool;
+	}
+}
+
+namespace protocol
+{
+	class HTTPConnectionPool;
+}
 
 namespace providers
 {
 	///
 	/// Implementation of an HTTPClientProvider which creates a HTTP client for executing status check and beacon send requests.
 	///
+	/// @par
+	/// All created clients share one connection pool, so that connections are kept alive across requests,
+	/// and one compressor pool, so that the deflate state is not set up for each request.
+	///
 	class DefaultHTTPClientProvider : public IHTTPClientProvider
 	{
 	public:
 
+		///
+		/// Constructor
+		/// @param[in] logger to write traces to
+		/// @param[in] threadSuspender used by the HTTP clients to sleep between retries
+		/// @param[in] timingProvider used by the connection pool to track idle connections
+		/// @param[in] openKitConfiguration configuration of the connection and compressor pools
+		///
 		DefaultHTTPClientProvider(
 			std::shared_ptr<openkit::ILogger> logger,
-			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender
+			std::shared_ptr<core::util::IInterruptibleThreadSuspender> threadSuspender,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			std::shared_ptr<core::configuration::IOpenKitConfiguration> openKitConfiguration
 		);
 
 		~DefaultHTTPClientProvider() override = default;
@@ -39,10 +67,14 @@ namespace providers
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 		) override;
 
+		size_t processPendingRequests() override;
+
 	private:
 
 		std::shared_ptr<openkit::ILogger> mLogger;
 		std::shared_ptr<core::util::IInterruptibleThreadSuspender> mThreadSuspender;
+		std::shared_ptr<protocol::HTTPConnectionPool> mConnectionPool;
+		std::shared_ptr<base::util::StreamingCompressorPool> mCompressorPool;
 	};
 }
 
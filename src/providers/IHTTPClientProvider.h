@@ -47,6 +47,16 @@ namespace providers
 		virtual std::shared_ptr<protocol::IHTTPClient> createClient(
 			std::shared_ptr<core::configuration::IHTTPClientConfiguration> configuration
 		) = 0;
+
+		///
+		/// Drives the requests sent asynchronously by clients of this provider, until at least one of them completed.
+		///
+		/// @par
+		/// The response handlers of all completed requests are invoked on the calling thread.
+		///
+		/// @return the number of requests which are still pending.
+		///
+		virtual size_t processPendingRequests() = 0;
 	};
 }
 
@@ -33,8 +33,8 @@ using namespace util::json::parser;
 using JsonTokenType = util::json::lexer::JsonTokenType;
 
 
-JsonParser::JsonParser(const std::string& input)
-	: JsonParser(std::make_shared<util::json::lexer::JsonLexer>(input))
+JsonParser::JsonParser(std::string input)
+	: JsonParser(std::make_shared<util::json::lexer::JsonLexer>(std::move(input)))
 {
 }
 
@@ -76,7 +76,7 @@ JsonParserState JsonParser::getState() const
 
 const JsonParser::JsonValuePtr JsonParser::doParse()
 {
-	std::shared_ptr<util::json::lexer::JsonToken> token;
+	JsonTokenPtr token;
 
 	do
 	{
@@ -283,7 +283,7 @@ void JsonParser::parseInObjectStartState(const JsonTokenPtr token)
 			closeCompositeJsonValueAndRestoreState();
 			break;
 		case JsonTokenType::VALUE_STRING:
-			mValueStack.top()->mLastParsedObjectKey = token->getValue();
+			mValueStack.top()->mLastParsedObjectKey.assign(token->getValueData(), token->getValueLength());
 			mState = JsonParserState::IN_OBJECT_KEY;
 			break;
 		default:
@@ -369,11 +369,9 @@ void JsonParser::parseInObjectValueState(const JsonTokenPtr token)
 			// object is closed right after some value. push last parsed key/value into map
 			ensureKeyValuePairWasParsed();
 
-			auto firstElement = mValueStack.top();
-			auto key = firstElement->mLastParsedObjectKey;
-			auto value = firstElement->mLastParsedObjectValue;
-			auto backingMap = firstElement->mBackingMap;
-			(*backingMap)[key] = value;
+			auto& firstElement = mValueStack.top();
+			(*firstElement->mBackingMap)[std::move(firstElement->mLastParsedObjectKey)]
+				= std::move(firstElement->mLastParsedObjectValue);
 
 			closeCompositeJsonValueAndRestoreState();
 			break;
@@ -402,7 +400,7 @@ void JsonParser::parseInObjectDelimiterState(JsonTokenPtr token)
 
 	if (token->getTokenType() == JsonTokenType::VALUE_STRING)
 	{
-		mValueStack.top()->mLastParsedObjectKey = token->getValue();
+		mValueStack.top()->mLastParsedObjectKey.assign(token->getValueData(), token->getValueLength());
 		mState = JsonParserState::IN_OBJECT_KEY;
 	}
 	else
@@ -476,13 +474,11 @@ void JsonParser::putLastParsedKeyValuePairIntoObject()
 	ensureKeyValuePairWasParsed();
 	ensureTopLevelElementIsAJsonObject();
 
-	auto firstValueStackElement = mValueStack.top();
-	auto key = firstValueStackElement->mLastParsedObjectKey;
-	auto value = firstValueStackElement->mLastParsedObjectValue;
-	auto backingMap = firstValueStackElement->mBackingMap;
-	(*backingMap)[key] = value;
+	auto& firstValueStackElement = mValueStack.top();
+	(*firstValueStackElement->mBackingMap)[std::move(firstValueStackElement->mLastParsedObjectKey)]
+		= std::move(firstValueStackElement->mLastParsedObjectValue);
 
-	firstValueStackElement->mLastParsedObjectKey = std::string();
+	firstValueStackElement->mLastParsedObjectKey.clear();
 	firstValueStackElement->mLastParsedObjectValue = nullptr;
 }
 
@@ -493,11 +489,11 @@ const JsonParser::JsonValuePtr JsonParser::tokenToSimpleJsonValue(const JsonToke
 		case JsonTokenType::LITERAL_NULL:
 			return openkit::json::JsonNullValue::nullValue();
 		case JsonTokenType::LITERAL_BOOLEAN:
-			return openkit::json::JsonBooleanValue::fromLiteral(token->getValue());
+			return openkit::json::JsonBooleanValue::fromValue(token == util::json::lexer::JsonToken::booleanTrueToken());
 		case JsonTokenType::VALUE_STRING:
 			return openkit::json::JsonStringValue::fromString(token->getValue());
 		case JsonTokenType::VALUE_NUMBER:
-			return openkit::json::JsonNumberValue::fromNumberLiteral((token->getValue()));
+			return openkit::json::JsonNumberValue::fromNumberLiteral(token->getValueData(), token->getValueLength());
 		default:
 			throw JsonParserException("Internal parser error: Unexpected JSON token \"" + token->toString() + "\"");
 	}
@@ -516,7 +512,7 @@ void JsonParser::ensureTopLevelElementIsAJsonArray() const
 {
 	ensureValueContainerStackIsNotEmpty();
 
-	auto firstStackElement = mValueStack.top();
+	const auto& firstStackElement = mValueStack.top();
 	if (firstStackElement->mJsonValue->getValueType() != openkit::json::JsonValueType::ARRAY_VALUE)
 	{
 		// sanity check. cannot happen unless there is a programming error
@@ -533,7 +529,7 @@ void JsonParser::ensureTopLevelElementIsAJsonObject() const
 {
 	ensureValueContainerStackIsNotEmpty();
 
-	auto firstStackElement = mValueStack.top();
+	const auto& firstStackElement = mValueStack.top();
 	if (firstStackElement->mJsonValue->getValueType() != openkit::json::JsonValueType::OBJECT_VALUE)
 	{
 		// sanity check. cannot happen unless there is a programming error
@@ -550,7 +546,7 @@ void JsonParser::ensureKeyValuePairWasParsed() const
 {
 	ensureValueContainerStackIsNotEmpty();
 
-	auto firstStackElement = mValueStack.top();
+	const auto& firstStackElement = mValueStack.top();
 	if (firstStackElement->mLastParsedObjectKey.empty())
 	{
 		throw JsonParserException(internalParserErrorMessage(mState, "mLastParsedObjectKey is not set"));
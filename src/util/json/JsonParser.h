@@ -39,7 +39,7 @@ namespace util
 		class JsonParser
 		{
 			using JsonLexerPtr = std::shared_ptr<util::json::lexer::JsonLexer>;
-			using JsonTokenPtr = std::shared_ptr<util::json::lexer::JsonToken>;
+			using JsonTokenPtr = const util::json::lexer::JsonToken*;
 			using JsonValuePtr = std::shared_ptr<openkit::json::JsonValue>;
 			using JsonArrayValuePtr = std::shared_ptr<openkit::json::JsonArrayValue>;
 			using JsonObjectValuePtr = std::shared_ptr<openkit::json::JsonObjectValue>;
@@ -51,7 +51,7 @@ namespace util
 			///
 			/// @param input JSON input string
 			///
-			JsonParser(const std::string& input);
+			JsonParser(std::string input);
 
 			///
 			/// Internal constructor taking the lexical analyzer.
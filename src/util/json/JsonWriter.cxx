@@ -15,94 +15,178 @@
  */
 
 #include "util/json/JsonWriter.h"
-#include <iomanip>
 
 using namespace openkit::json;
 
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
 JsonWriter::JsonWriter()
-    : mStringStream()
+	: mBuffer()
+	, mNumNonFiniteValues(0)
 {
 }
 
 void JsonWriter::openArray()
 {
-	mStringStream << '[';
+	mBuffer.push_back('[');
 }
 
 void JsonWriter::closeArray()
 {
-	mStringStream << "]";
+	mBuffer.push_back(']');
 }
 
 void JsonWriter::openObject()
 {
-	mStringStream << "{";
+	mBuffer.push_back('{');
 }
 
 void JsonWriter::closeObject()
 {
-	mStringStream << "}";
+	mBuffer.push_back('}');
 }
 
 void JsonWriter::insertKey(const std::string& key)
 {
-	mStringStream << "\"" << escapeString(key) << "\"";
+	insertKey(key.data(), key.size());
+}
+
+void JsonWriter::insertKey(const char* key, size_t length)
+{
+	mBuffer.push_back('"');
+	appendEscaped(key, length);
+	mBuffer.push_back('"');
 }
 
 void JsonWriter::insertStringValue(const std::string& value)
 {
-	mStringStream << "\"" << escapeString(value) << "\"";
+	insertStringValue(value.data(), value.size());
+}
+
+void JsonWriter::insertStringValue(const char* value, size_t length)
+{
+	mBuffer.push_back('"');
+	appendEscaped(value, length);
+	mBuffer.push_back('"');
 }
 
 void JsonWriter::insertValue(const std::string& value)
 {
-	mStringStream << escapeString(value);
+	appendEscaped(value.data(), value.size());
+}
+
+void JsonWriter::insertSerialized(const char* json, size_t length)
+{
+	mBuffer.append(json, length);
+}
+
+void JsonWriter::insertIntegerValue(int64_t value)
+{
+	char digits[20];
+	auto numDigits = size_t(0);
+
+	// negate in unsigned arithmetic, since -INT64_MIN is not representable
+	auto magnitude = value < 0 ? uint64_t(0) - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+	do
+	{
+		digits[numDigits++] = static_cast<char>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+
+	if (value < 0)
+	{
+		mBuffer.push_back('-');
+	}
+	while (numDigits > 0)
+	{
+		mBuffer.push_back(digits[--numDigits]);
+	}
+}
+
+void JsonWriter::insertNonFiniteValue()
+{
+	mBuffer.append("null", 4);
+	mNumNonFiniteValues++;
 }
 
 void JsonWriter::insertKeyValueSeperator()
 {
-	mStringStream << ":";
+	mBuffer.push_back(':');
 }
 
 void JsonWriter::insertElementSeperator()
 {
-	mStringStream << ",";
+	mBuffer.push_back(',');
+}
+
+size_t JsonWriter::getNumNonFiniteValues() const
+{
+	return mNumNonFiniteValues;
+}
+
+size_t JsonWriter::getLength() const
+{
+	return mBuffer.size();
+}
+
+const char* JsonWriter::getData() const
+{
+	return mBuffer.data();
+}
+
+void JsonWriter::truncate(size_t length)
+{
+	if (length < mBuffer.size())
+	{
+		mBuffer.resize(length);
+	}
+}
+
+void JsonWriter::reset()
+{
+	mBuffer.clear();
+	mNumNonFiniteValues = 0;
 }
 
 const std::string JsonWriter::toString()
 {
-	return mStringStream.str();
-}
-
-const std::string JsonWriter::escapeString(const std::string& value)
-{
-    std::ostringstream esc;
-
-    for (auto c = value.cbegin(); c != value.cend(); c++)
-    {
-        switch (*c)
-        {
-            
-            case '\b': esc << "\\b"; break;
-            case '\f': esc << "\\f"; break;
-            case '\n': esc << "\\n"; break;
-            case '\r': esc << "\\r"; break;
-            case '\t': esc << "\\t"; break;
-            case '/': esc << "\\/"; break;
-            case '"': esc << "\\\""; break;
-            case '\\': esc << "\\\\"; break;
-            default:
-                if ('\x00' <= *c && *c <= '\x1f')
-                {
-                    esc << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*c);
-                }
-                else
-                {
-                    esc << *c;
-                }
-        }
-    }
-
-    return esc.str();
+	return mBuffer;
 }
 
+void JsonWriter::appendEscaped(const char* data, size_t length)
+{
+	// characters not requiring an escape sequence are appended in runs
+	auto runStart = size_t(0);
+	for (auto i = size_t(0); i < length; i++)
+	{
+		auto c = data[i];
+		const char* escaped = nullptr;
+		switch (c)
+		{
+			case '\b': escaped = "\\b"; break;
+			case '\f': escaped = "\\f"; break;
+			case '\n': escaped = "\\n"; break;
+			case '\r': escaped = "\\r"; break;
+			case '\t': escaped = "\\t"; break;
+			case '/': escaped = "\\/"; break;
+			case '"': escaped = "\\\""; break;
+			case '\\': escaped = "\\\\"; break;
+			default:
+				if ('\x00' <= c && c <= '\x1f')
+				{
+					mBuffer.append(data + runStart, i - runStart);
+					mBuffer.append("\\u00", 4);
+					mBuffer.push_back(HEX_DIGITS[(c >> 4) & 0x0f]);
+					mBuffer.push_back(HEX_DIGITS[c & 0x0f]);
+					runStart = i + 1;
+				}
+				continue;
+		}
+
+		mBuffer.append(data + runStart, i - runStart);
+		mBuffer.append(escaped, 2);
+		runStart = i + 1;
+	}
+
+	mBuffer.append(data + runStart, length - runStart);
+}
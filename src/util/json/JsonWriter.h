@@ -17,7 +17,8 @@
 #ifndef _OPENKIT_JSON_JSONWRITER_H
 #define _OPENKIT_JSON_JSONWRITER_H
 
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace openkit
@@ -25,8 +26,12 @@ namespace openkit
 	namespace json
 	{
 		///
-	/// JSON writer class for writing a JSON string
-	///
+		/// JSON writer class for writing a JSON string
+		///
+		/// @par
+		/// All characters are appended to a single buffer, which keeps its capacity when the writer is @ref reset,
+		/// so that a writer can be reused for writing multiple JSON strings.
+		///
 		class JsonWriter
 		{
 
@@ -64,6 +69,14 @@ namespace openkit
 			/// 
 			void insertKey(const std::string& key);
 
+			///
+			/// Appending characters for a key in a JSON string
+			///
+			/// @param key JSON key, which does not need to be null terminated
+			/// @param length number of bytes of the key
+			///
+			void insertKey(const char* key, size_t length);
+
 			/// 
 			/// Appending characters for a string value in a JSON string
 			/// 
@@ -71,6 +84,14 @@ namespace openkit
 			/// 
 			void insertStringValue(const std::string& value);
 
+			///
+			/// Appending characters for a string value in a JSON string
+			///
+			/// @param value JSON string value, which does not need to be null terminated
+			/// @param length number of bytes of the value
+			///
+			void insertStringValue(const char* value, size_t length);
+
 			/// 
 			/// Appending characters for a value in a JSON string
 			/// 
@@ -78,6 +99,30 @@ namespace openkit
 			/// 
 			void insertValue(const std::string& value);
 
+			///
+			/// Appending characters of an already serialized JSON value or key value pair, without escaping them
+			///
+			/// @param json serialized JSON, which does not need to be null terminated
+			/// @param length number of bytes of the serialized JSON
+			///
+			void insertSerialized(const char* json, size_t length);
+
+			///
+			/// Appending characters for an integer value in a JSON string
+			///
+			/// @param value JSON integer value
+			///
+			void insertIntegerValue(int64_t value);
+
+			///
+			/// Appending characters for a non-finite numeric value (NaN or infinity) in a JSON string
+			///
+			/// @par
+			/// Since JSON does not support non-finite numbers, @c null is written instead.
+			/// The number of non-finite values written is available via @ref getNumNonFiniteValues.
+			///
+			void insertNonFiniteValue();
+
 			/// 
 			/// Appending characters for seperating a key value pair in a JSON string
 			/// 
@@ -88,6 +133,33 @@ namespace openkit
 			/// 
 			void insertElementSeperator();
 
+			///
+			/// Returns the number of non-finite numeric values written so far
+			///
+			size_t getNumNonFiniteValues() const;
+
+			///
+			/// Returns the number of bytes written so far
+			///
+			size_t getLength() const;
+
+			///
+			/// Returns the characters written so far, which are not null terminated
+			///
+			const char* getData() const;
+
+			///
+			/// Discards all characters written after the first @c length bytes
+			///
+			/// @param length the number of bytes to keep
+			///
+			void truncate(size_t length);
+
+			///
+			/// Discards all characters written so far, but keeps the allocated buffer
+			///
+			void reset();
+
 			/// 
 			/// Returning the whole JSON string
 			/// 
@@ -96,21 +168,26 @@ namespace openkit
 		private: // functions
 
 			///
-			/// Escaping characters for JSON output
+			/// Appends the escaped characters for JSON output
 			/// 
 			/// @param value JSON string value which should be escaped
-			/// @return Escaped string value
+			/// @param length number of bytes of the value
 			///
-			const std::string escapeString(const std::string& value);
+			void appendEscaped(const char* value, size_t length);
 
 		private: // members
 
 			///
-			/// the underlying string stream
+			/// the underlying buffer
+			///
+			std::string mBuffer;
+
+			///
+			/// the number of non-finite numeric values written
 			///
-			std::stringstream mStringStream;
+			size_t mNumNonFiniteValues;
 		};
 	}
 }
 
-#endif //_OPENKIT_JSON_JSONWRITER_H
\ No newline at end of file
+#endif //_OPENKIT_JSON_JSONWRITER_H
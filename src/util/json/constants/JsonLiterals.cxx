@@ -19,8 +19,70 @@
 using namespace util::json::constants;
 
 
-const std::regex& JsonLiterals::getNumberPattern()
+static bool isDigit(char chr)
 {
-	static std::regex numberPattern(JsonLiterals::NUMBER_PATTERN_STRING, std::regex::optimize);
-	return numberPattern;
-}
\ No newline at end of file
+	return chr >= '0' && chr <= '9';
+}
+
+bool JsonLiterals::isNumberLiteral(const char* literal, size_t literalLength, bool& isInteger)
+{
+	const char* current = literal;
+	const char* end = literal + literalLength;
+
+	// optional minus sign
+	if (current != end && *current == '-')
+	{
+		current++;
+	}
+
+	// integer part, which must not have leading zeros
+	if (current == end || !isDigit(*current))
+	{
+		return false;
+	}
+	if (*current++ != '0')
+	{
+		while (current != end && isDigit(*current))
+		{
+			current++;
+		}
+	}
+
+	isInteger = true;
+
+	// optional fraction part
+	if (current != end && *current == '.')
+	{
+		current++;
+		if (current == end || !isDigit(*current))
+		{
+			return false;
+		}
+		while (current != end && isDigit(*current))
+		{
+			current++;
+		}
+		isInteger = false;
+	}
+
+	// optional exponent part
+	if (current != end && (*current == 'e' || *current == 'E'))
+	{
+		current++;
+		if (current != end && (*current == '+' || *current == '-'))
+		{
+			current++;
+		}
+		if (current == end || !isDigit(*current))
+		{
+			return false;
+		}
+		while (current != end && isDigit(*current))
+		{
+			current++;
+		}
+		isInteger = false;
+	}
+
+	return current == end;
+}
@@ -17,8 +17,7 @@
 #ifndef _UTIL_JSON_CONSTANTS_JSONLITERALS_H
 #define _UTIL_JSON_CONSTANTS_JSONLITERALS_H
 
-#include <string>
-#include <regex>
+#include <cstddef>
 
 namespace util
 {
@@ -46,14 +45,19 @@ namespace util
 				static constexpr const char* NULL_LITERAL = "null";
 
 				///
-				/// regex pattern for parsing number literals
+				/// Tests if the given characters form a JSON number literal.
 				///
-				static constexpr const char* NUMBER_PATTERN_STRING = "^-?(0|[1-9]\\d*)(\\.\\d+)?([eE][+-]?\\d+)?$";
-
+				/// @par
+				/// The grammar follows https://tools.ietf.org/html/rfc8259#section-6 and is equal to the regular
+				/// expression @c ^-?(0|[1-9]\d*)(\.\d+)?([eE][+-]?\d+)?$
+				///
+				/// @param[in] literal the characters to test, which do not need to be null terminated
+				/// @param[in] literalLength the number of characters in @c literal
+				/// @param[out] isInteger set to @c true if the literal has neither a fraction nor an exponent part
 				///
-				/// Get sole instance of JSON number pattern regex.
+				/// @return @c true if the characters form a number literal, @c false otherwise
 				///
-				static const std::regex& getNumberPattern();
+				static bool isNumberLiteral(const char* literal, size_t literalLength, bool& isInteger);
 			};
 		}
 	}
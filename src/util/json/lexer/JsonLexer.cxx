@@ -17,21 +17,18 @@
 #include "util/json/lexer/JsonLexer.h"
 #include "util/json/lexer/JsonLexerConstants.h"
 #include "util/json/constants/JsonLiterals.h"
-#include "util/json/reader/DefaultResettableReader.h"
 #include "core/util/StringUtil.h"
 
-#include <iomanip>
+#include <cstdio>
+#include <cstring>
 
 using namespace util::json::lexer;
 
 
-JsonLexer::JsonLexer(const std::string& input)
-	: JsonLexer(std::make_shared<util::json::reader::DefaultResettableReader>(input))
-{
-}
-
-JsonLexer::JsonLexer(const JsonLexer::ReaderPtr input)
-	: mReader(input)
+JsonLexer::JsonLexer(std::string input)
+	: mInput(std::move(input))
+	, mPosition(0)
+	, mValueToken(JsonToken::createStringToken("", 0))
 {
 }
 
@@ -39,7 +36,7 @@ JsonLexer::~JsonLexer()
 {
 }
 
-const JsonLexer::JsonTokenPtr JsonLexer::nextToken()
+const JsonToken* JsonLexer::nextToken()
 {
 	if (mLexerState == JsonLexerState::ERROR)
 	{
@@ -53,7 +50,7 @@ const JsonLexer::JsonTokenPtr JsonLexer::nextToken()
 
 	// "Insignificant whitespace is allowed before or after any of the six structural characters."
 	// (https://tools.ietf.org/html/rfc8259#section-2), therefore consume all whitespace characters
-	JsonTokenPtr nextToken;
+	const JsonToken* nextToken;
 	try
 	{
 		bool isEndOfFileReached = consumeWhitespaceCharacters();
@@ -68,180 +65,183 @@ const JsonLexer::JsonTokenPtr JsonLexer::nextToken()
 			nextToken = doParseNextToken();
 		}
 	}
-	catch (JsonLexerException& e)
-	{
-		mLexerState = JsonLexerState::ERROR;
-		throw e;
-	}
-	catch (std::ios_base::failure&)
+	catch (JsonLexerException&)
 	{
 		mLexerState = JsonLexerState::ERROR;
-		std::throw_with_nested(JsonLexerException("Exception when reading from input stream"));
+		throw;
 	}
 
 	return nextToken;
 }
 
-const JsonLexer::JsonTokenPtr JsonLexer::doParseNextToken()
+const JsonToken* JsonLexer::doParseNextToken()
 {
 	// parse next character
-	mReader->mark(1);
-	char nextChar = static_cast<char>(mReader->read());
+	char nextChar = mInput[mPosition];
 
 	switch (nextChar)
 	{
 		case LEFT_SQUARE_BRACKET:
+			mPosition++;
 			return JsonToken::leftSquareBracketToken();
 		case RIGHT_SQUARE_BRACKET:
+			mPosition++;
 			return JsonToken::rightSquareBracketToken();
 		case LEFT_BRACE:
+			mPosition++;
 			return JsonToken::leftBraceToken();
 		case RIGHT_BRACE:
+			mPosition++;
 			return JsonToken::rightBraceToken();
 		case COLON:
+			mPosition++;
 			return JsonToken::colonToken();
 		case COMMA:
+			mPosition++;
 			return JsonToken::commaToken();
 		case TRUE_LITERAL_START: // fallthrough
 		case FALSE_LITERAL_START:
 			// could be a boolean literal (true|false)
-			mReader->reset();
 			return tryParseBooleanLiteral();
 		case NULL_LITERAL_START:
 			// could be null literal
-			mReader->reset();
 			return tryParseNullLiteral();
 		case QUOTATION_MARK:
 			// string value - omit the starting "
+			mPosition++;
 			return tryParseStringToken();
 		default:
 			// check if it is a number or a completely unknown token
 			if(isDigitOrMinus(nextChar))
 			{
-				mReader->reset();
 				return tryParseNumberToken();
 			}
 			else
 			{
-				mReader->reset();
-				std::string literalToken = parseLiteral();
-				throw JsonLexerException(unexpectedLiteralTokenMessage(literalToken));
+				auto literalStart = mPosition;
+				auto literalLength = parseLiteral();
+				throw JsonLexerException(unexpectedLiteralTokenMessage(mInput.substr(literalStart, literalLength)));
 			}
 	}
 }
 
-const JsonLexer::JsonTokenPtr JsonLexer::tryParseBooleanLiteral()
+const JsonToken* JsonLexer::tryParseBooleanLiteral()
 {
-	auto literal = parseLiteral();
-	if (literal == util::json::constants::JsonLiterals::BOOLEAN_TRUE_LITERAL)
+	auto literalStart = mPosition;
+	auto literalLength = parseLiteral();
+	if (isLiteral(mInput.data() + literalStart, literalLength, util::json::constants::JsonLiterals::BOOLEAN_TRUE_LITERAL))
 	{
 		return JsonToken::booleanTrueToken();
 	}
-	else if (literal == util::json::constants::JsonLiterals::BOOLEAN_FALSE_LITERAL)
+	else if (isLiteral(mInput.data() + literalStart, literalLength, util::json::constants::JsonLiterals::BOOLEAN_FALSE_LITERAL))
 	{
 		return JsonToken::booleanFalseToken();
 	}
 
 	// not a valid boolean literal
-	throw JsonLexerException(unexpectedLiteralTokenMessage(literal));
+	throw JsonLexerException(unexpectedLiteralTokenMessage(mInput.substr(literalStart, literalLength)));
 }
 
-const JsonLexer::JsonTokenPtr JsonLexer::tryParseNullLiteral()
+const JsonToken* JsonLexer::tryParseNullLiteral()
 {
-	auto literal = parseLiteral();
-	if (literal == util::json::constants::JsonLiterals::NULL_LITERAL)
+	auto literalStart = mPosition;
+	auto literalLength = parseLiteral();
+	if (isLiteral(mInput.data() + literalStart, literalLength, util::json::constants::JsonLiterals::NULL_LITERAL))
 	{
 		return JsonToken::nullToken();
 	}
 
 	// not a valid null literal
-	throw JsonLexerException(unexpectedLiteralTokenMessage(literal));
+	throw JsonLexerException(unexpectedLiteralTokenMessage(mInput.substr(literalStart, literalLength)));
 }
 
-const JsonLexer::JsonTokenPtr JsonLexer::tryParseStringToken()
+const JsonToken* JsonLexer::tryParseStringToken()
 {
-	auto stringValueStream = std::stringstream();
-	auto nextChar = mReader->read();
+	// decoded characters are written back to the input, which is safe since the decoded representation of a string
+	// is never longer than its escaped representation
+	auto stringStart = mPosition;
+	auto writePosition = mPosition;
 
-	while (nextChar != EOF  && nextChar != QUOTATION_MARK)
+	while (mPosition < mInput.size())
 	{
+		auto nextChar = static_cast<unsigned char>(mInput[mPosition]);
+		if (nextChar == QUOTATION_MARK)
+		{
+			// string is properly terminated
+			mPosition++;
+			mValueToken = JsonToken::createStringToken(mInput.data() + stringStart, writePosition - stringStart);
+			return &mValueToken;
+		}
+
 		if (isEscapeCharacter(nextChar))
 		{
-			tryParseEscapeSequence(stringValueStream);
+			mPosition++;
+			tryParseEscapeSequence(stringStart, writePosition);
 		}
 		else if (isCharacterThatNeedsEscaping(nextChar))
 		{
-			std::ostringstream os;
-			os << "Invalid control character \"\\u" << std::hex << std::setw(4) << std::setfill('0') << std::uppercase << nextChar << "\"";
-			throw JsonLexerException(os.str());
+			char message[40];
+			std::snprintf(message, sizeof(message), "Invalid control character \"\\u%04X\"", nextChar);
+			throw JsonLexerException(message);
 		}
 		else
 		{
-			stringValueStream << static_cast<char>(nextChar);
+			if (writePosition != mPosition)
+			{
+				mInput[writePosition] = mInput[mPosition];
+			}
+			writePosition++;
+			mPosition++;
 		}
-
-		nextChar = mReader->read();
 	}
 
-	auto stringValue = stringValueStream.str();
+	// string is not properly terminated because the end of the input was reached
+	throw JsonLexerException("Unterminated string literal \"" + mInput.substr(stringStart, writePosition - stringStart) + "\"");
+}
 
-	if (nextChar != EOF)
+void JsonLexer::tryParseEscapeSequence(size_t stringStart, size_t& writePosition)
+{
+	if (mPosition >= mInput.size())
 	{
-		// string is properly terminated
-		return JsonToken::createStringToken(stringValue);
+		throw JsonLexerException("Unterminated string literal \"" + mInput.substr(stringStart, writePosition - stringStart) + "\"");
 	}
 
-	// string is not properly terminated because EOF was reached
-	throw JsonLexerException("Unterminated string literal \"" + stringValue + "\"");
-}
-
-void JsonLexer::tryParseEscapeSequence(std::stringstream& literalString)
-{
-	auto nextChar = mReader->read();
+	auto nextChar = mInput[mPosition++];
 
 	switch (nextChar)
 	{
-		case EOF:
-			throw JsonLexerException("Unterminated string literal \"" + literalString.str() + "\"");
 		case QUOTATION_MARK:  // fallthrough
 		case REVERSE_SOLIDUS: // fallthrough
 		case SOLIDUS:
-			literalString << static_cast<char>(nextChar);
+			mInput[writePosition++] = nextChar;
 			break;
 		case 'b':
-			literalString << BACKSPACE;
+			mInput[writePosition++] = BACKSPACE;
 			break;
 		case 'f':
-			literalString << FORM_FEED;
+			mInput[writePosition++] = FORM_FEED;
 			break;
 		case 'n':
-			literalString << LINE_FEED;
+			mInput[writePosition++] = LINE_FEED;
 			break;
 		case 'r':
-			literalString << CARRIAGE_RETURN;
+			mInput[writePosition++] = CARRIAGE_RETURN;
 			break;
 		case 't':
-			literalString << HORIZONTAL_TAB;
+			mInput[writePosition++] = HORIZONTAL_TAB;
 			break;
 		case 'u':
-			tryParseUnicodeEscapeSequence(literalString);
+			tryParseUnicodeEscapeSequence(writePosition);
 			break;
 		default:
-			std::ostringstream os;
-			os << "Invalid escape sequence \"\\" << static_cast<char>(nextChar) << "\"";
-			throw JsonLexerException(os.str());
+			throw JsonLexerException(std::string("Invalid escape sequence \"\\") + nextChar + "\"");
 	}
 }
 
-void JsonLexer::tryParseUnicodeEscapeSequence(std::stringstream& literalString)
+void JsonLexer::tryParseUnicodeEscapeSequence(size_t& writePosition)
 {
-	auto unicodeSequence = readUnicodeEscapeSequence();
-
-	// parse out the hex character
-	auto parsedInt = std::strtol(unicodeSequence.c_str(), nullptr, 16);
-
-	unsigned char parsedIntHighPart = (0xFF00 & parsedInt) >> 8;
-	unsigned char parsedIntLowPart = 0x00FF & parsedInt;
+	auto sequenceStart = mPosition;
+	auto parsedInt = readUnicodeEscapeSequence();
 
 	if (core::util::StringUtil::isHighSurrogateCharacter(parsedInt))
 	{
@@ -250,133 +250,118 @@ void JsonLexer::tryParseUnicodeEscapeSequence(std::stringstream& literalString)
 		auto lowSurrogate = tryParseLowSurrogateChar(hasParsedLowSurrogateChar);
 		if (!hasParsedLowSurrogateChar || !core::util::StringUtil::isLowSurrogateCharacter(lowSurrogate))
 		{
-			throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + unicodeSequence + "\"");
+			throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + mInput.substr(sequenceStart, static_cast<size_t>(NUM_UNICODE_CHARACTERS)) + "\"");
 		}
 
 		// convert UTF-16 surrogate pair to proper UTF-8 representation
-		std::u16string surrogatePairString{ static_cast<char16_t >(parsedInt), static_cast<char16_t>(lowSurrogate) };
-		auto convertedSurrogatePair = core::util::StringUtil::convertUtf16StringToUtf8String(surrogatePairString);
-
-		literalString << convertedSurrogatePair;
+		auto codePoint = 0x10000 + ((parsedInt - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+		mInput[writePosition++] = static_cast<char>(0xF0 | (codePoint >> 18));
+		mInput[writePosition++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+		mInput[writePosition++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		mInput[writePosition++] = static_cast<char>(0x80 | (codePoint & 0x3F));
 	}
 	else if (core::util::StringUtil::isLowSurrogateCharacter(parsedInt))
 	{
 		// low surrogate character without previous high surrogate
-		throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + unicodeSequence + "\"");
+		throw JsonLexerException("Invalid UTF-16 surrogate pair \"\\u" + mInput.substr(sequenceStart, static_cast<size_t>(NUM_UNICODE_CHARACTERS)) + "\"");
 	}
 	else
 	{
+		unsigned char parsedIntHighPart = (0xFF00 & parsedInt) >> 8;
+		unsigned char parsedIntLowPart = 0x00FF & parsedInt;
+
 		if (parsedIntHighPart)
 		{
-			literalString << parsedIntHighPart;
+			mInput[writePosition++] = static_cast<char>(parsedIntHighPart);
 		}
 
-		literalString << parsedIntLowPart;
+		mInput[writePosition++] = static_cast<char>(parsedIntLowPart);
 	}
 }
 
 int32_t JsonLexer::tryParseLowSurrogateChar(bool& isSuccess)
 {
-	mReader->mark(1);
-
-	if (mReader->read() == REVERSE_SOLIDUS && mReader->read() == 'u')
+	if (mPosition + 1 < mInput.size() && mInput[mPosition] == REVERSE_SOLIDUS && mInput[mPosition + 1] == 'u')
 	{
-		auto unicodeSequence = readUnicodeEscapeSequence();
-		auto lowSurrogateChar = static_cast<int32_t>(strtol(unicodeSequence.c_str(), nullptr, 16));
+		mPosition += 2;
 		isSuccess = true;
-		return lowSurrogateChar;
+		return readUnicodeEscapeSequence();
 	}
 
 	isSuccess = false;
-	mReader->reset();
 	return -1;
 }
 
-std::string JsonLexer::readUnicodeEscapeSequence()
+int32_t JsonLexer::readUnicodeEscapeSequence()
 {
-	auto stream = std::stringstream();
+	auto sequenceStart = mPosition;
+	int32_t parsedInt = 0;
 
-	auto nextChar = mReader->read();
-	while (nextChar != EOF && stream.tellp() < NUM_UNICODE_CHARACTERS)
+	while (mPosition < mInput.size() && mPosition - sequenceStart < static_cast<size_t>(NUM_UNICODE_CHARACTERS))
 	{
+		auto nextChar = mInput[mPosition];
 		if (!isHexCharacter(nextChar))
 		{
-			throw JsonLexerException("Invalid unicode escape sequence \"\\u" + stream.str() + static_cast<char>(nextChar) + "\"");
+			throw JsonLexerException("Invalid unicode escape sequence \"\\u" + mInput.substr(sequenceStart, mPosition - sequenceStart) + nextChar + "\"");
 		}
 
-		stream << static_cast<char>(nextChar);
-
-		mReader->mark(1);
-		nextChar = mReader->read();
+		parsedInt = (parsedInt << 4) | hexCharacterValue(nextChar);
+		mPosition++;
 	}
 
-	if (nextChar == EOF)
+	if (mPosition >= mInput.size())
 	{
-		// string is not properly terminated, because EOF was reached
-		throw JsonLexerException("Unterminated string literal \"\\u" + stream.str() + "\"");
+		// string is not properly terminated, because the end of the input was reached
+		throw JsonLexerException("Unterminated string literal \"\\u" + mInput.substr(sequenceStart, mPosition - sequenceStart) + "\"");
 	}
 
 	// 4 hex characters were parsed
-	mReader->reset();
-
-	return stream.str();
+	return parsedInt;
 }
 
-JsonLexer::JsonTokenPtr JsonLexer::tryParseNumberToken()
+const JsonToken* JsonLexer::tryParseNumberToken()
 {
-	auto literal = parseLiteral();
+	auto literalStart = mPosition;
+	auto literalLength = parseLiteral();
 
-	if (std::regex_match(literal, util::json::constants::JsonLiterals::getNumberPattern()))
+	bool isInteger = false;
+	if (util::json::constants::JsonLiterals::isNumberLiteral(mInput.data() + literalStart, literalLength, isInteger))
 	{
-		return JsonToken::createNumberToken(literal);
+		mValueToken = JsonToken::createNumberToken(mInput.data() + literalStart, literalLength);
+		return &mValueToken;
 	}
 
 	// not a valid number literal
-	throw JsonLexerException("Invalid number literal \"" + literal + "\"");
+	throw JsonLexerException("Invalid number literal \"" + mInput.substr(literalStart, literalLength) + "\"");
 }
 
-const std::string JsonLexer::parseLiteral()
+size_t JsonLexer::parseLiteral()
 {
-	auto literalStream = std::stringstream();
-
-	mReader->mark(1);
-	auto chr = mReader->read();
+	auto literalStart = mPosition;
 
-	while (chr != EOF && !isJsonWhitespaceCharacter(chr) && !isJsonStructuralCharacter(chr))
+	while (mPosition < mInput.size()
+		&& !isJsonWhitespaceCharacter(mInput[mPosition])
+		&& !isJsonStructuralCharacter(mInput[mPosition]))
 	{
-		literalStream << static_cast<char>(chr);
-
-		mReader->mark(1);
-		chr = mReader->read();
+		mPosition++;
 	}
 
-	if (chr != EOF)
-	{
-		// reset read position, which might be a whitespace or structural character
-		mReader->reset();
-	}
-
-	return literalStream.str();
+	return mPosition - literalStart;
 }
 
 bool JsonLexer::consumeWhitespaceCharacters()
 {
-	int32_t chr;
-	do
+	while (mPosition < mInput.size() && isJsonWhitespaceCharacter(mInput[mPosition]))
 	{
-		mReader->mark(1);
-		chr = mReader->read();
+		mPosition++;
 	}
-	while (chr != EOF && isJsonWhitespaceCharacter(chr));
 
-	if (chr != EOF)
-	{
-		// reset read position to the first non-whitespace character
-		mReader->reset();
-		return false;
-	}
+	return mPosition >= mInput.size();
+}
 
-	return true;
+bool JsonLexer::isLiteral(const char* chars, size_t length, const char* literal)
+{
+	return std::strlen(literal) == length && std::memcmp(chars, literal, length) == 0;
 }
 
 bool JsonLexer::isJsonWhitespaceCharacter(int32_t chr)
@@ -433,7 +418,20 @@ bool JsonLexer::isHexCharacter(int32_t chr)
 		|| (chr >= 'A' && chr <= 'F');
 }
 
-std::string JsonLexer::unexpectedLiteralTokenMessage(std::string& literalToken)
+int32_t JsonLexer::hexCharacterValue(int32_t chr)
+{
+	if (chr >= '0' && chr <= '9')
+	{
+		return chr - '0';
+	}
+	if (chr >= 'a' && chr <= 'f')
+	{
+		return chr - 'a' + 10;
+	}
+	return chr - 'A' + 10;
+}
+
+std::string JsonLexer::unexpectedLiteralTokenMessage(const std::string& literalToken)
 {
 	return "Unexpected literal \"" + literalToken + "\"";
 }
\ No newline at end of file
@@ -20,11 +20,9 @@
 #include "util/json/lexer/JsonLexerState.h"
 #include "util/json/lexer/JsonToken.h"
 #include "util/json/lexer/JsonLexerException.h"
-#include "util/json/reader/IResettableReader.h"
 
 #include <string>
-#include <sstream>
-#include <memory>
+#include <cstddef>
 
 namespace util
 {
@@ -32,11 +30,15 @@ namespace util
 	{
 		namespace lexer
 		{
+			///
+			/// Lexical analyzer splitting a JSON string into @ref JsonToken "tokens"
+			///
+			/// @par
+			/// The lexer scans its own copy of the input in a single pass. Tokens refer to the characters of this
+			/// buffer, escape sequences in strings are decoded in place, so no token value is copied.
+			///
 			class JsonLexer
 			{
-				using ReaderPtr = std::shared_ptr<util::json::reader::IResettableReader>;
-				using JsonTokenPtr = std::shared_ptr<JsonToken>;
-
 			public: // functions
 
 				///
@@ -49,21 +51,17 @@ namespace util
 				///
 				/// @param input JSON string for lexical analysis
 				///
-				JsonLexer(const std::string& input);
-
-				///
-				/// Constructor taking a @ref IResettableReader from where to read the JSON data
-				///
-				/// @param input a reader @ref IResettableReader "reader" instance from where to read the JSON data
-				///
-				JsonLexer(const ReaderPtr input);
+				JsonLexer(std::string input);
 
 				///
 				/// Returns the next token, or @c nullptr if no next token is available.
 				///
+				/// @par
+				/// The returned token, including its value, is only valid until the next call of this function.
+				///
 				/// @return the next @ref JsonToken or @c nullptr if there is no such token.
 				///
-				virtual const JsonTokenPtr nextToken();
+				virtual const JsonToken* nextToken();
 
 			private: // members
 
@@ -73,9 +71,19 @@ namespace util
 				JsonLexerState mLexerState = JsonLexerState::INITIAL;
 
 				///
-				/// the reader from where to read the JSON input
+				/// the JSON input, which is also used as storage for decoded string tokens
+				///
+				std::string mInput;
+
+				///
+				/// position of the next character to read from @ref mInput
+				///
+				size_t mPosition;
+
+				///
+				/// token returned for string and number values
 				///
-				ReaderPtr mReader;
+				JsonToken mValueToken;
 
 			private: // functions
 
@@ -83,13 +91,13 @@ namespace util
 				/// Parses a token after all whitespace characters were consumed.
 				///
 				/// @par
-				///  It must be guaranteed that the first character is
+				///  It must be guaranteed that the current character is
 				///  @li a non-whitespace character
-				///  @li not EOF (integer value -1)
+				///  @li not the end of the input
 				///
 				/// @return the next token
 				///
-				const JsonTokenPtr doParseNextToken();
+				const JsonToken* doParseNextToken();
 
 				///
 				/// Tries to parse a boolean literal, which is either true or false with all lower case characters.
@@ -99,7 +107,7 @@ namespace util
 				///
 				/// @return the parsed @ref JsonToken
 				///
-				const JsonTokenPtr tryParseBooleanLiteral();
+				const JsonToken* tryParseBooleanLiteral();
 
 				///
 				/// Try to parse a null literal
@@ -108,49 +116,54 @@ namespace util
 				///
 				/// @return the parsed @ref JsonToken
 				///
-				const JsonTokenPtr tryParseNullLiteral();
+				const JsonToken* tryParseNullLiteral();
 
 				///
-				/// Try to parse a JSON string token
+				/// Try to parse a JSON string token, starting right after the opening quotation mark
 				///
 				/// @return the parsed string token
 				///
-				const JsonTokenPtr tryParseStringToken();
+				const JsonToken* tryParseStringToken();
 
 				///
-				/// Tries to parse an escape sequence
+				/// Tries to parse an escape sequence, starting right after the escape character
+				///
+				/// @param[in] stringStart position of the string's first character in @ref mInput
+				/// @param[in,out] writePosition position in @ref mInput where to store the decoded character(s)
 				///
-				void tryParseEscapeSequence(std::stringstream& literalString);
+				void tryParseEscapeSequence(size_t stringStart, size_t& writePosition);
 
 				///
 				/// Tries to parse a unicode escape sequence.
 				///
-				void tryParseUnicodeEscapeSequence(std::stringstream& literalString);
+				/// @param[in,out] writePosition position in @ref mInput where to store the decoded character(s)
+				///
+				void tryParseUnicodeEscapeSequence(size_t& writePosition);
 
 				///
 				/// Tries to parse a low surrogate UTF-16 character
 				///
-				/// @param[out] isSuccess indicates if the parsed character is a low surrogate character
-				/// @return the low surrogate character or @c nullptr if the first two characters are not the start of
+				/// @param[out] isSuccess indicates if the next characters are the start of a unicode escape sequence
+				/// @return the low surrogate character or @c -1 if the first two characters are not the start of
 				///   a unicode escape sequence.
 				///
 				int32_t tryParseLowSurrogateChar(bool& isSuccess);
 
 				///
-				/// Reads a unicode escape sequence and returns the read data
+				/// Reads a unicode escape sequence and returns the read character
 				///
 				/// @par
 				///   A unicode escape sequence is a 4 character long sequence where each of those 4 characters is a
 				///   hex (base-16) character. The characters a-f may be lower, upper or mixed case.
 				///
-				std::string readUnicodeEscapeSequence();
+				int32_t readUnicodeEscapeSequence();
 
 				///
 				/// Tries to parse a number token.
 				///
 				/// @return the parsed number token
 				///
-				JsonTokenPtr tryParseNumberToken();
+				const JsonToken* tryParseNumberToken();
 
 				///
 				/// Parses a literal
@@ -159,19 +172,30 @@ namespace util
 				///  A literal is considered to be terminated by eiter
 				///  @li one of the four whitespace characters
 				///  @li one of the six structural characters
+				///  @li the end of the input
 				///
-				/// @return the parsed literal string
+				/// @return the number of characters of the literal starting at the current position
 				///
-				const std::string parseLiteral();
+				size_t parseLiteral();
 
 				///
-				/// Consumes all whitespace characters from the @ref IResettableReader until the first non-whitespace is
-				/// encountered.
+				/// Consumes all whitespace characters until the first non-whitespace is encountered.
 				///
-				/// @return @c true if EOF (end of file) is reached, @c false otherwise.
+				/// @return @c true if the end of the input is reached, @c false otherwise.
 				///
 				bool consumeWhitespaceCharacters();
 
+				///
+				/// Tests if the given characters are equal to the given null terminated literal
+				///
+				/// @param chars the characters to test
+				/// @param length the number of characters in @c chars
+				/// @param literal the literal to compare with
+				///
+				/// @return @c true if the characters are equal to the literal, @c false otherwise
+				///
+				static bool isLiteral(const char* chars, size_t length, const char* literal);
+
 				///
 				/// Tests if the given character is a JSON whitespace character according to RFC 8259
 				///
@@ -236,6 +260,14 @@ namespace util
 				///
 				static bool isHexCharacter(int32_t chr);
 
+				///
+				/// Helper method to return the value of a hex character
+				///
+				/// @param chr the hex character, which must satisfy @ref isHexCharacter
+				/// @return the value of the hex character in range [0, 15]
+				///
+				static int32_t hexCharacterValue(int32_t chr);
+
 				///
 				/// Helper method to return the "unexpected literal" exception message
 				///
@@ -245,7 +277,7 @@ namespace util
 				/// @param literalToken the unexpected literal token
 				/// @return an error message for an exception
 				///
-				static std::string unexpectedLiteralTokenMessage(std::string& literalToken);
+				static std::string unexpectedLiteralTokenMessage(const std::string& literalToken);
 			};
 		}
 	}
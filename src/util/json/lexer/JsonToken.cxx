@@ -19,103 +19,99 @@
 #include "util/json/lexer/JsonLexerException.h"
 #include "util/json/constants/JsonLiterals.h"
 
-#include <sstream>
+#include <cstring>
 
 using namespace util::json::lexer;
 using namespace util::json::constants;
 
 
-const std::shared_ptr<JsonToken> JsonToken::booleanTrueToken()
+const JsonToken* JsonToken::booleanTrueToken()
 {
-	static const auto booleanTrueToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::LITERAL_BOOLEAN, JsonLiterals::BOOLEAN_TRUE_LITERAL));
+	static const JsonToken booleanTrueToken(JsonTokenType::LITERAL_BOOLEAN,
+		JsonLiterals::BOOLEAN_TRUE_LITERAL, std::strlen(JsonLiterals::BOOLEAN_TRUE_LITERAL));
 
-	return booleanTrueToken;
+	return &booleanTrueToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::booleanFalseToken()
+const JsonToken* JsonToken::booleanFalseToken()
 {
-	static const auto booleanFalseToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::LITERAL_BOOLEAN, JsonLiterals::BOOLEAN_FALSE_LITERAL));
+	static const JsonToken booleanFalseToken(JsonTokenType::LITERAL_BOOLEAN,
+		JsonLiterals::BOOLEAN_FALSE_LITERAL, std::strlen(JsonLiterals::BOOLEAN_FALSE_LITERAL));
 
-	return booleanFalseToken;
+	return &booleanFalseToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::nullToken()
+const JsonToken* JsonToken::nullToken()
 {
-	static const auto nullToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::LITERAL_NULL, JsonLiterals::NULL_LITERAL));
+	static const JsonToken nullToken(JsonTokenType::LITERAL_NULL,
+		JsonLiterals::NULL_LITERAL, std::strlen(JsonLiterals::NULL_LITERAL));
 
-	return nullToken;
+	return &nullToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::leftBraceToken()
+const JsonToken* JsonToken::leftBraceToken()
 {
-	static const auto leftBraceToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::LEFT_BRACE));
+	static const JsonToken leftBraceToken(JsonTokenType::LEFT_BRACE);
 
-	return leftBraceToken;
+	return &leftBraceToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::rightBraceToken()
+const JsonToken* JsonToken::rightBraceToken()
 {
-	static const auto rightBraceToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::RIGHT_BRACE));
+	static const JsonToken rightBraceToken(JsonTokenType::RIGHT_BRACE);
 
-	return rightBraceToken;
+	return &rightBraceToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::leftSquareBracketToken()
+const JsonToken* JsonToken::leftSquareBracketToken()
 {
-	static const auto leftSquareBracketToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::LEFT_SQUARE_BRACKET));
+	static const JsonToken leftSquareBracketToken(JsonTokenType::LEFT_SQUARE_BRACKET);
 
-	return leftSquareBracketToken;
+	return &leftSquareBracketToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::rightSquareBracketToken()
+const JsonToken* JsonToken::rightSquareBracketToken()
 {
-	static const auto rightSquareBracketToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::RIGHT_SQUARE_BRACKET));
+	static const JsonToken rightSquareBracketToken(JsonTokenType::RIGHT_SQUARE_BRACKET);
 
-	return rightSquareBracketToken;
+	return &rightSquareBracketToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::commaToken()
+const JsonToken* JsonToken::commaToken()
 {
-	static const auto commaToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::COMMA));
+	static const JsonToken commaToken(JsonTokenType::COMMA);
 
-	return commaToken;
+	return &commaToken;
 }
 
-const std::shared_ptr<JsonToken> JsonToken::colonToken()
+const JsonToken* JsonToken::colonToken()
 {
-	static const auto colonToken
-		= std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::COLON));
+	static const JsonToken colonToken(JsonTokenType::COLON);
 
-	return colonToken;
+	return &colonToken;
 }
 
 
 JsonToken::JsonToken(JsonTokenType tokenType)
-	: JsonToken(tokenType, "")
+	: JsonToken(tokenType, "", 0)
 {
 }
 
-JsonToken::JsonToken(const JsonTokenType tokenType, const std::string& value)
-	: mTokenType(tokenType), mValue(value)
+JsonToken::JsonToken(const JsonTokenType tokenType, const char* value, size_t valueLength)
+	: mTokenType(tokenType)
+	, mValue(value)
+	, mValueLength(valueLength)
 {
 }
 
-std::shared_ptr<JsonToken> JsonToken::createStringToken(const std::string& stringValue)
+JsonToken JsonToken::createStringToken(const char* stringValue, size_t stringValueLength)
 {
-	return std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::VALUE_STRING, stringValue));
+	return JsonToken(JsonTokenType::VALUE_STRING, stringValue, stringValueLength);
 }
 
-std::shared_ptr<JsonToken> JsonToken::createNumberToken(const std::string& numericValue)
+JsonToken JsonToken::createNumberToken(const char* numericValue, size_t numericValueLength)
 {
-	return std::shared_ptr<JsonToken>(new JsonToken(JsonTokenType::VALUE_NUMBER, numericValue));
+	return JsonToken(JsonTokenType::VALUE_NUMBER, numericValue, numericValueLength);
 }
 
 JsonTokenType JsonToken::getTokenType() const
@@ -123,17 +119,28 @@ JsonTokenType JsonToken::getTokenType() const
 	return mTokenType;
 }
 
-const std::string& JsonToken::getValue() const
+const std::string JsonToken::getValue() const
+{
+	return std::string(mValue, mValueLength);
+}
+
+const char* JsonToken::getValueData() const
 {
 	return mValue;
 }
 
+size_t JsonToken::getValueLength() const
+{
+	return mValueLength;
+}
+
 const std::string JsonToken::toString() const
 {
-	std::stringstream stream;
-	stream << "JsonToken {tokenType=" << tokenTypeToString(mTokenType) << ", value=" << mValue << "}";
+	std::string result = "JsonToken {tokenType=" + tokenTypeToString(mTokenType) + ", value=";
+	result.append(mValue, mValueLength);
+	result.push_back('}');
 
-	return stream.str();
+	return result;
 }
 
 const std::string JsonToken::tokenTypeToString(JsonTokenType tokeType)
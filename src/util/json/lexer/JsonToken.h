@@ -20,7 +20,7 @@
 #include "util/json/lexer/JsonTokenType.h"
 
 #include <string>
-#include <memory>
+#include <cstddef>
 
 namespace util
 {
@@ -31,6 +31,10 @@ namespace util
 			///
 			/// Container class representing a token
 			///
+			/// @par
+			/// A token does not own its value, but refers to the characters in the buffer of the
+			/// @ref util::json::lexer::JsonLexer "JSON lexer", which stay valid until the next token is read.
+			///
 			class JsonToken
 			{
 
@@ -39,63 +43,65 @@ namespace util
 				///
 				/// @ref JsonToken to be used for boolean @c true literal
 				///
-				static const std::shared_ptr<JsonToken> booleanTrueToken();
+				static const JsonToken* booleanTrueToken();
 
 				///
 				/// @ref JsonToken to be used for boolean @c false literal
 				///
-				static const std::shared_ptr<JsonToken> booleanFalseToken();
+				static const JsonToken* booleanFalseToken();
 
 				///
 				/// @ref JsonToken to be used for null literal
 				///
-				static const std::shared_ptr<JsonToken> nullToken();
+				static const JsonToken* nullToken();
 
 				///
 				/// @ref JsonToken to be used for left brace
 				///
-				static const std::shared_ptr<JsonToken> leftBraceToken();
+				static const JsonToken* leftBraceToken();
 
 				///
 				/// @ref JsonToken to be used for right brace
 				///
-				static const std::shared_ptr<JsonToken> rightBraceToken();
+				static const JsonToken* rightBraceToken();
 
 				///
 				/// @ref JsonToken to be used for left square bracket
 				///
-				static const std::shared_ptr<JsonToken> leftSquareBracketToken();
+				static const JsonToken* leftSquareBracketToken();
 
 				///
 				/// @ref JsonToken to be used for right square bracket
 				///
-				static const std::shared_ptr<JsonToken> rightSquareBracketToken();
+				static const JsonToken* rightSquareBracketToken();
 
 				///
 				/// @ref JsonToken to be used for comma
 				///
-				static const std::shared_ptr<JsonToken> commaToken();
+				static const JsonToken* commaToken();
 
 				///
 				/// @ref JsonToken to be used for colon
 				///
-				static const std::shared_ptr<JsonToken> colonToken();
+				static const JsonToken* colonToken();
 
 			public: // functions
 
 				///
 				/// Create a  @ref JsonToken of type @ref JsonTokenType::VALUE_STRING and the given value.
-				/// @param stringValue  the value to be used for the token
+				/// @param stringValue the (unescaped) characters to be used for the token
+				/// @param stringValueLength the number of characters in @c stringValue
 				/// @return the created token
 				///
-				static std::shared_ptr<JsonToken> createStringToken(const std::string& stringValue);
+				static JsonToken createStringToken(const char* stringValue, size_t stringValueLength);
 
 				///
 				/// Create a new @ref JsonToken of type @ref JsonTokenType::VALUE_NUMBER and the given value.
-				/// @param numericValue the value to be used for the token
+				/// @param numericValue the characters to be used for the token
+				/// @param numericValueLength the number of characters in @c numericValue
 				/// @return the newly created token
 				///
-				static std::shared_ptr<JsonToken> createNumberToken(const std::string& numericValue);
+				static JsonToken createNumberToken(const char* numericValue, size_t numericValueLength);
 
 				///
 				/// Returns the type of this token
@@ -110,7 +116,17 @@ namespace util
 				///
 				/// @return the token value as string
 				///
-				const std::string& getValue() const;
+				const std::string getValue() const;
+
+				///
+				/// Returns the characters of this token's value, which are not null terminated
+				///
+				const char* getValueData() const;
+
+				///
+				/// Returns the number of characters of this token's value
+				///
+				size_t getValueLength() const;
 
 				///
 				/// Returns a string representation of this @ref JsonToken
@@ -129,17 +145,22 @@ namespace util
 				///
 				/// the type of this token
 				///
-				const JsonTokenType mTokenType;
+				JsonTokenType mTokenType;
 
 				///
 				/// token value for primitive tokens
 				///
-				const std::string mValue;
+				const char* mValue;
+
+				///
+				/// number of characters in @ref mValue
+				///
+				size_t mValueLength;
 
 			private: // functions
 
 				///
-				/// Construct the token with the type only and set the value to @c nullptr
+				/// Construct the token with the type only and set the value to an empty string
 				/// @param tokenType type of this token
 				///
 				JsonToken(const JsonTokenType tokenType);
@@ -151,11 +172,13 @@ namespace util
 				/// Instead of using this constructor use either one of the following
 				/// @li the predefined instances
 				/// @li @ref ::createStringToken
+				/// @li @ref ::createNumberToken
 				///
 				/// @param tokenType the type of this token
 				/// @param value value of this token, if it has a value.
+				/// @param valueLength the number of characters in @c value
 				///
-				JsonToken(const JsonTokenType tokenType, const std::string& value);
+				JsonToken(const JsonTokenType tokenType, const char* value, size_t valueLength);
 			};
 		}
 	}
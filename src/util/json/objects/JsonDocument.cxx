@@ -0,0 +1,527 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpenKit/json/JsonDocument.h"
+#include "OpenKit/json/JsonArrayValue.h"
+#include "OpenKit/json/JsonBooleanValue.h"
+#include "OpenKit/json/JsonNumberValue.h"
+#include "OpenKit/json/JsonStringValue.h"
+#include "core/util/StringUtil.h"
+#include "util/json/JsonWriter.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace openkit::json;
+
+constexpr size_t JsonDocument::MAX_INLINE_STRING_LENGTH;
+
+JsonDocument::JsonDocument()
+	: mNodes()
+	, mOpenContainers()
+	, mStrings()
+	, mSize(0)
+{
+}
+
+JsonDocument& JsonDocument::addString(const char* key, const char* value)
+{
+	if (value == nullptr)
+	{
+		return addNull(key);
+	}
+
+	auto node = addNode(NodeType::STRING_VALUE, key);
+	if (node != nullptr)
+	{
+		node->stringValue = storeString(value, strlen(value));
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addString(const char* key, const std::string& value)
+{
+	auto node = addNode(NodeType::STRING_VALUE, key);
+	if (node != nullptr)
+	{
+		node->stringValue = storeString(value.data(), value.size());
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addLong(const char* key, int64_t value)
+{
+	auto node = addNode(NodeType::LONG_VALUE, key);
+	if (node != nullptr)
+	{
+		node->longValue = value;
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addDouble(const char* key, double value)
+{
+	auto node = addNode(NodeType::DOUBLE_VALUE, key);
+	if (node != nullptr)
+	{
+		node->doubleValue = value;
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addBoolean(const char* key, bool value)
+{
+	auto node = addNode(NodeType::BOOLEAN_VALUE, key);
+	if (node != nullptr)
+	{
+		node->booleanValue = value;
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addNull(const char* key)
+{
+	addNode(NodeType::NULL_VALUE, key);
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addValue(const char* key, const JsonValue& value)
+{
+	switch (value.getValueType())
+	{
+		case JsonValueType::NULL_VALUE:
+			addNull(key);
+			break;
+		case JsonValueType::BOOLEAN_VALUE:
+			addBoolean(key, static_cast<const JsonBooleanValue&>(value).getValue());
+			break;
+		case JsonValueType::NUMBER_VALUE:
+		{
+			auto& numberValue = static_cast<const JsonNumberValue&>(value);
+			if (numberValue.isInteger())
+			{
+				addLong(key, numberValue.getLongValue());
+			}
+			else
+			{
+				addDouble(key, numberValue.getDoubleValue());
+			}
+			break;
+		}
+		case JsonValueType::STRING_VALUE:
+			addString(key, static_cast<const JsonStringValue&>(value).getValue());
+			break;
+		case JsonValueType::ARRAY_VALUE:
+			beginArray(key);
+			for (const auto& element : static_cast<const JsonArrayValue&>(value))
+			{
+				if (element != nullptr)
+				{
+					addValue(nullptr, *element);
+				}
+			}
+			endArray();
+			break;
+		case JsonValueType::OBJECT_VALUE:
+			beginObject(key);
+			for (const auto& member : static_cast<const JsonObjectValue&>(value))
+			{
+				if (member.second != nullptr)
+				{
+					addValue(member.first.c_str(), *member.second);
+				}
+			}
+			endObject();
+			break;
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::addMembers(const JsonObjectValue::JsonObjectMap& members)
+{
+	for (const auto& member : members)
+	{
+		if (member.second != nullptr)
+		{
+			addValue(member.first.c_str(), *member.second);
+		}
+	}
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::beginObject(const char* key)
+{
+	addNode(NodeType::OBJECT_BEGIN, key);
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::endObject()
+{
+	endContainer(NodeType::OBJECT_BEGIN);
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::beginArray(const char* key)
+{
+	addNode(NodeType::ARRAY_BEGIN, key);
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::endArray()
+{
+	endContainer(NodeType::ARRAY_BEGIN);
+
+	return *this;
+}
+
+JsonDocument& JsonDocument::appendString(const char* value)
+{
+	return addString(nullptr, value);
+}
+
+JsonDocument& JsonDocument::appendString(const std::string& value)
+{
+	return addString(nullptr, value);
+}
+
+JsonDocument& JsonDocument::appendLong(int64_t value)
+{
+	return addLong(nullptr, value);
+}
+
+JsonDocument& JsonDocument::appendDouble(double value)
+{
+	return addDouble(nullptr, value);
+}
+
+JsonDocument& JsonDocument::appendBoolean(bool value)
+{
+	return addBoolean(nullptr, value);
+}
+
+JsonDocument& JsonDocument::appendNull()
+{
+	return addNull(nullptr);
+}
+
+JsonDocument& JsonDocument::appendObject()
+{
+	return beginObject(nullptr);
+}
+
+JsonDocument& JsonDocument::appendArray()
+{
+	return beginArray(nullptr);
+}
+
+void JsonDocument::clear()
+{
+	mNodes.clear();
+	mOpenContainers.clear();
+	mStrings.clear();
+	mSize = 0;
+}
+
+size_t JsonDocument::size() const
+{
+	return mSize;
+}
+
+bool JsonDocument::empty() const
+{
+	return mSize == 0;
+}
+
+bool JsonDocument::containsKey(const std::string& key) const
+{
+	return containsKey(0, key.data(), key.size());
+}
+
+std::string JsonDocument::toString() const
+{
+	JsonWriter writer;
+	writeJsonString(writer);
+	return writer.toString();
+}
+
+void JsonDocument::writeJsonString(JsonWriter& jsonWriter) const
+{
+	jsonWriter.openObject();
+
+	auto numWritten = size_t(0);
+	for (auto position = firstMember(); position != endMember(); position = nextMember(position))
+	{
+		if (numWritten++ > 0)
+		{
+			jsonWriter.insertElementSeperator();
+		}
+
+		auto& key = mNodes[position].key;
+		jsonWriter.insertKey(getData(key), key.length);
+		jsonWriter.insertKeyValueSeperator();
+		writeNode(jsonWriter, position);
+	}
+
+	jsonWriter.closeObject();
+}
+
+size_t JsonDocument::firstMember() const
+{
+	auto position = size_t(0);
+	while (position < mNodes.size() && mNodes[position].isIgnored)
+	{
+		position = skipNode(position);
+	}
+
+	return position;
+}
+
+size_t JsonDocument::nextMember(size_t position) const
+{
+	do
+	{
+		position = skipNode(position);
+	} while (position < mNodes.size() && mNodes[position].isIgnored);
+
+	return position;
+}
+
+size_t JsonDocument::endMember() const
+{
+	return mNodes.size();
+}
+
+const char* JsonDocument::getMemberKey(size_t position, size_t& keyLength) const
+{
+	auto& key = mNodes[position].key;
+	keyLength = key.length;
+
+	return getData(key);
+}
+
+void JsonDocument::writeMemberValue(JsonWriter& jsonWriter, size_t position) const
+{
+	writeNode(jsonWriter, position);
+}
+
+JsonDocument::Node* JsonDocument::addNode(NodeType type, const char* key)
+{
+	auto isArray = isInArray();
+	auto keyLength = key == nullptr ? size_t(0) : strlen(key);
+
+	auto isIgnored = false;
+	if (!isArray)
+	{
+		// values of an object require a unique key
+		auto firstPosition = mOpenContainers.empty() ? size_t(0) : size_t(mOpenContainers.back()) + 1;
+		isIgnored = key == nullptr || containsKey(firstPosition, key, keyLength);
+	}
+
+	auto isContainer = type == NodeType::OBJECT_BEGIN || type == NodeType::ARRAY_BEGIN;
+	if (isIgnored && !isContainer)
+	{
+		return nullptr;
+	}
+
+	if (!isIgnored && mOpenContainers.empty())
+	{
+		mSize++;
+	}
+
+	Node node;
+	node.type = type;
+	node.isIgnored = isIgnored;
+	node.end = 0;
+	node.key = isArray ? storeString(nullptr, 0) : storeString(key, keyLength);
+	node.longValue = 0;
+	mNodes.push_back(node);
+
+	if (isContainer)
+	{
+		mOpenContainers.push_back(static_cast<uint32_t>(mNodes.size() - 1));
+	}
+
+	return &mNodes.back();
+}
+
+bool JsonDocument::isInArray() const
+{
+	return !mOpenContainers.empty() && mNodes[mOpenContainers.back()].type == NodeType::ARRAY_BEGIN;
+}
+
+bool JsonDocument::containsKey(size_t position, const char* key, size_t keyLength) const
+{
+	while (position < mNodes.size() && mNodes[position].type != NodeType::CONTAINER_END)
+	{
+		auto& node = mNodes[position];
+		if (!node.isIgnored && node.key.length == keyLength && memcmp(getData(node.key), key, keyLength) == 0)
+		{
+			return true;
+		}
+
+		position = skipNode(position);
+	}
+
+	return false;
+}
+
+JsonDocument::StringRef JsonDocument::storeString(const char* data, size_t length)
+{
+	StringRef string;
+	string.length = static_cast<uint32_t>(length);
+
+	if (length <= MAX_INLINE_STRING_LENGTH)
+	{
+		if (length > 0)
+		{
+			memcpy(string.inlineData, data, length);
+		}
+	}
+	else
+	{
+		string.offset = static_cast<uint32_t>(mStrings.size());
+		mStrings.append(data, length);
+	}
+
+	return string;
+}
+
+const char* JsonDocument::getData(const StringRef& string) const
+{
+	return string.length <= MAX_INLINE_STRING_LENGTH ? string.inlineData : mStrings.data() + string.offset;
+}
+
+void JsonDocument::endContainer(NodeType type)
+{
+	if (mOpenContainers.empty() || mNodes[mOpenContainers.back()].type != type)
+	{
+		return;
+	}
+
+	Node node;
+	node.type = NodeType::CONTAINER_END;
+	node.isIgnored = false;
+	node.end = 0;
+	node.key = storeString(nullptr, 0);
+	node.longValue = 0;
+	mNodes.push_back(node);
+
+	mNodes[mOpenContainers.back()].end = static_cast<uint32_t>(mNodes.size() - 1);
+	mOpenContainers.pop_back();
+}
+
+size_t JsonDocument::skipNode(size_t position) const
+{
+	auto& node = mNodes[position];
+	if (node.type == NodeType::OBJECT_BEGIN || node.type == NodeType::ARRAY_BEGIN)
+	{
+		// containers which are not finished yet extend up to the end of the document
+		return node.end == 0 ? mNodes.size() : size_t(node.end) + 1;
+	}
+
+	return position + 1;
+}
+
+size_t JsonDocument::writeNode(JsonWriter& jsonWriter, size_t position) const
+{
+	auto& node = mNodes[position];
+	switch (node.type)
+	{
+		case NodeType::NULL_VALUE:
+			jsonWriter.insertValue("null");
+			break;
+		case NodeType::BOOLEAN_VALUE:
+			jsonWriter.insertValue(node.booleanValue ? "true" : "false");
+			break;
+		case NodeType::LONG_VALUE:
+			jsonWriter.insertIntegerValue(node.longValue);
+			break;
+		case NodeType::DOUBLE_VALUE:
+			if (std::isfinite(node.doubleValue))
+			{
+				jsonWriter.insertValue(core::util::StringUtil::toInvariantString(node.doubleValue));
+			}
+			else
+			{
+				jsonWriter.insertNonFiniteValue();
+			}
+			break;
+		case NodeType::STRING_VALUE:
+			jsonWriter.insertStringValue(getData(node.stringValue), node.stringValue.length);
+			break;
+		case NodeType::OBJECT_BEGIN:
+		case NodeType::ARRAY_BEGIN:
+		{
+			auto isObject = node.type == NodeType::OBJECT_BEGIN;
+			auto end = skipNode(position);
+			if (isObject)
+			{
+				jsonWriter.openObject();
+			}
+			else
+			{
+				jsonWriter.openArray();
+			}
+
+			auto numWritten = size_t(0);
+			auto child = position + 1;
+			while (child < end && mNodes[child].type != NodeType::CONTAINER_END)
+			{
+				if (mNodes[child].isIgnored)
+				{
+					child = skipNode(child);
+					continue;
+				}
+
+				if (numWritten++ > 0)
+				{
+					jsonWriter.insertElementSeperator();
+				}
+				if (isObject)
+				{
+					jsonWriter.insertKey(getData(mNodes[child].key), mNodes[child].key.length);
+					jsonWriter.insertKeyValueSeperator();
+				}
+				child = writeNode(jsonWriter, child);
+			}
+
+			if (isObject)
+			{
+				jsonWriter.closeObject();
+			}
+			else
+			{
+				jsonWriter.closeArray();
+			}
+			return end;
+		}
+		case NodeType::CONTAINER_END:
+			break;
+	}
+
+	return position + 1;
+}
@@ -19,13 +19,142 @@
 #include "util/json/JsonWriter.h"
 #include "core/util/StringUtil.h"
 
-#include <stdexcept>
-#include <sstream>
+#include <cerrno>
+#include <clocale>
 #include <cmath>
+#include <cstdlib>
 
 using namespace openkit::json;
 using namespace util::json::constants;
 
+///
+/// Powers of ten, which are exactly representable as double
+///
+static constexpr double EXACT_POWERS_OF_TEN[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+///
+/// Largest integer up to which all integers are exactly representable as double (2^53)
+///
+static constexpr uint64_t MAX_EXACT_DOUBLE_MANTISSA = UINT64_C(1) << 53;
+
+///
+/// Maximum number of significant digits accumulated by @ref parseDoubleFast
+///
+static constexpr int32_t MAX_SIGNIFICANT_DIGITS = 19;
+
+///
+/// Converts a validated number literal to a double, if this can be done exactly without rounding errors.
+///
+/// @par
+/// This is the case, if the significant digits fit into the 53 bit mantissa and the power of ten is exactly
+/// representable, since a single multiplication or division of two exact values is correctly rounded.
+///
+/// @return @c true if the literal was converted, @c false if it must be converted by @ref parseDoubleWithStrtod
+///
+static bool parseDoubleFast(const char* literalValue, size_t literalLength, double& parsedValue)
+{
+	const char* current = literalValue;
+	const char* end = literalValue + literalLength;
+
+	bool isNegative = *current == '-';
+	if (isNegative)
+	{
+		current++;
+	}
+
+	uint64_t mantissa = 0;
+	int32_t numSignificantDigits = 0;
+	int32_t exponent = 0;
+	bool isInFraction = false;
+	for (; current != end && *current != 'e' && *current != 'E'; current++)
+	{
+		if (*current == '.')
+		{
+			isInFraction = true;
+			continue;
+		}
+
+		auto digit = static_cast<uint64_t>(*current - '0');
+		if (mantissa != 0 || digit != 0)
+		{
+			if (numSignificantDigits == MAX_SIGNIFICANT_DIGITS)
+			{
+				return false;
+			}
+			mantissa = mantissa * 10 + digit;
+			numSignificantDigits++;
+		}
+		if (isInFraction)
+		{
+			exponent--;
+		}
+	}
+
+	if (current != end)
+	{
+		// skip the exponent character and parse the exponent, which is saturated to avoid overflows
+		current++;
+		bool isNegativeExponent = *current == '-';
+		if (*current == '-' || *current == '+')
+		{
+			current++;
+		}
+
+		int32_t exponentPart = 0;
+		for (; current != end; current++)
+		{
+			if (exponentPart < 100000)
+			{
+				exponentPart = exponentPart * 10 + (*current - '0');
+			}
+		}
+		exponent += isNegativeExponent ? -exponentPart : exponentPart;
+	}
+
+	if (mantissa == 0)
+	{
+		parsedValue = isNegative ? -0.0 : 0.0;
+		return true;
+	}
+
+	if (mantissa > MAX_EXACT_DOUBLE_MANTISSA || exponent < -22 || exponent > 22)
+	{
+		return false;
+	}
+
+	auto value = static_cast<double>(mantissa);
+	value = exponent < 0 ? value / EXACT_POWERS_OF_TEN[-exponent] : value * EXACT_POWERS_OF_TEN[exponent];
+	parsedValue = isNegative ? -value : value;
+
+	return true;
+}
+
+///
+/// Converts a validated number literal to a double using @c strtod.
+///
+/// @return @c true if the literal was converted, @c false if the value is out of range
+///
+static bool parseDoubleWithStrtod(const char* literalValue, size_t literalLength, double& parsedValue)
+{
+	// strtod requires a null terminated string and uses the decimal point of the current C locale
+	std::string literal(literalValue, literalLength);
+	auto decimalPoint = std::localeconv()->decimal_point;
+	auto decimalPointPosition = literal.find('.');
+	if (decimalPointPosition != std::string::npos && decimalPoint != nullptr && *decimalPoint != '\0')
+	{
+		literal.replace(decimalPointPosition, 1, decimalPoint);
+	}
+
+	errno = 0;
+	parsedValue = std::strtod(literal.c_str(), nullptr);
+
+	return errno != ERANGE || !std::isinf(parsedValue);
+}
+
 JsonNumberValue::JsonNumberValue(int64_t longValue)
 	: mIsInteger(true)
 	, mLongValue(longValue)
@@ -52,51 +181,63 @@ std::shared_ptr<JsonNumberValue> JsonNumberValue::fromDouble(double doubleValue)
 
 std::shared_ptr<JsonNumberValue> JsonNumberValue::fromNumberLiteral(const std::string& literalValue)
 {
-	std::smatch matches;
+	return fromNumberLiteral(literalValue.data(), literalValue.size());
+}
 
-	if (!std::regex_match(literalValue, matches, JsonLiterals::getNumberPattern()))
+std::shared_ptr<JsonNumberValue> JsonNumberValue::fromNumberLiteral(const char* literalValue, size_t literalLength)
+{
+	bool isInteger = false;
+	if (!JsonLiterals::isNumberLiteral(literalValue, literalLength, isInteger))
 	{
 		return nullptr;
 	}
 
-	try
+	if (isInteger)
 	{
-		if (!matches[2].matched && !matches[3].matched)
-		{
-			// only integer part matched
-			return parseLongValue(literalValue);
-		}
-		return parseDoubleValue(literalValue);
-	}
-	catch (std::invalid_argument&)
-	{
-		return nullptr;
+		return parseLongValue(literalValue, literalLength);
 	}
+	return parseDoubleValue(literalValue, literalLength);
 }
 
-std::shared_ptr<JsonNumberValue> JsonNumberValue::parseLongValue(const std::string& literalValue)
+std::shared_ptr<JsonNumberValue> JsonNumberValue::parseLongValue(const char* literalValue, size_t literalLength)
 {
-	std::istringstream iss(literalValue);
+	const char* current = literalValue;
+	const char* end = literalValue + literalLength;
+
+	bool isNegative = *current == '-';
+	if (isNegative)
+	{
+		current++;
+	}
 
-	int64_t parsedValue;
-	iss >> parsedValue;
+	// the magnitude of the smallest int64_t is one more than the magnitude of the largest one
+	const uint64_t maxMagnitude = static_cast<uint64_t>(INT64_MAX) + (isNegative ? 1 : 0);
 
-	if (iss.fail() || !iss.eof())
+	uint64_t magnitude = 0;
+	for (; current != end; current++)
 	{
-		return nullptr;
+		auto digit = static_cast<uint64_t>(*current - '0');
+		if (magnitude > (maxMagnitude - digit) / 10)
+		{
+			// value does not fit into a 64-bit integer
+			return nullptr;
+		}
+		magnitude = magnitude * 10 + digit;
 	}
 
-	return JsonNumberValue::fromLong(parsedValue);
+	if (isNegative)
+	{
+		// negate in unsigned arithmetic, to also cover the smallest int64_t
+		return JsonNumberValue::fromLong(static_cast<int64_t>(~magnitude + 1));
+	}
+	return JsonNumberValue::fromLong(static_cast<int64_t>(magnitude));
 }
 
-std::shared_ptr<JsonNumberValue> JsonNumberValue::parseDoubleValue(const std::string& literalValue)
+std::shared_ptr<JsonNumberValue> JsonNumberValue::parseDoubleValue(const char* literalValue, size_t literalLength)
 {
-	std::istringstream iss(literalValue);
-
 	double parsedValue;
-	iss >> parsedValue;
-
-	if(iss.fail() || !iss.eof())
+	if (!parseDoubleFast(literalValue, literalLength, parsedValue)
+		&& !parseDoubleWithStrtod(literalValue, literalLength, parsedValue))
 	{
 		return nullptr;
 	}
@@ -141,22 +282,18 @@ double JsonNumberValue::getDoubleValue() const
 
 void JsonNumberValue::writeJsonString(JsonWriter& jsonWriter) const
 {
-	std::string str;
-
 	if (isInteger())
 	{
-		str = core::util::StringUtil::toInvariantString(mLongValue);
+		jsonWriter.insertIntegerValue(mLongValue);
 	}
 	else if (isFinite())
 	{
-		str = core::util::StringUtil::toInvariantString(mDoubleValue);
+		jsonWriter.insertValue(core::util::StringUtil::toInvariantString(mDoubleValue));
 	}
 	else
 	{
-		str = "null";
+		jsonWriter.insertNonFiniteValue();
 	}
-
-	jsonWriter.insertValue(str);
 }
 
 bool JsonNumberValue::isFinite() const
@@ -49,6 +49,7 @@ set(OPENKIT_SOURCES_TEST_CORE
 set(OPENKIT_SOURCES_TEST_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/ActionCommonImplTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadBuilderTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/EventPayloadTemplateTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/LeafActionTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/NullActionTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/NullRootActionTest.cxx
@@ -63,6 +64,7 @@ set(OPENKIT_SOURCES_TEST_CORE_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/SupplementaryBasicDataTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestTracerTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestTracerURLValidityTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/objects/WebRequestURLTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/builder/TestOpenKitBuilder.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/builder/TestSessionBuilder.h
     ${CMAKE_CURRENT_LIST_DIR}/core/objects/mock/MockIActionCommon.h
@@ -79,11 +81,17 @@ set(OPENKIT_SOURCES_TEST_CORE_OBJECTS
 )
 
 set(OPENKIT_SOURCES_TEST_CORE_UTIL
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/BoundedQueueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CompressorTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/DeadlineQueueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/DefaultLoggerTest.cxx
-    ${CMAKE_CURRENT_LIST_DIR}/core/util/EventPayloadBuilderUtilTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/ExecutorTaskTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidatorTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/InterruptibleThreadSuspenderTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/LogRecordQueueTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/SharedExecutorTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressorPoolTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressorTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/StringUtilTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ThreadSurrogateTest.cxx
@@ -94,9 +102,13 @@ set(OPENKIT_SOURCES_TEST_CORE_UTIL
 set(OPENKIT_SOURCES_TEST_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/StatusResponseTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParserTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPConnectionPoolTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPRequestMultiplexerTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconRecordWriterTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/JsonResponseParserTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/KeyValueResponseParserTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/RecoveredBeaconSenderTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributesDefaultsTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseAttributesTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseParserTest.cxx
@@ -142,6 +154,7 @@ set(OPENKIT_SOURCES_TEST_CORE_COMMUNICATION
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/BeaconSendingRequestUtilTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/BeaconSendingResponseUtilTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/BeaconSendingTerminalStateTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/communication/SessionRegistryTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/CustomMatchers.h
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/builder/TestBeaconSendingContextBuilder.h
     ${CMAKE_CURRENT_LIST_DIR}/core/communication/mock/MockAbstractBeaconSendingState.h
@@ -156,6 +169,7 @@ set(OPENKIT_SOURCES_TEST_CORE_CONFIGURATION
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/OpenKitConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/PrivacyConfigurationTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfigurationTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/configuration/ServerConfigurationSnapshotTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIBeaconCacheConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIBeaconConfiguration.h
     ${CMAKE_CURRENT_LIST_DIR}/core/configuration/mock/MockIHTTPClientConfiguration.h
@@ -165,15 +179,20 @@ set(OPENKIT_SOURCES_TEST_CORE_CONFIGURATION
 )
 
 set(OPENKIT_SOURCES_TEST_CORE_CACHING
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/AsyncBeaconCacheTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEntryTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecordTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheRecordArenaTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheEvictorTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheOverflowStoreTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconCacheTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconKeyTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/BeaconRecordQueueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/SpaceEvictionStrategyTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/TimeEvictionStrategyTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIBeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIBeaconCacheEvictionStrategy.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIBeaconCacheOverflowStore.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIBeaconCacheEvictor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/caching/mock/MockIObserver.h
 )
@@ -187,17 +206,13 @@ set(OPENKIT_SOURCES_TEST_UTIL_JSON_LEXER
 set(OPENKIT_SOURCES_TEST_UTIL_JSON_OBJECTS
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonArrayValueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonBooleanValueTest.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonDocumentTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonNullValueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonNumberValueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonObjectValueTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/objects/JsonStringValueTest.cxx
 )
 
-set(OPENKIT_SOURCES_TEST_UTIL_JSON_READER
-    ${CMAKE_CURRENT_LIST_DIR}/util/json/reader/MockResettableReader.h
-    ${CMAKE_CURRENT_LIST_DIR}/util/json/reader/DefaultResettableReaderTest.cxx
-)
-
 set(OPENKIT_SOURCES_TEST_UTIL_JSON
     ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonParserTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/util/json/JsonWriterTest.cxx
@@ -218,7 +233,6 @@ set(OPENKIT_SOURCES_UNITTEST
     ${OPENKIT_SOURCES_TEST_PROVIDERS}
     ${OPENKIT_SOURCES_TEST_UTIL_JSON_LEXER}
     ${OPENKIT_SOURCES_TEST_UTIL_JSON_OBJECTS}
-    ${OPENKIT_SOURCES_TEST_UTIL_JSON_READER}
     ${OPENKIT_SOURCES_TEST_UTIL_JSON}
 )
 
@@ -271,7 +285,6 @@ function(build_open_kit_tests)
     source_group("Source Files\\JSON" FILES ${OPENKIT_SOURCES_TEST_UTIL_JSON})
     source_group("Source Files\\JSON\\Lexer" FILES ${OPENKIT_SOURCES_TEST_UTIL_JSON_LEXER})
     source_group("Source Files\\JSON\\Objects" FILES ${OPENKIT_SOURCES_TEST_UTIL_JSON_OBJECTS})
-    source_group("Source Files\\JSON\\Reader" FILES ${OPENKIT_SOURCES_TEST_UTIL_JSON_READER})
     source_group("Source Files\\Protocol" FILES ${OPENKIT_SOURCES_TEST_PROTOCOL})
     source_group("Source Files\\Providers" FILES ${OPENKIT_SOURCES_TEST_PROVIDERS})
 
@@ -653,4 +653,345 @@ TEST_F(DynatraceOpenKitBuilderTest, getHttpResponseInterceptorCannotBeChangedToN
 	// then
 	ASSERT_THAT(obtained, testing::NotNull());
 	ASSERT_THAT(std::dynamic_pointer_cast<NullHttpResponseInterceptor_t>(obtained), testing::NotNull());
-}
\ No newline at end of file
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultHttpConnectionPoolMaxIdleConnections)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getHttpConnectionPoolMaxIdleConnections();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_HTTP_CONNECTION_POOL_MAX_IDLE_CONNECTIONS));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getHttpConnectionPoolMaxIdleConnectionsReturnsChangedValue)
+{
+	// given
+	const int32_t maxIdleConnections = 17;
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withHttpConnectionPoolMaxIdleConnections(maxIdleConnections);
+	auto obtained = target.getHttpConnectionPoolMaxIdleConnections();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(maxIdleConnections));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultHttpConnectionPoolIdleTimeout)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getHttpConnectionPoolIdleTimeout();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_HTTP_CONNECTION_POOL_IDLE_TIMEOUT_IN_MILLIS));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getHttpConnectionPoolIdleTimeoutReturnsChangedValue)
+{
+	// given
+	const int64_t idleTimeout = 12345;
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withHttpConnectionPoolIdleTimeout(idleTimeout);
+	auto obtained = target.getHttpConnectionPoolIdleTimeout();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(idleTimeout));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultMaxConcurrentBeaconRequests)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getMaxConcurrentBeaconRequests();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getMaxConcurrentBeaconRequestsReturnsChangedValue)
+{
+	// given
+	const int32_t maxConcurrentRequests = 4;
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withMaxConcurrentBeaconRequests(maxConcurrentRequests);
+	auto obtained = target.getMaxConcurrentBeaconRequests();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(maxConcurrentRequests));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, withMaxConcurrentBeaconRequestsIgnoresNonPositiveValues)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withMaxConcurrentBeaconRequests(0);
+	target.withMaxConcurrentBeaconRequests(-1);
+	auto obtained = target.getMaxConcurrentBeaconRequests();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconCompressionLevel)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconCompressionLevel();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_COMPRESSION_LEVEL));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconCompressionLevelReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCompressionLevel(9);
+	auto obtained = target.getBeaconCompressionLevel();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(9));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, withBeaconCompressionLevelIgnoresValuesOutOfRange)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCompressionLevel(-2);
+	target.withBeaconCompressionLevel(10);
+	auto obtained = target.getBeaconCompressionLevel();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_COMPRESSION_LEVEL));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconCompressionStrategy)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconCompressionStrategy();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_COMPRESSION_STRATEGY));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconCompressionStrategyReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCompressionStrategy(openkit::CompressionStrategy::FILTERED);
+	auto obtained = target.getBeaconCompressionStrategy();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(openkit::CompressionStrategy::FILTERED));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconCacheOverflowDirectoryIsEmpty)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconCacheOverflowDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsEmpty());
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconCacheOverflowDirectoryReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCacheOverflowDirectory("/var/cache/openkit");
+	auto obtained = target.getBeaconCacheOverflowDirectory();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq("/var/cache/openkit"));
+
+	// and when
+	target.withBeaconCacheOverflowDirectory(nullptr);
+
+	// then
+	ASSERT_THAT(target.getBeaconCacheOverflowDirectory(), testing::IsEmpty());
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconCacheOverflowMaxSize)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconCacheOverflowMaxSize();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconCacheOverflowMaxSizeReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCacheOverflowMaxSize(1024);
+	auto obtained = target.getBeaconCacheOverflowMaxSize();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(int64_t(1024)));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, withBeaconCacheOverflowMaxSizeIgnoresNonPositiveValues)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconCacheOverflowMaxSize(0);
+	target.withBeaconCacheOverflowMaxSize(-1);
+	auto obtained = target.getBeaconCacheOverflowMaxSize();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconRecordQueueCapacity)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconRecordQueueCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_CAPACITY));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconRecordQueueCapacityReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconRecordQueueCapacity(4096);
+	auto obtained = target.getBeaconRecordQueueCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(4096));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, withBeaconRecordQueueCapacityIgnoresNegativeValues)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconRecordQueueCapacity(-1);
+	auto obtained = target.getBeaconRecordQueueCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_CAPACITY));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultBeaconRecordQueueFullPolicy)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getBeaconRecordQueueFullPolicy();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_FULL_POLICY));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getBeaconRecordQueueFullPolicyReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withBeaconRecordQueueFullPolicy(openkit::BeaconRecordQueueFullPolicy::DROP);
+	auto obtained = target.getBeaconRecordQueueFullPolicy();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(openkit::BeaconRecordQueueFullPolicy::DROP));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, sharedExecutorIsDisabledByDefault)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.isSharedExecutorEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_SHARED_EXECUTOR_ENABLED));
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, isSharedExecutorEnabledReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withSharedExecutor(true);
+	auto obtained = target.isSharedExecutorEnabled();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, defaultLogRecordQueueCapacity)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	auto obtained = target.getLogRecordQueueCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(core::configuration::DEFAULT_LOG_RECORD_QUEUE_CAPACITY));
+}
+
+TEST_F(DynatraceOpenKitBuilderTest, getLogRecordQueueCapacityReturnsChangedValue)
+{
+	// given
+	StubOpenKitBuilder target(ENDPOINT_URL, APPLICATION_ID, DEVICE_ID);
+
+	// when
+	target.withLogRecordQueueCapacity(256);
+	target.withLogRecordQueueCapacity(-1);
+	auto obtained = target.getLogRecordQueueCapacity();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(256));
+}
@@ -45,6 +45,7 @@ namespace test
 			ON_CALL(*this, getEndpointURL()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 			ON_CALL(*this, getOrigDeviceID()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 			ON_CALL(*this, getTrustManager()).WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getBeaconCacheOverflowDirectory()).WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
 
 			ON_CALL(*this, getDataCollectionLevel())
 				.WillByDefault(testing::Return(core::configuration::DEFAULT_DATA_COLLECTION_LEVEL));
@@ -108,6 +109,28 @@ namespace test
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpRequestInterceptor>, getHttpRequestInterceptor, (), (const, override));
 
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpResponseInterceptor>, getHttpResponseInterceptor, (), (const, override));
+
+		MOCK_METHOD(int32_t, getHttpConnectionPoolMaxIdleConnections, (), (const, override));
+
+		MOCK_METHOD(int64_t, getHttpConnectionPoolIdleTimeout, (), (const, override));
+
+		MOCK_METHOD(int32_t, getMaxConcurrentBeaconRequests, (), (const, override));
+
+		MOCK_METHOD(int32_t, getBeaconCompressionLevel, (), (const, override));
+
+		MOCK_METHOD(openkit::CompressionStrategy, getBeaconCompressionStrategy, (), (const, override));
+
+		MOCK_METHOD(const std::string&, getBeaconCacheOverflowDirectory, (), (const, override));
+
+		MOCK_METHOD(int64_t, getBeaconCacheOverflowMaxSize, (), (const, override));
+
+		MOCK_METHOD(int32_t, getBeaconRecordQueueCapacity, (), (const, override));
+
+		MOCK_METHOD(openkit::BeaconRecordQueueFullPolicy, getBeaconRecordQueueFullPolicy, (), (const, override));
+
+		MOCK_METHOD(bool, isSharedExecutorEnabled, (), (const, override));
+
+		MOCK_METHOD(int32_t, getLogRecordQueueCapacity, (), (const, override));
 	};
 }
 
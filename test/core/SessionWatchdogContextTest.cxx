@@ -361,6 +361,40 @@ TEST_F(SessionWatchdogContextTest, executeSleepsMinimumTimeToNextSessionGraceEnd
 	target->execute();
 }
 
+TEST_F(SessionWatchdogContextTest, executeOnceReturnsMinimumTimeToNextSessionGraceEndPeriodWithoutSleeping)
+{
+	// with
+	auto mockSession1 = MockSessionInternals::createNice();
+
+	// expect
+	EXPECT_CALL(*mockThreadSuspender, sleep(testing::_))
+		.Times(0);
+
+	// given
+	ON_CALL(*mockSession, getSplitByEventsGracePeriodEndTimeInMillis())
+		.WillByDefault(testing::Return(4));
+	ON_CALL(*mockSession, tryEnd())
+		.WillByDefault(testing::Return(false));
+
+	ON_CALL(*mockSession1, getSplitByEventsGracePeriodEndTimeInMillis())
+		.WillByDefault(testing::Return(3));
+	ON_CALL(*mockSession1, tryEnd())
+		.WillByDefault(testing::Return(false));
+
+	ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(0));
+
+	auto target = createContext();
+	target->closeOrEnqueueForClosing(mockSession, 4);
+	target->closeOrEnqueueForClosing(mockSession1, 3);
+
+	// when
+	auto obtained = target->executeOnce();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(3));
+}
+
 TEST_F(SessionWatchdogContextTest, executeRemovesSessionProxyIfNextSplitTimeIsNegative)
 {
 	// expect
@@ -397,6 +431,53 @@ TEST_F(SessionWatchdogContextTest, executeDoesNotRemoveSessionProxyIfNextSplitTi
 	ASSERT_THAT(target->getSessionsToSplitByTimeout().size(), testing::Eq(size_t(1)));
 }
 
+TEST_F(SessionWatchdogContextTest, executeDoesNotAddSessionProxyAgainIfRemovedWhileSplitting)
+{
+	// given
+	auto target = createContext();
+	target->addToSplitByTimeout(mockSessionProxy);
+
+	// expect
+	EXPECT_CALL(*mockSessionProxy, splitSessionByTime())
+		.Times(1)
+		.WillOnce(testing::DoAll(
+			testing::InvokeWithoutArgs([&target, this]() { target->removeFromSplitByTimeout(mockSessionProxy); }),
+			testing::Return(10)));
+
+	// when
+	target->execute();
+
+	// then
+	ASSERT_THAT(target->getSessionsToSplitByTimeout(), testing::IsEmpty());
+}
+
+TEST_F(SessionWatchdogContextTest, executeKeepsSessionProxyIfAddedAgainWhileSplitting)
+{
+	// given
+	auto target = createContext();
+	target->addToSplitByTimeout(mockSessionProxy);
+
+	// expect
+	EXPECT_CALL(*mockSessionProxy, splitSessionByTime())
+		.Times(2)
+		.WillOnce(testing::DoAll(
+			testing::InvokeWithoutArgs([&target, this]() { target->addToSplitByTimeout(mockSessionProxy); }),
+			testing::Return(-1)))
+		.WillOnce(testing::Return(-1));
+
+	// when
+	target->execute();
+
+	// then
+	ASSERT_THAT(target->getSessionsToSplitByTimeout().size(), testing::Eq(size_t(1)));
+
+	// and when the session proxy is checked again with the next execution
+	target->execute();
+
+	// then
+	ASSERT_THAT(target->getSessionsToSplitByTimeout(), testing::IsEmpty());
+}
+
 TEST_F(SessionWatchdogContextTest, executeSleepsDefaultTimeIfSessionProxySplitTimeIsNegativeAndNoFurtherSessionProxyExists)
 {
 	// expect
@@ -594,6 +675,62 @@ TEST_F(SessionWatchdogContextTest, executeDoesNotSleepLongerThanDefaultSleepTime
 	target->execute();
 }
 
+TEST_F(SessionWatchdogContextTest, executeDoesNotVisitSessionsWhoseGracePeriodIsNotExpired)
+{
+	// expect
+	EXPECT_CALL(*mockSession, getSplitByEventsGracePeriodEndTimeInMillis())
+		.Times(0);
+	EXPECT_CALL(*mockSession, end(testing::_))
+		.Times(0);
+
+	// given
+	ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(10));
+	ON_CALL(*mockSession, tryEnd())
+		.WillByDefault(testing::Return(false));
+
+	auto target = createContext();
+	target->closeOrEnqueueForClosing(mockSession, 100);
+
+	// when
+	target->execute();
+	target->execute();
+
+	// then
+	ASSERT_THAT(target->getSessionsToClose().size(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SessionWatchdogContextTest, executeChecksSessionProxyAgainWhenNextSplitTimeIsReached)
+{
+	// with
+	int64_t currentTime = 50;
+	const int64_t nextSplitTime = 200;
+
+	// expect
+	EXPECT_CALL(*mockSessionProxy, splitSessionByTime())
+		.Times(2)
+		.WillRepeatedly(testing::Return(nextSplitTime));
+
+	// given
+	ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+		.WillByDefault(testing::ReturnPointee(&currentTime));
+
+	auto target = createContext();
+	target->addToSplitByTimeout(mockSessionProxy);
+	target->execute();
+
+	// when the split time is not yet reached
+	currentTime = nextSplitTime - 1;
+	target->execute();
+
+	// and when the split time is reached
+	currentTime = nextSplitTime;
+	target->execute();
+
+	// then
+	ASSERT_THAT(target->getSessionsToSplitByTimeout().size(), testing::Eq(size_t(1)));
+}
+
 TEST_F(SessionWatchdogContextTest, requestShutdownSetsIsShutdownRequestedToTrue)
 {
 	// given
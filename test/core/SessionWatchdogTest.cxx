@@ -123,6 +123,38 @@ TEST_F(SessionWatchdogTest, contextIsExecutedUntilShutdownIsRequested)
 	target->shutdown();
 }
 
+TEST_F(SessionWatchdogTest, contextIsExecutedOnASharedExecutorUntilShutdownIsRequested)
+{
+	// expect
+	EXPECT_CALL(*mockContext, isShutdownRequested())
+		.Times(3)
+		.WillOnce(testing::Return(false))
+		.WillOnce(testing::Return(false))
+		.WillOnce(testing::Invoke([this] {
+				this->mPromise.set_value();
+				return true;
+			})
+		);
+	EXPECT_CALL(*mockContext, executeOnce())
+		.Times(2)
+		.WillRepeatedly(testing::Return(0));
+	EXPECT_CALL(*mockContext, execute())
+		.Times(0);
+
+	// given
+	auto executor = std::make_shared<core::util::SharedExecutor>(1);
+	auto target = std::make_shared<SessionWatchdog_t>(mockLogger, mockContext, executor);
+
+	// when
+	target->initialize();
+
+	auto status = mFuture.wait_for(std::chrono::seconds(1)); // wait for task
+	ASSERT_THAT(status, testing::Eq(std::future_status::ready));
+
+	// cleanup
+	target->shutdown();
+}
+
 TEST_F(SessionWatchdogTest, shutdownLogsWatchdogThreadStop)
 {
 	// expect
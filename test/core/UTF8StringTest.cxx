@@ -20,6 +20,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
 
 using Utf8String_t = core::UTF8String;
 
@@ -27,6 +30,76 @@ class UTF8StringTest : public testing::Test
 {
 };
 
+///
+/// Byte-wise UTF-8 validation as implemented before validating in bulk runs, used as reference
+///
+static size_t validateBytewise(const char* stringData, std::string& validated)
+{
+	const char* replacementCharacter = "\xEF\xBF\xBD";
+
+	size_t byteLength = 0;
+	while (stringData[byteLength] != '\0' && !(stringData[byteLength] == '\xC0' && stringData[byteLength + 1] == '\x80'))
+	{
+		byteLength++;
+	}
+
+	auto multibyteSequenceLength = -1;
+	auto multibyteSequencePosition = -1;
+	size_t characterCount = 0;
+	for (size_t i = 0; i < byteLength; i++)
+	{
+		auto character = static_cast<unsigned char>(stringData[i]);
+		auto byteWidth = (character & 0x80) == 0 ? 1
+			: (character & 0xE0) == 0xC0 ? 2
+			: (character & 0xF0) == 0xE0 ? 3
+			: (character & 0xF8) == 0xF0 ? 4
+			: 0;
+
+		if ((character & 0xC0) == 0x80)
+		{
+			multibyteSequencePosition++;
+			if (multibyteSequencePosition > multibyteSequenceLength - 1)
+			{
+				validated.append(replacementCharacter);
+				characterCount++;
+				multibyteSequenceLength = -1;
+				multibyteSequencePosition = -1;
+			}
+			else if (multibyteSequencePosition == multibyteSequenceLength - 1)
+			{
+				validated.append(stringData + i - multibyteSequenceLength + 1, multibyteSequenceLength);
+				characterCount++;
+				multibyteSequenceLength = -1;
+				multibyteSequencePosition = -1;
+			}
+		}
+		else if (byteWidth == 1)
+		{
+			if (multibyteSequenceLength >= 0)
+			{
+				validated.append(replacementCharacter);
+				characterCount++;
+			}
+			validated.push_back(stringData[i]);
+			characterCount++;
+			multibyteSequenceLength = -1;
+			multibyteSequencePosition = -1;
+		}
+		else if (byteWidth > 1)
+		{
+			if (multibyteSequenceLength != -1)
+			{
+				validated.append(replacementCharacter);
+				characterCount++;
+			}
+			multibyteSequenceLength = byteWidth;
+			multibyteSequencePosition = 0;
+		}
+	}
+
+	return characterCount;
+}
+
 TEST_F(UTF8StringTest, aStringCanBeInitializedWithAnASCIIString)
 {
 	Utf8String_t s("test123");
@@ -872,4 +945,172 @@ TEST_F(UTF8StringTest, notEqualUtf8Strings)
 
 	EXPECT_FALSE(s1 == s2);
 	EXPECT_TRUE(s1 != s2);
-}
\ No newline at end of file
+}
+
+TEST_F(UTF8StringTest, concatenateWithInvalidCharPointerReplacesInvalidCharacters)
+{
+	Utf8String_t s(u8"H€llo ");
+	s.concatenate("W\xE2\x82rld");
+
+	EXPECT_EQ(s.getStringData(), u8"H€llo W�rld");
+	EXPECT_EQ(s.getStringLength(), 11);
+}
+
+TEST_F(UTF8StringTest, aStringCanBeInitializedWithAnAsciiStdStringRvalue)
+{
+	std::string data("test123");
+	Utf8String_t s(std::move(data));
+
+	EXPECT_EQ(s.getStringData(), "test123");
+	EXPECT_EQ(s.getStringLength(), 7);
+}
+
+TEST_F(UTF8StringTest, aStringCanBeInitializedWithAnInvalidStdStringRvalue)
+{
+	std::string data("\xC3\x84\xE2\x82 test");
+	data.push_back('\0');
+	data.append("ignored");
+	Utf8String_t s(std::move(data));
+
+	EXPECT_EQ(s.getStringData(), u8"Ä� test");
+	EXPECT_EQ(s.getStringLength(), 7);
+}
+
+TEST_F(UTF8StringTest, movingAStringLeavesAnEmptyString)
+{
+	Utf8String_t s1(u8"H€llo World");
+	Utf8String_t s2(std::move(s1));
+
+	EXPECT_EQ(s2.getStringData(), u8"H€llo World");
+	EXPECT_EQ(s2.getStringLength(), 11);
+	EXPECT_TRUE(s1.empty());
+	EXPECT_EQ(s1.size(), 0);
+}
+
+TEST_F(UTF8StringTest, moveAssigningAStringLeavesAnEmptyString)
+{
+	Utf8String_t s1(u8"H€llo World");
+	Utf8String_t s2("test");
+	s2 = std::move(s1);
+
+	EXPECT_EQ(s2.getStringData(), u8"H€llo World");
+	EXPECT_EQ(s2.getStringLength(), 11);
+	EXPECT_TRUE(s1.empty());
+	EXPECT_EQ(s1.size(), 0);
+}
+
+TEST_F(UTF8StringTest, movingAStringDoesNotThrow)
+{
+	// required for std::vector to move instead of copy when growing
+	EXPECT_TRUE(std::is_nothrow_move_constructible<Utf8String_t>::value);
+	EXPECT_TRUE(std::is_nothrow_move_assignable<Utf8String_t>::value);
+}
+
+TEST_F(UTF8StringTest, aLongMixedStringIsValidatedAcrossWordBoundaries)
+{
+	Utf8String_t s(u8"0123456€89abcdefghij€klmnopqrstu😀vwxyz");
+
+	EXPECT_EQ(s.getStringData(), u8"0123456€89abcdefghij€klmnopqrstu😀vwxyz");
+	EXPECT_EQ(s.getStringLength(), 38);
+	EXPECT_EQ(s.size(), 45);
+}
+
+TEST_F(UTF8StringTest, aLongStringWithInvalidBytesIsValidatedAcrossWordBoundaries)
+{
+	Utf8String_t s("0123456789abcdef\xE2\x82" "0123456789abcdef\x80" "0123456789\xF8" "abcdef\xC3");
+
+	EXPECT_EQ(s.getStringData(), u8"0123456789abcdef�0123456789abcdef�0123456789abcdef");
+	EXPECT_EQ(s.getStringLength(), 50);
+}
+
+TEST_F(UTF8StringTest, aLongStringIsModifiedUtf8TerminatedAfterMultibyteCharacters)
+{
+	Utf8String_t s(u8"0123456789€abcdef\xC0\x80" "ignored");
+
+	EXPECT_EQ(s.getStringData(), u8"0123456789€abcdef");
+	EXPECT_EQ(s.getStringLength(), 17);
+}
+
+TEST_F(UTF8StringTest, aStringIndexOfUsingTheOffsetParameterWithUTF8Characters)
+{
+	Utf8String_t s(u8"€a€b€a€b€a€b€a€b");
+
+	EXPECT_EQ(s.getIndexOf("a", 2), 5);
+	EXPECT_EQ(s.getIndexOf(u8"€", 11), 12);
+	EXPECT_EQ(s.getIndexOf("b", 15), 15);
+	EXPECT_EQ(s.getIndexOf("b", 16), std::string::npos);
+}
+
+TEST_F(UTF8StringTest, substringStartingAtTheEndOfTheStringIsEmpty)
+{
+	Utf8String_t s("key=");
+
+	Utf8String_t substr = s.substring(4);
+
+	EXPECT_EQ(substr.getStringLength(), 0);
+	EXPECT_EQ(substr.size(), 0);
+}
+
+TEST_F(UTF8StringTest, substringFromLongUTF8String)
+{
+	Utf8String_t s(u8"0123456789€abcdefghij€klmnopqrstuvwxyz€ABCDEFGHIJ");
+
+	Utf8String_t substr = s.substring(9, 29);
+
+	EXPECT_EQ(substr.getStringData(), u8"9€abcdefghij€klmnopqrstuvwxyz");
+	EXPECT_EQ(substr.getStringLength(), 29);
+}
+
+TEST_F(UTF8StringTest, validationOfRandomMixedAndInvalidInputEqualsBytewiseValidation)
+{
+	// bytes of all UTF-8 classes, including invalid ones and the modified UTF-8 terminator
+	const char bytes[] = { 'a', 'Z', '0', ' ', '\x7F', '\x80', '\x8F', '\xBF', '\xC0', '\xC3', '\xDF',
+		'\xE2', '\xEF', '\xF0', '\xF4', '\xF8', '\xFF' };
+	std::mt19937 random(42);
+	std::uniform_int_distribution<size_t> byteDistribution(0, sizeof(bytes) - 1);
+	std::uniform_int_distribution<size_t> lengthDistribution(0, 40);
+
+	for (auto i = 0; i < 20000; i++)
+	{
+		std::string input;
+		for (auto length = lengthDistribution(random); length > 0; length--)
+		{
+			input.push_back(bytes[byteDistribution(random)]);
+		}
+
+		std::string expected;
+		auto expectedLength = validateBytewise(input.c_str(), expected);
+
+		Utf8String_t obtained(input.c_str());
+		ASSERT_EQ(obtained.getStringData(), expected) << "input of " << input.size() << " bytes, iteration " << i;
+		ASSERT_EQ(obtained.getStringLength(), expectedLength) << "input of " << input.size() << " bytes, iteration " << i;
+	}
+}
+
+TEST_F(UTF8StringTest, validationOfRandomMostlyAsciiInputEqualsBytewiseValidation)
+{
+	// long ASCII runs with occasional multibyte characters, crossing word boundaries at arbitrary offsets
+	const char* fragments[] = { "a", "abcdefg", "0123456789abcdef", u8"\u20AC", u8"\u00E4", u8"\U0001F600", "\xE2\x82",
+		"\x80", "\xF8", "\xC3" };
+	std::mt19937 random(42);
+	std::uniform_int_distribution<size_t> fragmentDistribution(0, sizeof(fragments) / sizeof(fragments[0]) - 1);
+	std::uniform_int_distribution<size_t> lengthDistribution(0, 24);
+
+	for (auto i = 0; i < 5000; i++)
+	{
+		std::string input;
+		for (auto numFragments = lengthDistribution(random); numFragments > 0; numFragments--)
+		{
+			auto fragment = fragmentDistribution(random);
+			// ASCII fragments are picked more often to form long runs
+			input += fragments[fragment < 3 || random() % 4 == 0 ? fragment : fragment % 3];
+		}
+
+		std::string expected;
+		auto expectedLength = validateBytewise(input.c_str(), expected);
+
+		Utf8String_t obtained(input.c_str());
+		ASSERT_EQ(obtained.getStringData(), expected) << "iteration " << i;
+		ASSERT_EQ(obtained.getStringLength(), expectedLength) << "iteration " << i;
+	}
+}
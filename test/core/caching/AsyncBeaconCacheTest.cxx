@@ -0,0 +1,260 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../api/mock/MockILogger.h"
+#include "mock/MockIBeaconCache.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/AsyncBeaconCache.h"
+#include "core/caching/BeaconCache.h"
+#include "core/caching/BeaconKey.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace test;
+
+using AsyncBeaconCache_t = core::caching::AsyncBeaconCache;
+using BeaconCache_t = core::caching::BeaconCache;
+using BeaconKey_t = core::caching::BeaconKey;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using QueueFullPolicy_t = openkit::BeaconRecordQueueFullPolicy;
+using Utf8String_t = core::UTF8String;
+
+class AsyncBeaconCacheTest : public testing::Test
+{
+protected:
+
+	MockNiceILogger_sp mockLogger;
+	std::shared_ptr<BeaconCache_t> beaconCache;
+
+	void SetUp() override
+	{
+		mockLogger = MockILogger::createNice();
+		beaconCache = std::make_shared<BeaconCache_t>(mockLogger);
+	}
+};
+
+TEST_F(AsyncBeaconCacheTest, queuedRecordsAreAddedToTheUnderlyingCacheInOrder)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 1024, QueueFullPolicy_t::BLOCK);
+
+	// when
+	target.addEventData(key, 1000, "a");
+	target.addActionData(key, 1001, "b");
+	target.addEventData(key, 1002, "c");
+	target.drainQueue();
+
+	// then
+	ASSERT_THAT(beaconCache->getEvents(key), testing::ElementsAre(Utf8String_t("a"), Utf8String_t("c")));
+	ASSERT_THAT(beaconCache->getActions(key), testing::ElementsAre(Utf8String_t("b")));
+}
+
+TEST_F(AsyncBeaconCacheTest, queuedRecordsAreMovedBeforeReadingTheCache)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 1024, QueueFullPolicy_t::BLOCK);
+
+	// when
+	target.addEventData(key, 1000, "a");
+
+	// then
+	ASSERT_THAT(target.isEmpty(key), testing::Eq(false));
+	ASSERT_THAT(target.getBeaconKeys(), testing::ElementsAre(key));
+}
+
+TEST_F(AsyncBeaconCacheTest, queuedRecordsAreMovedBeforeDeletingACacheEntry)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 1024, QueueFullPolicy_t::BLOCK);
+	target.addEventData(key, 1000, "a");
+
+	// when
+	target.deleteCacheEntry(key);
+
+	// then
+	ASSERT_THAT(beaconCache->getBeaconKeys(), testing::IsEmpty());
+	ASSERT_THAT(beaconCache->getNumBytesInCache(), testing::Eq(0));
+}
+
+TEST_F(AsyncBeaconCacheTest, deletingACacheEntryWaitsForRecordsBeingMovedByAnotherThread)
+{
+	// with
+	BeaconKey_t key(1, 0);
+	auto underlyingCache = MockIBeaconCache::createNice();
+	std::promise<void> recordTaken;
+	std::promise<void> releaseRecord;
+	auto releaseFuture = releaseRecord.get_future().share();
+	std::atomic<bool> recordAdded(false);
+	std::atomic<bool> deletedAfterRecordAdded(false);
+
+	ON_CALL(*underlyingCache, addEventData(key, testing::_, testing::_))
+		.WillByDefault(testing::InvokeWithoutArgs([&recordTaken, releaseFuture, &recordAdded]()
+		{
+			recordTaken.set_value();
+			releaseFuture.wait();
+			recordAdded = true;
+		}));
+	ON_CALL(*underlyingCache, deleteCacheEntry(key))
+		.WillByDefault(testing::InvokeWithoutArgs([&recordAdded, &deletedAfterRecordAdded]()
+		{
+			deletedAfterRecordAdded = recordAdded.load();
+		}));
+
+	// given
+	AsyncBeaconCache_t target(mockLogger, underlyingCache, 1024, QueueFullPolicy_t::BLOCK);
+	target.addEventData(key, 1000, "a");
+	std::thread drainThread([&target]() { target.drainQueue(); });
+	recordTaken.get_future().wait();
+
+	// when
+	std::thread deleteThread([&target, &key]() { target.deleteCacheEntry(key); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	releaseRecord.set_value();
+	drainThread.join();
+	deleteThread.join();
+
+	// then
+	ASSERT_THAT(deletedAfterRecordAdded.load(), testing::Eq(true));
+}
+
+TEST_F(AsyncBeaconCacheTest, queuedRecordsAreMovedWhenDestroyed)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto target = std::make_shared<AsyncBeaconCache_t>(mockLogger, beaconCache, 1024, QueueFullPolicy_t::BLOCK);
+	target->addEventData(key, 1000, "a");
+	target->addEventData(key, 1001, "b");
+
+	// when
+	target = nullptr;
+
+	// then
+	ASSERT_THAT(beaconCache->getEvents(key), testing::ElementsAre(Utf8String_t("a"), Utf8String_t("b")));
+}
+
+TEST_F(AsyncBeaconCacheTest, recordsAreMovedByTheBackgroundThread)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 1024, QueueFullPolicy_t::BLOCK);
+
+	// when
+	target.addEventData(key, 1000, "a");
+
+	// then
+	for (int32_t i = 0; i < 500 && beaconCache->getEvents(key).empty(); i++)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	ASSERT_THAT(beaconCache->getEvents(key), testing::ElementsAre(Utf8String_t("a")));
+}
+
+TEST_F(AsyncBeaconCacheTest, blockPolicyKeepsAllRecordsOfConcurrentReporters)
+{
+	// given
+	const int32_t numThreads = 4;
+	const int32_t numRecordsPerThread = 1000;
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 2, QueueFullPolicy_t::BLOCK);
+
+	// when
+	std::vector<std::thread> threads;
+	for (int32_t thread = 0; thread < numThreads; thread++)
+	{
+		threads.push_back(std::thread([&target, thread, numRecordsPerThread]()
+		{
+			for (int32_t i = 0; i < numRecordsPerThread; i++)
+			{
+				target.addEventData(BeaconKey_t(thread, 0), i, core::UTF8String(std::to_string(i)));
+			}
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	target.drainQueue();
+
+	// then
+	ASSERT_THAT(target.getNumDroppedRecords(), testing::Eq(uint64_t(0)));
+	for (int32_t thread = 0; thread < numThreads; thread++)
+	{
+		auto events = beaconCache->getEvents(BeaconKey_t(thread, 0));
+		ASSERT_THAT(events.size(), testing::Eq(size_t(numRecordsPerThread)));
+		for (int32_t i = 0; i < numRecordsPerThread; i++)
+		{
+			ASSERT_THAT(events[i], testing::Eq(Utf8String_t(std::to_string(i))));
+		}
+	}
+}
+
+TEST_F(AsyncBeaconCacheTest, dropPolicyDiscardsRecordsIfTheQueueIsFull)
+{
+	// given
+	const int32_t numRecords = 10000;
+	BeaconKey_t key(1, 0);
+	AsyncBeaconCache_t target(mockLogger, beaconCache, 2, QueueFullPolicy_t::DROP);
+
+	// when
+	for (int32_t i = 0; i < numRecords; i++)
+	{
+		target.addEventData(key, i, "a");
+	}
+	target.drainQueue();
+
+	// then
+	auto numEvents = beaconCache->getEvents(key).size();
+	ASSERT_THAT(numEvents + target.getNumDroppedRecords(), testing::Eq(uint64_t(numRecords)));
+}
+
+TEST_F(AsyncBeaconCacheTest, otherCallsAreForwardedToTheUnderlyingCache)
+{
+	// with
+	BeaconKey_t key(1, 0);
+	const Utf8String_t prefix("prefix");
+	const Utf8String_t delimiter("&");
+
+	// expect
+	auto mockBeaconCache = MockIBeaconCache::createStrict();
+	EXPECT_CALL(*mockBeaconCache, hasDataForSending(key)).WillOnce(testing::Return(true));
+	EXPECT_CALL(*mockBeaconCache, getNextBeaconChunk(key, prefix, 42, delimiter)).WillOnce(testing::Return(Utf8String_t("chunk")));
+	EXPECT_CALL(*mockBeaconCache, removeChunkedData(key)).Times(1);
+	EXPECT_CALL(*mockBeaconCache, resetChunkedData(key)).Times(1);
+	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache()).WillOnce(testing::Return(17));
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(100)).WillOnce(testing::Return(3));
+
+	// given
+	AsyncBeaconCache_t target(mockLogger, mockBeaconCache, 1024, QueueFullPolicy_t::BLOCK);
+
+	// when, then
+	ASSERT_THAT(target.hasDataForSending(key), testing::Eq(true));
+	ASSERT_THAT(target.getNextBeaconChunk(key, prefix, 42, delimiter), testing::Eq(Utf8String_t("chunk")));
+	target.removeChunkedData(key);
+	target.resetChunkedData(key);
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(17));
+	ASSERT_THAT(target.evictRecordsBySize(100), testing::Eq(uint32_t(3)));
+}
@@ -621,6 +621,49 @@ TEST_F(BeaconCacheEntryTest, removeOldestRecordsRemovesActionDataIfEventDataIsEm
 	ASSERT_THAT(target.getActionData(), testing::Eq(std::list<BeaconCacheRecord_t>{ dataThree, dataFour }));
 }
 
+TEST_F(BeaconCacheEntryTest, removeOldestRecordsReturnsRemovedRecordsIfRequested)
+{
+	// given
+	BeaconCacheEntry_t target;
+	target.addActionData(BeaconCacheRecord_t(1000L, "One"));
+	target.addEventData(BeaconCacheRecord_t(1001L, "Two"));
+	target.addActionData(BeaconCacheRecord_t(1002L, "Three"));
+
+	// when
+	std::vector<core::caching::IBeaconCacheOverflowStore::Record> removedRecords;
+	auto obtained = target.removeOldestRecords(2, &removedRecords);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(2));
+	ASSERT_THAT(removedRecords.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(removedRecords[0].isActionData, testing::Eq(true));
+	ASSERT_THAT(removedRecords[0].timestamp, testing::Eq(1000L));
+	ASSERT_THAT(removedRecords[0].data, testing::Eq("One"));
+	ASSERT_THAT(removedRecords[1].isActionData, testing::Eq(false));
+	ASSERT_THAT(removedRecords[1].timestamp, testing::Eq(1001L));
+	ASSERT_THAT(removedRecords[1].data, testing::Eq("Two"));
+}
+
+TEST_F(BeaconCacheEntryTest, addRecordsForSendingAddsRecordsToDataBeingSent)
+{
+	// given
+	BeaconCacheEntry_t target;
+	target.addEventData(BeaconCacheRecord_t(1002L, "Three"));
+
+	// when
+	target.addRecordsForSending({
+		core::caching::IBeaconCacheOverflowStore::Record(false, 1000L, "One"),
+		core::caching::IBeaconCacheOverflowStore::Record(true, 1001L, "Two")
+	});
+
+	// then
+	ASSERT_THAT(target.hasDataToSend(), testing::Eq(true));
+	ASSERT_THAT(target.getEventDataBeingSent(), testing::Eq(std::list<BeaconCacheRecord_t>{ BeaconCacheRecord_t(1000L, "One") }));
+	ASSERT_THAT(target.getActionDataBeingSent(), testing::Eq(std::list<BeaconCacheRecord_t>{ BeaconCacheRecord_t(1001L, "Two") }));
+	ASSERT_THAT(target.getEventData(), testing::Eq(std::list<BeaconCacheRecord_t>{ BeaconCacheRecord_t(1002L, "Three") }));
+	ASSERT_THAT(target.getTotalNumberOfBytes(), testing::Eq(BeaconCacheRecord_t(1002L, "Three").getDataSizeInBytes()));
+}
+
 TEST_F(BeaconCacheEntryTest, removeOldestRecordsRemovesEventDataIfActionDataIsEmpty)
 {
 	// given
@@ -824,4 +867,60 @@ TEST_F(BeaconCacheEntryTest, hasDataForSendingReturnsTrueIfActionDataWasAddedBef
 
 	// then
 	ASSERT_THAT(obtained, testing::Eq(true));
-}
\ No newline at end of file
+}
+
+TEST_F(BeaconCacheEntryTest, removingRecordsReducesTotalNumberOfBytes)
+{
+	// given
+	BeaconCacheRecord_t dataOne(1000L, "One");
+	BeaconCacheRecord_t dataTwo(2000L, "Two");
+	BeaconCacheRecord_t dataThree(3000L, "Three");
+
+	BeaconCacheEntry_t target;
+	target.addEventData(dataOne);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	// when
+	target.removeRecordsOlderThan(2000L);
+
+	// then
+	ASSERT_THAT(target.getTotalNumberOfBytes(), testing::Eq(dataTwo.getDataSizeInBytes() + dataThree.getDataSizeInBytes()));
+
+	// and when
+	target.removeOldestRecords(1);
+
+	// then
+	ASSERT_THAT(target.getTotalNumberOfBytes(), testing::Eq(dataThree.getDataSizeInBytes()));
+}
+
+TEST_F(BeaconCacheEntryTest, getOldestRecordTimestampGivesTimestampOfNextRecordToEvict)
+{
+	// given
+	BeaconCacheRecord_t dataOne(2000L, "One");
+	BeaconCacheRecord_t dataTwo(1000L, "Two");
+	BeaconCacheRecord_t dataThree(3000L, "Three");
+
+	BeaconCacheEntry_t target;
+	ASSERT_THAT(target.hasRecordsToEvict(), testing::Eq(false));
+
+	target.addEventData(dataOne);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	// then
+	ASSERT_THAT(target.hasRecordsToEvict(), testing::Eq(true));
+	ASSERT_THAT(target.getOldestRecordTimestamp(), testing::Eq(1000L));
+
+	// and when
+	target.removeOldestRecords(1);
+
+	// then
+	ASSERT_THAT(target.getOldestRecordTimestamp(), testing::Eq(2000L));
+
+	// and when data is being sent
+	target.copyDataForSending();
+
+	// then
+	ASSERT_THAT(target.hasRecordsToEvict(), testing::Eq(false));
+}
@@ -22,6 +22,7 @@
 #include "core/caching/IObserver.h"
 #include "core/util/CountDownLatch.h"
 #include "core/util/CyclicBarrier.h"
+#include "core/util/SharedExecutor.h"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -34,6 +35,7 @@ using namespace test;
 using BeaconCacheEvictor_t = core::caching::BeaconCacheEvictor;
 using CountDownLatch_t = core::util::CountDownLatch;
 using CyclicBarrier_t = core::util::CyclicBarrier;
+using SharedExecutor_t = core::util::SharedExecutor;
 using IObserver_t = core::caching::IObserver;
 using MockNiceIBeaconCache_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCache>>;
 using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
@@ -54,6 +56,14 @@ protected:
 		mockBeaconCache = MockIBeaconCache::createNice();
 		mockStrategyOne = MockIBeaconCacheEvictionStrategy::createNice();
 		mockStrategyTwo = MockIBeaconCacheEvictionStrategy::createNice();
+
+		for (auto strategy : { mockStrategyOne, mockStrategyTwo })
+		{
+			ON_CALL(*strategy, isExecutionRequired())
+				.WillByDefault(testing::Return(true));
+			ON_CALL(*strategy, getMillisUntilNextExecution())
+				.WillByDefault(testing::Return(-1));
+		}
 	}
 };
 
@@ -214,3 +224,178 @@ TEST_F(BeaconCacheEvictorTest, triggeringEvictionStrategiesInThread)
 	ASSERT_TRUE(stopped);
 	ASSERT_FALSE(evictor.isAlive());
 }
+
+TEST_F(BeaconCacheEvictorTest, updateDoesNotWakeUpEvictionThreadIfNoStrategyRequiresExecution)
+{
+	// given
+	std::vector<IObserver_t*> observers;
+	CountDownLatch_t addObserverLatch(1);
+
+	ON_CALL(*mockBeaconCache, addObserver(testing::_))
+		.WillByDefault(testing::Invoke(
+			[&observers, &addObserverLatch](IObserver_t* observer) -> void
+			{
+				observers.push_back(observer);
+				addObserverLatch.countDown();
+			}
+		));
+	ON_CALL(*mockStrategyOne, isExecutionRequired())
+		.WillByDefault(testing::Return(false));
+	ON_CALL(*mockStrategyTwo, isExecutionRequired())
+		.WillByDefault(testing::Return(false));
+
+	EXPECT_CALL(*mockStrategyOne, execute())
+		.Times(0);
+	EXPECT_CALL(*mockStrategyTwo, execute())
+		.Times(0);
+
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne, mockStrategyTwo });
+	evictor.start();
+	addObserverLatch.await();
+
+	// when
+	for (int i = 0; i < 10; i++)
+	{
+		observers.front()->update();
+	}
+	auto stopped = evictor.stop();
+
+	// then
+	ASSERT_TRUE(stopped);
+	ASSERT_THAT(evictor.getNumUpdates(), testing::Eq(10u));
+	ASSERT_THAT(evictor.getNumWakeups(), testing::Eq(0u));
+}
+
+TEST_F(BeaconCacheEvictorTest, updatesAreCoalescedWhileWakeupIsPending)
+{
+	// given
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne });
+
+	// then
+	EXPECT_CALL(*mockStrategyOne, isExecutionRequired())
+		.Times(1);
+
+	// when the eviction thread is not running, the first wakeup stays pending
+	for (int i = 0; i < 10; i++)
+	{
+		evictor.update();
+	}
+
+	ASSERT_THAT(evictor.getNumUpdates(), testing::Eq(10u));
+}
+
+TEST_F(BeaconCacheEvictorTest, timeDrivenStrategiesAreExecutedWithoutUpdates)
+{
+	// given
+	CountDownLatch_t executeLatch(3);
+
+	ON_CALL(*mockStrategyOne, getMillisUntilNextExecution())
+		.WillByDefault(testing::Return(1));
+	ON_CALL(*mockStrategyOne, execute())
+		.WillByDefault(testing::Invoke(
+			[&executeLatch]() -> void
+			{
+				executeLatch.countDown();
+			}
+		));
+
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne, mockStrategyTwo });
+	evictor.start();
+
+	// when
+	executeLatch.await();
+	auto stopped = evictor.stop();
+
+	// then
+	ASSERT_TRUE(stopped);
+	ASSERT_THAT(evictor.getNumUpdates(), testing::Eq(0u));
+	ASSERT_THAT(evictor.getNumWakeups(), testing::Ge(3u));
+}
+
+TEST_F(BeaconCacheEvictorTest, startingAndStoppingABeaconCacheEvictorRunningOnASharedExecutor)
+{
+	// given
+	auto executor = std::make_shared<SharedExecutor_t>(1);
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne }, executor);
+
+	// then
+	EXPECT_CALL(*mockBeaconCache, addObserver(testing::_))
+		.Times(1);
+
+	// when
+	auto started = evictor.start();
+	auto startedAgain = evictor.start();
+	auto aliveAfterStart = evictor.isAlive();
+	auto stopped = evictor.stop();
+
+	// then
+	ASSERT_TRUE(started);
+	ASSERT_FALSE(startedAgain);
+	ASSERT_TRUE(aliveAfterStart);
+	ASSERT_TRUE(stopped);
+	ASSERT_FALSE(evictor.isAlive());
+}
+
+TEST_F(BeaconCacheEvictorTest, updateTriggersEvictionStrategiesOnASharedExecutor)
+{
+	// given
+	CyclicBarrier_t strategyInvokedBarrier(2);
+
+	ON_CALL(*mockStrategyTwo, execute())
+		.WillByDefault(testing::Invoke(
+			[&strategyInvokedBarrier]() -> void
+			{
+				strategyInvokedBarrier.await();
+			}
+		));
+
+	auto executor = std::make_shared<SharedExecutor_t>(1);
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne, mockStrategyTwo }, executor);
+	evictor.start();
+
+	EXPECT_CALL(*mockStrategyOne, execute())
+		.Times(testing::Exactly(10));
+	EXPECT_CALL(*mockStrategyTwo, execute())
+		.Times(testing::Exactly(10));
+
+	// when
+	for (int i = 0; i < 10; i++)
+	{
+		evictor.update();
+		strategyInvokedBarrier.await();
+	}
+	auto stopped = evictor.stop();
+
+	// then
+	ASSERT_TRUE(stopped);
+	ASSERT_THAT(evictor.getNumWakeups(), testing::Eq(10u));
+}
+
+TEST_F(BeaconCacheEvictorTest, timeDrivenStrategiesAreExecutedOnASharedExecutor)
+{
+	// given
+	CountDownLatch_t executeLatch(3);
+
+	ON_CALL(*mockStrategyOne, getMillisUntilNextExecution())
+		.WillByDefault(testing::Return(1));
+	ON_CALL(*mockStrategyOne, execute())
+		.WillByDefault(testing::Invoke(
+			[&executeLatch]() -> void
+			{
+				executeLatch.countDown();
+			}
+		));
+
+	auto executor = std::make_shared<SharedExecutor_t>(1);
+	BeaconCacheEvictor_t evictor(mockLogger, mockBeaconCache, { mockStrategyOne, mockStrategyTwo }, executor);
+	evictor.start();
+
+	// when
+	executeLatch.await();
+	auto stopped = evictor.stop();
+
+	// then
+	ASSERT_TRUE(stopped);
+	ASSERT_THAT(evictor.getNumUpdates(), testing::Eq(0u));
+	ASSERT_THAT(evictor.getNumWakeups(), testing::Ge(3u));
+}
@@ -0,0 +1,467 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../../api/mock/MockILogger.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCacheOverflowStore.h"
+#include "core/caching/BeaconKey.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace test;
+
+using BeaconCacheOverflowStore_t = core::caching::BeaconCacheOverflowStore;
+using BeaconHeader_t = core::caching::BeaconHeader;
+using BeaconKey_t = core::caching::BeaconKey;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using Record_t = core::caching::IBeaconCacheOverflowStore::Record;
+using RecoveredBeacon_t = core::caching::IBeaconCacheOverflowStore::RecoveredBeacon;
+using Utf8String_t = core::UTF8String;
+
+static const std::string DIRECTORY = "BeaconCacheOverflowStoreTest";
+static constexpr int64_t MAX_SIZE_IN_BYTES = 64 * 1024;
+static constexpr uint64_t MAX_NUMBER_OF_SEGMENTS = 256;
+static constexpr size_t MAX_NUM_BYTES = 1024 * 1024;
+
+class BeaconCacheOverflowStoreTest : public testing::Test
+{
+protected:
+
+	MockNiceILogger_sp mockLogger;
+	BeaconHeader_t header;
+
+	void SetUp() override
+	{
+		mockLogger = MockILogger::createNice();
+
+		header.deviceID = 42;
+		header.sessionNumber = 7;
+		header.clientIPAddress = "127.0.0.1";
+		header.beaconData = "vv=3&va=8.0.0&ap=appID";
+
+		removeDirectory();
+#ifdef _WIN32
+		_mkdir(DIRECTORY.c_str());
+#else
+		mkdir(DIRECTORY.c_str(), 0700);
+#endif
+	}
+
+	void TearDown() override
+	{
+		removeDirectory();
+	}
+
+	static void removeDirectory()
+	{
+		std::remove(getManifestFileName().c_str());
+		std::remove((getManifestFileName() + ".tmp").c_str());
+		for (uint64_t segmentID = 0; segmentID < MAX_NUMBER_OF_SEGMENTS; segmentID++)
+		{
+			std::remove(getSegmentFileName(segmentID).c_str());
+		}
+#ifdef _WIN32
+		_rmdir(DIRECTORY.c_str());
+#else
+		rmdir(DIRECTORY.c_str());
+#endif
+	}
+
+	static std::string getSegmentFileName(uint64_t segmentID)
+	{
+		return DIRECTORY + "/beacons-" + std::to_string(segmentID) + ".seg";
+	}
+
+	static std::string getManifestFileName()
+	{
+		return DIRECTORY + "/beacons.manifest";
+	}
+
+	std::shared_ptr<BeaconCacheOverflowStore_t> createStore(int64_t maxSizeInBytes = MAX_SIZE_IN_BYTES)
+	{
+		return std::make_shared<BeaconCacheOverflowStore_t>(mockLogger, DIRECTORY, maxSizeInBytes);
+	}
+};
+
+TEST_F(BeaconCacheOverflowStoreTest, openFailsIfDirectoryDoesNotExist)
+{
+	// given
+	BeaconCacheOverflowStore_t target(mockLogger, DIRECTORY + "/does/not/exist", MAX_SIZE_IN_BYTES);
+
+	// when
+	auto obtained = target.open();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a") }), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, storedRecordsCanBeTakenInStoredOrder)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	BeaconKey_t key(1, 0);
+
+	// when
+	target->store(key, header, { Record_t(false, 1000, "a"), Record_t(true, 1001, "b") });
+	target->store(key, header, { Record_t(false, 1002, "\xC3\xA4") });
+
+	// then
+	ASSERT_THAT(target->hasRecords(key), testing::Eq(true));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(1, 1)), testing::Eq(false));
+
+	auto obtained = target->takeRecords(key, MAX_NUM_BYTES);
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(3)));
+	ASSERT_THAT(obtained[0].isActionData, testing::Eq(false));
+	ASSERT_THAT(obtained[0].timestamp, testing::Eq(int64_t(1000)));
+	ASSERT_THAT(obtained[0].data, testing::Eq("a"));
+	ASSERT_THAT(obtained[1].isActionData, testing::Eq(true));
+	ASSERT_THAT(obtained[1].timestamp, testing::Eq(int64_t(1001)));
+	ASSERT_THAT(obtained[1].data, testing::Eq("b"));
+	ASSERT_THAT(obtained[2].isActionData, testing::Eq(false));
+	ASSERT_THAT(obtained[2].timestamp, testing::Eq(int64_t(1002)));
+	ASSERT_THAT(obtained[2].data, testing::Eq("\xC3\xA4"));
+
+	ASSERT_THAT(target->hasRecords(key), testing::Eq(false));
+	ASSERT_THAT(target->takeRecords(key, MAX_NUM_BYTES), testing::IsEmpty());
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, takeRecordsTakesOldestRecordsFittingIntoGivenSize)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	BeaconKey_t key(1, 0);
+	target->store(key, header, {
+		Record_t(false, 1000, Utf8String_t(std::string(1000, 'a'))),
+		Record_t(false, 1001, Utf8String_t(std::string(1000, 'b'))),
+		Record_t(false, 1002, Utf8String_t(std::string(1000, 'c')))
+	});
+
+	// when
+	auto first = target->takeRecords(key, 1500);
+	auto second = target->takeRecords(key, 1500);
+
+	// then
+	ASSERT_THAT(first.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(first[0].timestamp, testing::Eq(int64_t(1000)));
+	ASSERT_THAT(second.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(second[0].timestamp, testing::Eq(int64_t(1001)));
+	ASSERT_THAT(target->hasRecords(key), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, takeRecordsTakesAtLeastOneRecord)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	BeaconKey_t key(1, 0);
+	target->store(key, header, { Record_t(false, 1000, "a"), Record_t(false, 1001, "b") });
+
+	// when
+	auto obtained = target->takeRecords(key, 0);
+
+	// then
+	ASSERT_THAT(obtained.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained[0].data, testing::Eq("a"));
+	ASSERT_THAT(target->hasRecords(key), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, removeRecordsDiscardsAllRecordsOfBeacon)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	target->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a") });
+	target->store(BeaconKey_t(2, 0), header, { Record_t(false, 1000, "b") });
+
+	// when
+	target->removeRecords(BeaconKey_t(1, 0));
+
+	// then
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(1, 0)), testing::Eq(false));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(2, 0)), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, recordsOfCurrentProcessAreNotReturnedAsRecoveredBeacon)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	target->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a") });
+
+	// when
+	RecoveredBeacon_t recoveredBeacon;
+	auto obtained = target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(1, 0)), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, recordsOfPreviousProcessAreRecovered)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 2), header, { Record_t(false, 1000, "a"), Record_t(true, 1001, "b") });
+	previous.reset();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	RecoveredBeacon_t recoveredBeacon;
+	auto obtained = target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(recoveredBeacon.beaconKey, testing::Eq(BeaconKey_t(1, 2)));
+	ASSERT_THAT(recoveredBeacon.header.deviceID, testing::Eq(int64_t(42)));
+	ASSERT_THAT(recoveredBeacon.header.sessionNumber, testing::Eq(7));
+	ASSERT_THAT(recoveredBeacon.header.clientIPAddress, testing::Eq("127.0.0.1"));
+	ASSERT_THAT(recoveredBeacon.header.beaconData, testing::Eq("vv=3&va=8.0.0&ap=appID"));
+	ASSERT_THAT(recoveredBeacon.records.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(recoveredBeacon.records[0].data, testing::Eq("a"));
+	ASSERT_THAT(recoveredBeacon.records[1].data, testing::Eq("b"));
+	ASSERT_THAT(recoveredBeacon.records[1].isActionData, testing::Eq(true));
+
+	// the records of the previous process do not clash with the current process' records
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(1, 2)), testing::Eq(false));
+	ASSERT_THAT(target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, takenRecordsAreNotRecovered)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a") });
+	previous->store(BeaconKey_t(2, 0), header, { Record_t(false, 1000, "b") });
+	previous->takeRecords(BeaconKey_t(1, 0), MAX_NUM_BYTES);
+	previous->removeRecords(BeaconKey_t(2, 0));
+	previous.reset();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	RecoveredBeacon_t recoveredBeacon;
+	auto obtained = target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, partiallyTakenRecordsAreNotRecovered)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a"), Record_t(false, 1001, "b"), Record_t(false, 1002, "c") });
+	previous->takeRecords(BeaconKey_t(1, 0), 0);
+	previous.reset();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	RecoveredBeacon_t recoveredBeacon;
+	auto obtained = target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(recoveredBeacon.records.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(recoveredBeacon.records[0].data, testing::Eq("b"));
+	ASSERT_THAT(recoveredBeacon.records[1].data, testing::Eq("c"));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, recoveredBeaconIsTakenInBatches)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a"), Record_t(false, 1001, "b") });
+	previous.reset();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	RecoveredBeacon_t first;
+	RecoveredBeacon_t second;
+	RecoveredBeacon_t third;
+	ASSERT_THAT(target->takeRecoveredBeacon(first, 0), testing::Eq(true));
+	ASSERT_THAT(target->takeRecoveredBeacon(second, 0), testing::Eq(true));
+	auto obtained = target->takeRecoveredBeacon(third, 0);
+
+	// then
+	ASSERT_THAT(first.records.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(first.records[0].data, testing::Eq("a"));
+	ASSERT_THAT(second.records.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(second.records[0].data, testing::Eq("b"));
+	ASSERT_THAT(second.header.beaconData, testing::Eq("vv=3&va=8.0.0&ap=appID"));
+	ASSERT_THAT(obtained, testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, manifestIsReplacedWhenReopening)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous.reset();
+
+	// when
+	auto target = createStore();
+	auto obtained = target->open();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(std::ifstream(getManifestFileName()).good(), testing::Eq(true));
+	ASSERT_THAT(std::ifstream(getManifestFileName() + ".tmp").good(), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, restoredRecoveredBeaconIsRecoveredAgain)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a"), Record_t(false, 1001, "b") });
+	previous.reset();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	RecoveredBeacon_t recoveredBeacon;
+	ASSERT_THAT(target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES), testing::Eq(true));
+	recoveredBeacon.records.erase(recoveredBeacon.records.begin());
+
+	// when
+	target->restoreRecoveredBeacon(recoveredBeacon);
+
+	// then
+	RecoveredBeacon_t obtained;
+	ASSERT_THAT(target->takeRecoveredBeacon(obtained, MAX_NUM_BYTES), testing::Eq(true));
+	ASSERT_THAT(obtained.beaconKey, testing::Eq(BeaconKey_t(1, 0)));
+	ASSERT_THAT(obtained.records.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained.records[0].data, testing::Eq("b"));
+
+	// also after a restart
+	target->restoreRecoveredBeacon(obtained);
+	target.reset();
+	target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	ASSERT_THAT(target->takeRecoveredBeacon(obtained, MAX_NUM_BYTES), testing::Eq(true));
+	ASSERT_THAT(obtained.records.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(obtained.records[0].data, testing::Eq("b"));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, oldestRecordsAreDiscardedIfMaxSizeIsExceeded)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	Utf8String_t data(std::string(1024, 'x'));
+
+	// when
+	for (int32_t i = 0; i < 256; i++)
+	{
+		ASSERT_THAT(target->store(BeaconKey_t(i, 0), header, { Record_t(false, i, data) }), testing::Eq(true));
+	}
+
+	// then
+	ASSERT_THAT(target->getSizeInBytes(), testing::Le(MAX_SIZE_IN_BYTES));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(0, 0)), testing::Eq(false));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(255, 0)), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, recordsExceedingMaxSizeAreNotStored)
+{
+	// given
+	auto target = createStore(8 * 1024);
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	auto obtained = target->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, Utf8String_t(std::string(16 * 1024, 'x'))) });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target->hasRecords(BeaconKey_t(1, 0)), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, segmentFilesAreDeletedIfAllRecordsHaveBeenTaken)
+{
+	// given
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+	auto initialSize = target->getSizeInBytes();
+	Utf8String_t data(std::string(1024, 'x'));
+	for (int32_t i = 0; i < 32; i++)
+	{
+		target->store(BeaconKey_t(i, 0), header, { Record_t(false, i, data) });
+	}
+
+	// when
+	for (int32_t i = 0; i < 32; i++)
+	{
+		target->takeRecords(BeaconKey_t(i, 0), MAX_NUM_BYTES);
+	}
+
+	// then
+	ASSERT_THAT(std::ifstream(getSegmentFileName(0)).good(), testing::Eq(false));
+	ASSERT_THAT(target->getSizeInBytes(), testing::Lt(initialSize + 32 * 1024));
+}
+
+TEST_F(BeaconCacheOverflowStoreTest, truncatedRecordAtEndOfSegmentIsIgnoredOnRecovery)
+{
+	// given
+	auto previous = createStore();
+	ASSERT_THAT(previous->open(), testing::Eq(true));
+	previous->store(BeaconKey_t(1, 0), header, { Record_t(false, 1000, "a") });
+	previous.reset();
+
+	// simulate a crash while writing a record
+	std::ofstream segment(getSegmentFileName(0), std::ios::binary | std::ios::app);
+	segment.write("\x40\x00\x00\x00\x02", 5);
+	segment.close();
+
+	auto target = createStore();
+	ASSERT_THAT(target->open(), testing::Eq(true));
+
+	// when
+	RecoveredBeacon_t recoveredBeacon;
+	auto obtained = target->takeRecoveredBeacon(recoveredBeacon, MAX_NUM_BYTES);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(recoveredBeacon.records.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(recoveredBeacon.records[0].data, testing::Eq("a"));
+}
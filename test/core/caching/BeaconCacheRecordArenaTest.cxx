@@ -0,0 +1,316 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconCacheRecordArena.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <limits>
+#include <string>
+
+using BeaconCacheRecordArena_t = core::caching::BeaconCacheRecordArena;
+using Utf8String_t = core::UTF8String;
+
+class BeaconCacheRecordArenaTest : public testing::Test
+{
+};
+
+TEST_F(BeaconCacheRecordArenaTest, aDefaultConstructedArenaIsEmpty)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(true));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(0)));
+	ASSERT_THAT(target.getRecords(), testing::IsEmpty());
+}
+
+TEST_F(BeaconCacheRecordArenaTest, addedRecordsAreKeptInInsertionOrder)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+
+	// when
+	target.add(1000, "foo");
+	target.add(500, "");
+	target.add(1500, "\xC3\xA4");
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(3)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(5)));
+
+	auto records = target.getRecords();
+	ASSERT_THAT(records.size(), testing::Eq(size_t(3)));
+	auto it = records.begin();
+	ASSERT_THAT(it->getTimestamp(), testing::Eq(int64_t(1000)));
+	ASSERT_THAT(it->getData(), testing::Eq("foo"));
+	++it;
+	ASSERT_THAT(it->getTimestamp(), testing::Eq(int64_t(500)));
+	ASSERT_THAT(it->getData(), testing::Eq(""));
+	++it;
+	ASSERT_THAT(it->getTimestamp(), testing::Eq(int64_t(1500)));
+	ASSERT_THAT(it->getData(), testing::Eq("\xC3\xA4"));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, manyAndLargeRecordsSpanningMultipleBlocksCanBeAdded)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	std::string large(64 * 1024, 'x');
+
+	// when
+	for (int64_t i = 0; i < 1000; i++)
+	{
+		target.add(i, "record");
+	}
+	target.add(1000, Utf8String_t(large));
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1001)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(6 * 1000 + large.size())));
+
+	auto records = target.getRecords();
+	int64_t expectedTimestamp = 0;
+	for (const auto& record : records)
+	{
+		ASSERT_THAT(record.getTimestamp(), testing::Eq(expectedTimestamp));
+		expectedTimestamp++;
+	}
+	ASSERT_THAT(records.back().getData(), testing::Eq(Utf8String_t(large)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, prependMovesRecordsOfOtherArenaToTheFront)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(3, "c");
+	BeaconCacheRecordArena_t other;
+	other.add(1, "a");
+	other.add(2, "bb");
+
+	// when
+	target.prepend(other);
+
+	// then
+	ASSERT_THAT(other.empty(), testing::Eq(true));
+	ASSERT_THAT(other.getDataSizeInBytes(), testing::Eq(int64_t(0)));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(3)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(4)));
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(1)));
+
+	// and when adding data afterwards, it's appended at the end
+	target.add(4, "d");
+	auto records = target.getRecords();
+	ASSERT_THAT(records.back().getTimestamp(), testing::Eq(int64_t(4)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, appendToChunkAppendsDataUntilMaxSizeIsExceeded)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(1, "abc");
+	target.add(2, "def");
+	target.add(3, "ghi");
+	Utf8String_t chunk("prefix");
+
+	// when
+	target.appendToChunk(chunk, 10, "&");
+
+	// then
+	ASSERT_THAT(chunk, testing::Eq("prefix&abc&def"));
+	ASSERT_THAT(chunk.getStringLength(), testing::Eq(size_t(14)));
+
+	auto records = target.getRecords();
+	auto it = records.begin();
+	ASSERT_THAT(it->isMarkedForSending(), testing::Eq(true));
+	++it;
+	ASSERT_THAT(it->isMarkedForSending(), testing::Eq(true));
+	++it;
+	ASSERT_THAT(it->isMarkedForSending(), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, removeMarkedForSendingOnlyRemovesMarkedRecords)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(1, "abc");
+	target.add(2, "def");
+	target.add(3, "ghi");
+	Utf8String_t chunk;
+	target.appendToChunk(chunk, 5, "&");
+
+	// when
+	target.removeMarkedForSending();
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(3)));
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(3)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, unsetSendingRemovesAllSendingMarks)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(1, "abc");
+	target.add(2, "def");
+	Utf8String_t chunk;
+	target.appendToChunk(chunk, 100, "&");
+
+	// when
+	target.unsetSending();
+	target.removeMarkedForSending();
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+	for (const auto& record : target.getRecords())
+	{
+		ASSERT_THAT(record.isMarkedForSending(), testing::Eq(false));
+	}
+}
+
+TEST_F(BeaconCacheRecordArenaTest, removeRecordsOlderThanRemovesRecordsInAnyPosition)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(1000, "a");
+	target.add(2000, "b");
+	target.add(500, "cc");
+	target.add(3000, "d");
+
+	// when
+	auto obtained = target.removeRecordsOlderThan(1500);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(2));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(2)));
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(2000)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, removeRecordsOlderThanReleasesEmptyBlocksInAnyPosition)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	// each record is too large to share its block with the previous one
+	target.add(1000, Utf8String_t(std::string(300, 'a')));
+	target.add(500, Utf8String_t(std::string(700, 'b')));
+	target.add(2000, Utf8String_t(std::string(1500, 'c')));
+	ASSERT_THAT(target.getNumberOfBlocks(), testing::Eq(size_t(3)));
+
+	// when
+	auto obtained = target.removeRecordsOlderThan(750);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(1));
+	ASSERT_THAT(target.getNumberOfBlocks(), testing::Eq(size_t(2)));
+
+	auto records = target.getRecords();
+	ASSERT_THAT(records.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(records.front().getTimestamp(), testing::Eq(int64_t(1000)));
+	ASSERT_THAT(records.back().getTimestamp(), testing::Eq(int64_t(2000)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, removingAllRecordsKeepsOnlyOneBlock)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	target.add(1000, Utf8String_t(std::string(300, 'a')));
+	target.add(500, Utf8String_t(std::string(700, 'b')));
+	target.add(2000, Utf8String_t(std::string(1500, 'c')));
+
+	// when
+	target.removeRecordsOlderThan(3000);
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(true));
+	ASSERT_THAT(target.getNumberOfBlocks(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getMinTimestamp(), testing::Eq(std::numeric_limits<int64_t>::max()));
+
+	// and when
+	target.add(4000, "d");
+
+	// then
+	ASSERT_THAT(target.getNumberOfBlocks(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(4000)));
+	ASSERT_THAT(target.getFirstData(), testing::Eq("d"));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, removeFirstRemovesRecordsFromTheFront)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	for (int64_t i = 0; i < 100; i++)
+	{
+		target.add(i, "some record data");
+	}
+
+	// when
+	for (int64_t i = 0; i < 99; i++)
+	{
+		ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(i));
+		target.removeFirst();
+	}
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(99)));
+
+	// and when removing the last one
+	target.removeFirst();
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(true));
+	ASSERT_THAT(target.getDataSizeInBytes(), testing::Eq(int64_t(0)));
+
+	// and when adding again
+	target.add(100, "x");
+
+	// then
+	ASSERT_THAT(target.getFirstTimestamp(), testing::Eq(int64_t(100)));
+}
+
+TEST_F(BeaconCacheRecordArenaTest, getMinTimestampIsALowerBoundOfAllTimestamps)
+{
+	// given
+	BeaconCacheRecordArena_t target;
+	ASSERT_THAT(target.getMinTimestamp(), testing::Eq(std::numeric_limits<int64_t>::max()));
+
+	target.add(2000, "a");
+	target.add(1000, "b");
+	target.add(3000, "c");
+
+	// then
+	ASSERT_THAT(target.getMinTimestamp(), testing::Eq(int64_t(1000)));
+
+	// and when
+	target.removeRecordsOlderThan(1500);
+
+	// then
+	ASSERT_THAT(target.getMinTimestamp(), testing::Eq(int64_t(2000)));
+
+	// and when nothing is old enough
+	auto obtained = target.removeRecordsOlderThan(2000);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(0));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+}
@@ -15,6 +15,7 @@
  */
 
 #include "../../api/mock/MockILogger.h"
+#include "mock/MockIBeaconCacheOverflowStore.h"
 #include "mock/MockIObserver.h"
 
 #include "core/UTF8String.h"
@@ -26,16 +27,22 @@
 #include "gmock/gmock.h"
 
 #include <algorithm>
+#include <thread>
+#include <vector>
 
 using namespace test;
 
 using BeaconCache_t = core::caching::BeaconCache;
 using BeaconCacheRecord_t = core::caching::BeaconCacheRecord;
+using BeaconHeader_t = core::caching::BeaconHeader;
 using BeaconKey_t = core::caching::BeaconKey;
 using BeaconKeySet_t = std::unordered_set<BeaconKey_t, BeaconKey_t::Hash>;
 using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
 using MockNiceIObserver_t = testing::NiceMock<MockIObserver>;
 using MockStrictIObserver_t = testing::StrictMock<MockIObserver>;
+using OverflowRecord_t = core::caching::IBeaconCacheOverflowStore::Record;
+using OverflowRecords_t = std::vector<OverflowRecord_t>;
+using RecoveredBeacon_t = core::caching::IBeaconCacheOverflowStore::RecoveredBeacon;
 using Utf8String_t = core::UTF8String;
 
 class BeaconCacheTest : public testing::Test
@@ -123,6 +130,49 @@ TEST_F(BeaconCacheTest, addEventDataIncreasesCacheSize)
 		testing::Eq(BeaconCacheRecord_t(1000L, "a").getDataSizeInBytes() +	BeaconCacheRecord_t(1000L, "z").getDataSizeInBytes() + BeaconCacheRecord_t(1000L, "iii").getDataSizeInBytes()));
 }
 
+TEST_F(BeaconCacheTest, concurrentlyAddedDataOfManyBeaconsIsCompletelyAccounted)
+{
+	// given
+	const int32_t numThreads = 8;
+	const int32_t numBeaconsPerThread = 10;
+	const int32_t numRecordsPerBeacon = 50;
+	BeaconCache_t target(mockLogger);
+
+	// when adding data from multiple threads, each using own beacons
+	std::vector<std::thread> threads;
+	for (int32_t threadIndex = 0; threadIndex < numThreads; threadIndex++)
+	{
+		threads.emplace_back([&target, threadIndex]()
+		{
+			for (int32_t record = 0; record < numRecordsPerBeacon; record++)
+			{
+				for (int32_t beacon = 0; beacon < numBeaconsPerThread; beacon++)
+				{
+					BeaconKey_t key(threadIndex * numBeaconsPerThread + beacon, 0);
+					target.addEventData(key, 1000L, "e");
+					target.addActionData(key, 1000L, "a");
+				}
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then
+	auto keys = target.getBeaconKeys();
+	ASSERT_THAT(keys.size(), testing::Eq(size_t(numThreads * numBeaconsPerThread)));
+	for (const auto& key : keys)
+	{
+		ASSERT_THAT(target.getEvents(key).size(), testing::Eq(size_t(numRecordsPerBeacon)));
+		ASSERT_THAT(target.getActions(key).size(), testing::Eq(size_t(numRecordsPerBeacon)));
+	}
+
+	auto recordSize = BeaconCacheRecord_t(1000L, "e").getDataSizeInBytes();
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(2 * numThreads * numBeaconsPerThread * numRecordsPerBeacon * recordSize));
+}
+
 TEST_F(BeaconCacheTest, addEventDataNotifiesObserver)
 {
 	// given
@@ -678,6 +728,272 @@ TEST_F(BeaconCacheTest, evictRecordsByNumber)
 	ASSERT_THAT(obtained, testing::Eq(static_cast<uint32_t>(2)));
 }
 
+TEST_F(BeaconCacheTest, evictRecordsUpdatesNumBytesInCache)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	BeaconCache_t target(mockLogger);
+	target.addActionData(key, 1000L, "a");
+	target.addActionData(key, 1001L, "iii");
+	target.addEventData(key, 1000L, "b");
+	target.addEventData(key, 1001L, "jjj");
+
+	// when
+	target.evictRecordsByAge(key, 1001);
+
+	// then
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(6L));	// iiijjj
+
+	// and when
+	target.evictRecordsByNumber(key, 1);
+
+	// then
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(3L));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsCountsNumberOfEvictedRecords)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	BeaconCache_t target(mockLogger);
+	target.addActionData(key, 1000L, "a");
+	target.addActionData(key, 1001L, "iii");
+	target.addEventData(key, 1000L, "b");
+	target.addEventData(key, 1001L, "jjj");
+	target.addEventData(key, 1002L, "kkk");
+
+	// when
+	target.evictRecordsByAge(key, 1001);
+	target.evictRecordsByNumber(key, 1);
+	target.evictRecordsBySize(1);
+
+	// then
+	ASSERT_THAT(target.getNumEvictedRecords(), testing::Eq(static_cast<uint64_t>(4)));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsBySizeEvictsOldestRecordsOfAllBeacons)
+{
+	// given
+	BeaconKey_t keyOne(1, 0);
+	BeaconKey_t keyTwo(2, 0);
+	BeaconCache_t target(mockLogger);
+	target.addActionData(keyOne, 1000L, "aa");
+	target.addEventData(keyOne, 1003L, "bb");
+	target.addActionData(keyTwo, 1001L, "cc");
+	target.addEventData(keyTwo, 1002L, "dd");
+	target.addEventData(keyTwo, 1004L, "ee");
+
+	// when
+	auto obtained = target.evictRecordsBySize(5);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(static_cast<uint32_t>(3)));
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(4L));
+	ASSERT_THAT(target.getActions(keyOne), testing::IsEmpty());
+	ASSERT_THAT(target.getEvents(keyOne), testing::ElementsAre(core::UTF8String("bb")));
+	ASSERT_THAT(target.getActions(keyTwo), testing::IsEmpty());
+	ASSERT_THAT(target.getEvents(keyTwo), testing::ElementsAre(core::UTF8String("ee")));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsBySizeDoesNotEvictDataBeingSent)
+{
+	// given
+	BeaconKey_t keyOne(1, 0);
+	BeaconKey_t keyTwo(2, 0);
+	BeaconCache_t target(mockLogger);
+	target.addActionData(keyOne, 1000L, "aa");
+	target.addActionData(keyTwo, 1001L, "cc");
+	target.prepareDataForSending(keyOne);
+
+	// when
+	auto obtained = target.evictRecordsBySize(100);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(static_cast<uint32_t>(1)));
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(0L));
+	ASSERT_THAT(target.getActionsBeingSent(keyOne).size(), testing::Eq(size_t(1)));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsBySizeMovesRecordsToOverflowStore)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	BeaconHeader_t header;
+	header.beaconData = "vv=3";
+	auto overflowStore = MockIBeaconCacheOverflowStore::createStrict();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.setBeaconHeader(key, header);
+	target.addActionData(key, 1000L, "aa");
+	target.addEventData(key, 1001L, "bb");
+	target.addEventData(key, 1002L, "cc");
+
+	// expect
+	OverflowRecords_t storedRecords;
+	EXPECT_CALL(*overflowStore, store(testing::Eq(key), testing::Field(&BeaconHeader_t::beaconData, testing::Eq("vv=3")), testing::_))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&storedRecords), testing::Return(true)));
+
+	// when
+	auto obtained = target.evictRecordsBySize(3);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(static_cast<uint32_t>(2)));
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(2L));
+	ASSERT_THAT(storedRecords.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(storedRecords[0].isActionData, testing::Eq(true));
+	ASSERT_THAT(storedRecords[0].timestamp, testing::Eq(1000L));
+	ASSERT_THAT(storedRecords[0].data, testing::Eq("aa"));
+	ASSERT_THAT(storedRecords[1].isActionData, testing::Eq(false));
+	ASSERT_THAT(storedRecords[1].timestamp, testing::Eq(1001L));
+	ASSERT_THAT(storedRecords[1].data, testing::Eq("bb"));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsBySizeRemovesSpilledRecordsOfBeaconDeletedInTheMeantime)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.addEventData(key, 1000L, "aa");
+
+	// expect
+	EXPECT_CALL(*overflowStore, store(testing::Eq(key), testing::_, testing::_))
+		.WillOnce(testing::DoAll(testing::InvokeWithoutArgs([&target, &key]() { target.deleteCacheEntry(key); }),
+			testing::Return(true)));
+	EXPECT_CALL(*overflowStore, removeRecords(key))
+		.Times(2);
+
+	// when
+	target.evictRecordsBySize(1);
+}
+
+TEST_F(BeaconCacheTest, hasDataForSendingGivesTrueIfBeaconHasRecordsInOverflowStore)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.setBeaconHeader(key, BeaconHeader_t());
+
+	ON_CALL(*overflowStore, hasRecords(key))
+		.WillByDefault(testing::Return(true));
+
+	// when
+	target.prepareDataForSending(key);
+
+	// then
+	ASSERT_THAT(target.hasDataForSending(key), testing::Eq(true));
+}
+
+TEST_F(BeaconCacheTest, getNextBeaconChunkPagesInRecordsFromOverflowStoreOneChunkAtATime)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.addEventData(key, 1002L, "cc");
+
+	ON_CALL(*overflowStore, hasRecords(key))
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*overflowStore, takeRecords(key, size_t(1024)))
+		.WillOnce(testing::Return(OverflowRecords_t{ OverflowRecord_t(true, 1000L, "aa"), OverflowRecord_t(false, 1001L, "bb") }));
+
+	// when
+	target.prepareDataForSending(key);
+	auto firstChunk = target.getNextBeaconChunk(key, "prefix", 1024, "&");
+	target.removeChunkedData(key);
+	auto secondChunk = target.getNextBeaconChunk(key, "prefix", 1024, "&");
+
+	// then
+	ASSERT_THAT(firstChunk, testing::Eq("prefix&cc"));
+	ASSERT_THAT(secondChunk, testing::Eq("prefix&bb&aa"));
+	ASSERT_THAT(target.getNumBytesInCache(), testing::Eq(0L));
+}
+
+TEST_F(BeaconCacheTest, prepareDataForSendingDoesNotPageInRecordsFromOverflowStore)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.addEventData(key, 1002L, "cc");
+
+	ON_CALL(*overflowStore, hasRecords(key))
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*overflowStore, takeRecords(testing::_, testing::_))
+		.Times(0);
+
+	// when
+	target.prepareDataForSending(key);
+	target.getNextBeaconChunk(key, "prefix", 1024, "&");
+}
+
+TEST_F(BeaconCacheTest, deleteCacheEntryRemovesRecordsFromOverflowStore)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.addEventData(key, 1000L, "a");
+
+	// expect
+	EXPECT_CALL(*overflowStore, removeRecords(key))
+		.Times(1);
+
+	// when
+	target.deleteCacheEntry(key);
+}
+
+TEST_F(BeaconCacheTest, isEmptyGivesFalseIfBeaconHasRecordsInOverflowStore)
+{
+	// given
+	BeaconKey_t key(1, 0);
+	auto overflowStore = MockIBeaconCacheOverflowStore::createNice();
+	BeaconCache_t target(mockLogger, overflowStore);
+	target.setBeaconHeader(key, BeaconHeader_t());
+
+	ON_CALL(*overflowStore, hasRecords(key))
+		.WillByDefault(testing::Return(true));
+
+	// then
+	ASSERT_THAT(target.isEmpty(key), testing::Eq(false));
+}
+
+TEST_F(BeaconCacheTest, recoveredBeaconsAreDelegatedToOverflowStore)
+{
+	// given
+	auto overflowStore = MockIBeaconCacheOverflowStore::createStrict();
+	BeaconCache_t target(mockLogger, overflowStore);
+	RecoveredBeacon_t recoveredBeacon;
+
+	// expect
+	EXPECT_CALL(*overflowStore, takeRecoveredBeacon(testing::Ref(recoveredBeacon), size_t(1024)))
+		.WillOnce(testing::Return(true));
+	EXPECT_CALL(*overflowStore, restoreRecoveredBeacon(testing::Ref(recoveredBeacon)))
+		.Times(1);
+
+	// when
+	ASSERT_THAT(target.takeRecoveredBeacon(recoveredBeacon, 1024), testing::Eq(true));
+	target.restoreRecoveredBeacon(recoveredBeacon);
+}
+
+TEST_F(BeaconCacheTest, setBeaconHeaderAndRecoveredBeaconsAreIgnoredWithoutOverflowStore)
+{
+	// given
+	BeaconCache_t target(mockLogger);
+	RecoveredBeacon_t recoveredBeacon;
+
+	// when
+	target.setBeaconHeader(BeaconKey_t(1, 0), BeaconHeader_t());
+
+	// then
+	ASSERT_THAT(target.getBeaconKeys(), testing::IsEmpty());
+	ASSERT_THAT(target.takeRecoveredBeacon(recoveredBeacon, 1024), testing::Eq(false));
+}
+
 TEST_F(BeaconCacheTest, isEmptyGivesTrueIfBeaconDoesNotExistInCache)
 {
 	// given
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/UTF8String.h"
+#include "core/caching/BeaconKey.h"
+#include "core/caching/BeaconRecordQueue.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <thread>
+#include <vector>
+
+using BeaconKey_t = core::caching::BeaconKey;
+using BeaconRecordQueue_t = core::caching::BeaconRecordQueue;
+using Record_t = core::caching::BeaconRecordQueue::Record;
+using Utf8String_t = core::UTF8String;
+
+class BeaconRecordQueueTest : public testing::Test
+{
+};
+
+TEST_F(BeaconRecordQueueTest, capacityIsRoundedUpToPowerOfTwo)
+{
+	ASSERT_THAT(BeaconRecordQueue_t(0).getCapacity(), testing::Eq(size_t(2)));
+	ASSERT_THAT(BeaconRecordQueue_t(2).getCapacity(), testing::Eq(size_t(2)));
+	ASSERT_THAT(BeaconRecordQueue_t(3).getCapacity(), testing::Eq(size_t(4)));
+	ASSERT_THAT(BeaconRecordQueue_t(1000).getCapacity(), testing::Eq(size_t(1024)));
+}
+
+TEST_F(BeaconRecordQueueTest, popFromEmptyQueueFails)
+{
+	// given
+	BeaconRecordQueue_t target(4);
+	Record_t record;
+
+	// when, then
+	ASSERT_THAT(target.tryPop(record), testing::Eq(false));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+}
+
+TEST_F(BeaconRecordQueueTest, recordsArePoppedInTheOrderTheyWerePushed)
+{
+	// given
+	BeaconRecordQueue_t target(4);
+	Record_t first(BeaconKey_t(1, 0), 1000, "a=b", false);
+	Record_t second(BeaconKey_t(2, 1), 2000, "c=d", true);
+
+	// when
+	ASSERT_THAT(target.tryPush(first), testing::Eq(true));
+	ASSERT_THAT(target.tryPush(second), testing::Eq(true));
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+
+	Record_t obtained;
+	ASSERT_THAT(target.tryPop(obtained), testing::Eq(true));
+	ASSERT_THAT(obtained.beaconKey, testing::Eq(BeaconKey_t(1, 0)));
+	ASSERT_THAT(obtained.timestamp, testing::Eq(1000));
+	ASSERT_THAT(obtained.data, testing::Eq(Utf8String_t("a=b")));
+	ASSERT_THAT(obtained.isActionData, testing::Eq(false));
+
+	ASSERT_THAT(target.tryPop(obtained), testing::Eq(true));
+	ASSERT_THAT(obtained.beaconKey, testing::Eq(BeaconKey_t(2, 1)));
+	ASSERT_THAT(obtained.timestamp, testing::Eq(2000));
+	ASSERT_THAT(obtained.data, testing::Eq(Utf8String_t("c=d")));
+	ASSERT_THAT(obtained.isActionData, testing::Eq(true));
+
+	ASSERT_THAT(target.tryPop(obtained), testing::Eq(false));
+}
+
+TEST_F(BeaconRecordQueueTest, pushToFullQueueFailsAndKeepsTheRecord)
+{
+	// given
+	BeaconRecordQueue_t target(2);
+	Record_t record(BeaconKey_t(1, 0), 1000, "a=b", false);
+	ASSERT_THAT(target.tryPush(record), testing::Eq(true));
+	record = Record_t(BeaconKey_t(1, 0), 1001, "a=b", false);
+	ASSERT_THAT(target.tryPush(record), testing::Eq(true));
+
+	// when
+	record = Record_t(BeaconKey_t(1, 0), 1002, "c=d", false);
+	auto obtained = target.tryPush(record);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(record.data, testing::Eq(Utf8String_t("c=d")));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+}
+
+TEST_F(BeaconRecordQueueTest, slotsAreReusedAfterPopping)
+{
+	// given
+	BeaconRecordQueue_t target(2);
+
+	for (int64_t i = 0; i < 10; i++)
+	{
+		// when
+		Record_t record(BeaconKey_t(1, 0), i, "a=b", false);
+		ASSERT_THAT(target.tryPush(record), testing::Eq(true));
+
+		// then
+		Record_t obtained;
+		ASSERT_THAT(target.tryPop(obtained), testing::Eq(true));
+		ASSERT_THAT(obtained.timestamp, testing::Eq(i));
+	}
+}
+
+TEST_F(BeaconRecordQueueTest, recordsOfConcurrentProducersAreReceivedInOrderPerProducer)
+{
+	// given
+	const int32_t numProducers = 4;
+	const int64_t numRecordsPerProducer = 10000;
+	BeaconRecordQueue_t target(64);
+
+	// when
+	std::vector<std::thread> producers;
+	for (int32_t producer = 0; producer < numProducers; producer++)
+	{
+		producers.push_back(std::thread([&target, producer, numRecordsPerProducer]()
+		{
+			for (int64_t i = 0; i < numRecordsPerProducer; i++)
+			{
+				Record_t record(BeaconKey_t(producer, 0), i, "a=b", false);
+				while (!target.tryPush(record))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+
+	std::vector<int64_t> nextTimestamps(numProducers, 0);
+	int64_t numRecordsReceived = 0;
+	while (numRecordsReceived < numProducers * numRecordsPerProducer)
+	{
+		Record_t record;
+		if (!target.tryPop(record))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// then
+		auto producer = record.beaconKey.getBeaconId();
+		EXPECT_THAT(record.timestamp, testing::Eq(nextTimestamps[producer]));
+		nextTimestamps[producer]++;
+		numRecordsReceived++;
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+}
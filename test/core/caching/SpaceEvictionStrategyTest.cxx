@@ -257,23 +257,20 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogIfStrategyIsDisabledA
 	target.execute();
 }
 
-TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
+TEST_F(SpaceEvictionStrategyTest, executeEvictionEvictsBytesExceedingLowerBound)
 {
-	// with
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 0);
-
 	// expect
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(keyOne, 1))
-		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(keyTwo, 1))
-		.Times(testing::Exactly(1));
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(1000L));		// 1000 after eviction (to exit the while loop)
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(1001L))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(3));
+	EXPECT_CALL(*mockBeaconCache, getBeaconKeys())
+		.Times(0);
+	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(testing::_, testing::_))
+		.Times(0);
 
 	// given
 	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
@@ -283,8 +280,6 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
 		configuration,
 		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
 	);
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
 
 	// when
 	target.execute();
@@ -292,23 +287,15 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
 
 TEST_F(SpaceEvictionStrategyTest, executeEvictionLogsEvictionResultIfDebugIsEnabled)
 {
-	// with
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 14);
-
 	// expect
 	EXPECT_CALL(*mockLoggerStrict, isDebugEnabled())
-		.Times(3);
-	EXPECT_CALL(*mockLoggerStrict, mockDebug("SpaceEvictionStrategy doExecute() - Removed 5 records from Beacon with key [sn=1, seq=0]"))
 		.Times(1);
-	EXPECT_CALL(*mockLoggerStrict, mockDebug("SpaceEvictionStrategy doExecute() - Removed 1 records from Beacon with key [sn=42, seq=14]"))
+	EXPECT_CALL(*mockLoggerStrict, mockDebug("SpaceEvictionStrategy doExecute() - Removed 6 records"))
 		.Times(1);
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(0L));			// 0 after eviction (to exit the while loop)
 
 	// given
 	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
@@ -319,12 +306,8 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionLogsEvictionResultIfDebugIsEnab
 		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
 	);
 
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
-	ON_CALL(*mockBeaconCache, evictRecordsByNumber(keyOne, testing::_))
-		.WillByDefault(testing::Return(5));
-	ON_CALL(*mockBeaconCache, evictRecordsByNumber(keyTwo, testing::_))
-		.WillByDefault(testing::Return(1));
+	ON_CALL(*mockBeaconCache, evictRecordsBySize(testing::_))
+		.WillByDefault(testing::Return(6));
 
 	// when executing
 	target.execute();
@@ -338,13 +321,11 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogEvictionResultIfDebug
 
 	// expect
 	EXPECT_CALL(*mockLoggerStrict, isDebugEnabled())
-		.Times(3);
+		.Times(1);
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(0L));			// 0 after eviction (to exit the while loop)
 
 	// given
 	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
@@ -355,15 +336,8 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogEvictionResultIfDebug
 		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
 	);
 
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 0);
-
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
-	ON_CALL(*mockBeaconCache, evictRecordsByNumber(keyOne, testing::_))
-		.WillByDefault(testing::Return(5));
-	ON_CALL(*mockBeaconCache, evictRecordsByNumber(keyTwo, testing::_))
-		.WillByDefault(testing::Return(1));
+	ON_CALL(*mockBeaconCache, evictRecordsBySize(testing::_))
+		.WillByDefault(testing::Return(6));
 
 	// when executing
 	target.execute();
@@ -371,15 +345,19 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogEvictionResultIfDebug
 
 TEST_F(SpaceEvictionStrategyTest, executeEvictionRunsUntilTheCacheSizeIsLessThanOrEqualToLowerBound)
 {
-	// with
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 0);
-
 	// expect
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(keyOne, 1))
-		.Times(testing::Exactly(2));
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(keyTwo, 1))
-		.Times(testing::Exactly(2));
+	testing::InSequence s;
+	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
+		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
+		.WillOnce(testing::Return(2000L));		// 2000 for while loop in SpaceEvictionStrategy::doExecute()
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(1000L))
+		.WillOnce(testing::Return(2));
+	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
+		.WillOnce(testing::Return(1500L));		// 1500 since data was added concurrently
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(500L))
+		.WillOnce(testing::Return(1));
+	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
+		.WillOnce(testing::Return(1000L));		// 1000 to exit the while loop
 
 	// given
 	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
@@ -390,42 +368,48 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionRunsUntilTheCacheSizeIsLessThan
 		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
 	);
 
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
+	// when
+	target.execute();
+}
 
-	// then
+TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfNothingCanBeEvicted)
+{
+	// expect
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1500L))		// 1500 for outer while loop (second iteration) in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1000L))		// 1000 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
-		.WillRepeatedly(testing::Return(0L));	// just for safety
+		.WillRepeatedly(testing::Return(2001L));
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(1001L))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(0));
+
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	SpaceEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCache,
+		configuration,
+		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
 
 	// when
 	target.execute();
 }
 
-TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedBetweenTwoBeacons)
+TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterrupted)
 {
 	// expect
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
-		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillRepeatedly(testing::Return(0L));	// just for safety
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(testing::_, 1))
-		.Times(testing::Exactly(1));
+		.WillRepeatedly(testing::Return(2001L));
+	EXPECT_CALL(*mockBeaconCache, evictRecordsBySize(testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::Return(1));
 
 	// given
 	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
 	uint32_t callCountIsStopRequested = 0;
 	auto isStopRequested = [&callCountIsStopRequested]() -> bool {
-		// isStopRequested shall return "true" after the 2nd call
-		return ++callCountIsStopRequested > 2;
+		// isStopRequested shall return "true" after the 1st call
+		return ++callCountIsStopRequested > 1;
 	};
 	SpaceEvictionStrategy_t target(
 		mockLoggerNice,
@@ -434,33 +418,34 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedBet
 		isStopRequested
 	);
 
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 0);
-
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
-
 	// when
 	target.execute();
 }
 
-TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfNumBytesInCacheFallsBelowLowerBoundBetweenTwoBeacons)
+TEST_F(SpaceEvictionStrategyTest, executionIsRequiredIfNumberOfBytesExceedsUpperBound)
 {
-	// then
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	SpaceEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCache,
+		configuration,
+		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+
 	EXPECT_CALL(*mockBeaconCache, getNumBytesInCache())
-		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1500L))		// 1500 for outer while loop (second iteration) in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(1000L))		// 1000 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
-		.WillRepeatedly(testing::Return(0L));	// just for safety
-	EXPECT_CALL(*mockBeaconCache, evictRecordsByNumber(testing::An<const BeaconKey_t&>(), 1))
-		.Times(testing::Exactly(3));
+		.WillOnce(testing::Return(2000L))
+		.WillOnce(testing::Return(2001L));
+
+	// when, then
+	ASSERT_THAT(target.isExecutionRequired(), testing::Eq(false));
+	ASSERT_THAT(target.isExecutionRequired(), testing::Eq(true));
+}
 
+TEST_F(SpaceEvictionStrategyTest, executionIsNeverRequiredIfStrategyIsDisabled)
+{
 	// given
-	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	auto configuration = createBeaconCacheConfig(1000L, 0L, 2000L);
 	SpaceEvictionStrategy_t target(
 		mockLoggerNice,
 		mockBeaconCache,
@@ -468,12 +453,24 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfNumBytesInCacheFallsBelo
 		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
 	);
 
-	BeaconKey_t keyOne(1, 0);
-	BeaconKey_t keyTwo(42, 0);
+	ON_CALL(*mockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(5000L));
 
-	ON_CALL(*mockBeaconCache, getBeaconKeys())
-		.WillByDefault(testing::Return(BeaconKeySet_t({ keyOne, keyTwo })));
+	// when, then
+	ASSERT_THAT(target.isExecutionRequired(), testing::Eq(false));
+}
 
-	// when
-	target.execute();
-}
\ No newline at end of file
+TEST_F(SpaceEvictionStrategyTest, spaceEvictionIsNotTimeDriven)
+{
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	SpaceEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCache,
+		configuration,
+		std::bind(&SpaceEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+
+	// when, then
+	ASSERT_THAT(target.getMillisUntilNextExecution(), testing::Lt(0));
+}
@@ -436,3 +436,73 @@ TEST_F(TimeEvictionStrategyTest, executeEvictionIsStoppedIfStopIsRequested)
 	// when
 	target.execute();
 }
+
+TEST_F(TimeEvictionStrategyTest, executionIsNeverRequiredDueToDataBeingAdded)
+{
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	TimeEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCacheStrict,
+		configuration,
+		mockTimingProviderStrict,
+		std::bind(&TimeEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+
+	// when, then
+	ASSERT_THAT(target.isExecutionRequired(), testing::Eq(false));
+}
+
+TEST_F(TimeEvictionStrategyTest, nextExecutionIsNotScheduledIfStrategyIsDisabled)
+{
+	// given
+	auto configuration = createBeaconCacheConfig(0L, 1000L, 2000L);
+	TimeEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCacheStrict,
+		configuration,
+		mockTimingProviderStrict,
+		std::bind(&TimeEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+
+	// when, then
+	ASSERT_THAT(target.getMillisUntilNextExecution(), testing::Lt(0));
+}
+
+TEST_F(TimeEvictionStrategyTest, nextExecutionIsDueImmediatelyIfStrategyWasNotExecutedYet)
+{
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	TimeEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCacheStrict,
+		configuration,
+		mockTimingProviderStrict,
+		std::bind(&TimeEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+
+	// when, then
+	ASSERT_THAT(target.getMillisUntilNextExecution(), testing::Eq(0));
+}
+
+TEST_F(TimeEvictionStrategyTest, nextExecutionIsDueWhenMaxRecordAgeElapsedSinceLastRun)
+{
+	// given
+	auto configuration = createBeaconCacheConfig(1000L, 1000L, 2000L);
+	TimeEvictionStrategy_t target(
+		mockLoggerNice,
+		mockBeaconCacheStrict,
+		configuration,
+		mockTimingProviderStrict,
+		std::bind(&TimeEvictionStrategyTest::mockedIsStopRequestedFunctionAlwaysFalse, this)
+	);
+	target.setLastRunTimestamp(5000L);
+
+	EXPECT_CALL(*mockTimingProviderStrict, provideTimestampInMilliseconds())
+		.WillOnce(testing::Return(5300L))
+		.WillOnce(testing::Return(7000L));
+
+	// when, then
+	ASSERT_THAT(target.getMillisUntilNextExecution(), testing::Eq(700));
+	ASSERT_THAT(target.getMillisUntilNextExecution(), testing::Eq(0));
+}
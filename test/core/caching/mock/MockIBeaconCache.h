@@ -153,6 +153,8 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(uint32_t, evictRecordsBySize, (int64_t), (override));
+
 		MOCK_METHOD(int64_t, getNumBytesInCache, (), (const, override));
 
 		MOCK_METHOD(
@@ -163,6 +165,20 @@ namespace test
 			),
 			(override)
 		);
+
+		MOCK_METHOD(
+			void,
+			setBeaconHeader,
+			(
+				const core::caching::BeaconKey&,
+				const core::caching::BeaconHeader&
+			),
+			(override)
+		);
+
+		MOCK_METHOD(bool, takeRecoveredBeacon, (core::caching::IBeaconCacheOverflowStore::RecoveredBeacon&, size_t), (override));
+
+		MOCK_METHOD(void, restoreRecoveredBeacon, (const core::caching::IBeaconCacheOverflowStore::RecoveredBeacon&), (override));
 	};
 }
 #endif
@@ -45,6 +45,10 @@ namespace test
 		}
 
 		MOCK_METHOD(void, execute, (), (override));
+
+		MOCK_METHOD(bool, isExecutionRequired, (), (override));
+
+		MOCK_METHOD(int64_t, getMillisUntilNextExecution, (), (override));
 	};
 }
 #endif
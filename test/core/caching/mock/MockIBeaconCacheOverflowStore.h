@@ -0,0 +1,72 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _TEST_CORE_CACHING_MOCK_MOCKIBEACONCACHEOVERFLOWSTORE_H
+#define _TEST_CORE_CACHING_MOCK_MOCKIBEACONCACHEOVERFLOWSTORE_H
+
+#include "core/caching/IBeaconCacheOverflowStore.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <vector>
+
+namespace test
+{
+	class MockIBeaconCacheOverflowStore
+		: public core::caching::IBeaconCacheOverflowStore
+	{
+	public:
+		MockIBeaconCacheOverflowStore() = default;
+
+		~MockIBeaconCacheOverflowStore() override = default;
+
+		static std::shared_ptr<testing::NiceMock<MockIBeaconCacheOverflowStore>> createNice()
+		{
+			return std::make_shared<testing::NiceMock<MockIBeaconCacheOverflowStore>>();
+		}
+
+		static std::shared_ptr<testing::StrictMock<MockIBeaconCacheOverflowStore>> createStrict()
+		{
+			return std::make_shared<testing::StrictMock<MockIBeaconCacheOverflowStore>>();
+		}
+
+		MOCK_METHOD(
+			bool,
+			store,
+			(
+				const core::caching::BeaconKey&,
+				const core::caching::BeaconHeader&,
+				const std::vector<Record>&
+			),
+			(override)
+		);
+
+		MOCK_METHOD(bool, hasRecords, (const core::caching::BeaconKey&), (override));
+
+		MOCK_METHOD(std::vector<Record>, takeRecords, (const core::caching::BeaconKey&, size_t), (override));
+
+		MOCK_METHOD(void, removeRecords, (const core::caching::BeaconKey&), (override));
+
+		MOCK_METHOD(bool, takeRecoveredBeacon, (RecoveredBeacon&, size_t), (override));
+
+		MOCK_METHOD(void, restoreRecoveredBeacon, (const RecoveredBeacon&), (override));
+	};
+}
+
+#endif
@@ -38,6 +38,8 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <limits>
+
 using namespace test;
 
 using BeaconSendingCaptureOffState_t = core::communication::BeaconSendingCaptureOffState;
@@ -197,6 +199,10 @@ TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestsAreMadeForAllNotConfig
 		.WillOnce(testing::SaveArg<0>(&serverConfigCapture));
 	EXPECT_CALL(*mockSession6New, decreaseNumRemainingSessionRequests())
 		.Times(1);
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession5New)))
+		.Times(1);
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession6New)))
+		.Times(0);
 
 	// given
 	BeaconSendingCaptureOnState_t target;
@@ -305,6 +311,8 @@ TEST_F(BeaconSendingCaptureOnStateTest, captureIsDisabledIfNoFurtherNewSessionRe
 
 	EXPECT_CALL(*mockSession5New, disableCapture()).Times(1);
 	EXPECT_CALL(*mockSession6New, disableCapture()).Times(1);
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession5New))).Times(1);
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession6New))).Times(1);
 
 	// given
 	BeaconSendingCaptureOnState_t target;
@@ -587,6 +595,162 @@ TEST_F(BeaconSendingCaptureOnStateTest, sendingFinishedSessionsIsAbortedImmediat
 	ASSERT_THAT(captureOffState->getSleepTimeInMilliseconds(), testing::Eq(sleepTime));
 }
 
+TEST_F(BeaconSendingCaptureOnStateTest, finishedSessionsAreSentAsynchronouslyIfMultipleConcurrentRequestsAreAllowed)
+{
+	// with
+	auto statusResponse = MockIStatusResponse::createNice();
+
+	ON_CALL(*mockContext, getMaxConcurrentBeaconRequests())
+		.WillByDefault(testing::Return(2));
+	ON_CALL(*mockSession3Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::InvokeArgument<2>(statusResponse));
+	ON_CALL(*mockSession3Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::InvokeArgument<2>(statusResponse));
+	ON_CALL(*mockSession4Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockSession3Finished, sendBeaconAsync(testing::_, testing::Ref(*mockContext), testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::Ref(*mockContext), testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockSession3Finished, sendBeacon(testing::_, testing::_))
+		.Times(0);
+	EXPECT_CALL(*mockSession4Finished, sendBeacon(testing::_, testing::_))
+		.Times(0);
+
+	EXPECT_CALL(*mockContext, removeSession(testing::Eq(mockSession3Finished)))
+		.Times(1);
+	EXPECT_CALL(*mockContext, removeSession(testing::Eq(mockSession4Finished)))
+		.Times(1);
+
+	// given
+	auto target = BeaconSendingCaptureOnState_t();
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, finishedSessionsAreSentConcurrentlyOnTheCallingThread)
+{
+	// with
+	auto statusResponse = MockIStatusResponse::createNice();
+	std::vector<protocol::IHTTPClient::ResponseHandler> pendingHandlers;
+
+	auto mockHTTPClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*mockHTTPClientProvider, processPendingRequests())
+		.WillByDefault(testing::Invoke([&pendingHandlers, &statusResponse]()
+		{
+			// respond to all requests started so far
+			std::vector<protocol::IHTTPClient::ResponseHandler> handlers;
+			handlers.swap(pendingHandlers);
+			for (auto& handler : handlers)
+			{
+				handler(statusResponse);
+			}
+			return pendingHandlers.size();
+		}));
+	ON_CALL(*mockContext, getHTTPClientProvider())
+		.WillByDefault(testing::Return(mockHTTPClientProvider));
+	ON_CALL(*mockContext, getMaxConcurrentBeaconRequests())
+		.WillByDefault(testing::Return(2));
+	// open sessions are not sent
+	ON_CALL(*mockContext, getSendInterval())
+		.WillByDefault(testing::Return(std::numeric_limits<int64_t>::max() / 2));
+
+	auto storeHandler = [&pendingHandlers](std::shared_ptr<providers::IHTTPClientProvider>,
+		const protocol::IAdditionalQueryParameters&, protocol::IHTTPClient::ResponseHandler handler)
+	{
+		pendingHandlers.push_back(handler);
+	};
+	ON_CALL(*mockSession3Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Invoke(storeHandler));
+	ON_CALL(*mockSession3Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Invoke(storeHandler));
+	ON_CALL(*mockSession4Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	{
+		testing::InSequence s;
+
+		EXPECT_CALL(*mockSession3Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+			.Times(1);
+		EXPECT_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+			.Times(1);
+		EXPECT_CALL(*mockHTTPClientProvider, processPendingRequests())
+			.Times(1);
+		EXPECT_CALL(*mockContext, removeSession(testing::Eq(mockSession3Finished)))
+			.Times(1);
+		EXPECT_CALL(*mockContext, removeSession(testing::Eq(mockSession4Finished)))
+			.Times(1);
+	}
+
+	// given
+	auto target = BeaconSendingCaptureOnState_t();
+
+	// when
+	target.execute(*mockContext);
+
+	// then
+	ASSERT_THAT(pendingHandlers, testing::IsEmpty());
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, concurrentlySentFinishedSessionsAreKeptWhenTooManyRequestsResponseIsReceived)
+{
+	// with
+	int64_t sleepTime = 12345;
+	auto statusResponse = MockIStatusResponse::createNice();
+	ON_CALL(*statusResponse, isTooManyRequestsResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*statusResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*statusResponse, getRetryAfterInMilliseconds())
+		.WillByDefault(testing::Return(sleepTime));
+
+	ON_CALL(*mockContext, getMaxConcurrentBeaconRequests())
+		.WillByDefault(testing::Return(2));
+	ON_CALL(*mockSession3Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::InvokeArgument<2>(statusResponse));
+	ON_CALL(*mockSession3Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::InvokeArgument<2>(statusResponse));
+	ON_CALL(*mockSession4Finished, isDataSendingAllowed())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	EXPECT_CALL(*mockContext, removeSession(testing::_))
+		.Times(0);
+	EXPECT_CALL(*mockSession4Finished, sendBeaconAsync(testing::_, testing::_, testing::_))
+		.Times(0);
+	EXPECT_CALL(*mockSession1Open, sendBeacon(testing::_, testing::_))
+		.Times(0);
+	EXPECT_CALL(*mockSession2Open, sendBeacon(testing::_, testing::_))
+		.Times(0);
+
+	IBeaconSendingState_sp captureOffCapture = nullptr;
+	EXPECT_CALL(*mockContext, setNextState(testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::SaveArg<0>(&captureOffCapture));
+
+	// given
+	BeaconSendingCaptureOnState_t target;
+
+	// when
+	target.execute(*mockContext);
+
+	// then
+	ASSERT_THAT(captureOffCapture, testing::NotNull());
+	auto captureOffState = std::dynamic_pointer_cast<BeaconSendingCaptureOffState_t>(captureOffCapture);
+	ASSERT_THAT(captureOffState, testing::NotNull());
+	ASSERT_THAT(captureOffState->getSleepTimeInMilliseconds(), testing::Eq(sleepTime));
+}
+
 TEST_F(BeaconSendingCaptureOnStateTest, aBeaconSendingCaptureOnStateSendsOpenSessionsIfNotExpired)
 {
 	// with
@@ -18,6 +18,7 @@
 #include "CustomMatchers.h"
 #include "builder/TestBeaconSendingContextBuilder.h"
 #include "mock/MockIBeaconSendingState.h"
+#include "../caching/mock/MockIBeaconCache.h"
 #include "../configuration/mock/MockIBeaconCacheConfiguration.h"
 #include "../configuration/mock/MockIBeaconConfiguration.h"
 #include "../configuration/mock/MockIHTTPClientConfiguration.h"
@@ -105,6 +106,18 @@ protected:
 
 		return builder;
 	}
+
+	static std::shared_ptr<MockStrictSession_t> createStrictNewSession()
+	{
+		// adding a session determines its state once
+		auto session = MockSessionInternals::createStrict();
+		EXPECT_CALL(*session, isConfiguredAndFinished())
+			.WillOnce(testing::Return(false));
+		EXPECT_CALL(*session, isConfiguredAndOpen())
+			.WillOnce(testing::Return(false));
+
+		return session;
+	}
 };
 
 TEST_F(BeaconSendingContextTest, currentStateIsInitializedAccordingly)
@@ -452,8 +465,8 @@ TEST_F(BeaconSendingContextTest, addSession)
 	// given
 	auto target = createBeaconSendingContext()->build();
 
-	auto mockSessionOne = MockSessionInternals::createStrict();
-	auto mockSessionTwo = MockSessionInternals::createStrict();
+	auto mockSessionOne = createStrictNewSession();
+	auto mockSessionTwo = createStrictNewSession();
 
 	// when
 	target->addSession(mockSessionOne);
@@ -473,8 +486,8 @@ TEST_F(BeaconSendingContextTest, removeSession)
 	// given
 	auto target = createBeaconSendingContext()->build();
 
-	auto mockSessionOne = MockSessionInternals::createStrict();
-	auto mockSessionTwo = MockSessionInternals::createStrict();
+	auto mockSessionOne = createStrictNewSession();
+	auto mockSessionTwo = createStrictNewSession();
 
 	target->addSession(mockSessionOne);
 	target->addSession(mockSessionTwo);
@@ -738,7 +751,7 @@ TEST_F(BeaconSendingContextTest, handleStatusResponseUpdatesSendInterval)
 		HttpHeaderCollection_t()
 	);
 
-	auto mockSession = MockSessionInternals::createStrict();
+	auto mockSession = createStrictNewSession();
 
 	auto target = createBeaconSendingContext()->build();
 	target->addSession(mockSession);
@@ -795,7 +808,7 @@ TEST_F(BeaconSendingContextTest, handleStatusResponseUpdatesCaptureStateToTrue)
 		HttpHeaderCollection_t()
 	);
 
-	auto mockSession = MockSessionInternals::createStrict();
+	auto mockSession = createStrictNewSession();
 
 	auto target = createBeaconSendingContext()->build();
 	target->disableCaptureAndClear();
@@ -974,6 +987,27 @@ TEST_F(BeaconSendingContextTest, getAllFinishedAndConfiguredSessionsReturnsOnlyC
 	ASSERT_THAT(*obtained.begin(), testing::Eq(relevantSession));
 }
 
+TEST_F(BeaconSendingContextTest, updateSessionStateMovesSessionToItsNewState)
+{
+	// given
+	auto session = MockSessionInternals::createNice();
+
+	auto target = createBeaconSendingContext()->build();
+	target->addSession(session);
+	ASSERT_THAT(target->getAllNotConfiguredSessions().size(), testing::Eq(size_t(1)));
+
+	ON_CALL(*session, isConfigured()).WillByDefault(testing::Return(true));
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(true));
+
+	// when
+	target->updateSessionState(session);
+
+	// then
+	ASSERT_THAT(target->getAllNotConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target->getAllOpenAndConfiguredSessions().size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target->getSessionCount(), testing::Eq(size_t(1)));
+}
+
 TEST_F(BeaconSendingContextTest, getCurrentServerIdReturnsServerIdOfHttpClientConfig)
 {
 	// given
@@ -1156,3 +1190,34 @@ TEST_F(BeaconSendingContextTest, applicationIdMismatchesIfStoredAndReceivedAppli
 	// then
 	ASSERT_THAT(obtained, testing::Eq(true));
 }
+
+TEST_F(BeaconSendingContextTest, sendRecoveredBeaconsReturnsNullptrIfThereIsNoBeaconCache)
+{
+	// given
+	auto target = createBeaconSendingContext()->build();
+
+	// when
+	auto obtained = target->sendRecoveredBeacons();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(BeaconSendingContextTest, sendRecoveredBeaconsTakesRecoveredBeaconsFromBeaconCache)
+{
+	// with
+	auto beaconCache = MockIBeaconCache::createNice();
+
+	// expect
+	EXPECT_CALL(*beaconCache, takeRecoveredBeacon(testing::_, testing::_))
+		.WillOnce(testing::Return(false));
+
+	// given
+	auto target = createBeaconSendingContext()->with(beaconCache).build();
+
+	// when
+	auto obtained = target->sendRecoveredBeacons();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
@@ -144,6 +144,10 @@ TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionsStateEnal
 		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mockSession2Open, enableCapture())
 		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession1Open)))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession2Open)))
+		.Times(testing::Exactly(1));
 
 	// given
 	BeaconSendingFlushSessionState_t target;
@@ -160,6 +164,10 @@ TEST_F(BeaconSendingFlushSessionsStateTest, aBeaconSendingFlushSessionsStateClos
 		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mockSession2Open, end(false))
 		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession1Open)))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockContext, updateSessionState(testing::Eq(mockSession2Open)))
+		.Times(testing::Exactly(1));
 
 	// given
 	BeaconSendingFlushSessionState_t target;
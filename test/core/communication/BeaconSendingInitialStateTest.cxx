@@ -413,6 +413,71 @@ TEST_F(BeaconSendingInitialStateTest, aSuccessfulStatusResponsePerformsStateTran
 	target.execute(*mockContext);
 }
 
+TEST_F(BeaconSendingInitialStateTest, aSuccessfulStatusResponseSendsRecoveredBeaconsIfCapturingIsEnabled)
+{
+	// with
+	ON_CALL(*mockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	// expect
+	testing::InSequence s;
+	EXPECT_CALL(*mockContext, setInitCompleted(true))
+		.Times(1);
+	EXPECT_CALL(*mockContext, sendRecoveredBeacons())
+		.Times(1);
+
+	// given
+	BeaconSendingInitialState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingInitialStateTest, aSuccessfulStatusResponseDoesNotSendRecoveredBeaconsIfCapturingIsDisabled)
+{
+	// with
+	ON_CALL(*mockContext, isCaptureOn())
+		.WillByDefault(testing::Return(false));
+
+	// expect
+	EXPECT_CALL(*mockContext, sendRecoveredBeacons())
+		.Times(0);
+
+	// given
+	BeaconSendingInitialState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
+TEST_F(BeaconSendingInitialStateTest, aTooManyRequestsResponseForRecoveredBeaconsPerformsStateTransitionToCaptureOffState)
+{
+	// with
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isTooManyRequestsResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*errorResponse, getRetryAfterInMilliseconds())
+		.WillByDefault(testing::Return(1234));
+
+	ON_CALL(*mockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockContext, sendRecoveredBeacons())
+		.WillByDefault(testing::Return(errorResponse));
+
+	// expect
+	testing::InSequence s;
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingCaptureOnState()))
+		.Times(1);
+	EXPECT_CALL(*mockContext, setNextState(IsABeaconSendingCaptureOffState()))
+		.Times(1);
+
+	// given
+	BeaconSendingInitialState_t target;
+
+	// when
+	target.execute(*mockContext);
+}
+
 TEST_F(BeaconSendingInitialStateTest, aSuccessfulStatusResponsePerformsStateTransitionToCaptureOffStateIfCapturingIsDisabled)
 {
 	// with
@@ -0,0 +1,286 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "../objects/mock/MockSessionInternals.h"
+
+#include "core/communication/SessionRegistry.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+using namespace test;
+
+using MockNiceSessionInternals_sp = std::shared_ptr<testing::NiceMock<MockSessionInternals>>;
+using SessionRegistry_t = core::communication::SessionRegistry;
+
+class SessionRegistryTest : public testing::Test
+{
+protected:
+
+	MockNiceSessionInternals_sp createSession(bool configured, bool finished)
+	{
+		auto session = MockSessionInternals::createNice();
+		ON_CALL(*session, isConfigured()).WillByDefault(testing::Return(configured));
+		ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(configured && !finished));
+		ON_CALL(*session, isConfiguredAndFinished()).WillByDefault(testing::Return(configured && finished));
+		ON_CALL(*session, isFinished()).WillByDefault(testing::Return(finished));
+
+		return session;
+	}
+};
+
+TEST_F(SessionRegistryTest, aDefaultConstructedRegistryIsEmpty)
+{
+	// given
+	SessionRegistry_t target;
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target.getAllSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getNotConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::IsEmpty());
+}
+
+TEST_F(SessionRegistryTest, addingTheSameSessionTwiceRegistersItOnce)
+{
+	// given
+	auto session = createSession(false, false);
+	SessionRegistry_t target;
+
+	// when
+	target.add(session);
+	target.add(session);
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getAllSessions(), testing::ElementsAre(session));
+}
+
+TEST_F(SessionRegistryTest, removingAnUnknownSessionReturnsFalse)
+{
+	// given
+	SessionRegistry_t target;
+	target.add(createSession(false, false));
+
+	// when
+	auto obtained = target.remove(createSession(false, false));
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SessionRegistryTest, sessionsAreReturnedByTheirState)
+{
+	// given
+	auto newSession = createSession(false, false);
+	auto openSession = createSession(true, false);
+	auto finishedSession = createSession(true, true);
+
+	SessionRegistry_t target;
+	target.add(finishedSession);
+	target.add(openSession);
+	target.add(newSession);
+
+	// then
+	ASSERT_THAT(target.getNotConfiguredSessions(), testing::ElementsAre(newSession));
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::ElementsAre(openSession));
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::ElementsAre(finishedSession));
+	ASSERT_THAT(target.getAllSessions(), testing::UnorderedElementsAre(newSession, openSession, finishedSession));
+}
+
+TEST_F(SessionRegistryTest, sessionsChangingTheirStateAreReturnedWithTheirNewState)
+{
+	// given
+	auto session = createSession(false, false);
+	SessionRegistry_t target;
+	target.add(session);
+	ASSERT_THAT(target.getNotConfiguredSessions(), testing::ElementsAre(session));
+
+	// when
+	ON_CALL(*session, isConfigured()).WillByDefault(testing::Return(true));
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(true));
+	target.updateState(session);
+
+	// then
+	ASSERT_THAT(target.getNotConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::ElementsAre(session));
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::IsEmpty());
+
+	// and when
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(false));
+	ON_CALL(*session, isConfiguredAndFinished()).WillByDefault(testing::Return(true));
+	target.updateState(session);
+
+	// then
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::ElementsAre(session));
+}
+
+TEST_F(SessionRegistryTest, sessionsChangingTheirStateAreNotMovedWithoutUpdatingTheirState)
+{
+	// given
+	auto session = createSession(false, false);
+	SessionRegistry_t target;
+	target.add(session);
+
+	// when
+	ON_CALL(*session, isConfigured()).WillByDefault(testing::Return(true));
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(true));
+
+	// then
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::IsEmpty());
+}
+
+TEST_F(SessionRegistryTest, updatingTheStateNeverMovesASessionBackwards)
+{
+	// given
+	auto session = createSession(true, true);
+	SessionRegistry_t target;
+	target.add(session);
+
+	// when
+	ON_CALL(*session, isConfiguredAndFinished()).WillByDefault(testing::Return(false));
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Return(true));
+	target.updateState(session);
+
+	// then
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::ElementsAre(session));
+}
+
+TEST_F(SessionRegistryTest, updatingTheStateOfAnUnknownSessionIsIgnored)
+{
+	// given
+	SessionRegistry_t target;
+
+	// when
+	target.updateState(createSession(true, true));
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::IsEmpty());
+}
+
+TEST_F(SessionRegistryTest, updatingTheStateOfAnUnknownSessionDoesNotQueryItsState)
+{
+	// given
+	auto session = MockSessionInternals::createStrict();
+	SessionRegistry_t target;
+
+	// expect
+	EXPECT_CALL(*session, isConfiguredAndFinished())
+		.Times(0);
+	EXPECT_CALL(*session, isConfiguredAndOpen())
+		.Times(0);
+
+	// when
+	target.updateState(session);
+}
+
+TEST_F(SessionRegistryTest, aSessionConfiguredWhileBeingAddedIsReturnedWithItsCurrentState)
+{
+	// given
+	auto session = MockSessionInternals::createNice();
+	std::atomic<bool> configured(false);
+	std::atomic<bool> isConfiguring(false);
+	std::promise<void> updatedPromise;
+	std::thread configuringThread;
+	SessionRegistry_t target;
+
+	ON_CALL(*session, isConfigured()).WillByDefault(testing::Invoke([&configured]() { return configured.load(); }));
+	ON_CALL(*session, isConfiguredAndOpen()).WillByDefault(testing::Invoke([&]()
+	{
+		auto isConfiguredAndOpen = configured.load();
+		if (!isConfiguring.exchange(true))
+		{
+			// the session is configured concurrently, right after its state was determined by add()
+			configuringThread = std::thread([&]()
+			{
+				configured = true;
+				target.updateState(session);
+				updatedPromise.set_value();
+			});
+			updatedPromise.get_future().wait_for(std::chrono::milliseconds(50));
+		}
+
+		return isConfiguredAndOpen;
+	}));
+
+	// when
+	target.add(session);
+	configuringThread.join();
+
+	// then
+	ASSERT_THAT(target.getNotConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::ElementsAre(session));
+}
+
+TEST_F(SessionRegistryTest, finishedSessionsAreNotCheckedAgain)
+{
+	// given
+	auto session = createSession(true, true);
+	SessionRegistry_t target;
+
+	// expect
+	EXPECT_CALL(*session, isConfiguredAndFinished())
+		.Times(1);
+	EXPECT_CALL(*session, isConfiguredAndOpen())
+		.Times(0);
+
+	// when
+	target.add(session);
+	for (int i = 0; i < 5; i++)
+	{
+		target.getNotConfiguredSessions();
+		target.getOpenAndConfiguredSessions();
+		target.getFinishedAndConfiguredSessions();
+	}
+}
+
+TEST_F(SessionRegistryTest, sessionsCanBeRemovedAfterChangingTheirState)
+{
+	// given
+	auto sessionOne = createSession(true, false);
+	auto sessionTwo = createSession(true, true);
+	auto sessionThree = createSession(false, false);
+
+	SessionRegistry_t target;
+	target.add(sessionOne);
+	target.add(sessionTwo);
+	target.add(sessionThree);
+	target.getFinishedAndConfiguredSessions();
+
+	// when
+	auto removedOne = target.remove(sessionOne);
+	auto removedTwo = target.remove(sessionTwo);
+
+	// then
+	ASSERT_THAT(removedOne, testing::Eq(true));
+	ASSERT_THAT(removedTwo, testing::Eq(true));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.getAllSessions(), testing::ElementsAre(sessionThree));
+	ASSERT_THAT(target.getOpenAndConfiguredSessions(), testing::IsEmpty());
+	ASSERT_THAT(target.getFinishedAndConfiguredSessions(), testing::IsEmpty());
+}
@@ -25,6 +25,7 @@
 #include "../../../providers/mock/MockITimingProvider.h"
 
 #include "OpenKit/ILogger.h"
+#include "core/caching/IBeaconCache.h"
 #include "core/communication/BeaconSendingContext.h"
 #include "core/communication/IBeaconSendingState.h"
 #include "core/configuration/IHTTPClientConfiguration.h"
@@ -45,6 +46,7 @@ namespace test
 			, mClientProvider(nullptr)
 			, mTimingProvider(nullptr)
 			, mThreadSuspender(nullptr)
+			, mBeaconCache(nullptr)
 			, mState(nullptr)
 		{
 		}
@@ -81,6 +83,12 @@ namespace test
 			return *this;
 		}
 
+		TestBeaconSendingContextBuilder& with(std::shared_ptr<core::caching::IBeaconCache> beaconCache)
+		{
+			mBeaconCache = beaconCache;
+			return *this;
+		}
+
 		TestBeaconSendingContextBuilder& with(std::unique_ptr<core::communication::IBeaconSendingState> state)
 		{
 			mState = std::move(state);
@@ -103,6 +111,7 @@ namespace test
 					clientProvider,
 					timingProvider,
 					threadSuspender,
+					mBeaconCache,
 					std::move(mState)
 				);
 			}
@@ -112,7 +121,8 @@ namespace test
 				clientConfig,
 				clientProvider,
 				timingProvider,
-				threadSuspender
+				threadSuspender,
+				mBeaconCache
 			);
 		}
 
@@ -122,6 +132,7 @@ namespace test
 		std::shared_ptr<providers::IHTTPClientProvider> mClientProvider;
 		std::shared_ptr<providers::ITimingProvider> mTimingProvider;
 		std::shared_ptr<core::util::IInterruptibleThreadSuspender> mThreadSuspender;
+		std::shared_ptr<core::caching::IBeaconCache> mBeaconCache;
 		std::unique_ptr<core::communication::IBeaconSendingState> mState;
 	};
 }
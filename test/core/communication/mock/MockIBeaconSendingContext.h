@@ -46,6 +46,8 @@ class MockIBeaconSendingContext
 				.WillByDefault(testing::Return(nullptr));
 			ON_CALL(*this, getHTTPClient())
 				.WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getMaxConcurrentBeaconRequests())
+				.WillByDefault(testing::Return(1));
 
 			ON_CALL(*this, getAllNotConfiguredSessions())
 				.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::objects::SessionInternals>>()));
@@ -108,6 +110,8 @@ class MockIBeaconSendingContext
 
 		MOCK_METHOD(std::shared_ptr<protocol::IHTTPClient>, getHTTPClient, (), (override));
 
+		MOCK_METHOD(int32_t, getMaxConcurrentBeaconRequests, (), (const, override));
+
 		MOCK_METHOD(int64_t, getCurrentTimestamp, (), (const, override));
 
 		MOCK_METHOD(void, sleep, (), (override));
@@ -141,6 +145,8 @@ class MockIBeaconSendingContext
 
 		MOCK_METHOD(std::shared_ptr<core::configuration::IServerConfiguration>, getLastServerConfiguration, (), (const, override));
 
+		MOCK_METHOD(std::shared_ptr<protocol::IStatusResponse>, sendRecoveredBeacons, (), (override));
+
 		MOCK_METHOD(std::vector<std::shared_ptr<core::objects::SessionInternals>>, getAllNotConfiguredSessions, (), (override));
 
 		MOCK_METHOD(std::vector<std::shared_ptr<core::objects::SessionInternals>>, getAllOpenAndConfiguredSessions, (), (override));
@@ -155,6 +161,8 @@ class MockIBeaconSendingContext
 
 		MOCK_METHOD(bool, removeSession, (std::shared_ptr<core::objects::SessionInternals>), (override));
 
+		MOCK_METHOD(void, updateSessionState, (std::shared_ptr<core::objects::SessionInternals>), (override));
+
 		MOCK_METHOD(core::communication::IBeaconSendingState::StateType, getCurrentStateType, (), (const, override));
 
 		MOCK_METHOD(int64_t, getConfigurationTimestamp, (), (const, override));
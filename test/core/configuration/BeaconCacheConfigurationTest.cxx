@@ -190,4 +190,72 @@ TEST_F(BeaconCacheConfigurationTest, zeroUpperCacheSizeBoundIsTakenOverFromOpenK
 
 	// then
 	ASSERT_THAT(obtained->getCacheSizeUpperBound(), testing::Eq(upperBound));
-}
\ No newline at end of file
+}
+
+TEST_F(BeaconCacheConfigurationTest, overflowDirectoryIsTakenOverFromOpenKitBuilder)
+{
+	// with
+	const std::string directory = "/tmp/openkit";
+
+	// expect
+	EXPECT_CALL(*mockBuilder, getBeaconCacheOverflowDirectory())
+		.Times(1)
+		.WillOnce(testing::ReturnRef(directory));
+
+	// given, when
+	auto obtained = BeaconCacheConfiguration_t::from(*mockBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getOverflowDirectory(), testing::Eq(directory));
+}
+
+TEST_F(BeaconCacheConfigurationTest, overflowMaxSizeIsTakenOverFromOpenKitBuilder)
+{
+	// with
+	const int64_t maxSize = 4711;
+
+	// expect
+	EXPECT_CALL(*mockBuilder, getBeaconCacheOverflowMaxSize())
+		.Times(1)
+		.WillOnce(testing::Return(maxSize));
+
+	// given, when
+	auto obtained = BeaconCacheConfiguration_t::from(*mockBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getOverflowMaxSize(), testing::Eq(maxSize));
+}
+
+TEST_F(BeaconCacheConfigurationTest, recordQueueCapacityIsTakenOverFromOpenKitBuilder)
+{
+	// with
+	const int32_t capacity = 1024;
+
+	// expect
+	EXPECT_CALL(*mockBuilder, getBeaconRecordQueueCapacity())
+		.Times(1)
+		.WillOnce(testing::Return(capacity));
+
+	// given, when
+	auto obtained = BeaconCacheConfiguration_t::from(*mockBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getRecordQueueCapacity(), testing::Eq(capacity));
+}
+
+TEST_F(BeaconCacheConfigurationTest, recordQueueFullPolicyIsTakenOverFromOpenKitBuilder)
+{
+	// with
+	const auto policy = openkit::BeaconRecordQueueFullPolicy::DROP;
+
+	// expect
+	EXPECT_CALL(*mockBuilder, getBeaconRecordQueueFullPolicy())
+		.Times(1)
+		.WillOnce(testing::Return(policy));
+
+	// given, when
+	auto obtained = BeaconCacheConfiguration_t::from(*mockBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getRecordQueueFullPolicy(), testing::Eq(policy));
+}
@@ -68,6 +68,15 @@ protected:
 		return serverConfig;
 	}
 
+	void allowSnapshotOf(const std::shared_ptr<testing::StrictMock<MockIServerConfiguration>>& serverConfig)
+	{
+		EXPECT_CALL(*serverConfig, isSendingDataAllowed()).Times(testing::AnyNumber());
+		EXPECT_CALL(*serverConfig, isSendingErrorsAllowed()).Times(testing::AnyNumber());
+		EXPECT_CALL(*serverConfig, isSendingCrashesAllowed()).Times(testing::AnyNumber());
+		EXPECT_CALL(*serverConfig, getTrafficControlPercentage()).Times(testing::AnyNumber());
+		EXPECT_CALL(*serverConfig, getMultiplicity()).Times(testing::AnyNumber());
+	}
+
 	BeaconConfiguration_sp createBeaconConfig()
 	{
 		return std::make_shared<BeaconConfiguration_t>(mockOpenKitConfig, mockPrivacyConfig, SERVER_ID);
@@ -167,7 +176,8 @@ TEST_F(BeaconConfigurationTest, newInstanceReturnsHttpClientConfigWithGivenServe
 TEST_F(BeaconConfigurationTest, initializeServerConfigurationDoesNotSetIsServerConfigurationSet)
 {
 	// given
-	auto serverConfig = MockIServerConfiguration::createStrict(); // expect no calls
+	auto serverConfig = MockIServerConfiguration::createStrict(); // expect no calls, apart from taking the snapshot
+	allowSnapshotOf(serverConfig);
 	auto target = createBeaconConfig();
 
 	// when
@@ -180,7 +190,8 @@ TEST_F(BeaconConfigurationTest, initializeServerConfigurationDoesNotSetIsServerC
 TEST_F(BeaconConfigurationTest, initializeServerConfigurationSetsServerConfiguration)
 {
 	// given
-	auto serverConfig = MockIServerConfiguration::createStrict(); // expect no calls
+	auto serverConfig = MockIServerConfiguration::createStrict(); // expect no calls, apart from taking the snapshot
+	allowSnapshotOf(serverConfig);
 	auto target = createBeaconConfig();
 
 	// when
@@ -267,6 +278,7 @@ TEST_F(BeaconConfigurationTest, updateServerConfigurationSetsIsServerConfigurati
 {
 	// given
 	auto serverConfig = MockIServerConfiguration::createStrict();
+	allowSnapshotOf(serverConfig);
 	auto target = createBeaconConfig();
 
 	// when
@@ -280,6 +292,7 @@ TEST_F(BeaconConfigurationTest, updateServerConfigurationTakesOverServerConfigur
 {
 	// given
 	auto serverConfig = MockIServerConfiguration::createStrict();
+	allowSnapshotOf(serverConfig);
 	auto target = createBeaconConfig();
 
 	// when
@@ -294,6 +307,8 @@ TEST_F(BeaconConfigurationTest, updateServerConfigurationMergesServerConfigIfAlr
 	// with
 	auto serverConfig1 = MockIServerConfiguration::createStrict();
 	auto serverConfig2 = MockIServerConfiguration::createStrict();
+	allowSnapshotOf(serverConfig1);
+	allowSnapshotOf(serverConfig2);
 
 	// expect
 	EXPECT_CALL(*serverConfig1, merge(testing::Eq(serverConfig2)))
@@ -316,6 +331,7 @@ TEST_F(BeaconConfigurationTest, updateServerConfigurationDoesNotUpdateHttpClient
 	// given
 	const int32_t serverId = 73;
 	auto serverConfig = MockIServerConfiguration::createStrict();
+	allowSnapshotOf(serverConfig);
 	ON_CALL(*serverConfig, getServerId()).WillByDefault(testing::Return(serverId));
 
 	auto target = createBeaconConfig();
@@ -335,6 +351,7 @@ TEST_F(BeaconConfigurationTest, updateServerConfigurationDoesNotUpdateHttpClient
 	// given
 	const int32_t serverId = 73;
 	auto serverConfig = MockIServerConfiguration::createStrict();
+	allowSnapshotOf(serverConfig);
 	ON_CALL(*serverConfig, getServerId()).WillByDefault(testing::Return(serverId));
 	ON_CALL(*mockOpenKitConfig, getDefaultServerId()).WillByDefault(testing::Return(serverId));
 
@@ -506,3 +523,55 @@ TEST_F(BeaconConfigurationTest, disableCaptureDoesOnlyModifyCaptureFlag)
 	ASSERT_THAT(obtained->getBeaconSizeInBytes(), testing::Eq(initialServerConfig->getBeaconSizeInBytes()));
 	ASSERT_THAT(obtained->getMultiplicity(), testing::Eq(initialServerConfig->getMultiplicity()));
 }
+
+TEST_F(BeaconConfigurationTest, serverConfigurationSnapshotIsTakenFromDefaultServerConfigurationInitially)
+{
+	// given
+	auto target = createBeaconConfig();
+	auto defaultConfig = ServerConfiguration_t::defaultInstance();
+
+	// when
+	auto obtained = target->getServerConfigurationSnapshot();
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(defaultConfig->isSendingDataAllowed()));
+	ASSERT_THAT(obtained.getTrafficControlPercentage(), testing::Eq(defaultConfig->getTrafficControlPercentage()));
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(defaultConfig->getMultiplicity()));
+}
+
+TEST_F(BeaconConfigurationTest, updateServerConfigurationPublishesNewSnapshot)
+{
+	// given
+	auto serverConfig = mockServerConfig(true);
+	ON_CALL(*serverConfig, isSendingDataAllowed()).WillByDefault(testing::Return(true));
+	ON_CALL(*serverConfig, isSendingCrashesAllowed()).WillByDefault(testing::Return(false));
+	ON_CALL(*serverConfig, getTrafficControlPercentage()).WillByDefault(testing::Return(42));
+
+	auto target = createBeaconConfig();
+
+	// when
+	target->updateServerConfiguration(serverConfig);
+	auto obtained = target->getServerConfigurationSnapshot();
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(true));
+	ASSERT_THAT(obtained.isSendingCrashesAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.getTrafficControlPercentage(), testing::Eq(42));
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(37));
+}
+
+TEST_F(BeaconConfigurationTest, disableCapturePublishesNewSnapshot)
+{
+	// given
+	auto target = createBeaconConfig();
+	ASSERT_THAT(target->getServerConfigurationSnapshot().isSendingDataAllowed(), testing::Eq(true));
+
+	// when
+	target->disableCapture();
+	auto obtained = target->getServerConfigurationSnapshot();
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingErrorsAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingCrashesAllowed(), testing::Eq(false));
+}
@@ -165,6 +165,26 @@ TEST_F(HTTPClientConfigurationTest, instanceFromOpenKitConfigTakesOverHttpRespon
 	ASSERT_THAT(obtained, testing::Eq(httpResponseInterceptor));
 }
 
+TEST_F(HTTPClientConfigurationTest, instanceFromOpenKitConfigTakesOverMaxConcurrentBeaconRequests)
+{
+	// with
+	auto openKitConfig = MockIOpenKitConfiguration::createNice();
+
+	// expect
+	EXPECT_CALL(*openKitConfig, getMaxConcurrentBeaconRequests())
+		.Times(1)
+		.WillOnce(testing::Return(5));
+
+	// given
+	auto target = HTTPClientConfiguration_t::Builder(openKitConfig).build();
+
+	// when
+	auto obtained = target->getMaxConcurrentRequests();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(5));
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Create builder instance from HTTPClientConfiguration
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
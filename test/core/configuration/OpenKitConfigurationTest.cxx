@@ -248,4 +248,88 @@ TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopies
 
 	// then
 	ASSERT_THAT(obtained->getHttpResponseInterceptor(), testing::Eq(responseInterceptor));
-}
\ No newline at end of file
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesHttpConnectionPoolMaxIdleConnections)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getHttpConnectionPoolMaxIdleConnections())
+		.Times(1)
+		.WillOnce(testing::Return(8));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getHttpConnectionPoolMaxIdleConnections(), testing::Eq(8));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesHttpConnectionPoolIdleTimeout)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getHttpConnectionPoolIdleTimeout())
+		.Times(1)
+		.WillOnce(testing::Return(int64_t(30000)));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getHttpConnectionPoolIdleTimeout(), testing::Eq(30000));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesMaxConcurrentBeaconRequests)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getMaxConcurrentBeaconRequests())
+		.Times(1)
+		.WillOnce(testing::Return(3));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getMaxConcurrentBeaconRequests(), testing::Eq(3));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesSharedExecutorEnabled)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, isSharedExecutorEnabled())
+		.Times(1)
+		.WillOnce(testing::Return(true));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->isSharedExecutorEnabled(), testing::Eq(true));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesBeaconCompressionLevel)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getBeaconCompressionLevel())
+		.Times(1)
+		.WillOnce(testing::Return(6));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getBeaconCompressionLevel(), testing::Eq(6));
+}
+
+TEST_F(OpenKitConfigurationTest, creatingAnOpenKitConfigurationFromBuilderCopiesBeaconCompressionStrategy)
+{
+	// expect
+	EXPECT_CALL(*mockOpenKitBuilder, getBeaconCompressionStrategy())
+		.Times(1)
+		.WillOnce(testing::Return(openkit::CompressionStrategy::HUFFMAN_ONLY));
+
+	// when
+	auto obtained = OpenKitConfiguration_t::from(*mockOpenKitBuilder);
+
+	// then
+	ASSERT_THAT(obtained->getBeaconCompressionStrategy(), testing::Eq(openkit::CompressionStrategy::HUFFMAN_ONLY));
+}
@@ -0,0 +1,135 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "mock/MockIServerConfiguration.h"
+
+#include "core/configuration/ServerConfigurationSnapshot.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <limits>
+
+using namespace test;
+
+using MockIServerConfiguration_sp = std::shared_ptr<testing::NiceMock<MockIServerConfiguration>>;
+using ServerConfigurationSnapshot_t = core::configuration::ServerConfigurationSnapshot;
+
+class ServerConfigurationSnapshotTest : public testing::Test
+{
+protected:
+
+	MockIServerConfiguration_sp mockServerConfig;
+
+	void SetUp() override
+	{
+		mockServerConfig = MockIServerConfiguration::createNice();
+	}
+};
+
+TEST_F(ServerConfigurationSnapshotTest, snapshotOfNullServerConfigurationDoesNotAllowSendingAnything)
+{
+	// when
+	auto obtained = ServerConfigurationSnapshot_t::from(nullptr);
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingErrorsAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingCrashesAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.getTrafficControlPercentage(), testing::Eq(0));
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(0));
+}
+
+TEST_F(ServerConfigurationSnapshotTest, snapshotTakesOverSendingFlags)
+{
+	// given
+	ON_CALL(*mockServerConfig, isSendingDataAllowed()).WillByDefault(testing::Return(true));
+	ON_CALL(*mockServerConfig, isSendingErrorsAllowed()).WillByDefault(testing::Return(false));
+	ON_CALL(*mockServerConfig, isSendingCrashesAllowed()).WillByDefault(testing::Return(true));
+
+	// when
+	auto obtained = ServerConfigurationSnapshot_t::from(mockServerConfig);
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(true));
+	ASSERT_THAT(obtained.isSendingErrorsAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingCrashesAllowed(), testing::Eq(true));
+}
+
+TEST_F(ServerConfigurationSnapshotTest, snapshotTakesOverTrafficControlPercentageAndMultiplicity)
+{
+	// given
+	ON_CALL(*mockServerConfig, getTrafficControlPercentage()).WillByDefault(testing::Return(57));
+	ON_CALL(*mockServerConfig, getMultiplicity()).WillByDefault(testing::Return(std::numeric_limits<int32_t>::max()));
+
+	// when
+	auto obtained = ServerConfigurationSnapshot_t::from(mockServerConfig);
+
+	// then
+	ASSERT_THAT(obtained.getTrafficControlPercentage(), testing::Eq(57));
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(std::numeric_limits<int32_t>::max()));
+}
+
+TEST_F(ServerConfigurationSnapshotTest, snapshotKeepsNegativeMultiplicity)
+{
+	// given
+	ON_CALL(*mockServerConfig, isSendingDataAllowed()).WillByDefault(testing::Return(true));
+	ON_CALL(*mockServerConfig, getMultiplicity()).WillByDefault(testing::Return(-3));
+
+	// when
+	auto obtained = ServerConfigurationSnapshot_t::from(mockServerConfig);
+
+	// then
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(-3));
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(true));
+}
+
+TEST_F(ServerConfigurationSnapshotTest, trafficControlPercentageIsLimitedToValidRange)
+{
+	// given
+	ON_CALL(*mockServerConfig, getTrafficControlPercentage())
+		.WillByDefault(testing::Return(-1));
+
+	// when, then
+	ASSERT_THAT(ServerConfigurationSnapshot_t::from(mockServerConfig).getTrafficControlPercentage(), testing::Eq(0));
+
+	// and given
+	ON_CALL(*mockServerConfig, getTrafficControlPercentage())
+		.WillByDefault(testing::Return(1000));
+
+	// when, then
+	ASSERT_THAT(ServerConfigurationSnapshot_t::from(mockServerConfig).getTrafficControlPercentage(), testing::Eq(100));
+}
+
+TEST_F(ServerConfigurationSnapshotTest, snapshotCanBeRestoredFromPackedValue)
+{
+	// given
+	ON_CALL(*mockServerConfig, isSendingDataAllowed()).WillByDefault(testing::Return(false));
+	ON_CALL(*mockServerConfig, isSendingErrorsAllowed()).WillByDefault(testing::Return(true));
+	ON_CALL(*mockServerConfig, getTrafficControlPercentage()).WillByDefault(testing::Return(13));
+	ON_CALL(*mockServerConfig, getMultiplicity()).WillByDefault(testing::Return(5));
+	auto snapshot = ServerConfigurationSnapshot_t::from(mockServerConfig);
+
+	// when
+	ServerConfigurationSnapshot_t obtained(snapshot.getPackedValue());
+
+	// then
+	ASSERT_THAT(obtained.isSendingDataAllowed(), testing::Eq(false));
+	ASSERT_THAT(obtained.isSendingErrorsAllowed(), testing::Eq(true));
+	ASSERT_THAT(obtained.getTrafficControlPercentage(), testing::Eq(13));
+	ASSERT_THAT(obtained.getMultiplicity(), testing::Eq(5));
+}
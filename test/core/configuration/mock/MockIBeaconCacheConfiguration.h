@@ -20,6 +20,8 @@
 #include "core/configuration/ConfigurationDefaults.h"
 #include "core/configuration/IBeaconCacheConfiguration.h"
 
+#include "../../../DefaultValues.h"
+
 #include "gmock/gmock.h"
 
 #include <memory>
@@ -39,6 +41,14 @@ namespace test
 				.WillByDefault(testing::Return(core::configuration::DEFAULT_LOWER_MEMORY_BOUNDARY_IN_BYTES));
 			ON_CALL(*this, getCacheSizeUpperBound())
 				.WillByDefault(testing::Return(core::configuration::DEFAULT_UPPER_MEMORY_BOUNDARY_IN_BYTES));
+			ON_CALL(*this, getOverflowDirectory())
+				.WillByDefault(testing::ReturnRef(DefaultValues::EMPTY_STRING));
+			ON_CALL(*this, getOverflowMaxSize())
+				.WillByDefault(testing::Return(core::configuration::DEFAULT_BEACON_CACHE_OVERFLOW_MAX_SIZE_IN_BYTES));
+			ON_CALL(*this, getRecordQueueCapacity())
+				.WillByDefault(testing::Return(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_CAPACITY));
+			ON_CALL(*this, getRecordQueueFullPolicy())
+				.WillByDefault(testing::Return(core::configuration::DEFAULT_BEACON_RECORD_QUEUE_FULL_POLICY));
 		}
 
 		~MockIBeaconCacheConfiguration() override = default;
@@ -58,6 +68,14 @@ namespace test
 		MOCK_METHOD(int64_t, getCacheSizeLowerBound, (), (const, override));
 
 		MOCK_METHOD(int64_t, getCacheSizeUpperBound, (), (const, override));
+
+		MOCK_METHOD(const std::string&, getOverflowDirectory, (), (const, override));
+
+		MOCK_METHOD(int64_t, getOverflowMaxSize, (), (const, override));
+
+		MOCK_METHOD(int32_t, getRecordQueueCapacity, (), (const, override));
+
+		MOCK_METHOD(openkit::BeaconRecordQueueFullPolicy, getRecordQueueFullPolicy, (), (const, override));
 	};
 }
 
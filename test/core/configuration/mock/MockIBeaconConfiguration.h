@@ -42,6 +42,12 @@ namespace test
 			ON_CALL(*this, getPrivacyConfiguration()).WillByDefault(testing::Return(nullptr));
 			ON_CALL(*this, getHTTPClientConfiguration()).WillByDefault(testing::Return(nullptr));
 			ON_CALL(*this, getServerConfiguration()).WillByDefault(testing::Return(nullptr));
+			ON_CALL(*this, getServerConfigurationSnapshot()).WillByDefault(testing::Invoke(
+				[this]() -> core::configuration::ServerConfigurationSnapshot
+				{
+					return core::configuration::ServerConfigurationSnapshot::from(getServerConfiguration());
+				}
+			));
 		}
 
 		~MockIBeaconConfiguration() override = default;
@@ -64,6 +70,8 @@ namespace test
 
 		MOCK_METHOD(std::shared_ptr<core::configuration::IServerConfiguration>, getServerConfiguration, (), (override));
 
+		MOCK_METHOD(core::configuration::ServerConfigurationSnapshot, getServerConfigurationSnapshot, (), (const, override));
+
 		MOCK_METHOD(
 			void,
 			initializeServerConfiguration,
@@ -68,6 +68,8 @@ namespace test
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpRequestInterceptor>, getHttpRequestInterceptor, (), (const, override));
 
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpResponseInterceptor>, getHttpResponseInterceptor, (), (const, override));
+
+		MOCK_METHOD(int32_t, getMaxConcurrentRequests, (), (const, override));
 	};
 }
 
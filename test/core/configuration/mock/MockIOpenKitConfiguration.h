@@ -96,6 +96,18 @@ namespace test
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpRequestInterceptor>, getHttpRequestInterceptor, (), (const, override));
 
 		MOCK_METHOD(std::shared_ptr<openkit::IHttpResponseInterceptor>, getHttpResponseInterceptor, (), (const, override));
+
+		MOCK_METHOD(int32_t, getHttpConnectionPoolMaxIdleConnections, (), (const, override));
+
+		MOCK_METHOD(int64_t, getHttpConnectionPoolIdleTimeout, (), (const, override));
+
+		MOCK_METHOD(int32_t, getMaxConcurrentBeaconRequests, (), (const, override));
+
+		MOCK_METHOD(int32_t, getBeaconCompressionLevel, (), (const, override));
+
+		MOCK_METHOD(openkit::CompressionStrategy, getBeaconCompressionStrategy, (), (const, override));
+
+		MOCK_METHOD(bool, isSharedExecutorEnabled, (), (const, override));
 	};
 }
 
@@ -58,6 +58,8 @@ namespace test
 		MOCK_METHOD(int32_t, getCurrentServerID, (), (const, override));
 
 		MOCK_METHOD(void, addSession, (std::shared_ptr<core::objects::SessionInternals>), (override));
+
+		MOCK_METHOD(void, updateSessionState, (std::shared_ptr<core::objects::SessionInternals>), (override));
 	};
 }
 #endif
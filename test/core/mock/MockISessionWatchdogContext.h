@@ -44,6 +44,8 @@ namespace test
 
 		MOCK_METHOD(void, execute, (), (override));
 
+		MOCK_METHOD(int64_t, executeOnce, (), (override));
+
 		MOCK_METHOD(void, requestShutdown, (), (override));
 
 		MOCK_METHOD(bool, isShutdownRequested, (), (override));
@@ -19,6 +19,9 @@
 #include <OpenKit/json/JsonObjectValue.h>
 #include <OpenKit/json/JsonStringValue.h>
 #include <OpenKit/json/JsonNumberValue.h>
+#include <OpenKit/json/JsonBooleanValue.h>
+#include <OpenKit/json/JsonDocument.h>
+#include <core/objects/EventPayloadTemplate.h>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -256,4 +259,225 @@ TEST_F(EventPayloadBuilderTest, buildMapWithNestedMapThatContainsArrayWithInfini
 
 	// then
 	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"custom\":{\"custom\":[\"Test\",1,null,2]}}"));
-}
\ No newline at end of file
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorIsNotAddedWithoutNonFiniteValues)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	auto nestedMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+
+	auto jsonValuesArray = std::make_shared<openkit::json::JsonArrayValue::JsonValueList>();
+	jsonValuesArray->push_back(openkit::json::JsonNumberValue::fromDouble(5.5));
+	jsonValuesArray->push_back(openkit::json::JsonStringValue::fromString("Value"));
+
+	nestedMap->insert(std::make_pair("custom", openkit::json::JsonArrayValue::fromList(jsonValuesArray)));
+	sampleMap->insert(std::make_pair("custom", openkit::json::JsonObjectValue::fromMap(nestedMap)));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"custom\":{\"custom\":[5.5,\"Value\"]}}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorIsAddedForNanValue)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("custom", openkit::json::JsonNumberValue::fromDouble(nan(""))));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"custom\":null,\"dt.rum.has_nfn_values\":true}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorIsAddedForNestedInfiniteValue)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	auto nestedMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+
+	auto jsonValuesArray = std::make_shared<openkit::json::JsonArrayValue::JsonValueList>();
+	jsonValuesArray->push_back(openkit::json::JsonNumberValue::fromDouble(std::numeric_limits<float>::infinity()));
+
+	nestedMap->insert(std::make_pair("custom", openkit::json::JsonArrayValue::fromList(jsonValuesArray)));
+	sampleMap->insert(std::make_pair("custom", openkit::json::JsonObjectValue::fromMap(nestedMap)));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"custom\":{\"custom\":[null]},\"dt.rum.has_nfn_values\":true}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorIgnoresRemovedAttributes)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("dt.custom", openkit::json::JsonNumberValue::fromDouble(nan(""))));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.cleanReservedInternalAttributes()
+		.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorKeepsExistingAttributeWithoutNonFiniteValues)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("dt.rum.has_nfn_values", openkit::json::JsonBooleanValue::falseValue()));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// expect
+	EXPECT_CALL(*mockLogger, mockWarning(testing::_)).Times(0);
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"dt.rum.has_nfn_values\":false}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonFiniteNumericValuesIndicatorOverridesExistingAttributeWithNonFiniteValues)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("dt.rum.has_nfn_values", openkit::json::JsonNumberValue::fromDouble(nan(""))));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// expect
+	EXPECT_CALL(*mockLogger, mockWarning(testing::_)).Times(1);
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"dt.rum.has_nfn_values\":true}"));
+}
+
+TEST_F(EventPayloadBuilderTest, customAttributesSizeIsMeasuredBeforeCleaningReservedAttributes)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("dt.custom", openkit::json::JsonStringValue::fromString("Removed")));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addNonOverridableAttribute("event.type", openkit::json::JsonStringValue::fromString("type"))
+		.cleanReservedInternalAttributes()
+		.addCustomAttributesSizeAttribute("dt.rum.custom_attributes_size")
+		.addNonOverridableAttribute("event.kind", openkit::json::JsonStringValue::fromString("kind"));
+
+	auto measuredPayload = std::string("{\"dt.custom\":\"Removed\",\"event.type\":\"type\"}");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"event.type\":\"type\",\"event.kind\":\"kind\",\"dt.rum.custom_attributes_size\":"
+		+ std::to_string(measuredPayload.size()) + "}"));
+}
+
+TEST_F(EventPayloadBuilderTest, customAttributesSizeCountsCharactersOfOverriddenAttributes)
+{
+	// given
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("event.kind", openkit::json::JsonStringValue::fromString(u8"äöü")));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addCustomAttributesSizeAttribute("size")
+		.addNonOverridableAttribute("event.kind", openkit::json::JsonStringValue::fromString("kind"));
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"event.kind\":\"kind\",\"size\":20}"));
+}
+
+TEST_F(EventPayloadBuilderTest, buildFromDocumentBehavesLikeBuildFromMap)
+{
+	// given
+	openkit::json::JsonDocument document;
+	document.addString("dt.hello", "Removed")
+		.addString("event.kind", "Custom")
+		.addDouble("nan", nan(""))
+		.beginObject("nested")
+			.addLong("value", 1)
+		.endObject();
+
+	EventPayloadBuilder eventPayloadBuilder(document, mockLogger);
+	eventPayloadBuilder.cleanReservedInternalAttributes()
+		.addOverridableAttribute("event.kind", openkit::json::JsonStringValue::fromString("Overridden"))
+		.addNonOverridableAttribute("event.type", openkit::json::JsonStringValue::fromString("type"))
+		.addNonFiniteNumericValuesIndicator("dt.rum.has_nfn_values");
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq(
+		"{\"event.kind\":\"Custom\",\"nan\":null,\"nested\":{\"value\":1},\"event.type\":\"type\",\"dt.rum.has_nfn_values\":true}"));
+}
+
+TEST_F(EventPayloadBuilderTest, nonOverridableAttributeReplacesDocumentMember)
+{
+	// given
+	openkit::json::JsonDocument document;
+	document.addString("event.kind", "Custom")
+		.addLong("other", 2);
+
+	EventPayloadBuilder eventPayloadBuilder(document, mockLogger);
+	eventPayloadBuilder.addNonOverridableAttribute("event.kind", openkit::json::JsonStringValue::fromString("kind"));
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"other\":2,\"event.kind\":\"kind\"}"));
+}
+
+TEST_F(EventPayloadBuilderTest, templateAttributesAreSpliced)
+{
+	// given
+	EventPayloadTemplate eventTemplate;
+	eventTemplate.addNonOverridableAttribute("application", *openkit::json::JsonStringValue::fromString("app"))
+		.addOverridableAttribute("version", *openkit::json::JsonStringValue::fromString("1.0"));
+
+	auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	EventPayloadBuilder eventPayloadBuilder(emptyMap, mockLogger);
+	eventPayloadBuilder.addOverridableAttribute("timestamp", openkit::json::JsonNumberValue::fromLong(1))
+		.addTemplateAttributes(eventTemplate);
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"timestamp\":1,\"application\":\"app\",\"version\":\"1.0\"}"));
+}
+
+TEST_F(EventPayloadBuilderTest, templateAttributesAreOverriddenLikeIndividualAttributes)
+{
+	// given
+	EventPayloadTemplate eventTemplate;
+	eventTemplate.addNonOverridableAttribute("application", *openkit::json::JsonStringValue::fromString("app"))
+		.addOverridableAttribute("version", *openkit::json::JsonStringValue::fromString("1.0"));
+
+	auto sampleMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	sampleMap->insert(std::make_pair("application", openkit::json::JsonStringValue::fromString("custom")));
+	sampleMap->insert(std::make_pair("version", openkit::json::JsonStringValue::fromString("2.0")));
+
+	EventPayloadBuilder eventPayloadBuilder(sampleMap, mockLogger);
+	eventPayloadBuilder.addTemplateAttributes(eventTemplate);
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::AllOf(
+		AttributeIsOverridden("application", "app"),
+		AttributeIsOverridden("version", "2.0"),
+		testing::Not(testing::HasSubstr("custom")),
+		testing::Not(testing::HasSubstr("1.0"))));
+}
+
+TEST_F(EventPayloadBuilderTest, reservedTemplateAttributesAreCleaned)
+{
+	// given
+	EventPayloadTemplate eventTemplate;
+	eventTemplate.addNonOverridableAttribute("dt.rum.application", *openkit::json::JsonStringValue::fromString("app"))
+		.addNonOverridableAttribute("event.provider", *openkit::json::JsonStringValue::fromString("provider"));
+
+	auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+	EventPayloadBuilder eventPayloadBuilder(emptyMap, mockLogger);
+	eventPayloadBuilder.addTemplateAttributes(eventTemplate)
+		.cleanReservedInternalAttributes();
+
+	// then
+	ASSERT_THAT(eventPayloadBuilder.build(), testing::Eq("{\"event.provider\":\"provider\"}"));
+}
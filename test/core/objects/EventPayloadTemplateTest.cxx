@@ -0,0 +1,61 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <core/objects/EventPayloadTemplate.h>
+#include <OpenKit/json/JsonStringValue.h>
+#include <OpenKit/json/JsonNumberValue.h>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using namespace core::objects;
+
+class EventPayloadTemplateTest : public testing::Test
+{
+};
+
+TEST_F(EventPayloadTemplateTest, createEmptyTemplate)
+{
+	// given
+	EventPayloadTemplate target;
+
+	// then
+	ASSERT_THAT(target.getAttributes().empty(), testing::Eq(true));
+}
+
+TEST_F(EventPayloadTemplateTest, attributesAreSerializedInOrderOfAddition)
+{
+	// given
+	EventPayloadTemplate target;
+	target.addNonOverridableAttribute("first", *openkit::json::JsonStringValue::fromString("a/b"))
+		.addOverridableAttribute("second", *openkit::json::JsonNumberValue::fromLong(42));
+
+	// when
+	const auto& attributes = target.getAttributes();
+
+	// then
+	ASSERT_THAT(attributes.size(), testing::Eq(size_t(2)));
+
+	ASSERT_THAT(attributes[0].key, testing::Eq("first"));
+	ASSERT_THAT(attributes[0].serializedMember, testing::Eq("\"first\":\"a\\/b\""));
+	ASSERT_THAT(attributes[0].serializedMember.substr(attributes[0].valueOffset), testing::Eq("\"a\\/b\""));
+	ASSERT_THAT(attributes[0].isOverridable, testing::Eq(false));
+
+	ASSERT_THAT(attributes[1].key, testing::Eq("second"));
+	ASSERT_THAT(attributes[1].serializedMember, testing::Eq("\"second\":42"));
+	ASSERT_THAT(attributes[1].serializedMember.substr(attributes[1].valueOffset), testing::Eq("42"));
+	ASSERT_THAT(attributes[1].isOverridable, testing::Eq(true));
+}
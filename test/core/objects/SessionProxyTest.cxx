@@ -44,9 +44,11 @@ using SessionProxy_sp = std::shared_ptr<SessionProxy_t>;
 using SessionInternals_t = core::objects::SessionInternals;
 using SessionInternals_sp = std::shared_ptr<SessionInternals_t>;
 using IOpenKitComposite_sp = std::shared_ptr<core::objects::IOpenKitComposite>;
+using JsonObjectMapPtr_t = openkit::json::JsonObjectValue::JsonObjectMapPtr;
 using NullRootAction_t = core::objects::NullRootAction;
 using NullWebRequestTracer_t = core::objects::NullWebRequestTracer;
 using ServerConfiguration_t = core::configuration::ServerConfiguration;
+using WebRequestURL_t = core::objects::WebRequestURL;
 using ResponseAttributes_t = protocol::ResponseAttributes;
 using MockILogger_sp = std::shared_ptr<MockILogger>;
 using MockIOpenKitComposite_sp = std::shared_ptr<MockIOpenKitComposite>;
@@ -733,7 +735,7 @@ TEST_F(SessionProxyTest, sendEventWithEmptyPayloadWorks)
     auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
 
     // expect
-    EXPECT_CALL(*mockSession, sendEvent(testing::Eq(eventName), testing::Eq(emptyMap)))
+    EXPECT_CALL(*mockSession, sendEvent(testing::Eq(eventName), testing::Matcher<JsonObjectMapPtr_t>(testing::Eq(emptyMap))))
         .Times(1);
 
     // given
@@ -750,7 +752,7 @@ TEST_F(SessionProxyTest, sendEventWithNullPtrPayloadWorks)
     const char* eventName = "eventName";
 
     // expect
-    EXPECT_CALL(*mockSession, sendEvent(testing::Eq(eventName), testing::Eq(nullptr)))
+    EXPECT_CALL(*mockSession, sendEvent(testing::Eq(eventName), testing::Matcher<JsonObjectMapPtr_t>(testing::IsNull())))
         .Times(1);
 
     // given
@@ -765,7 +767,7 @@ TEST_F(SessionProxyTest, sendEventDoesNothingIfSessionIsEnded)
     auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
 
     // expect
-    EXPECT_CALL(*mockSession, sendEvent(testing::_, testing::_))
+    EXPECT_CALL(*mockSession, sendEvent(testing::_, testing::A<JsonObjectMapPtr_t>()))
         .Times(0);
 
     // given
@@ -1157,7 +1159,8 @@ TEST_F(SessionProxyTest, traceWebRequestWithValidUrlStringDelegatesToRealSession
     const char* url = "https://www.google.com";
 
     // expect
-    EXPECT_CALL(*mockSession, traceWebRequest(testing::Eq(url)))
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::Matcher<const WebRequestURL_t&>(
+        testing::Property(&WebRequestURL_t::getURL, testing::Eq(core::UTF8String(url))))))
         .Times(1);
 
     // given
@@ -1172,7 +1175,9 @@ TEST_F(SessionProxyTest, tracingANullStringWebRequestIsNotAllowed)
     // expect
     EXPECT_CALL(*mockLogger, mockWarning("SessionProxy [sn=0, seq=0] traceWebRequest: url must not be null or empty"))
         .Times(1);
-    EXPECT_CALL(*mockSession, traceWebRequest(testing::_))
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const char*>()))
+        .Times(0);
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const WebRequestURL_t&>()))
         .Times(0);
 
     // given
@@ -1191,7 +1196,9 @@ TEST_F(SessionProxyTest, tracingAnEmptyStringWebRequestIsNotAllowed)
     // expect
     EXPECT_CALL(*mockLogger, mockWarning("SessionProxy [sn=0, seq=0] traceWebRequest: url must not be null or empty"))
         .Times(1);
-    EXPECT_CALL(*mockSession, traceWebRequest(testing::_))
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const char*>()))
+        .Times(0);
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const WebRequestURL_t&>()))
         .Times(0);
 
     // given
@@ -1210,7 +1217,9 @@ TEST_F(SessionProxyTest, tracingAStringWebRequestWithInvalidUrlIsNotAllowed)
     // expect
     EXPECT_CALL(*mockLogger, mockWarning("SessionProxy [sn=0, seq=0] traceWebRequest: url \"foobar/://\" does not have a valid scheme"))
         .Times(1);
-    EXPECT_CALL(*mockSession, traceWebRequest(testing::_))
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const char*>()))
+        .Times(0);
+    EXPECT_CALL(*mockSession, traceWebRequest(testing::A<const WebRequestURL_t&>()))
         .Times(0);
 
     // given
@@ -1954,6 +1963,40 @@ TEST_F(SessionProxyTest, onChildClosedCallsDequeueOnSessionWatchdog)
     target->onChildClosed(session);
 }
 
+TEST_F(SessionProxyTest, onChildClosedUpdatesSessionStateInBeaconSender)
+{
+    // with
+    auto session = MockSessionInternals::createNice();
+
+    // expect
+    EXPECT_CALL(*mockBeaconSender, updateSessionState(testing::Eq(session)))
+        .Times(1);
+
+    // given
+    auto target = std::dynamic_pointer_cast<core::objects::IOpenKitComposite>(createSessionProxy());
+    target->storeChildInList(session);
+
+    // when
+    target->onChildClosed(session);
+}
+
+TEST_F(SessionProxyTest, onChildClosedDoesNotUpdateSessionStateForOtherChildObjects)
+{
+    // with
+    auto childObject = MockIOpenKitObject::createNice();
+
+    // expect
+    EXPECT_CALL(*mockBeaconSender, updateSessionState(testing::_))
+        .Times(0);
+
+    // given
+    auto target = std::dynamic_pointer_cast<core::objects::IOpenKitComposite>(createSessionProxy());
+    target->storeChildInList(childObject);
+
+    // when
+    target->onChildClosed(childObject);
+}
+
 TEST_F(SessionProxyTest, onServerConfigurationUpdateTakesOverServerConfigurationOnFirstCall)
 {
     // given
@@ -44,6 +44,7 @@
 using namespace test;
 
 using IOpenKitObject_t = core::objects::IOpenKitObject;
+using JsonObjectMapPtr_t = openkit::json::JsonObjectValue::JsonObjectMapPtr;
 using MockIBeaconSender_sp = std::shared_ptr<MockIBeaconSender>;
 using MockILogger_sp = std::shared_ptr<MockILogger>;
 using MockIAdditionalQueryParameters_sp = std::shared_ptr<MockIAdditionalQueryParameters>;
@@ -494,7 +495,7 @@ TEST_F(SessionTest, sendEventWithEmptyPayloadWorks)
 	auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
 
 	// expect
-	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::Eq(eventName), testing::Eq(emptyMap)))
+	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::Eq(eventName), testing::Matcher<JsonObjectMapPtr_t>(testing::Eq(emptyMap))))
 		.Times(1);
 
 	// given
@@ -513,7 +514,7 @@ TEST_F(SessionTest, sendEventWithNullPtrPayloadWorks)
 	const char* eventName = "eventName";
 
 	// expect
-	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::Eq(eventName), testing::Eq(nullptr)))
+	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::Eq(eventName), testing::Matcher<JsonObjectMapPtr_t>(testing::IsNull())))
 		.Times(1);
 
 	// given
@@ -1377,7 +1378,7 @@ TEST_F(SessionTest, sendEventDoesNothingIfSessionIsEnded)
 	auto emptyMap = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
 
 	// expect
-	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::_, testing::_))
+	EXPECT_CALL(*mockBeaconNice, sendEvent(testing::_, testing::A<JsonObjectMapPtr_t>()))
 		.Times(0);
 
 	// given
@@ -0,0 +1,161 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/UTF8String.h"
+#include "core/objects/WebRequestURL.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <random>
+#include <regex>
+#include <string>
+
+using WebRequestURL_t = core::objects::WebRequestURL;
+using Utf8String_t = core::UTF8String;
+
+class WebRequestURLTest : public testing::Test
+{
+protected:
+
+	/// the regular expression, which was used to validate URL schemes before
+	const std::regex schemeValidationPattern = std::regex("^[a-zA-Z][a-zA-Z0-9+\\-.]*://.+$", std::regex::ECMAScript);
+
+	void assertSchemeValidationIsEquivalentToRegex(const std::string& url)
+	{
+		ASSERT_THAT(WebRequestURL_t::isValidScheme(url), testing::Eq(std::regex_match(url, schemeValidationPattern)))
+			<< "url: \"" << url << "\"";
+	}
+};
+
+TEST_F(WebRequestURLTest, nullptrIsEmpty)
+{
+	// given
+	WebRequestURL_t target(nullptr);
+
+	// then
+	ASSERT_THAT(target.isEmpty(), testing::Eq(true));
+	ASSERT_THAT(target.hasValidScheme(), testing::Eq(false));
+}
+
+TEST_F(WebRequestURLTest, emptyStringIsEmpty)
+{
+	// given
+	WebRequestURL_t target("");
+
+	// then
+	ASSERT_THAT(target.isEmpty(), testing::Eq(true));
+	ASSERT_THAT(target.hasValidScheme(), testing::Eq(false));
+}
+
+TEST_F(WebRequestURLTest, urlWithoutQueryIsKept)
+{
+	// given
+	WebRequestURL_t target("https://www.google.com/search");
+
+	// then
+	ASSERT_THAT(target.isEmpty(), testing::Eq(false));
+	ASSERT_THAT(target.hasValidScheme(), testing::Eq(true));
+	ASSERT_THAT(target.getURL(), testing::Eq(Utf8String_t("https://www.google.com/search")));
+	ASSERT_THAT(target.getURLWithoutQuery(), testing::Eq(Utf8String_t("https://www.google.com/search")));
+}
+
+TEST_F(WebRequestURLTest, queryIsStrippedFromUrl)
+{
+	// given
+	WebRequestURL_t target(u8"https://www.google.com/s\u00e4arch?q=1&r=?");
+
+	// then
+	ASSERT_THAT(target.getURL(), testing::Eq(Utf8String_t(u8"https://www.google.com/s\u00e4arch?q=1&r=?")));
+	ASSERT_THAT(target.getURLWithoutQuery(), testing::Eq(Utf8String_t(u8"https://www.google.com/s\u00e4arch")));
+}
+
+TEST_F(WebRequestURLTest, queryIsNotStrippedFromUrlWithInvalidScheme)
+{
+	// given
+	WebRequestURL_t target("1http://www.google.com?q=1");
+
+	// then
+	ASSERT_THAT(target.hasValidScheme(), testing::Eq(false));
+	ASSERT_THAT(target.getURL(), testing::Eq(Utf8String_t("1http://www.google.com?q=1")));
+	ASSERT_THAT(target.getURLWithoutQuery(), testing::Eq(Utf8String_t()));
+}
+
+TEST_F(WebRequestURLTest, lineTerminatorsAfterSchemeAreNotValid)
+{
+	// then
+	ASSERT_THAT(WebRequestURL_t::isValidScheme("a://host\n"), testing::Eq(false));
+	ASSERT_THAT(WebRequestURL_t::isValidScheme("a://\rhost"), testing::Eq(false));
+	ASSERT_THAT(WebRequestURL_t::isValidScheme(std::string("a://\0host", 9)), testing::Eq(true));
+}
+
+TEST_F(WebRequestURLTest, schemeValidationIsEquivalentToRegexForAllShortStrings)
+{
+	// given
+	const std::string alphabet("aZ5+-.:/?\n\r \x80");
+
+	// when, then
+	std::string url;
+	std::vector<size_t> indices;
+	for (auto length = size_t(0); length <= 4; length++)
+	{
+		indices.assign(length, 0);
+		url.assign(length, alphabet[0]);
+
+		while (true)
+		{
+			assertSchemeValidationIsEquivalentToRegex(url);
+
+			auto position = size_t(0);
+			while (position < length && ++indices[position] == alphabet.size())
+			{
+				indices[position] = 0;
+				url[position] = alphabet[0];
+				position++;
+			}
+
+			if (position == length)
+			{
+				break;
+			}
+
+			url[position] = alphabet[indices[position]];
+		}
+	}
+}
+
+TEST_F(WebRequestURLTest, schemeValidationIsEquivalentToRegexForRandomStrings)
+{
+	// given
+	const std::string fragments[] = { "http", "://", ":", "/", "?", "+", "-", ".", "a", "Z", "9", "\n", "\r", " ", "@", "\x80", "\xc3\xa4", std::string(1, '\0') };
+	const auto numFragments = sizeof(fragments) / sizeof(fragments[0]);
+
+	std::mt19937 random(42);
+	std::uniform_int_distribution<size_t> fragmentDistribution(0, numFragments - 1);
+	std::uniform_int_distribution<size_t> lengthDistribution(0, 12);
+
+	// when, then
+	for (auto i = 0; i < 20000; i++)
+	{
+		std::string url;
+		for (auto numFragmentsInUrl = lengthDistribution(random); numFragmentsInUrl > 0; numFragmentsInUrl--)
+		{
+			url += fragments[fragmentDistribution(random)];
+		}
+
+		assertSchemeValidationIsEquivalentToRegex(url);
+	}
+}
@@ -69,6 +69,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendBizEvent,
+			(
+				const char*, // type
+				const openkit::json::JsonDocument& /*attributes*/
+				),
+			(override)
+		);
+
 		MOCK_METHOD(
 			void,
 			sendEvent,
@@ -79,6 +89,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendEvent,
+			(
+				const char*, // name
+				const openkit::json::JsonDocument& /*attributes*/
+			),
+			(override)
+		);
+
 		MOCK_METHOD(
 			void,
 			reportCrash,
@@ -41,7 +41,8 @@ namespace test
 		MockSessionInternals()
 		{
 			ON_CALL(*this, enterAction(testing::_)).WillByDefault(testing::ReturnNull());
-			ON_CALL(*this, traceWebRequest(testing::_)).WillByDefault(testing::ReturnNull());
+			ON_CALL(*this, traceWebRequest(testing::A<const char*>())).WillByDefault(testing::ReturnNull());
+			ON_CALL(*this, traceWebRequest(testing::A<const core::objects::WebRequestURL&>())).WillByDefault(testing::ReturnNull());
 			ON_CALL(*this, sendBeacon(testing::_, testing::_)).WillByDefault(testing::ReturnNull());
 		}
 
@@ -78,6 +79,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendBizEvent,
+			(
+				const char*, /*type*/
+				const openkit::json::JsonDocument& /*attributes*/
+				),
+			(override)
+		);
+
 		MOCK_METHOD(
 			void,
 			sendEvent,
@@ -88,6 +99,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendEvent,
+			(
+				const char*, /*name*/
+				const openkit::json::JsonDocument& /*attributes*/
+				),
+			(override)
+		);
+
 		MOCK_METHOD(
 			void,
 			reportCrash,
@@ -134,6 +155,15 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			std::shared_ptr<openkit::IWebRequestTracer>,
+			traceWebRequest,
+			(
+				const core::objects::WebRequestURL& /*url */
+			),
+			(override)
+		);
+
 		MOCK_METHOD(void, end, (), (override));
 
 		MOCK_METHOD(void, startSession, (), (override));
@@ -148,6 +178,17 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendBeaconAsync,
+			(
+				std::shared_ptr<providers::IHTTPClientProvider>,
+				const protocol::IAdditionalQueryParameters&,
+				protocol::IHTTPClient::ResponseHandler
+			),
+			(override)
+		);
+
 		MOCK_METHOD(bool, isEmpty, (), (const, override));
 
 		MOCK_METHOD(void, clearCapturedData, (), (override));
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/util/BoundedQueue.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using BoundedQueue_t = core::util::BoundedQueue<int64_t>;
+
+class BoundedQueueTest : public testing::Test
+{
+};
+
+TEST_F(BoundedQueueTest, popDoesNotInvokeTheReaderIfTheQueueIsEmpty)
+{
+	// given
+	BoundedQueue_t target(2);
+	auto numInvocations = 0;
+
+	// when
+	auto obtained = target.tryPop([&numInvocations](int64_t&) { numInvocations++; });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(numInvocations, testing::Eq(0));
+}
+
+TEST_F(BoundedQueueTest, pushDoesNotInvokeTheWriterIfTheQueueIsFull)
+{
+	// given
+	BoundedQueue_t target(2);
+	ASSERT_THAT(target.tryPush([](int64_t& value) { value = 1; }), testing::Eq(true));
+	ASSERT_THAT(target.tryPush([](int64_t& value) { value = 2; }), testing::Eq(true));
+	auto numInvocations = 0;
+
+	// when
+	auto obtained = target.tryPush([&numInvocations](int64_t&) { numInvocations++; });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(numInvocations, testing::Eq(0));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+}
+
+TEST_F(BoundedQueueTest, payloadsArePassedToTheReaderInTheOrderTheyWereWrittenAcrossLaps)
+{
+	// given
+	BoundedQueue_t target(2);
+
+	for (int64_t i = 0; i < 5; i++)
+	{
+		// when
+		ASSERT_THAT(target.tryPush([i](int64_t& value) { value = i; }), testing::Eq(true));
+
+		// then
+		int64_t obtained = -1;
+		ASSERT_THAT(target.tryPop([&obtained](int64_t& value) { obtained = value; }), testing::Eq(true));
+		ASSERT_THAT(obtained, testing::Eq(i));
+	}
+}
+
+TEST_F(BoundedQueueTest, everyPayloadIsReadExactlyOnceByConcurrentConsumers)
+{
+	// given
+	const int32_t numThreads = 4;
+	const int64_t numValuesPerProducer = 10000;
+	const int64_t numValues = numThreads * numValuesPerProducer;
+	BoundedQueue_t target(64);
+	std::vector<std::atomic<int32_t>> numReads(static_cast<size_t>(numValues));
+	for (auto& count : numReads)
+	{
+		count.store(0);
+	}
+	std::atomic<int64_t> numValuesRead(0);
+
+	// when
+	std::vector<std::thread> threads;
+	for (int32_t producer = 0; producer < numThreads; producer++)
+	{
+		threads.push_back(std::thread([&target, producer, numValuesPerProducer]()
+		{
+			for (int64_t i = 0; i < numValuesPerProducer; i++)
+			{
+				auto nextValue = producer * numValuesPerProducer + i;
+				while (!target.tryPush([nextValue](int64_t& value) { value = nextValue; }))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+	for (int32_t consumer = 0; consumer < numThreads; consumer++)
+	{
+		threads.push_back(std::thread([&target, &numReads, &numValuesRead, numValues]()
+		{
+			while (numValuesRead.load() < numValues)
+			{
+				auto isRead = target.tryPop([&numReads](int64_t& value) { numReads[static_cast<size_t>(value)]++; });
+				if (isRead)
+				{
+					numValuesRead++;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then
+	for (auto& count : numReads)
+	{
+		ASSERT_THAT(count.load(), testing::Eq(1));
+	}
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+}
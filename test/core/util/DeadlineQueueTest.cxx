@@ -0,0 +1,227 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/util/DeadlineQueue.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+
+template <typename T>
+using DeadlineQueue_t = core::util::DeadlineQueue<T>;
+
+class DeadlineQueueTest : public testing::Test
+{
+protected:
+	std::shared_ptr<int32_t> elementOne = std::make_shared<int32_t>(1);
+	std::shared_ptr<int32_t> elementTwo = std::make_shared<int32_t>(2);
+	std::shared_ptr<int32_t> elementThree = std::make_shared<int32_t>(3);
+	DeadlineQueue_t<int32_t> deadlineQueue;
+};
+
+TEST_F(DeadlineQueueTest, aDefaultConstructedQueueIsEmpty)
+{
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(0)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(DeadlineQueue_t<int32_t>::NO_DEADLINE));
+	ASSERT_THAT(deadlineQueue.takeDue(DeadlineQueue_t<int32_t>::NO_DEADLINE), testing::IsEmpty());
+}
+
+TEST_F(DeadlineQueueTest, nextDeadlineIsTheEarliestDeadline)
+{
+	// when
+	deadlineQueue.put(elementOne, 30);
+	deadlineQueue.put(elementTwo, 10);
+	deadlineQueue.put(elementThree, 20);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(3)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(10));
+}
+
+TEST_F(DeadlineQueueTest, takeDueReturnsAndRemovesOnlyDueElementsInDeadlineOrder)
+{
+	// given
+	deadlineQueue.put(elementOne, 30);
+	deadlineQueue.put(elementTwo, 20);
+	deadlineQueue.put(elementThree, 10);
+
+	// when
+	auto obtained = deadlineQueue.takeDue(20);
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(elementThree, elementTwo));
+	ASSERT_THAT(deadlineQueue.toStdVector(), testing::ElementsAre(elementOne));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(30));
+}
+
+TEST_F(DeadlineQueueTest, elementsWithSameDeadlineAreTakenInInsertionOrder)
+{
+	// given
+	deadlineQueue.put(elementTwo, 10);
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.put(elementThree, 10);
+
+	// when
+	auto obtained = deadlineQueue.takeDue(10);
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(elementTwo, elementOne, elementThree));
+}
+
+TEST_F(DeadlineQueueTest, removedElementIsNotTaken)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.put(elementTwo, 20);
+
+	// when
+	auto removed = deadlineQueue.remove(elementOne);
+
+	// then
+	ASSERT_THAT(removed, testing::Eq(true));
+	ASSERT_THAT(deadlineQueue.remove(elementOne), testing::Eq(false));
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(20));
+	ASSERT_THAT(deadlineQueue.takeDue(20), testing::ElementsAre(elementTwo));
+}
+
+TEST_F(DeadlineQueueTest, puttingAnElementAgainReplacesItsDeadline)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+
+	// when
+	deadlineQueue.put(elementOne, 50);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(50));
+	ASSERT_THAT(deadlineQueue.takeDue(49), testing::IsEmpty());
+	ASSERT_THAT(deadlineQueue.takeDue(50), testing::ElementsAre(elementOne));
+}
+
+TEST_F(DeadlineQueueTest, removedElementsDoNotAccumulate)
+{
+	// given
+	std::vector<std::shared_ptr<int32_t>> elements;
+	for (int32_t i = 0; i < 1000; i++)
+	{
+		elements.push_back(std::make_shared<int32_t>(i));
+	}
+
+	// when elements with a far deadline are added and removed again
+	for (auto& element : elements)
+	{
+		deadlineQueue.put(element, 1000000);
+		deadlineQueue.remove(element);
+	}
+	deadlineQueue.put(elementOne, 10);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(10));
+	ASSERT_THAT(deadlineQueue.takeDue(1000000), testing::ElementsAre(elementOne));
+}
+
+TEST_F(DeadlineQueueTest, getDueKeepsDueElementsQueuedWithoutDeadline)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.put(elementTwo, 20);
+
+	// when
+	auto obtained = deadlineQueue.getDue(10);
+
+	// then
+	ASSERT_THAT(obtained, testing::ElementsAre(elementOne));
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(20));
+	ASSERT_THAT(deadlineQueue.getDue(20), testing::ElementsAre(elementTwo));
+}
+
+TEST_F(DeadlineQueueTest, rescheduleSetsNewDeadlineOfDueElement)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.getDue(10);
+
+	// when
+	deadlineQueue.reschedule(elementOne, 30);
+
+	// then
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(30));
+	ASSERT_THAT(deadlineQueue.takeDue(30), testing::ElementsAre(elementOne));
+}
+
+TEST_F(DeadlineQueueTest, rescheduleDoesNotAddElementRemovedInTheMeantime)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.getDue(10);
+	deadlineQueue.remove(elementOne);
+
+	// when
+	deadlineQueue.reschedule(elementOne, 30);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(0)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(DeadlineQueue_t<int32_t>::NO_DEADLINE));
+}
+
+TEST_F(DeadlineQueueTest, rescheduleDoesNotReplaceDeadlineOfElementPutInTheMeantime)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.getDue(10);
+	deadlineQueue.put(elementOne, 5);
+
+	// when
+	deadlineQueue.reschedule(elementOne, 30);
+
+	// then
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(5));
+}
+
+TEST_F(DeadlineQueueTest, removeDueRemovesDueElement)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.getDue(10);
+
+	// when
+	deadlineQueue.removeDue(elementOne);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(0)));
+}
+
+TEST_F(DeadlineQueueTest, removeDueDoesNotRemoveElementPutInTheMeantime)
+{
+	// given
+	deadlineQueue.put(elementOne, 10);
+	deadlineQueue.getDue(10);
+	deadlineQueue.put(elementOne, 20);
+
+	// when
+	deadlineQueue.removeDue(elementOne);
+
+	// then
+	ASSERT_THAT(deadlineQueue.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(deadlineQueue.getNextDeadline(), testing::Eq(20));
+}
@@ -18,6 +18,10 @@
 #include "core/util/DefaultLogger.h"
 
 #include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <string>
 
 using DefaultLogger_t = core::util::DefaultLogger;
 using LogLevel_t = openkit::LogLevel;
@@ -166,3 +170,81 @@ TEST_F(DefaultLoggerTest, defaultLoggerPrintOutAVeryLongString)
 	found = oss.str().find("nisl ut aliquip ex ea commodo'\n"); // check the last words
 	ASSERT_TRUE(found != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
 }
+
+TEST_F(DefaultLoggerTest, asynchronousLoggerWritesRecordsInOrder)
+{
+	// given
+	std::ostringstream oss;
+	{
+		DefaultLogger_t logger(oss, LogLevel_t::LOG_LEVEL_DEBUG, 16);
+
+		// when
+		logger.info("first %d", 1);
+		logger.debug("second %s", "record");
+	} // destroying the logger writes the queued records
+
+	// then
+	auto first = oss.str().find("INFO");
+	ASSERT_TRUE(first != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
+	first = oss.str().find("first 1\n");
+	ASSERT_TRUE(first != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
+	auto second = oss.str().find("DEBUG");
+	ASSERT_TRUE(second != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
+	second = oss.str().find("second record\n");
+	ASSERT_TRUE(second != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
+	ASSERT_TRUE(first < second) << "Unexpected log statement: " << oss.str() << std::endl;
+}
+
+TEST_F(DefaultLoggerTest, asynchronousLoggerDoesNotWriteRecordsBelowLogLevel)
+{
+	// given
+	std::ostringstream oss;
+	{
+		DefaultLogger_t logger(oss, LogLevel_t::LOG_LEVEL_WARN, 16);
+
+		// when
+		logger.debug("not written");
+	}
+
+	// then
+	ASSERT_TRUE(oss.str().empty()) << "Unexpected log statement: " << oss.str() << std::endl;
+}
+
+TEST_F(DefaultLoggerTest, asynchronousLoggerTruncatesVeryLongRecords)
+{
+	// given
+	std::ostringstream oss;
+	std::string longText(2 * core::util::LogRecordQueue::MAX_RECORD_LENGTH, 'x');
+	{
+		DefaultLogger_t logger(oss, LogLevel_t::LOG_LEVEL_DEBUG, 16);
+
+		// when
+		logger.debug("%s", longText.c_str());
+	}
+
+	// then
+	ASSERT_THAT(oss.str().size(), testing::Eq(core::util::LogRecordQueue::MAX_RECORD_LENGTH + 1));
+	ASSERT_THAT(oss.str().back(), testing::Eq('\n'));
+}
+
+TEST_F(DefaultLoggerTest, asynchronousLoggerCountsAndReportsDroppedRecords)
+{
+	// given
+	std::ostringstream oss;
+	uint64_t numDroppedRecords = 0;
+	{
+		DefaultLogger_t logger(oss, LogLevel_t::LOG_LEVEL_DEBUG, 2);
+
+		// when logging much faster than the background thread writes
+		for (int32_t i = 0; i < 10000; i++)
+		{
+			logger.debug("record %d", i);
+		}
+		numDroppedRecords = logger.getNumDroppedRecords();
+	}
+
+	// then
+	ASSERT_THAT(numDroppedRecords, testing::Gt(uint64_t(0)));
+	auto found = oss.str().find("log records dropped, since the queue was full");
+	ASSERT_TRUE(found != std::string::npos) << "Unexpected log statement: " << oss.str() << std::endl;
+}
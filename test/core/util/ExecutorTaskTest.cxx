@@ -0,0 +1,302 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/util/ExecutorTask.h"
+#include "core/util/SharedExecutor.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+
+using ExecutorTask_t = core::util::ExecutorTask;
+using SharedExecutor_t = core::util::SharedExecutor;
+
+class ExecutorTaskTest : public testing::Test
+{
+protected:
+
+	const std::chrono::milliseconds WaitTimeout = std::chrono::seconds(5);
+
+	void SetUp() override
+	{
+		mNumRuns = 0;
+		mExecutor.reset(new SharedExecutor_t(1));
+	}
+
+	void TearDown() override
+	{
+		mExecutor.reset();
+	}
+
+	std::shared_ptr<ExecutorTask_t> createTask(const ExecutorTask_t::TaskFunction& taskFunction)
+	{
+		return std::make_shared<ExecutorTask_t>(*mExecutor, taskFunction);
+	}
+
+	std::atomic<int32_t> mNumRuns;
+	std::unique_ptr<SharedExecutor_t> mExecutor;
+};
+
+TEST_F(ExecutorTaskTest, aNewlyCreatedTaskIsNeitherStartedNorAlive)
+{
+	// given
+	auto target = createTask([]() { return ExecutorTask_t::WAIT_FOR_WAKEUP; });
+
+	// then
+	ASSERT_THAT(target->isStarted(), testing::Eq(false));
+	ASSERT_THAT(target->isAlive(), testing::Eq(false));
+}
+
+TEST_F(ExecutorTaskTest, startRunsTheTaskFunction)
+{
+	// given
+	std::promise<void> runPromise;
+	auto target = createTask([&runPromise]()
+	{
+		runPromise.set_value();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+
+	// when
+	auto obtained = target->start(0);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(runPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(target->isStarted(), testing::Eq(true));
+	ASSERT_THAT(target->isAlive(), testing::Eq(true));
+
+	target->stop(0);
+}
+
+TEST_F(ExecutorTaskTest, startReturnsFalseIfTaskWasAlreadyStarted)
+{
+	// given
+	auto target = createTask([]() { return ExecutorTask_t::WAIT_FOR_WAKEUP; });
+	target->start(ExecutorTask_t::WAIT_FOR_WAKEUP);
+
+	// when
+	auto obtained = target->start(0);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+
+	target->stop(0);
+}
+
+TEST_F(ExecutorTaskTest, taskIsRunAgainAfterTheReturnedDelay)
+{
+	// given
+	std::promise<void> runPromise;
+	auto target = createTask([this, &runPromise]()
+	{
+		if (mNumRuns.fetch_add(1) + 1 == 3)
+		{
+			runPromise.set_value();
+			return ExecutorTask_t::WAIT_FOR_WAKEUP;
+		}
+		return int64_t(1);
+	});
+
+	// when
+	target->start(0);
+
+	// then
+	ASSERT_THAT(runPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(target->stop(WaitTimeout.count()), testing::Eq(true));
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(3));
+}
+
+TEST_F(ExecutorTaskTest, aWaitingTaskIsRunOnWakeup)
+{
+	// given
+	std::promise<void> runPromise;
+	auto target = createTask([&runPromise]()
+	{
+		runPromise.set_value();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	target->start(ExecutorTask_t::WAIT_FOR_WAKEUP);
+
+	// when
+	target->wakeup();
+
+	// then
+	ASSERT_THAT(runPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+
+	target->stop(0);
+}
+
+TEST_F(ExecutorTaskTest, wakeupDoesNotRunATaskWhichWasNotStarted)
+{
+	// given
+	auto target = createTask([this]()
+	{
+		mNumRuns.fetch_add(1);
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+
+	// when
+	target->wakeup();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+	// then
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(0));
+	ASSERT_THAT(target->isStarted(), testing::Eq(false));
+}
+
+TEST_F(ExecutorTaskTest, aStoppedTaskIsNotRunAnymore)
+{
+	// given
+	auto target = createTask([this]()
+	{
+		mNumRuns.fetch_add(1);
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	target->start(60 * 1000);
+
+	// when
+	auto obtained = target->stop(0);
+	target->wakeup();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(target->isStarted(), testing::Eq(true));
+	ASSERT_THAT(target->isAlive(), testing::Eq(false));
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(0));
+}
+
+TEST_F(ExecutorTaskTest, stopWaitsForARunInProgress)
+{
+	// given
+	std::promise<void> runStartedPromise;
+	std::promise<void> continuePromise;
+	auto continueFuture = continuePromise.get_future().share();
+	auto target = createTask([&runStartedPromise, continueFuture]()
+	{
+		runStartedPromise.set_value();
+		continueFuture.wait();
+		return int64_t(0);
+	});
+	target->start(0);
+	ASSERT_THAT(runStartedPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+
+	// when
+	auto obtainedWhileRunning = target->stop(10);
+	continuePromise.set_value();
+	auto obtainedAfterRun = target->stop(WaitTimeout.count());
+
+	// then
+	ASSERT_THAT(obtainedWhileRunning, testing::Eq(false));
+	ASSERT_THAT(obtainedAfterRun, testing::Eq(true));
+	ASSERT_THAT(target->isAlive(), testing::Eq(false));
+}
+
+TEST_F(ExecutorTaskTest, wakeupWhileRunningRunsTheTaskOnceMore)
+{
+	// given
+	std::promise<void> runStartedPromise;
+	std::promise<void> continuePromise;
+	std::promise<void> secondRunPromise;
+	auto continueFuture = continuePromise.get_future().share();
+	auto target = createTask([this, &runStartedPromise, &secondRunPromise, continueFuture]()
+	{
+		if (mNumRuns.fetch_add(1) == 0)
+		{
+			runStartedPromise.set_value();
+			continueFuture.wait();
+		}
+		else
+		{
+			secondRunPromise.set_value();
+		}
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	target->start(0);
+	ASSERT_THAT(runStartedPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+
+	// when
+	target->wakeup();
+	continuePromise.set_value();
+
+	// then
+	ASSERT_THAT(secondRunPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(target->stop(WaitTimeout.count()), testing::Eq(true));
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(2));
+}
+
+TEST_F(ExecutorTaskTest, stopCalledByTheTaskFunctionDoesNotWaitForTheRunInProgress)
+{
+	// given
+	std::shared_ptr<ExecutorTask_t> target;
+	std::promise<std::chrono::steady_clock::duration> stopDurationPromise;
+	std::promise<bool> stopResultPromise;
+	target = createTask([this, &target, &stopDurationPromise, &stopResultPromise]()
+	{
+		mNumRuns.fetch_add(1);
+		auto start = std::chrono::steady_clock::now();
+		stopResultPromise.set_value(target->stop(WaitTimeout.count()));
+		stopDurationPromise.set_value(std::chrono::steady_clock::now() - start);
+
+		// would be run again immediately, if it was not stopped
+		return int64_t(0);
+	});
+
+	// when
+	target->start(0);
+
+	// then
+	auto stopDurationFuture = stopDurationPromise.get_future();
+	ASSERT_THAT(stopDurationFuture.wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(stopDurationFuture.get(), testing::Lt(WaitTimeout));
+	ASSERT_THAT(stopResultPromise.get_future().get(), testing::Eq(true));
+	ASSERT_THAT(target->stop(WaitTimeout.count()), testing::Eq(true));
+	ASSERT_THAT(target->isAlive(), testing::Eq(false));
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(1));
+}
+
+TEST_F(ExecutorTaskTest, aTaskReleasingTheLastReferenceToItsExecutorIsNotRunAgain)
+{
+	// given
+	auto executor = std::make_shared<SharedExecutor_t>(1);
+	std::promise<void> releasedPromise;
+	auto target = std::make_shared<ExecutorTask_t>(*executor, [this, &executor, &releasedPromise]()
+	{
+		mNumRuns.fetch_add(1);
+		executor.reset();
+		releasedPromise.set_value();
+
+		// rescheduling must not access the destroyed executor
+		return int64_t(0);
+	});
+
+	// when
+	target->start(0);
+
+	// then
+	ASSERT_THAT(releasedPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	ASSERT_THAT(mNumRuns.load(), testing::Eq(1));
+	ASSERT_THAT(target->stop(WaitTimeout.count()), testing::Eq(true));
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/util/LogRecordQueue.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <string>
+
+using LogRecordQueue_t = core::util::LogRecordQueue;
+
+class LogRecordQueueTest : public testing::Test
+{
+};
+
+TEST_F(LogRecordQueueTest, capacityIsRoundedUpToPowerOfTwo)
+{
+	ASSERT_THAT(LogRecordQueue_t(0).getCapacity(), testing::Eq(size_t(2)));
+	ASSERT_THAT(LogRecordQueue_t(2).getCapacity(), testing::Eq(size_t(2)));
+	ASSERT_THAT(LogRecordQueue_t(5).getCapacity(), testing::Eq(size_t(8)));
+}
+
+TEST_F(LogRecordQueueTest, popFromEmptyQueueFails)
+{
+	// given
+	LogRecordQueue_t target(4);
+	std::string output;
+
+	// when, then
+	ASSERT_THAT(target.tryPopInto(output), testing::Eq(false));
+	ASSERT_THAT(output, testing::IsEmpty());
+	ASSERT_THAT(target.size(), testing::Eq(size_t(0)));
+}
+
+TEST_F(LogRecordQueueTest, recordsArePoppedInTheOrderTheyWerePushedFollowedByALineBreak)
+{
+	// given
+	LogRecordQueue_t target(4);
+	std::string output = "start\n";
+
+	// when
+	ASSERT_THAT(target.tryPush("first", 5), testing::Eq(true));
+	ASSERT_THAT(target.tryPush("second", 6), testing::Eq(true));
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(target.tryPopInto(output), testing::Eq(true));
+	ASSERT_THAT(target.tryPopInto(output), testing::Eq(true));
+	ASSERT_THAT(target.tryPopInto(output), testing::Eq(false));
+	ASSERT_THAT(output, testing::Eq("start\nfirst\nsecond\n"));
+}
+
+TEST_F(LogRecordQueueTest, pushToFullQueueFails)
+{
+	// given
+	LogRecordQueue_t target(2);
+	ASSERT_THAT(target.tryPush("a", 1), testing::Eq(true));
+	ASSERT_THAT(target.tryPush("b", 1), testing::Eq(true));
+
+	// when
+	auto obtained = target.tryPush("c", 1);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+}
+
+TEST_F(LogRecordQueueTest, longRecordsAreTruncated)
+{
+	// given
+	LogRecordQueue_t target(2);
+	std::string record(LogRecordQueue_t::MAX_RECORD_LENGTH + 10, 'x');
+	std::string output;
+
+	// when
+	target.tryPush(record.data(), record.size());
+	target.tryPopInto(output);
+
+	// then
+	ASSERT_THAT(output, testing::Eq(std::string(LogRecordQueue_t::MAX_RECORD_LENGTH, 'x') + "\n"));
+}
@@ -0,0 +1,177 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/util/SharedExecutor.h"
+#include "core/util/ExecutorTask.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using ExecutorTask_t = core::util::ExecutorTask;
+using SharedExecutor_t = core::util::SharedExecutor;
+
+class SharedExecutorTest : public testing::Test
+{
+protected:
+
+	const std::chrono::milliseconds WaitTimeout = std::chrono::seconds(5);
+};
+
+TEST_F(SharedExecutorTest, atLeastOneWorkerIsStarted)
+{
+	// when
+	SharedExecutor_t target(0);
+
+	// then
+	ASSERT_THAT(target.getNumberOfWorkers(), testing::Eq(size_t(1)));
+}
+
+TEST_F(SharedExecutorTest, givenNumberOfWorkersIsStarted)
+{
+	// when
+	SharedExecutor_t target(3);
+
+	// then
+	ASSERT_THAT(target.getNumberOfWorkers(), testing::Eq(size_t(3)));
+}
+
+TEST_F(SharedExecutorTest, getInstanceReturnsTheSameExecutorWhileItIsUsed)
+{
+	// when
+	auto first = SharedExecutor_t::getInstance();
+	auto second = SharedExecutor_t::getInstance();
+
+	// then
+	ASSERT_THAT(first, testing::NotNull());
+	ASSERT_THAT(second, testing::Eq(first));
+	ASSERT_THAT(first->getNumberOfWorkers(), testing::Eq(SharedExecutor_t::DEFAULT_NUMBER_OF_WORKERS));
+}
+
+TEST_F(SharedExecutorTest, tasksAreRunInTheOrderTheyBecomeDue)
+{
+	// given
+	SharedExecutor_t target(1);
+	std::mutex mutex;
+	std::vector<int32_t> runTasks;
+	std::promise<void> lastRunPromise;
+
+	auto lateTask = std::make_shared<ExecutorTask_t>(target, [&]()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		runTasks.push_back(2);
+		lastRunPromise.set_value();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	auto earlyTask = std::make_shared<ExecutorTask_t>(target, [&]()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		runTasks.push_back(1);
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+
+	// when
+	lateTask->start(50);
+	earlyTask->start(0);
+
+	// then
+	ASSERT_THAT(lastRunPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	std::lock_guard<std::mutex> lock(mutex);
+	ASSERT_THAT(runTasks, testing::ElementsAre(1, 2));
+}
+
+TEST_F(SharedExecutorTest, aCancelledTaskIsNotRun)
+{
+	// given
+	SharedExecutor_t target(1);
+	std::atomic<int32_t> numRuns(0);
+	auto task = std::make_shared<ExecutorTask_t>(target, [&numRuns]()
+	{
+		numRuns.fetch_add(1);
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	task->start(20);
+
+	// when
+	target.cancel(task);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	// then
+	ASSERT_THAT(numRuns.load(), testing::Eq(0));
+}
+
+TEST_F(SharedExecutorTest, tasksOfDifferentOwnersAreRunConcurrently)
+{
+	// given
+	SharedExecutor_t target(2);
+	std::promise<void> firstRunPromise;
+	std::promise<void> secondRunPromise;
+	auto secondRunFuture = secondRunPromise.get_future().share();
+
+	auto blockingTask = std::make_shared<ExecutorTask_t>(target, [&firstRunPromise, secondRunFuture]()
+	{
+		firstRunPromise.set_value();
+		secondRunFuture.wait();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+	auto otherTask = std::make_shared<ExecutorTask_t>(target, [&secondRunPromise]()
+	{
+		secondRunPromise.set_value();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+
+	// when
+	blockingTask->start(0);
+	ASSERT_THAT(firstRunPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	otherTask->start(0);
+
+	// then
+	ASSERT_THAT(secondRunFuture.wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(blockingTask->stop(WaitTimeout.count()), testing::Eq(true));
+}
+
+TEST_F(SharedExecutorTest, releasingTheLastReferenceInsideATaskDoesNotStopTheWorkerFromFinishing)
+{
+	// given
+	auto target = std::make_shared<SharedExecutor_t>(2);
+	std::weak_ptr<SharedExecutor_t> weakTarget = target;
+	std::promise<void> releasedPromise;
+	auto task = std::make_shared<ExecutorTask_t>(*target, [&target, &releasedPromise]()
+	{
+		target.reset();
+		releasedPromise.set_value();
+		return ExecutorTask_t::WAIT_FOR_WAKEUP;
+	});
+
+	// when
+	task->start(0);
+
+	// then
+	ASSERT_THAT(releasedPromise.get_future().wait_for(WaitTimeout), testing::Eq(std::future_status::ready));
+	ASSERT_THAT(weakTarget.expired(), testing::Eq(true));
+
+	// give the detached worker time to return from the task
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/util/StreamingCompressorPool.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using StreamingCompressorPool_t = base::util::StreamingCompressorPool;
+using CompressionStrategy_t = openkit::CompressionStrategy;
+
+class StreamingCompressorPoolTest : public testing::Test
+{
+};
+
+TEST_F(StreamingCompressorPoolTest, acquireCreatesCompressorWithConfiguredSettings)
+{
+	// given
+	StreamingCompressorPool_t target(9, CompressionStrategy_t::RLE, 2);
+
+	// when
+	auto obtained = target.acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->getCompressionLevel(), testing::Eq(9));
+	ASSERT_THAT(obtained->getCompressionStrategy(), testing::Eq(CompressionStrategy_t::RLE));
+	ASSERT_THAT(target.getNumberOfIdleCompressors(), testing::Eq(size_t(0)));
+}
+
+TEST_F(StreamingCompressorPoolTest, releasedCompressorIsReused)
+{
+	// given
+	StreamingCompressorPool_t target(-1, CompressionStrategy_t::DEFAULT, 2);
+	auto compressor = target.acquire();
+	auto compressorPtr = compressor.get();
+
+	// when
+	target.release(std::move(compressor));
+
+	// then
+	ASSERT_THAT(target.getNumberOfIdleCompressors(), testing::Eq(size_t(1)));
+	auto obtained = target.acquire();
+	ASSERT_THAT(obtained.get(), testing::Eq(compressorPtr));
+	ASSERT_THAT(target.getNumberOfIdleCompressors(), testing::Eq(size_t(0)));
+}
+
+TEST_F(StreamingCompressorPoolTest, releaseDiscardsCompressorIfPoolIsFull)
+{
+	// given
+	StreamingCompressorPool_t target(-1, CompressionStrategy_t::DEFAULT, 1);
+	auto compressor1 = target.acquire();
+	auto compressor2 = target.acquire();
+
+	// when
+	target.release(std::move(compressor1));
+	target.release(std::move(compressor2));
+
+	// then
+	ASSERT_THAT(target.getNumberOfIdleCompressors(), testing::Eq(size_t(1)));
+}
+
+TEST_F(StreamingCompressorPoolTest, releasingNullptrIsIgnored)
+{
+	// given
+	StreamingCompressorPool_t target(-1, CompressionStrategy_t::DEFAULT, 1);
+
+	// when
+	target.release(nullptr);
+
+	// then
+	ASSERT_THAT(target.getNumberOfIdleCompressors(), testing::Eq(size_t(0)));
+}
@@ -0,0 +1,215 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/util/Compressor.h"
+#include "core/util/StreamingCompressor.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using StreamingCompressor_t = base::util::StreamingCompressor;
+
+class StreamingCompressorTest : public testing::Test
+{
+protected:
+
+	static std::vector<unsigned char> readAll(StreamingCompressor_t& target, size_t bufferSize)
+	{
+		std::vector<unsigned char> result;
+		std::vector<unsigned char> buffer(bufferSize);
+
+		size_t written = 0;
+		do
+		{
+			EXPECT_TRUE(target.read(buffer.data(), buffer.size(), written));
+			result.insert(result.end(), buffer.begin(), buffer.begin() + written);
+		} while (written > 0);
+
+		return result;
+	}
+
+	static uint32_t readTrailingInputSize(const std::vector<unsigned char>& data)
+	{
+		// the last four bytes of a gzip stream contain the input size (little endian)
+		auto size = data.size();
+		return static_cast<uint32_t>(data[size - 4])
+			| (static_cast<uint32_t>(data[size - 3]) << 8)
+			| (static_cast<uint32_t>(data[size - 2]) << 16)
+			| (static_cast<uint32_t>(data[size - 1]) << 24);
+	}
+};
+
+TEST_F(StreamingCompressorTest, aNewInstanceIsFinished)
+{
+	// given
+	StreamingCompressor_t target;
+
+	// when
+	size_t written = 42;
+	char buffer[16];
+	auto obtained = target.read(buffer, sizeof(buffer), written);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(written, testing::Eq(size_t(0)));
+	ASSERT_THAT(target.isFinished(), testing::Eq(true));
+}
+
+TEST_F(StreamingCompressorTest, gzipCompressHelloWorld)
+{
+	// given
+	const std::string inData = "Hello World";
+	StreamingCompressor_t target;
+
+	// when
+	ASSERT_THAT(target.reset(inData.c_str(), inData.size()), testing::Eq(true));
+	auto obtained = readAll(target, 1024);
+
+	// then
+	ASSERT_THAT(target.isFinished(), testing::Eq(true));
+	ASSERT_THAT(obtained.size(), testing::Gt(size_t(18)));
+
+	// verify the GZIP magical number
+	EXPECT_EQ(obtained[0], 0x1F);
+	EXPECT_EQ(obtained[1], 0x8B);
+	EXPECT_EQ(obtained[2], 0x08);
+
+	EXPECT_EQ(readTrailingInputSize(obtained), inData.size());
+}
+
+TEST_F(StreamingCompressorTest, compressedDataIsIndependentOfTheReadBufferSize)
+{
+	// given
+	std::string inData;
+	for (int i = 0; i < 1000; i++)
+	{
+		inData.append("et=1&na=action&it=1&pa=0&s0=" + std::to_string(i) + "&t0=" + std::to_string(i * 7) + ";");
+	}
+	StreamingCompressor_t target;
+
+	// when
+	target.reset(inData.c_str(), inData.size());
+	auto obtainedLargeBuffer = readAll(target, 64 * 1024);
+	target.reset(inData.c_str(), inData.size());
+	auto obtainedSmallBuffer = readAll(target, 7);
+
+	// then
+	ASSERT_THAT(obtainedSmallBuffer, testing::Eq(obtainedLargeBuffer));
+	ASSERT_THAT(readTrailingInputSize(obtainedLargeBuffer), testing::Eq(inData.size()));
+}
+
+TEST_F(StreamingCompressorTest, compressedDataMatchesCompressor)
+{
+	// given
+	const std::string inData = "some beacon data, some beacon data, some beacon data";
+	StreamingCompressor_t target;
+
+	std::vector<unsigned char> expected;
+	base::util::Compressor::compressMemory(inData.c_str(), inData.size(), expected);
+
+	// when
+	target.reset(inData.c_str(), inData.size());
+	auto obtained = readAll(target, 5);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(expected));
+}
+
+TEST_F(StreamingCompressorTest, resetRestartsCompression)
+{
+	// given
+	const std::string inData = "Hello World";
+	StreamingCompressor_t target;
+	target.reset(inData.c_str(), inData.size());
+
+	char buffer[4];
+	size_t written = 0;
+	target.read(buffer, sizeof(buffer), written);
+
+	// when
+	target.reset(inData.c_str(), inData.size());
+	auto obtained = readAll(target, 1024);
+
+	// then
+	EXPECT_EQ(obtained[0], 0x1F);
+	EXPECT_EQ(obtained[1], 0x8B);
+	EXPECT_EQ(readTrailingInputSize(obtained), inData.size());
+}
+
+TEST_F(StreamingCompressorTest, higherCompressionLevelProducesSmallerOutput)
+{
+	// given
+	std::string inData;
+	for (int i = 0; i < 1000; i++)
+	{
+		inData.append("et=40&na=action+" + std::to_string(i % 17) + "&it=1&ca=" + std::to_string(i) + "&pa=0&s0=3&t0=" + std::to_string(i * 13) + "&s1=4&t1=25;");
+	}
+	StreamingCompressor_t storeOnly(0);
+	StreamingCompressor_t fastest(1);
+	StreamingCompressor_t best(9);
+
+	// when
+	storeOnly.reset(inData.c_str(), inData.size());
+	auto obtainedStoreOnly = readAll(storeOnly, 4096);
+	fastest.reset(inData.c_str(), inData.size());
+	auto obtainedFastest = readAll(fastest, 4096);
+	best.reset(inData.c_str(), inData.size());
+	auto obtainedBest = readAll(best, 4096);
+
+	// then
+	ASSERT_THAT(obtainedStoreOnly.size(), testing::Gt(inData.size()));
+	ASSERT_THAT(obtainedFastest.size(), testing::Lt(obtainedStoreOnly.size()));
+	ASSERT_THAT(obtainedBest.size(), testing::Le(obtainedFastest.size()));
+	ASSERT_THAT(readTrailingInputSize(obtainedBest), testing::Eq(inData.size()));
+}
+
+TEST_F(StreamingCompressorTest, allCompressionStrategiesProduceGzipData)
+{
+	const std::string inData = "et=40&na=action&it=1&ca=1&pa=0&s0=3&t0=7;et=40&na=action&it=1&ca=2&pa=0&s0=3&t0=9";
+	for (auto strategy : { openkit::CompressionStrategy::DEFAULT, openkit::CompressionStrategy::FILTERED,
+		openkit::CompressionStrategy::HUFFMAN_ONLY, openkit::CompressionStrategy::RLE, openkit::CompressionStrategy::FIXED })
+	{
+		// given
+		StreamingCompressor_t target(-1, strategy);
+
+		// when
+		ASSERT_THAT(target.reset(inData.c_str(), inData.size()), testing::Eq(true));
+		auto obtained = readAll(target, 16);
+
+		// then
+		EXPECT_EQ(obtained[0], 0x1F);
+		EXPECT_EQ(obtained[1], 0x8B);
+		EXPECT_EQ(readTrailingInputSize(obtained), inData.size());
+	}
+}
+
+TEST_F(StreamingCompressorTest, resetFailsForInvalidCompressionLevel)
+{
+	// given
+	const std::string inData = "Hello World";
+	StreamingCompressor_t target(42);
+
+	// when
+	auto obtained = target.reset(inData.c_str(), inData.size());
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.isFinished(), testing::Eq(true));
+}
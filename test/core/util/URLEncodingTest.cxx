@@ -139,4 +139,81 @@ TEST_F(URLEncodingTest, itIsPossibleToMarkAdditionalCharactersAsReserved)
 
 	// then
 	ASSERT_EQ(obtained, "%30123456789-.%5F~");
-}
\ No newline at end of file
+}
+
+TEST_F(URLEncodingTest, underscoreCanBeMarkedAsReserved)
+{
+	// given
+	Utf8String_t input("a_b-c.d~");
+
+	// when
+	auto obtained = UrlEncoding_t::urlencode(input, { '_' });
+
+	// then
+	ASSERT_EQ(obtained, "a%5Fb-c.d~");
+}
+
+TEST_F(URLEncodingTest, urlEncodeEscapesAllReservedAsciiCharacters)
+{
+	// given
+	Utf8String_t input(" !\"#$%&'()*+,/:;<=>?@[\\]^`{|}");
+
+	// when
+	auto obtained = UrlEncoding_t::urlencode(input);
+
+	// then
+	ASSERT_EQ(obtained, "%20%21%22%23%24%25%26%27%28%29%2A%2B%2C%2F%3A%3B%3C%3D%3E%3F%40%5B%5C%5D%5E%60%7B%7C%7D");
+}
+
+TEST_F(URLEncodingTest, urlEncodeEscapesControlAndNonAsciiBytes)
+{
+	// given
+	const char input[] = { 'a', '\x00', '\x1F', '\x7F', '\x80', '\xFF', 'z' };
+	std::string obtained;
+
+	// when
+	UrlEncoding_t::urlencode(input, sizeof(input), {}, obtained);
+
+	// then
+	ASSERT_EQ(obtained, "a%00%1F%7F%80%FFz");
+}
+
+TEST_F(URLEncodingTest, urlEncodeAppendsToGivenString)
+{
+	// given
+	std::string input("a b");
+	std::string obtained("prefix=");
+
+	// when
+	UrlEncoding_t::urlencode(input.data(), input.size(), { 'b' }, obtained);
+
+	// then
+	ASSERT_EQ(obtained, "prefix=a%20%62");
+}
+
+TEST_F(URLEncodingTest, precomputedUnreservedCharactersEncodeLikeAdditionalReservedCharacters)
+{
+	// given
+	Utf8String_t input("a_b c0~");
+	const UrlEncoding_t::UnreservedCharacters unreservedCharacters({ '_', '0' });
+
+	// when
+	auto obtained = UrlEncoding_t::urlencode(input, unreservedCharacters);
+
+	// then
+	ASSERT_EQ(obtained, "a%5Fb%20c%30~");
+	ASSERT_EQ(obtained, UrlEncoding_t::urlencode(input, { '_', '0' }));
+}
+
+TEST_F(URLEncodingTest, unreservedCharactersContainOnlyRfc3986UnreservedCharactersNotMarkedAsReserved)
+{
+	// given
+	const UrlEncoding_t::UnreservedCharacters target({ '_' });
+
+	// then
+	ASSERT_TRUE(target.contains('a'));
+	ASSERT_TRUE(target.contains('~'));
+	ASSERT_FALSE(target.contains('_'));
+	ASSERT_FALSE(target.contains(' '));
+	ASSERT_FALSE(target.contains(0xC3));
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/UTF8String.h"
+#include "core/util/StringUtil.h"
+#include "protocol/BeaconProtocolConstants.h"
+#include "protocol/BeaconRecordWriter.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <limits>
+
+using BeaconRecordKey_t = protocol::BeaconRecordKey;
+using BeaconRecordWriter_t = protocol::BeaconRecordWriter;
+using StringUtil_t = core::util::StringUtil;
+using Utf8String_t = core::UTF8String;
+
+static constexpr BeaconRecordKey_t KEY_A("&a=");
+static constexpr BeaconRecordKey_t KEY_B("&b=");
+static constexpr BeaconRecordKey_t KEY_C("&c=");
+static constexpr BeaconRecordKey_t KEY_K("&k=");
+static constexpr BeaconRecordKey_t KEY_L("&l=");
+
+class BeaconRecordWriterTest : public testing::Test
+{
+};
+
+TEST_F(BeaconRecordWriterTest, aDefaultConstructedWriterIsEmpty)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(true));
+	ASSERT_THAT(target.toUTF8String(), testing::Eq(""));
+}
+
+TEST_F(BeaconRecordWriterTest, keyValuePairsAreSeparatedByDelimiter)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePair(KEY_A, 1);
+	target.addKeyValuePair(KEY_B, int64_t(2));
+	target.addKeyValuePair(KEY_C, "three");
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(false));
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("a=1&b=2&c=three"));
+}
+
+TEST_F(BeaconRecordWriterTest, protocolKeysAreSerializedWithoutTheirLeadingDelimiterOnlyForTheFirstPair)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePair(protocol::BEACON_KEY_EVENT_TYPE, 1);
+	target.addKeyValuePair(protocol::BEACON_KEY_NAME, "foo");
+
+	// then
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("et=1&na=foo"));
+}
+
+TEST_F(BeaconRecordWriterTest, integersAreFormattedLikeInvariantString)
+{
+	// given
+	const int64_t values[] = { 0, 7, -7, 1234567890, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+
+	for (auto value : values)
+	{
+		BeaconRecordWriter_t target;
+
+		// when
+		target.addKeyValuePair(KEY_K, value);
+
+		// then
+		ASSERT_THAT(target.toUTF8String(), testing::Eq(Utf8String_t("k=" + StringUtil_t::toInvariantString(value))));
+	}
+}
+
+TEST_F(BeaconRecordWriterTest, int32MinimumIsFormattedCorrectly)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePair(KEY_K, std::numeric_limits<int32_t>::min());
+
+	// then
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("k=-2147483648"));
+}
+
+TEST_F(BeaconRecordWriterTest, doublesAreFormattedLikeInvariantString)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePair(KEY_K, 3.125);
+	target.addKeyValuePair(KEY_L, -2.0);
+
+	// then
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("k=3.125&l=-2"));
+}
+
+TEST_F(BeaconRecordWriterTest, stringValuesAreUrlEncodedIncludingUnderscore)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePair(KEY_K, Utf8String_t("a b_c&d=\xC3\xA4~.-"));
+
+	// then
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("k=a%20b%5Fc%26d%3D%C3%A4~.-"));
+	ASSERT_THAT(target.toUTF8String().getStringLength(), testing::Eq(size_t(27)));
+}
+
+TEST_F(BeaconRecordWriterTest, addKeyValuePairIfNotEmptyIgnoresEmptyValues)
+{
+	// given
+	BeaconRecordWriter_t target;
+
+	// when
+	target.addKeyValuePairIfNotEmpty(KEY_A, Utf8String_t());
+	target.addKeyValuePairIfNotEmpty(KEY_B, Utf8String_t("x"));
+	target.addKeyValuePairIfNotEmpty(KEY_C, Utf8String_t(""));
+
+	// then
+	ASSERT_THAT(target.toUTF8String(), testing::Eq("b=x"));
+}
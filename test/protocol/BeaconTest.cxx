@@ -18,6 +18,7 @@
 #include "protocol/Beacon.h"
 #include "OpenKit/CrashReportingLevel.h"
 #include "OpenKit/DataCollectionLevel.h"
+#include "OpenKit/json/JsonDocument.h"
 #include "OpenKit/json/JsonObjectValue.h"
 #include "OpenKit/json/JsonStringValue.h"
 #include "OpenKit/json/JsonArrayValue.h"
@@ -245,6 +246,8 @@ protected:
 
 		mockLogger = MockILogger::createNice();
 		mockBeaconCache = MockIBeaconCache::createStrict();
+		EXPECT_CALL(*mockBeaconCache, setBeaconHeader(testing::_, testing::_))
+			.Times(testing::AnyNumber());
 	}
 
 	BeaconBuilder_sp createBeacon()
@@ -2115,6 +2118,52 @@ TEST_F(BeaconTest, sendEventWithNullPtrPayload)
 	target->sendEvent(eventName, nullptr);
 }
 
+TEST_F(BeaconTest, sendEventWithDocumentPayload)
+{
+	// given
+	Utf8String_t eventName("event name");
+
+	openkit::json::JsonDocument document;
+	document.addString("custom", "CustomValue");
+
+	auto realMapPayload = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+
+	realMapPayload->insert({ "custom", openkit::json::JsonStringValue::fromString("CustomValue") });
+
+	realMapPayload->insert({ core::objects::TIMESTAMP, openkit::json::JsonNumberValue::fromLong(0) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_APPLICATION_ID, openkit::json::JsonStringValue::fromString(APP_ID.getStringData()) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_INSTANCE_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(DEVICE_ID)) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_SESSION_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(DEVICE_ID)
+		+ "_" + core::util::StringUtil::toInvariantString(SESSION_ID)) });
+	realMapPayload->insert({ core::objects::APP_VERSION, openkit::json::JsonStringValue::fromString(APP_VERSION.getStringData()) });
+	realMapPayload->insert({ core::objects::OS_NAME, openkit::json::JsonStringValue::fromString(OS_NAME.getStringData()) });
+	realMapPayload->insert({ core::objects::DEVICE_MANUFACTURER, openkit::json::JsonStringValue::fromString(DEVICE_MANUFACTURER.getStringData()) });
+	realMapPayload->insert({ core::objects::DEVICE_MODEL_IDENTIFIER, openkit::json::JsonStringValue::fromString(MODEL_ID.getStringData()) });
+	realMapPayload->insert({ protocol::EVENT_SCHEMA_VERSION, openkit::json::JsonStringValue::fromString("1.3") });
+	realMapPayload->insert({ core::objects::EVENT_PROVIDER, openkit::json::JsonStringValue::fromString(APP_ID.getStringData()) });
+
+	realMapPayload->insert({ "event.name", openkit::json::JsonStringValue::fromString("event name") });
+	realMapPayload->insert({ "event.kind", openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_RUM) });
+
+	auto str = openkit::json::JsonObjectValue::fromMap(realMapPayload)->toString();
+
+	// expect
+	std::stringstream s;
+	s << "et=" << static_cast<int32_t>(EventType_t::EVENT)	// event type
+		<< "&pl=" << core::util::URLEncoding::urlencode(str, { '_' }).getStringData()	// payload
+		;
+	EXPECT_CALL(*mockBeaconCache, addEventData(
+		BeaconKey_t(SESSION_ID, SESSION_SEQUENCE),	// beacon key
+		0,											// timestamp when error was reported
+		IsEventMapEqual(s.str())
+	)).Times(1);
+
+	auto target = createBeacon()->build();
+
+	// then
+	target->sendEvent(eventName, document);
+}
+
 TEST_F(BeaconTest, sendValidEventTryingToOverrideTimestamp)
 {
 	// given
@@ -2539,6 +2588,53 @@ TEST_F(BeaconTest, sendBizEventWithNullPtrPayload)
 	target->sendBizEvent(eventType, nullptr);
 }
 
+TEST_F(BeaconTest, sendBizEventWithDocumentPayload)
+{
+	// given
+	Utf8String_t eventType("event type");
+
+	openkit::json::JsonDocument document;
+	document.addString("custom", "CustomValue");
+
+	auto realMapPayload = std::make_shared<openkit::json::JsonObjectValue::JsonObjectMap>();
+
+	realMapPayload->insert({ "custom", openkit::json::JsonStringValue::fromString("CustomValue") });
+
+	realMapPayload->insert({ core::objects::TIMESTAMP, openkit::json::JsonNumberValue::fromLong(0) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_APPLICATION_ID, openkit::json::JsonStringValue::fromString(APP_ID.getStringData()) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_INSTANCE_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(DEVICE_ID)) });
+	realMapPayload->insert({ protocol::EVENT_PAYLOAD_SESSION_ID, openkit::json::JsonStringValue::fromString(core::util::StringUtil::toInvariantString(DEVICE_ID)
+		+ "_" + core::util::StringUtil::toInvariantString(SESSION_ID)) });
+	realMapPayload->insert({ core::objects::APP_VERSION, openkit::json::JsonStringValue::fromString(APP_VERSION.getStringData()) });
+	realMapPayload->insert({ core::objects::OS_NAME, openkit::json::JsonStringValue::fromString(OS_NAME.getStringData()) });
+	realMapPayload->insert({ core::objects::DEVICE_MANUFACTURER, openkit::json::JsonStringValue::fromString(DEVICE_MANUFACTURER.getStringData()) });
+	realMapPayload->insert({ core::objects::DEVICE_MODEL_IDENTIFIER, openkit::json::JsonStringValue::fromString(MODEL_ID.getStringData()) });
+	realMapPayload->insert({ protocol::EVENT_SCHEMA_VERSION, openkit::json::JsonStringValue::fromString("1.3") });
+	realMapPayload->insert({ core::objects::EVENT_PROVIDER, openkit::json::JsonStringValue::fromString(APP_ID.getStringData()) });
+
+	realMapPayload->insert({ "event.type", openkit::json::JsonStringValue::fromString("event type") });
+	realMapPayload->insert({ "dt.rum.custom_attributes_size", openkit::json::JsonNumberValue::fromLong(50) });
+	realMapPayload->insert({ "event.kind", openkit::json::JsonStringValue::fromString(core::objects::EVENT_KIND_BIZ) });
+
+	auto str = openkit::json::JsonObjectValue::fromMap(realMapPayload)->toString();
+
+	// expect
+	std::stringstream s;
+	s << "et=" << static_cast<int32_t>(EventType_t::EVENT)	// event type
+		<< "&pl=" << core::util::URLEncoding::urlencode(str, { '_' }).getStringData()	// payload
+		;
+	EXPECT_CALL(*mockBeaconCache, addEventData(
+		BeaconKey_t(SESSION_ID, SESSION_SEQUENCE),	// beacon key
+		0,											// timestamp when error was reported
+		IsEventMapEqual(s.str())
+	)).Times(1);
+
+	auto target = createBeacon()->build();
+
+	// then
+	target->sendBizEvent(eventType, document);
+}
+
 TEST_F(BeaconTest, sendValidBizEventTryingToOverrideTimestamp)
 {
 	// given
@@ -4050,6 +4146,119 @@ TEST_F(BeaconTest, sendDataAndFakeErrorResponse)
 	ASSERT_THAT(obtained, testing::Eq(statusResponse));
 }
 
+TEST_F(BeaconTest, sendAsyncSendsChunksOneAfterTheOther)
+{
+	// with
+	Utf8String_t firstChunk("some beacon string");
+	Utf8String_t secondChunk("some more beacon string");
+
+	// expect
+	auto beaconCache = MockIBeaconCache::createNice();
+	EXPECT_CALL(*beaconCache, prepareDataForSending(testing::_))
+		.Times(1);
+	EXPECT_CALL(*beaconCache, hasDataForSending(testing::_))
+		.Times(3)
+		.WillOnce(testing::Return(true))
+		.WillOnce(testing::Return(true))
+		.WillRepeatedly(testing::Return(false));
+	EXPECT_CALL(*beaconCache, getNextBeaconChunk(testing::_, testing::_, testing::_, testing::_))
+		.Times(2)
+		.WillOnce(testing::Return(firstChunk))
+		.WillOnce(testing::Return(secondChunk));
+	EXPECT_CALL(*beaconCache, removeChunkedData(testing::_))
+		.Times(2);
+	EXPECT_CALL(*beaconCache, resetChunkedData(testing::_))
+		.Times(0);
+
+	// given
+	auto firstResponse = MockIStatusResponse::createNice();
+	ON_CALL(*firstResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(false));
+	auto secondResponse = MockIStatusResponse::createNice();
+	ON_CALL(*secondResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(false));
+
+	auto httpClient = MockIHTTPClient::createNice();
+	EXPECT_CALL(*httpClient, sendBeaconRequestAsync(testing::_, testing::_, testing::Ref(*mockAdditionalQueryParameters), testing::_, testing::_, testing::_))
+		.Times(2)
+		.WillOnce(testing::InvokeArgument<5>(firstResponse))
+		.WillOnce(testing::InvokeArgument<5>(secondResponse));
+	EXPECT_CALL(*httpClient, sendBeaconRequest(testing::_, testing::_, testing::_, testing::_, testing::_))
+		.Times(0);
+
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	auto target = createBeacon()->with(beaconCache).build();
+
+	// when
+	std::shared_ptr<protocol::IStatusResponse> obtained = nullptr;
+	target->sendAsync(httpClientProvider, *mockAdditionalQueryParameters,
+		[&obtained](std::shared_ptr<protocol::IStatusResponse> response) { obtained = response; });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(secondResponse));
+}
+
+TEST_F(BeaconTest, sendAsyncStopsAndResetsChunkedDataOnErroneousResponse)
+{
+	// with
+	Utf8String_t firstChunk("some beacon string");
+
+	// expect
+	auto beaconCache = MockIBeaconCache::createNice();
+	ON_CALL(*beaconCache, hasDataForSending(testing::_))
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*beaconCache, getNextBeaconChunk(testing::_, testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Return(firstChunk));
+	EXPECT_CALL(*beaconCache, resetChunkedData(testing::_))
+		.Times(1);
+	EXPECT_CALL(*beaconCache, removeChunkedData(testing::_))
+		.Times(0);
+
+	// given
+	auto errorResponse = MockIStatusResponse::createNice();
+	ON_CALL(*errorResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
+
+	auto httpClient = MockIHTTPClient::createNice();
+	EXPECT_CALL(*httpClient, sendBeaconRequestAsync(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+		.Times(1)
+		.WillOnce(testing::InvokeArgument<5>(errorResponse));
+
+	auto httpClientProvider = MockIHTTPClientProvider::createNice();
+	ON_CALL(*httpClientProvider, createClient(testing::_))
+		.WillByDefault(testing::Return(httpClient));
+
+	auto target = createBeacon()->with(beaconCache).build();
+
+	// when
+	std::shared_ptr<protocol::IStatusResponse> obtained = nullptr;
+	target->sendAsync(httpClientProvider, *mockAdditionalQueryParameters,
+		[&obtained](std::shared_ptr<protocol::IStatusResponse> response) { obtained = response; });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(errorResponse));
+}
+
+TEST_F(BeaconTest, beaconHeaderContainsImmutableAndSessionDataWithSingleDelimiters)
+{
+	// with
+	core::caching::BeaconHeader header;
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, setBeaconHeader(BeaconKey_t(SESSION_ID, SESSION_SEQUENCE), testing::_))
+		.WillOnce(testing::SaveArg<1>(&header));
+
+	// when
+	createBeacon()->build();
+
+	// then
+	ASSERT_THAT(header.beaconData.getStringData(), testing::HasSubstr("&vs="));
+	ASSERT_THAT(header.beaconData.getStringData(), testing::Not(testing::HasSubstr("&&")));
+}
+
 TEST_F(BeaconTest, beaconDataPrefixVS2)
 {
 	// expect
@@ -4185,6 +4394,27 @@ TEST_F(BeaconTest, clearDataForwardsCallToBeaconCache)
 	target->clearData();
 }
 
+TEST_F(BeaconTest, beaconHeaderIsStoredAgainIfDataIsAddedAfterClearData)
+{
+	// expect
+	testing::InSequence s;
+	EXPECT_CALL(*mockBeaconCache, setBeaconHeader(BeaconKey_t(SESSION_ID, SESSION_SEQUENCE), testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, deleteCacheEntry(BeaconKey_t(SESSION_ID, SESSION_SEQUENCE)))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, setBeaconHeader(BeaconKey_t(SESSION_ID, SESSION_SEQUENCE), testing::_))
+		.Times(1);
+	EXPECT_CALL(*mockBeaconCache, addEventData(BeaconKey_t(SESSION_ID, SESSION_SEQUENCE), testing::_, testing::_))
+		.Times(1);
+
+	// given
+	auto target = createBeacon()->build();
+
+	// when
+	target->clearData();
+	target->startSession();
+}
+
 TEST_F(BeaconTest, deviceIDIsRandomizedIfDeviceIdSendingDisallowed)
 {
 	// with
@@ -0,0 +1,241 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "protocol/HTTPConnectionPool.h"
+
+#include "../api/mock/MockILogger.h"
+#include "../providers/mock/MockITimingProvider.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cstdint>
+#include <memory>
+
+using namespace test;
+
+using HTTPConnectionPool_t = protocol::HTTPConnectionPool;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+using MockNiceITimingProvider_sp = std::shared_ptr<testing::NiceMock<MockITimingProvider>>;
+
+static constexpr int64_t IDLE_TIMEOUT_IN_MILLISECONDS = 1000L;
+
+class HTTPConnectionPoolTest : public testing::Test
+{
+protected:
+	MockNiceILogger_sp mockLogger;
+	MockNiceITimingProvider_sp mockTimingProvider;
+	int64_t currentTimestamp;
+
+	void SetUp() override
+	{
+		currentTimestamp = 0L;
+
+		mockLogger = MockILogger::createNice();
+		mockTimingProvider = MockITimingProvider::createNice();
+		ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+			.WillByDefault(testing::Invoke([this]() { return currentTimestamp; }));
+	}
+
+	std::unique_ptr<HTTPConnectionPool_t> createPool(int32_t maxIdleConnections)
+	{
+		return std::unique_ptr<HTTPConnectionPool_t>(new HTTPConnectionPool_t(
+			mockLogger,
+			mockTimingProvider,
+			maxIdleConnections,
+			IDLE_TIMEOUT_IN_MILLISECONDS,
+			1
+		));
+	}
+};
+
+TEST_F(HTTPConnectionPoolTest, aNewPoolHasNoIdleConnections)
+{
+	// given
+	auto target = createPool(2);
+
+	// then
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPConnectionPoolTest, acquireReturnsAHandle)
+{
+	// given
+	auto target = createPool(2);
+
+	// when
+	auto obtained = target->acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+
+	// cleanup
+	target->release(obtained);
+}
+
+TEST_F(HTTPConnectionPoolTest, releasedHandleIsKeptIdleInThePool)
+{
+	// given
+	auto target = createPool(2);
+	auto handle = target->acquire();
+
+	// when
+	target->release(handle);
+
+	// then
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(1)));
+}
+
+TEST_F(HTTPConnectionPoolTest, acquireReusesAPreviouslyReleasedHandle)
+{
+	// given
+	auto target = createPool(2);
+	auto handle = target->acquire();
+	target->release(handle);
+
+	// when
+	auto obtained = target->acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(handle));
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+
+	// cleanup
+	target->release(obtained);
+}
+
+TEST_F(HTTPConnectionPoolTest, acquirePrefersTheMostRecentlyReleasedHandle)
+{
+	// given
+	auto target = createPool(2);
+	auto first = target->acquire();
+	auto second = target->acquire();
+	target->release(first);
+	target->release(second);
+
+	// when
+	auto obtained = target->acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(second));
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(1)));
+
+	// cleanup
+	target->release(obtained);
+}
+
+TEST_F(HTTPConnectionPoolTest, concurrentlyAcquiredHandlesAreDistinct)
+{
+	// given
+	auto target = createPool(2);
+
+	// when
+	auto first = target->acquire();
+	auto second = target->acquire();
+
+	// then
+	ASSERT_THAT(first, testing::NotNull());
+	ASSERT_THAT(second, testing::NotNull());
+	ASSERT_THAT(first, testing::Ne(second));
+
+	// cleanup
+	target->release(first);
+	target->release(second);
+}
+
+TEST_F(HTTPConnectionPoolTest, releaseDoesNotKeepMoreThanTheMaximumNumberOfIdleConnections)
+{
+	// given
+	auto target = createPool(2);
+	auto first = target->acquire();
+	auto second = target->acquire();
+	auto third = target->acquire();
+
+	// when
+	target->release(first);
+	target->release(second);
+	target->release(third);
+
+	// then
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(2)));
+}
+
+TEST_F(HTTPConnectionPoolTest, releaseDoesNotKeepAnyConnectionIfMaximumNumberOfIdleConnectionsIsZero)
+{
+	// given
+	auto target = createPool(0);
+	auto handle = target->acquire();
+
+	// when
+	target->release(handle);
+
+	// then
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPConnectionPoolTest, releaseIgnoresNullHandle)
+{
+	// given
+	auto target = createPool(2);
+
+	// when
+	target->release(nullptr);
+
+	// then
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPConnectionPoolTest, acquireDoesNotReuseAHandleWhichExceededTheIdleTimeout)
+{
+	// given
+	auto target = createPool(2);
+	auto handle = target->acquire();
+	target->release(handle);
+	currentTimestamp = IDLE_TIMEOUT_IN_MILLISECONDS;
+
+	// when
+	auto obtained = target->acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+
+	// cleanup
+	target->release(obtained);
+}
+
+TEST_F(HTTPConnectionPoolTest, acquireOnlyEvictsIdleHandlesWhichExceededTheIdleTimeout)
+{
+	// given
+	auto target = createPool(2);
+	auto first = target->acquire();
+	auto second = target->acquire();
+	target->release(first);
+	currentTimestamp = IDLE_TIMEOUT_IN_MILLISECONDS / 2;
+	target->release(second);
+	currentTimestamp = IDLE_TIMEOUT_IN_MILLISECONDS;
+
+	// when
+	auto obtained = target->acquire();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(second));
+	ASSERT_THAT(target->getNumberOfIdleConnections(), testing::Eq(size_t(0)));
+
+	// cleanup
+	target->release(obtained);
+}
@@ -0,0 +1,273 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "protocol/HTTPRequestMultiplexer.h"
+
+#include "../api/mock/MockILogger.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <curl/curl.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace test;
+
+using HTTPRequestMultiplexer_t = protocol::HTTPRequestMultiplexer;
+using MockNiceILogger_sp = std::shared_ptr<testing::NiceMock<MockILogger>>;
+
+// transfers to this URL fail immediately without any network access
+static constexpr char UNSUPPORTED_URL[] = "unsupported://localhost/";
+
+class HTTPRequestMultiplexerTest : public testing::Test
+{
+protected:
+	MockNiceILogger_sp mockLogger;
+	std::vector<CURL*> handles;
+
+	void SetUp() override
+	{
+		curl_global_init(CURL_GLOBAL_ALL);
+		mockLogger = MockILogger::createNice();
+	}
+
+	void TearDown() override
+	{
+		for (auto handle : handles)
+		{
+			curl_easy_cleanup(handle);
+		}
+		handles.clear();
+
+		curl_global_cleanup();
+	}
+
+	CURL* createHandle()
+	{
+		auto handle = curl_easy_init();
+		curl_easy_setopt(handle, CURLOPT_URL, UNSUPPORTED_URL);
+		handles.push_back(handle);
+
+		return handle;
+	}
+};
+
+TEST_F(HTTPRequestMultiplexerTest, aNewMultiplexerHasNoRunningTransfers)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+
+	// then
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, addDoesNotAcceptNullHandle)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+
+	// when
+	auto obtained = target.add(nullptr, [](CURLcode) {});
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, addedTransferIsNotPerformedBeforePerformIsCalled)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	auto isCompleted = false;
+
+	// when
+	auto obtained = target.add(createHandle(), [&isCompleted](CURLcode) { isCompleted = true; });
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(1)));
+	ASSERT_THAT(isCompleted, testing::Eq(false));
+
+	// cleanup
+	target.perform();
+}
+
+TEST_F(HTTPRequestMultiplexerTest, performInvokesCompletionHandlerWithTheTransferResult)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	auto result = CURLE_OK;
+	target.add(createHandle(), [&result](CURLcode transferResult) { result = transferResult; });
+
+	// when
+	auto obtained = target.perform();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(0)));
+	ASSERT_THAT(result, testing::Eq(CURLE_UNSUPPORTED_PROTOCOL));
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, performDrivesAllAddedTransfers)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	size_t numCompleted = 0;
+	target.add(createHandle(), [&numCompleted](CURLcode) { numCompleted++; });
+	target.add(createHandle(), [&numCompleted](CURLcode) { numCompleted++; });
+	target.add(createHandle(), [&numCompleted](CURLcode) { numCompleted++; });
+
+	// when
+	while (target.perform() > 0)
+	{
+	}
+
+	// then
+	ASSERT_THAT(numCompleted, testing::Eq(size_t(3)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, performReturnsImmediatelyIfNoTransferWasAdded)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+
+	// when
+	auto obtained = target.perform();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, completionHandlerCanAddFurtherTransfers)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	auto secondHandle = createHandle();
+	auto isSecondCompleted = false;
+	target.add(createHandle(), [&target, secondHandle, &isSecondCompleted](CURLcode)
+	{
+		target.add(secondHandle, [&isSecondCompleted](CURLcode) { isSecondCompleted = true; });
+	});
+
+	// when
+	auto obtained = target.perform();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(1)));
+	ASSERT_THAT(isSecondCompleted, testing::Eq(false));
+
+	// and when
+	obtained = target.perform();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(0)));
+	ASSERT_THAT(isSecondCompleted, testing::Eq(true));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, addDelayedDoesNotAcceptNullHandle)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+
+	// when
+	auto obtained = target.addDelayed(nullptr, [](CURLcode) {}, 10);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(false));
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(0)));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, delayedTransferIsCountedAsRunningTransfer)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+
+	// when
+	auto obtained = target.addDelayed(createHandle(), [](CURLcode) {}, 10);
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(true));
+	ASSERT_THAT(target.getNumberOfRunningTransfers(), testing::Eq(size_t(1)));
+
+	// cleanup
+	target.perform();
+}
+
+TEST_F(HTTPRequestMultiplexerTest, performStartsDelayedTransferNotBeforeItsDelayElapsed)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	auto result = CURLE_OK;
+	auto start = std::chrono::steady_clock::now();
+	target.addDelayed(createHandle(), [&result](CURLcode transferResult) { result = transferResult; }, 50);
+
+	// when
+	auto obtained = target.perform();
+
+	// then
+	ASSERT_THAT(std::chrono::steady_clock::now() - start, testing::Ge(std::chrono::milliseconds(50)));
+	ASSERT_THAT(obtained, testing::Eq(size_t(0)));
+	ASSERT_THAT(result, testing::Eq(CURLE_UNSUPPORTED_PROTOCOL));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, performDrivesRunningTransfersWhileOtherTransfersAreDelayed)
+{
+	// given
+	HTTPRequestMultiplexer_t target(mockLogger, 2);
+	auto isDelayedCompleted = false;
+	auto isOtherCompleted = false;
+	target.addDelayed(createHandle(), [&isDelayedCompleted](CURLcode) { isDelayedCompleted = true; }, 10000);
+	target.add(createHandle(), [&isOtherCompleted](CURLcode) { isOtherCompleted = true; });
+
+	// when
+	auto obtained = target.perform();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(size_t(1)));
+	ASSERT_THAT(isOtherCompleted, testing::Eq(true));
+	ASSERT_THAT(isDelayedCompleted, testing::Eq(false));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, destructorAbortsDelayedTransfers)
+{
+	// given
+	auto target = std::unique_ptr<HTTPRequestMultiplexer_t>(new HTTPRequestMultiplexer_t(mockLogger, 2));
+	auto result = CURLE_OK;
+	target->addDelayed(createHandle(), [&result](CURLcode transferResult) { result = transferResult; }, 10000);
+
+	// when
+	target.reset();
+
+	// then
+	ASSERT_THAT(result, testing::Eq(CURLE_ABORTED_BY_CALLBACK));
+}
+
+TEST_F(HTTPRequestMultiplexerTest, destructorAbortsRunningTransfers)
+{
+	// given
+	auto target = std::unique_ptr<HTTPRequestMultiplexer_t>(new HTTPRequestMultiplexer_t(mockLogger, 2));
+	auto result = CURLE_OK;
+	target->add(createHandle(), [&result](CURLcode transferResult) { result = transferResult; });
+
+	// when
+	target.reset();
+
+	// then
+	ASSERT_THAT(result, testing::Eq(CURLE_ABORTED_BY_CALLBACK));
+}
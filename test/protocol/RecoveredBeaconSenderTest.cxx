@@ -0,0 +1,156 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "protocol/RecoveredBeaconSender.h"
+
+#include "core/UTF8String.h"
+#include "core/caching/IBeaconCacheOverflowStore.h"
+
+#include "mock/MockIAdditionalQueryParameters.h"
+#include "mock/MockIHTTPClient.h"
+#include "mock/MockIStatusResponse.h"
+#include "../core/caching/mock/MockIBeaconCache.h"
+#include "../core/configuration/mock/MockIServerConfiguration.h"
+#include "../providers/mock/MockITimingProvider.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using namespace test;
+
+using MockNiceIAdditionalQueryParameters_sp = std::shared_ptr<testing::NiceMock<MockIAdditionalQueryParameters>>;
+using MockNiceIBeaconCache_sp = std::shared_ptr<testing::NiceMock<MockIBeaconCache>>;
+using MockNiceIHTTPClient_sp = std::shared_ptr<testing::NiceMock<MockIHTTPClient>>;
+using MockNiceIServerConfiguration_sp = std::shared_ptr<testing::NiceMock<MockIServerConfiguration>>;
+using MockNiceITimingProvider_sp = std::shared_ptr<testing::NiceMock<MockITimingProvider>>;
+using RecoveredBeacon_t = core::caching::IBeaconCacheOverflowStore::RecoveredBeacon;
+using RecoveredBeaconSender_t = protocol::RecoveredBeaconSender;
+using Utf8String_t = core::UTF8String;
+
+constexpr int32_t MULTIPLICITY = 3;
+constexpr int32_t BEACON_SIZE_IN_BYTES = 30 * 1024;
+
+class RecoveredBeaconSenderTest : public testing::Test
+{
+protected:
+
+	MockNiceIBeaconCache_sp mockBeaconCache;
+	MockNiceITimingProvider_sp mockTimingProvider;
+	MockNiceIHTTPClient_sp mockHTTPClient;
+	MockNiceIServerConfiguration_sp mockServerConfiguration;
+	MockNiceIAdditionalQueryParameters_sp mockAdditionalQueryParameters;
+
+	void SetUp() override
+	{
+		mockBeaconCache = MockIBeaconCache::createNice();
+
+		mockTimingProvider = MockITimingProvider::createNice();
+		ON_CALL(*mockTimingProvider, provideTimestampInMilliseconds())
+			.WillByDefault(testing::Return(5000));
+
+		mockHTTPClient = MockIHTTPClient::createNice();
+
+		mockServerConfiguration = MockIServerConfiguration::createNice();
+		ON_CALL(*mockServerConfiguration, getMultiplicity())
+			.WillByDefault(testing::Return(MULTIPLICITY));
+		ON_CALL(*mockServerConfiguration, getBeaconSizeInBytes())
+			.WillByDefault(testing::Return(BEACON_SIZE_IN_BYTES));
+
+		mockAdditionalQueryParameters = MockIAdditionalQueryParameters::createNice();
+	}
+
+	std::shared_ptr<protocol::IStatusResponse> send()
+	{
+		RecoveredBeaconSender_t target(mockBeaconCache, mockTimingProvider);
+		return target.send(mockHTTPClient, *mockAdditionalQueryParameters, *mockServerConfiguration);
+	}
+};
+
+TEST_F(RecoveredBeaconSenderTest, sendGivesNullptrIfThereAreNoRecoveredBeacons)
+{
+	// expect
+	EXPECT_CALL(*mockBeaconCache, takeRecoveredBeacon(testing::_, testing::_))
+		.WillOnce(testing::Return(false));
+	EXPECT_CALL(*mockHTTPClient, sendBeaconRequest(testing::_, testing::_, testing::_, testing::_, testing::_))
+		.Times(0);
+
+	// when
+	auto obtained = send();
+
+	// then
+	ASSERT_THAT(obtained, testing::IsNull());
+}
+
+TEST_F(RecoveredBeaconSenderTest, sendSendsRecoveredBeaconsWithTheirOriginalHeader)
+{
+	// with
+	RecoveredBeacon_t recoveredBeacon;
+	recoveredBeacon.header.deviceID = 1234;
+	recoveredBeacon.header.sessionNumber = 21;
+	recoveredBeacon.header.clientIPAddress = "10.0.0.1";
+	recoveredBeacon.header.beaconData = "vv=3&tv=1000";
+	recoveredBeacon.records.emplace_back(false, 1001, "et=1");
+	recoveredBeacon.records.emplace_back(true, 1002, "et=2");
+
+	auto statusResponse = MockIStatusResponse::createNice();
+	ON_CALL(*statusResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(false));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, takeRecoveredBeacon(testing::_, size_t(BEACON_SIZE_IN_BYTES - 1024)))
+		.Times(2)
+		.WillOnce(testing::DoAll(testing::SetArgReferee<0>(recoveredBeacon), testing::Return(true)))
+		.WillOnce(testing::Return(false));
+	EXPECT_CALL(*mockBeaconCache, restoreRecoveredBeacon(testing::_))
+		.Times(0);
+
+	Utf8String_t expectedChunk("vv=3&tv=1000&tx=5000&mp=" + std::to_string(MULTIPLICITY) + "&et=1&et=2");
+	EXPECT_CALL(*mockHTTPClient, sendBeaconRequest(testing::Eq(Utf8String_t("10.0.0.1")), testing::Eq(expectedChunk), testing::_, testing::Eq(21), testing::Eq(1234)))
+		.WillOnce(testing::Return(statusResponse));
+
+	// when
+	auto obtained = send();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(statusResponse));
+}
+
+TEST_F(RecoveredBeaconSenderTest, sendRestoresRecoveredBeaconIfSendingFails)
+{
+	// with
+	RecoveredBeacon_t recoveredBeacon;
+	recoveredBeacon.header.beaconData = "vv=3";
+	recoveredBeacon.records.emplace_back(false, 1001, "et=1");
+
+	auto statusResponse = MockIStatusResponse::createNice();
+	ON_CALL(*statusResponse, isErroneousResponse())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mockHTTPClient, sendBeaconRequest(testing::_, testing::_, testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Return(statusResponse));
+
+	// expect
+	EXPECT_CALL(*mockBeaconCache, takeRecoveredBeacon(testing::_, testing::_))
+		.WillOnce(testing::DoAll(testing::SetArgReferee<0>(recoveredBeacon), testing::Return(true)));
+	EXPECT_CALL(*mockBeaconCache, restoreRecoveredBeacon(
+			testing::Field(&RecoveredBeacon_t::records, testing::SizeIs(1))))
+		.Times(1);
+
+	// when
+	auto obtained = send();
+
+	// then
+	ASSERT_THAT(obtained, testing::Eq(statusResponse));
+}
@@ -195,6 +195,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendEvent,
+			(
+				const core::UTF8String&, /*name*/
+				const openkit::json::JsonDocument& /*attributes*/
+			),
+			(override)
+		);
+
 		MOCK_METHOD(
 			void,
 			sendBizEvent,
@@ -205,6 +215,16 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendBizEvent,
+			(
+				const core::UTF8String&, /*type*/
+				const openkit::json::JsonDocument& /*attributes*/
+				),
+			(override)
+		);
+
 		MOCK_METHOD(
 			std::shared_ptr<protocol::IStatusResponse>,
 			send,
@@ -215,6 +235,17 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendAsync,
+			(
+				std::shared_ptr<providers::IHTTPClientProvider>, /* clientProvider */
+				const protocol::IAdditionalQueryParameters&, /* additionalParameters */
+				protocol::IHTTPClient::ResponseHandler /* responseHandler */
+			),
+			(override)
+		);
+
 		MOCK_METHOD(bool, isEmpty, (), (const, override));
 
 		MOCK_METHOD(void, clearData, (), (override));
@@ -77,6 +77,20 @@ namespace test
 			(override)
 		);
 
+		MOCK_METHOD(
+			void,
+			sendBeaconRequestAsync,
+			(
+				const core::UTF8String&, /* clientIPAddress */
+				const core::UTF8String&, /* beaconData */
+				const protocol::IAdditionalQueryParameters&, /* additionalParameters */
+				int32_t, /* sessionNumber */
+				int64_t, /* deviceID */
+				protocol::IHTTPClient::ResponseHandler /* responseHandler */
+			),
+			(override)
+		);
+
 		MOCK_METHOD(
 			std::shared_ptr<protocol::IStatusResponse>,
 			sendNewSessionRequest,
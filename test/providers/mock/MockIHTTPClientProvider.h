@@ -58,6 +58,8 @@ namespace test {
 			(std::shared_ptr<core::configuration::IHTTPClientConfiguration>),
 			(override)
 		);
+
+		MOCK_METHOD(size_t, processPendingRequests, (), (override));
 	};
 }
 
@@ -1314,4 +1314,32 @@ TEST_F(JsonParserTest, parsingNonEmptyJsonObjectAsArrayValueWorks)
 
 	auto innerArraySecondValue = getValueAt(innerArray, 1);
 	ASSERT_THAT(innerArraySecondValue, isBooleanTokenOf(false));
-}
\ No newline at end of file
+}
+
+TEST_F(JsonParserTest, parsingLargeJsonPayloadWorks)
+{
+	// given
+	constexpr int32_t numberOfObjects = 1000;
+	std::stringstream stream;
+	stream << "[";
+	for (int32_t i = 0; i < numberOfObjects; i++)
+	{
+		stream << (i == 0 ? "" : ", ") << R"({"name": "item\t)" << i << R"(", "value": )" << i << ".5}";
+	}
+	stream << "]";
+
+	auto target = JsonParser(stream.str());
+
+	// when
+	auto obtained = target.parse();
+
+	// then
+	ASSERT_THAT(obtained, isArrayOfSize(numberOfObjects));
+	auto obtainedArray = CAST_ARRAY_TOKEN(obtained);
+
+	auto lastValue = getValueAt(obtainedArray, numberOfObjects - 1);
+	ASSERT_THAT(lastValue, isObjectOfSize(2));
+	auto lastObject = CAST_OBJECT_TOKEN(lastValue);
+	ASSERT_THAT((*lastObject)["name"], isStringTokenOf("item\t999"));
+	ASSERT_THAT((*lastObject)["value"], isNumberDecimalTokenOf(999.5));
+}
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <limits>
+
 using namespace openkit::json;
 
 class JsonWriterTest : public testing::Test
@@ -112,4 +114,84 @@ TEST_F(JsonWriterTest, checkKeyFormatting)
 
 	// then
 	ASSERT_THAT(target.toString(), testing::Eq(std::string("\"Key\"")));
-}
\ No newline at end of file
+}
+
+TEST_F(JsonWriterTest, checkStringValueEscaping)
+{
+	// given
+	auto target = JsonWriter();
+	target.insertStringValue(std::string("a\"b\\c/d\b\f\n\r\t\x01\x1f", 14));
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\\u0001\\u001f\"")));
+}
+
+TEST_F(JsonWriterTest, checkIntegerValueFormatting)
+{
+	// given
+	auto target = JsonWriter();
+	target.insertIntegerValue(0);
+	target.insertElementSeperator();
+	target.insertIntegerValue(-42);
+	target.insertElementSeperator();
+	target.insertIntegerValue(std::numeric_limits<int64_t>::min());
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("0,-42,-9223372036854775808")));
+}
+
+TEST_F(JsonWriterTest, checkNonFiniteValueFormatting)
+{
+	// given
+	auto target = JsonWriter();
+	target.insertNonFiniteValue();
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("null")));
+	ASSERT_THAT(target.getNumNonFiniteValues(), testing::Eq(size_t(1)));
+}
+
+TEST_F(JsonWriterTest, truncateDiscardsCharactersWrittenAfterwards)
+{
+	// given
+	auto target = JsonWriter();
+	target.insertKey(std::string("Key"));
+	auto length = target.getLength();
+	target.insertKeyValueSeperator();
+	target.insertStringValue(std::string("Value"));
+
+	// when
+	target.truncate(length);
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("\"Key\"")));
+}
+
+TEST_F(JsonWriterTest, resetDiscardsAllCharactersAndNonFiniteValues)
+{
+	// given
+	auto target = JsonWriter();
+	target.insertNonFiniteValue();
+
+	// when
+	target.reset();
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("")));
+	ASSERT_THAT(target.getNumNonFiniteValues(), testing::Eq(size_t(0)));
+}
+
+TEST_F(JsonWriterTest, checkSerializedFormatting)
+{
+	// given
+	auto target = JsonWriter();
+	std::string serialized("\"Key\":\"a\\/b\"");
+
+	// when
+	target.openObject();
+	target.insertSerialized(serialized.data(), serialized.size());
+	target.closeObject();
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(std::string("{\"Key\":\"a\\/b\"}")));
+}
@@ -16,7 +16,6 @@
 
 #include "util/json/lexer/JsonLexer.h"
 #include "util/json/lexer/JsonTokenType.h"
-#include "../reader/MockResettableReader.h"
 #include "core/util/StringUtil.h"
 
 #include <gtest/gtest.h>
@@ -63,20 +62,6 @@ class JsonLexerTest : public testing::Test
 {
 protected:
 
-	static const std::string getNestedExceptionMessage(std::exception& exception)
-	{
-		try
-		{
-			std::rethrow_if_nested(exception);
-		}
-		catch (const std::exception& e)
-		{
-			return e.what();
-		}
-
-		throw std::logic_error("not a nested exception");
-	}
-
 	static void assertNextTokenThrowsLexerException(JsonLexer& lexer, const std::string& message)
 	{
 		try
@@ -703,6 +688,35 @@ TEST_F(JsonLexerTest, lexingStringWithEscapedCharactersWorks)
 	ASSERT_THAT(obtained, isLiteralTokenOf(JsonTokenType::VALUE_STRING, stream.str()));
 }
 
+TEST_F(JsonLexerTest, lexingStringsWithEscapedCharactersDoesNotAffectSubsequentTokens)
+{
+	// given
+	auto target = JsonLexer(R"(["a\tb\u0041", "c\"d", 12.5])");
+
+	// when, then
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::LEFT_SQUARE_BRACKET));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::VALUE_STRING, "a\tbA"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::COMMA));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::VALUE_STRING, "c\"d"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::COMMA));
+	ASSERT_THAT(target.nextToken(), isLiteralTokenOf(JsonTokenType::VALUE_NUMBER, "12.5"));
+	ASSERT_THAT(target.nextToken(), isStructuralTokenOf(JsonTokenType::RIGHT_SQUARE_BRACKET));
+	ASSERT_THAT(target.nextToken(), testing::IsNull());
+}
+
+TEST_F(JsonLexerTest, lexingLongStringGivesExpectedToken)
+{
+	// given
+	auto longString = std::string(100000, 'x');
+	auto target = JsonLexer("\"" + longString + "\"");
+
+	// when
+	auto obtained = target.nextToken();
+
+	// then
+	ASSERT_THAT(obtained, isLiteralTokenOf(JsonTokenType::VALUE_STRING, longString));
+}
+
 TEST_F(JsonLexerTest, lexingStringWithInvalidEscapeSequenceThrowsException)
 {
 	// given
@@ -912,57 +926,6 @@ TEST_F(JsonLexerTest, lexingCompoundTokenStringGivesTokensInAppropriateOrder)
 	ASSERT_THAT(obtained, testing::IsNull());
 }
 
-TEST_F(JsonLexerTest, ioFailuresAreCaughtAndTransformedToLexerExceptions)
-{
-	// given
-	auto ioFailure = std::ios_base::failure("Does not work");
-	auto reader = std::make_shared<testing::NiceMock<test::MockResettableReader>>();
-	ON_CALL(*reader, read()).WillByDefault(testing::Throw(ioFailure));
-
-	auto target = JsonLexer(reader);
-
-	// when
-	try
-	{
-		target.nextToken();
-		FAIL() << "Expected JsonLexerException to be thrown";
-	}
-	catch (JsonLexerException& e)
-	{
-		ASSERT_THAT(e.getMessage(), testing::Eq("Exception when reading from input stream"));
-
-		auto nestedExceptionMsg = getNestedExceptionMessage(e);
-		ASSERT_THAT(nestedExceptionMsg, testing::Eq(ioFailure.what()));
-	}
-}
-
-TEST_F(JsonLexerTest, requestingNextTokenAfterIoFailureHasBeenThrownThrowsAnException)
-{
-	// given
-	auto ioFailure = std::ios_base::failure("Does not work");
-	auto reader = std::make_shared<testing::NiceMock<test::MockResettableReader>>();
-	ON_CALL(*reader, read()).WillByDefault(testing::Throw(ioFailure));
-
-	auto target = JsonLexer(reader);
-
-	// when
-	try
-	{
-		target.nextToken();
-		FAIL() << "Expected JsonLexerException to be thrown";
-	}
-	catch (JsonLexerException& e)
-	{
-		ASSERT_THAT(e.getMessage(), testing::Eq("Exception when reading from input stream"));
-
-		auto nestedExceptionMsg = getNestedExceptionMessage(e);
-		ASSERT_THAT(nestedExceptionMsg, testing::Eq(ioFailure.what()));
-	}
-
-	// and when requesting the next token a second time
-	assertNextTokenThrowsLexerException(target,  "JSON Lexer is in erroneous state");
-}
-
 TEST_F(JsonLexerTest, requestingNextTokenAfterLexerExceptionHasBeenThrownThrowsAnException)
 {
 	// given
@@ -91,23 +91,21 @@ TEST_F(JsonTokenTest, tokenValuesOfPredefinedTokensAreCorrect)
 TEST_F(JsonTokenTest, createStringTokenReturnsAppropriateJsonToken)
 {
 	// when
-	auto obtained = JsonToken::createStringToken("foobar");
+	auto obtained = JsonToken::createStringToken("foobar", 6);
 
 	// then
-	ASSERT_THAT(obtained, testing::NotNull());
-	ASSERT_THAT(obtained->getTokenType(), testing::Eq(JsonTokenType::VALUE_STRING));
-	ASSERT_THAT(obtained->getValue(), testing::Eq("foobar"));
+	ASSERT_THAT(obtained.getTokenType(), testing::Eq(JsonTokenType::VALUE_STRING));
+	ASSERT_THAT(obtained.getValue(), testing::Eq("foobar"));
 }
 
 TEST_F(JsonTokenTest, createNumberTokenReturnsAppropriateJsonToken)
 {
 	// when
-	auto obtained = JsonToken::createNumberToken("12345");
+	auto obtained = JsonToken::createNumberToken("12345", 5);
 
 	// then
-	ASSERT_THAT(obtained, testing::NotNull());
-	ASSERT_THAT(obtained->getTokenType(), testing::Eq(JsonTokenType::VALUE_NUMBER));
-	ASSERT_THAT(obtained->getValue(), testing::Eq("12345"));
+	ASSERT_THAT(obtained.getTokenType(), testing::Eq(JsonTokenType::VALUE_NUMBER));
+	ASSERT_THAT(obtained.getValue(), testing::Eq("12345"));
 }
 
 TEST_F(JsonTokenTest, tokenTypeToStringReturnsAppropriateStringRepresentation)
@@ -158,11 +156,22 @@ TEST_F(JsonTokenTest, toStringForTokenWithoutValueGivesAppropriateStringRepresen
 TEST_F(JsonTokenTest, toStringForTokenWithValueGivesAppropriateStringRepresentation)
 {
 	// given
-	auto target = JsonToken::createNumberToken("12345");
+	auto target = JsonToken::createNumberToken("12345", 5);
 
 	// when
-	auto obtained = target->toString();
+	auto obtained = target.toString();
 
 	// then
 	ASSERT_THAT(obtained, testing::Eq("JsonToken {tokenType=NUMBER, value=12345}"));
-}
\ No newline at end of file
+}
+
+TEST_F(JsonTokenTest, tokenValueIsRestrictedToGivenNumberOfCharacters)
+{
+	// given
+	auto target = JsonToken::createStringToken("foobar", 3);
+
+	// when, then
+	ASSERT_THAT(target.getValue(), testing::Eq("foo"));
+	ASSERT_THAT(target.getValueLength(), testing::Eq(size_t(3)));
+	ASSERT_THAT(target.toString(), testing::Eq("JsonToken {tokenType=STRING, value=foo}"));
+}
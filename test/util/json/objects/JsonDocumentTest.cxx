@@ -0,0 +1,204 @@
+/**
+ * Copyright 2018-2021 Dynatrace LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpenKit/json/JsonDocument.h"
+#include "OpenKit/json/JsonArrayValue.h"
+#include "OpenKit/json/JsonNumberValue.h"
+#include "OpenKit/json/JsonStringValue.h"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace openkit::json;
+
+class JsonDocumentTest : public testing::Test
+{
+};
+
+TEST_F(JsonDocumentTest, emptyDocumentIsWrittenAsEmptyObject)
+{
+	// given
+	JsonDocument target;
+
+	// then
+	ASSERT_THAT(target.empty(), testing::Eq(true));
+	ASSERT_THAT(target.toString(), testing::Eq("{}"));
+}
+
+TEST_F(JsonDocumentTest, scalarValuesAreWrittenInOrderOfAddition)
+{
+	// given
+	JsonDocument target;
+	target.addString("string", "value")
+		.addLong("long", -42)
+		.addDouble("double", 1.5)
+		.addBoolean("boolean", true)
+		.addNull("null");
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(5)));
+	ASSERT_THAT(target.toString(), testing::Eq("{\"string\":\"value\",\"long\":-42,\"double\":1.5,\"boolean\":true,\"null\":null}"));
+}
+
+TEST_F(JsonDocumentTest, longKeysAndStringsAreStoredOutsideOfTheValue)
+{
+	// given
+	JsonDocument target;
+	std::string longString(100, 'x');
+	target.addString("a very long key exceeding the inline length", longString)
+		.addString("short", "inline");
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq("{\"a very long key exceeding the inline length\":\"" + longString + "\",\"short\":\"inline\"}"));
+}
+
+TEST_F(JsonDocumentTest, stringsAreEscaped)
+{
+	// given
+	JsonDocument target;
+	target.addString("key\"", "a/b\n");
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq("{\"key\\\"\":\"a\\/b\\n\"}"));
+}
+
+TEST_F(JsonDocumentTest, nonFiniteDoublesAreWrittenAsNull)
+{
+	// given
+	JsonDocument target;
+	target.addDouble("nan", std::nan(""))
+		.addDouble("infinity", std::numeric_limits<double>::infinity());
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq("{\"nan\":null,\"infinity\":null}"));
+}
+
+TEST_F(JsonDocumentTest, nestedObjectsAndArraysAreWritten)
+{
+	// given
+	JsonDocument target;
+	target.beginObject("object")
+			.addLong("a", 1)
+			.beginArray("array")
+				.appendString("b")
+				.appendObject()
+					.addBoolean("c", false)
+				.endObject()
+				.appendArray()
+				.endArray()
+			.endArray()
+		.endObject()
+		.addNull("d");
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(target.toString(), testing::Eq("{\"object\":{\"a\":1,\"array\":[\"b\",{\"c\":false},[]]},\"d\":null}"));
+}
+
+TEST_F(JsonDocumentTest, containersWhichAreNotFinishedAreFinishedImplicitly)
+{
+	// given
+	JsonDocument target;
+	target.beginObject("object")
+		.beginArray("array")
+		.appendLong(1);
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq("{\"object\":{\"array\":[1]}}"));
+}
+
+TEST_F(JsonDocumentTest, firstValueOfDuplicateKeyIsKept)
+{
+	// given
+	JsonDocument target;
+	target.addLong("key", 1)
+		.addLong("key", 2)
+		.beginObject("key")
+			.addLong("nested", 3)
+		.endObject()
+		.addLong("other", 4);
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(2)));
+	ASSERT_THAT(target.toString(), testing::Eq("{\"key\":1,\"other\":4}"));
+}
+
+TEST_F(JsonDocumentTest, valuesWithoutKeyAreNotAddedToObjects)
+{
+	// given
+	JsonDocument target;
+	target.appendLong(1)
+		.addString("key", nullptr)
+		.addString(nullptr, "value");
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq("{\"key\":null}"));
+}
+
+TEST_F(JsonDocumentTest, containsKeyOnlyChecksTopLevelValues)
+{
+	// given
+	JsonDocument target;
+	target.beginObject("object")
+			.addLong("nested", 1)
+		.endObject()
+		.addLong("key", 2);
+
+	// then
+	ASSERT_THAT(target.containsKey("object"), testing::Eq(true));
+	ASSERT_THAT(target.containsKey("key"), testing::Eq(true));
+	ASSERT_THAT(target.containsKey("nested"), testing::Eq(false));
+}
+
+TEST_F(JsonDocumentTest, clearRemovesAllValues)
+{
+	// given
+	JsonDocument target;
+	target.addString("a very long key exceeding the inline length", "value");
+
+	// when
+	target.clear();
+	target.addLong("key", 1);
+
+	// then
+	ASSERT_THAT(target.size(), testing::Eq(size_t(1)));
+	ASSERT_THAT(target.toString(), testing::Eq("{\"key\":1}"));
+}
+
+TEST_F(JsonDocumentTest, addMembersAdaptsSharedPointerModel)
+{
+	// given
+	auto list = std::make_shared<JsonArrayValue::JsonValueList>();
+	list->push_back(JsonNumberValue::fromDouble(2.5));
+	list->push_back(JsonStringValue::fromString("text"));
+
+	auto nestedMap = std::make_shared<JsonObjectValue::JsonObjectMap>();
+	nestedMap->insert(std::make_pair("list", JsonArrayValue::fromList(list)));
+
+	JsonObjectValue::JsonObjectMap map;
+	map.insert(std::make_pair("nested", JsonObjectValue::fromMap(nestedMap)));
+
+	JsonDocument target;
+
+	// when
+	target.addMembers(map);
+
+	// then
+	ASSERT_THAT(target.toString(), testing::Eq(JsonObjectValue::fromMap(std::make_shared<JsonObjectValue::JsonObjectMap>(map))->toString()));
+}
@@ -174,6 +174,31 @@ TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsNullForUnparsableLong)
 	ASSERT_THAT(obtained, testing::IsNull());
 }
 
+TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsIntegerRepresentationForSmallestAndLargestLong)
+{
+	// when, then
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("-9223372036854775808")->getLongValue(), testing::Eq(INT64_MIN));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("9223372036854775807")->getLongValue(), testing::Eq(INT64_MAX));
+
+	// and when out of range, then
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("-9223372036854775809"), testing::IsNull());
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("9223372036854775808"), testing::IsNull());
+}
+
+TEST_F(JsonNumberValueTest, fromNumberLiteralOnlyParsesGivenNumberOfCharacters)
+{
+	// given
+	const char* literal = "1234.5]";
+
+	// when
+	auto obtained = JsonNumberValue::fromNumberLiteral(literal, 4);
+
+	// then
+	ASSERT_THAT(obtained, testing::NotNull());
+	ASSERT_THAT(obtained->isInteger(), testing::Eq(true));
+	ASSERT_THAT(obtained->getLongValue(), testing::Eq(1234));
+}
+
 TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsDoubleIfLiteralContainsFractionPart)
 {
 	// given
@@ -216,6 +241,24 @@ TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsDoubleIfLiteralContainsFract
 	ASSERT_THAT(obtained->getDoubleValue(), testing::Eq(6.25));
 }
 
+TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsCorrectlyRoundedDoubles)
+{
+	// when, then
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("3.1415926535897931")->getDoubleValue(), testing::Eq(3.141592653589793));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("-0.1")->getDoubleValue(), testing::Eq(-0.1));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("1e23")->getDoubleValue(), testing::Eq(1e23));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("2.2250738585072014e-308")->getDoubleValue(), testing::Eq(2.2250738585072014e-308));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("123456789012345678901234567890.0")->getDoubleValue(), testing::Eq(1.2345678901234568e29));
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("0.000e10")->getDoubleValue(), testing::Eq(0.0));
+}
+
+TEST_F(JsonNumberValueTest, fromNumberLiteralReturnsNullForDoubleOutOfRange)
+{
+	// when, then
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("1e400"), testing::IsNull());
+	ASSERT_THAT(JsonNumberValue::fromNumberLiteral("-1e400"), testing::IsNull());
+}
+
 TEST_F(JsonNumberValueTest, toStringFromNumberLiteral)
 {
 	// given